@@ -0,0 +1,85 @@
+#!/bin/bash
+# Compare the flreconstruct throughput of the checked out tree with the one
+# of a base revision, on the same machine and on the same corpus
+#
+# Usage: throughput.sh <base-revision>
+#
+# The corpus is generated once with the checked out tree, the base revision
+# reconstructs it to record the baseline, then the "throughput-compare" test
+# of the checked out tree fails on any regression, or if a reference value
+# is missing.
+
+# Set(ings):
+# - Echo each command to stdout
+# - Stop on first command that fails
+set -ex
+
+# Bayeux *cannot* run without the USER env var..
+# It may not be set in the image, so....
+export USER=`whoami`
+
+BASEREV="$1"
+if [ -z "${BASEREV}" ] ; then
+  echo "usage: throughput.sh <base-revision>" >&2
+  exit 1
+fi
+
+# Find ourselves
+SELFDIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" && pwd )"
+PROJECTDIR="$(dirname $(dirname "${SELFDIR}"))"
+
+# Compiler selection
+if [ `uname` == "Linux" ] ; then
+  # GCC 7 is default
+  export CC=gcc-7
+  export CXX=g++-7
+  export FC=gfortran-7
+
+  # GCC 9 on Ubuntu 20.04
+  if [ -e "/usr/bin/gcc-9" ] ; then
+    export CC=gcc-9
+    export CXX=g++-9
+    export FC=gfortran-9
+  fi
+fi
+
+# Create work directory, deleting if present
+WORKDIR="$PWD/throughput"
+rm -Rf "${WORKDIR}" && mkdir "${WORKDIR}"
+git -C "${PROJECTDIR}" worktree prune
+git -C "${PROJECTDIR}" worktree add --detach "${WORKDIR}/base-source" "${BASEREV}"
+
+# Configure and build a tree with benchmarks and tests
+configure_and_build() {
+  mkdir "$2" && cd "$2"
+  cmake -DCMAKE_PREFIX_PATH="$(brew --prefix);$(brew --prefix qt5-base)" \
+        -DFALAISE_ENABLE_TESTING=ON \
+        -DFALAISE_ENABLE_BENCHMARKS=ON \
+        -DCMAKE_INSTALL_LIBDIR=lib \
+        -GNinja \
+        "${@:3}" \
+        "$1"
+  ninja
+  cd "${WORKDIR}"
+}
+
+# Corpus, generated once with fixed seeds
+configure_and_build "${PROJECTDIR}" "${WORKDIR}/build" \
+                    -DFALAISE_THROUGHPUT_BASELINE="${WORKDIR}/baseline.conf"
+ninja -C "${WORKDIR}/build" throughput-corpus
+CORPUSDIR="${WORKDIR}/build/benchmarks/throughput"
+
+# Baseline, recorded with the base revision on the same corpus
+configure_and_build "${WORKDIR}/base-source" "${WORKDIR}/base-build" \
+                    -DFALAISE_THROUGHPUT_CORPUS_DIR="${CORPUSDIR}"
+(cd "${WORKDIR}/base-build" && ctest -R throughput-reconstruct --output-on-failure)
+cp "${PROJECTDIR}/benchmarks/throughput/baseline.conf" "${WORKDIR}/baseline.conf"
+"${WORKDIR}/build/BuildProducts/bin/falaise_throughput" \
+  -b "${WORKDIR}/baseline.conf" -u "${WORKDIR}/baseline.conf" -d "${CORPUSDIR}" \
+  "${WORKDIR}"/base-build/benchmarks/throughput/*.profile
+
+# Comparison, failing on regressions and missing reference values
+(cd "${WORKDIR}/build" && ctest -R throughput --output-on-failure)
+(cd "${WORKDIR}/build" && ninja throughput-table)
+
+git -C "${PROJECTDIR}" worktree remove --force "${WORKDIR}/base-source"
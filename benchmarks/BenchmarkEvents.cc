@@ -0,0 +1,224 @@
+// Ourselves
+#include "BenchmarkEvents.h"
+
+// Standard Library
+#include <algorithm>
+#include <cmath>
+
+// Third Party
+// - Bayeux
+#include "bayeux/datatools/clhep_units.h"
+#include "bayeux/mctools/base_step_hit.h"
+
+namespace FLBenchmarks {
+
+namespace {
+//! Geometry category of Geiger cells ([module.side.layer.row])
+const uint32_t kGeigerCellType = 1204;
+
+//! Geometry category of main wall blocks ([module.side.column.row.part])
+const uint32_t kCaloBlockType = 1302;
+
+//! Main wall dimensions of the demonstrator
+const uint32_t kCaloColumns = 20;
+const uint32_t kCaloRows = 13;
+
+//! A straight track in the tracker, as a row and a height for each layer
+struct StraightTrack {
+  uint32_t side;
+  double row0;      //!< Row crossed at layer 0
+  double rowSlope;  //!< Rows crossed per layer
+  double z0;        //!< Height at layer 0
+  double zSlope;    //!< Height change per layer
+};
+
+StraightTrack random_track(const snemo::geometry::gg_locator& ggloc, std::size_t index,
+                           Engine& engine) {
+  StraightTrack t;
+  t.side = index % ggloc.numberOfSides();
+  const double nrows = ggloc.numberOfRows(t.side);
+  const double halfLength = 0.4 * ggloc.cellLength();
+  t.row0 = std::uniform_real_distribution<double>(0.1 * nrows, 0.9 * nrows)(engine);
+  t.rowSlope = std::uniform_real_distribution<double>(-1.0, 1.0)(engine);
+  t.z0 = std::uniform_real_distribution<double>(-halfLength, halfLength)(engine);
+  t.zSlope = std::uniform_real_distribution<double>(-50.0, 50.0)(engine) * CLHEP::mm;
+  return t;
+}
+
+//! Return true and set the cell address if the track crosses a valid cell in this layer
+bool cell_on_track(const snemo::geometry::gg_locator& ggloc, const StraightTrack& t,
+                   uint32_t layer, geomtools::geom_id& gid) {
+  const double row = std::round(t.row0 + t.rowSlope * layer);
+  if (row < 0.0 || row >= ggloc.numberOfRows(t.side)) {
+    return false;
+  }
+  gid.reset();
+  gid.set_type(kGeigerCellType);
+  gid.set_address(ggloc.getModuleNumber(), t.side, layer, static_cast<uint32_t>(row));
+  return true;
+}
+}  // namespace
+
+void generate_tracks(const snemo::geometry::gg_locator& ggloc, std::size_t ntracks,
+                     Engine& engine, snemo::datamodel::TrackerHitHdlCollection& hits,
+                     snemo::datamodel::tracker_clustering_data* clustering) {
+  namespace sdm = snemo::datamodel;
+  std::uniform_real_distribution<double> radius(0.1 * CLHEP::cm, 2.1 * CLHEP::cm);
+
+  sdm::TrackerClusteringSolutionHdl solution(new sdm::tracker_clustering_solution);
+  solution->set_solution_id(0);
+
+  int hitID = static_cast<int>(hits.size());
+  for (std::size_t itrack = 0; itrack < ntracks; ++itrack) {
+    StraightTrack t = random_track(ggloc, itrack, engine);
+    sdm::TrackerClusterHdl cluster(new sdm::tracker_cluster);
+    cluster->set_cluster_id(static_cast<int>(itrack));
+
+    for (uint32_t layer = 0; layer < ggloc.numberOfLayers(t.side); ++layer) {
+      sdm::TrackerHitHdl hit(new sdm::calibrated_tracker_hit);
+      if (!cell_on_track(ggloc, t, layer, hit->grab_geom_id())) {
+        continue;
+      }
+      hit->set_hit_id(hitID++);
+      hit->set_z(t.z0 + t.zSlope * layer);
+      hit->set_sigma_z(0.7 * CLHEP::cm);
+      hit->set_r(radius(engine));
+      hit->set_sigma_r(0.3 * CLHEP::mm);
+      hit->set_delayed(false);
+      hit->set_bottom_cathode_missing(false);
+      hit->set_top_cathode_missing(false);
+      geomtools::vector_3d cellPosition = ggloc.getCellPosition(hit->get_geom_id());
+      hit->set_xy(cellPosition.x(), cellPosition.y());
+      hits.push_back(hit);
+      cluster->hits().push_back(hit);
+    }
+    solution->get_clusters().push_back(cluster);
+  }
+
+  if (clustering != nullptr) {
+    clustering->push_back(solution, true);
+  }
+}
+
+void generate_calorimeter_hits(std::size_t nhits, Engine& engine,
+                               snemo::datamodel::CalorimeterHitHdlCollection& hits) {
+  namespace sdm = snemo::datamodel;
+  std::uniform_int_distribution<uint32_t> side(0, 1);
+  std::uniform_int_distribution<uint32_t> column(0, kCaloColumns - 2);
+  std::uniform_int_distribution<uint32_t> row(0, kCaloRows - 1);
+  std::uniform_real_distribution<double> time(0.0, 50.0 * CLHEP::ns);
+  std::uniform_real_distribution<double> energy(0.1 * CLHEP::MeV, 2.0 * CLHEP::MeV);
+
+  uint32_t s = 0;
+  uint32_t c = 0;
+  uint32_t r = 0;
+  double t = 0.0;
+  for (std::size_t i = 0; i < nhits; ++i) {
+    // Every other hit is the neighbour of the previous one, a few ns later
+    if (i % 2 == 0) {
+      s = side(engine);
+      c = column(engine);
+      r = row(engine);
+      t = time(engine);
+    } else {
+      c++;
+      t += 2.0 * CLHEP::ns;
+    }
+    sdm::CalorimeterHitHdl hit(new sdm::calibrated_calorimeter_hit);
+    geomtools::geom_id gid(kCaloBlockType, 0, s, c, r, 0);
+    gid.set_any(4);
+    hit->set_hit_id(static_cast<int>(hits.size()));
+    hit->set_geom_id(gid);
+    hit->set_time(t);
+    hit->set_sigma_time(0.5 * CLHEP::ns);
+    hit->set_energy(energy(engine));
+    hit->set_sigma_energy(0.08 * hit->get_energy());
+    hits.push_back(hit);
+  }
+}
+
+void generate_tracker_steps(const snemo::geometry::gg_locator& ggloc, std::size_t ntracks,
+                            Engine& engine, mctools::simulated_data& simdata) {
+  std::uniform_real_distribution<double> radius(0.1 * CLHEP::cm, 2.1 * CLHEP::cm);
+  std::uniform_real_distribution<double> angle(0.0, 2.0 * M_PI);
+
+  if (!simdata.has_step_hits("gg")) {
+    simdata.add_step_hits("gg");
+  }
+  int hitID = 0;
+  for (std::size_t itrack = 0; itrack < ntracks; ++itrack) {
+    StraightTrack t = random_track(ggloc, itrack, engine);
+    for (uint32_t layer = 0; layer < ggloc.numberOfLayers(t.side); ++layer) {
+      geomtools::geom_id gid;
+      if (!cell_on_track(ggloc, t, layer, gid)) {
+        continue;
+      }
+      geomtools::vector_3d anode = ggloc.getCellPosition(gid);
+      anode.setZ(t.z0 + t.zSlope * layer);
+      const double r = radius(engine);
+      const double phi = angle(engine);
+      geomtools::vector_3d ionization = anode + geomtools::vector_3d(r * std::cos(phi),
+                                                                     r * std::sin(phi), 0.0);
+
+      mctools::base_step_hit& step = simdata.add_step_hit("gg");
+      step.set_hit_id(hitID++);
+      step.set_track_id(static_cast<int>(itrack) + 1);
+      step.set_parent_track_id(0);
+      step.set_geom_id(gid);
+      step.set_position_start(ggloc.transformModuleToWorld(ionization));
+      step.set_position_stop(ggloc.transformModuleToWorld(anode));
+      step.set_time_start(layer * 0.1 * CLHEP::ns);
+      step.set_time_stop(layer * 0.1 * CLHEP::ns);
+    }
+  }
+}
+
+void generate_calorimeter_steps(std::size_t nsteps, Engine& engine,
+                                mctools::simulated_data& simdata) {
+  std::uniform_int_distribution<uint32_t> side(0, 1);
+  std::uniform_int_distribution<uint32_t> column(0, kCaloColumns - 1);
+  std::uniform_int_distribution<uint32_t> row(0, kCaloRows - 1);
+  std::uniform_real_distribution<double> time(0.0, 50.0 * CLHEP::ns);
+  std::uniform_real_distribution<double> energy(0.01 * CLHEP::MeV, 1.0 * CLHEP::MeV);
+
+  if (!simdata.has_step_hits("calo")) {
+    simdata.add_step_hits("calo");
+  }
+  for (std::size_t i = 0; i < nsteps; ++i) {
+    mctools::base_step_hit& step = simdata.add_step_hit("calo");
+    step.set_hit_id(static_cast<int>(i));
+    step.set_geom_id(geomtools::geom_id(kCaloBlockType, 0, side(engine), column(engine),
+                                        row(engine), 0));
+    step.set_time_start(time(engine));
+    step.set_energy_deposit(energy(engine));
+    step.set_particle_name("e-");
+  }
+}
+
+std::vector<geomtools::vector_3d> generate_tracker_points(const snemo::geometry::gg_locator& ggloc,
+                                                          std::size_t npoints, Engine& engine) {
+  // Bounding box of the cell positions of both sides, in the module frame
+  const uint32_t lastLayer = ggloc.numberOfLayers(0) - 1;
+  const uint32_t lastRow = ggloc.numberOfRows(0) - 1;
+  const double xmin = std::min(ggloc.getXCoordOfLayer(0, lastLayer),
+                               ggloc.getXCoordOfLayer(1, ggloc.numberOfLayers(1) - 1));
+  const double xmax = std::max(ggloc.getXCoordOfLayer(0, lastLayer),
+                               ggloc.getXCoordOfLayer(1, ggloc.numberOfLayers(1) - 1));
+  const double ymin = ggloc.getYCoordOfRow(0, 0);
+  const double ymax = ggloc.getYCoordOfRow(0, lastRow);
+  const double halfLength = 0.5 * ggloc.cellLength();
+
+  std::uniform_real_distribution<double> x(xmin, xmax);
+  std::uniform_real_distribution<double> y(ymin, ymax);
+  std::uniform_real_distribution<double> z(-halfLength, halfLength);
+
+  std::vector<geomtools::vector_3d> points;
+  points.reserve(npoints);
+  for (std::size_t i = 0; i < npoints; ++i) {
+    points.push_back(ggloc.transformModuleToWorld(geomtools::vector_3d(x(engine), y(engine),
+                                                                       z(engine))));
+  }
+  return points;
+}
+
+}  // namespace FLBenchmarks
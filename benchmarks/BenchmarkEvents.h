@@ -0,0 +1,60 @@
+// BenchmarkEvents.h - Synthetic events of controllable multiplicity
+//
+// Copyright (c) 2013 by Ben Morgan <bmorgan.warwick@gmail.com>
+// Copyright (c) 2013 by The University of Warwick
+
+// Distributed under the OSI-approved BSD 3-Clause License (the "License");
+// see accompanying file License.txt for details.
+//
+// This software is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the License for more information.
+
+#ifndef FLBENCHMARKEVENTS_H
+#define FLBENCHMARKEVENTS_H
+
+// Standard Library:
+#include <cstddef>
+#include <random>
+#include <vector>
+
+// Third Party
+// - Bayeux
+#include "bayeux/geomtools/utils.h"
+#include "bayeux/mctools/simulated_data.h"
+
+// This Project
+#include "falaise/snemo/datamodels/calibrated_data.h"
+#include "falaise/snemo/datamodels/tracker_clustering_data.h"
+#include "falaise/snemo/geometry/gg_locator.h"
+
+namespace FLBenchmarks {
+
+//! Random engine used by all generators, seeded by the caller for reproducibility
+using Engine = std::mt19937;
+
+//! Fill calibrated tracker hits for straight tracks crossing all layers of one side
+//! If clustering is not null, it gets a default solution with one cluster per track
+void generate_tracks(const snemo::geometry::gg_locator& ggloc, std::size_t ntracks,
+                     Engine& engine, snemo::datamodel::TrackerHitHdlCollection& hits,
+                     snemo::datamodel::tracker_clustering_data* clustering = nullptr);
+
+//! Fill calibrated main wall calorimeter hits, grouped by pairs of neighbours close in time
+void generate_calorimeter_hits(std::size_t nhits, Engine& engine,
+                               snemo::datamodel::CalorimeterHitHdlCollection& hits);
+
+//! Fill "gg" step hits, one per Geiger cell crossed by straight tracks
+void generate_tracker_steps(const snemo::geometry::gg_locator& ggloc, std::size_t ntracks,
+                            Engine& engine, mctools::simulated_data& simdata);
+
+//! Fill "calo" step hits in random main wall blocks
+void generate_calorimeter_steps(std::size_t nsteps, Engine& engine,
+                                mctools::simulated_data& simdata);
+
+//! Return points uniformly distributed in the bounding box of the tracker volume (world frame)
+std::vector<geomtools::vector_3d> generate_tracker_points(const snemo::geometry::gg_locator& ggloc,
+                                                          std::size_t npoints, Engine& engine);
+
+}  // namespace FLBenchmarks
+
+#endif  // FLBENCHMARKEVENTS_H
@@ -0,0 +1,150 @@
+// Ourselves
+#include "BenchmarkSuite.h"
+
+// Standard Library
+#include <algorithm>
+#include <chrono>
+#include <ostream>
+
+// Third Party
+// - Bayeux
+#include "bayeux/datatools/exception.h"
+
+// This Project
+#include "falaise/version.h"
+
+namespace FLBenchmarks {
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+//! Return the time taken by n calls of the kernel [s]
+double time_calls(const Kernel& kernel, std::size_t n) {
+  auto start = Clock::now();
+  for (std::size_t i = 0; i < n; ++i) {
+    kernel();
+  }
+  std::chrono::duration<double> elapsed = Clock::now() - start;
+  return elapsed.count();
+}
+
+//! Write a string as a JSON literal
+void write_json_string(std::ostream& out, const std::string& s) {
+  out << '"';
+  for (char c : s) {
+    switch (c) {
+      case '"':
+        out << "\\\"";
+        break;
+      case '\\':
+        out << "\\\\";
+        break;
+      case '\n':
+        out << "\\n";
+        break;
+      case '\t':
+        out << "\\t";
+        break;
+      default:
+        out << c;
+    }
+  }
+  out << '"';
+}
+}  // namespace
+
+double Result::medianTime() const {
+  if (timesPerCall.empty()) {
+    return 0.0;
+  }
+  std::vector<double> sorted{timesPerCall};
+  std::sort(sorted.begin(), sorted.end());
+  std::size_t n = sorted.size();
+  return (n % 2 == 1) ? sorted[n / 2] : 0.5 * (sorted[n / 2 - 1] + sorted[n / 2]);
+}
+
+double Result::minimumTime() const {
+  if (timesPerCall.empty()) {
+    return 0.0;
+  }
+  return *std::min_element(timesPerCall.begin(), timesPerCall.end());
+}
+
+void Suite::add(const std::string& name, const std::string& unit, Setup setup) {
+  for (const Entry& e : benchmarks_) {
+    DT_THROW_IF(e.name == name, std::logic_error, "Duplicate benchmark '" << name << "'");
+  }
+  benchmarks_.push_back(Entry{name, unit, setup});
+}
+
+std::vector<std::string> Suite::names() const {
+  std::vector<std::string> result;
+  for (const Entry& e : benchmarks_) {
+    result.push_back(e.name);
+  }
+  return result;
+}
+
+void Suite::run(const RunParameters& parameters, std::ostream& log) {
+  DT_THROW_IF(parameters.repetitions == 0, std::logic_error, "Need at least one repetition");
+  results_.clear();
+
+  for (const Entry& e : benchmarks_) {
+    if (e.name.find(parameters.filter) == std::string::npos) {
+      continue;
+    }
+    for (std::size_t multiplicity : parameters.multiplicities) {
+      Kernel kernel = e.setup(multiplicity);
+      kernel();
+
+      // Calibrate the batch size on the minimum time
+      std::size_t n = 1;
+      while (time_calls(kernel, n) < parameters.minimumTime) {
+        n *= 2;
+      }
+
+      Result r;
+      r.name = e.name;
+      r.unit = e.unit;
+      r.multiplicity = multiplicity;
+      r.iterations = n;
+      for (std::size_t i = 0; i < parameters.repetitions; ++i) {
+        r.timesPerCall.push_back(1.e9 * time_calls(kernel, n) / n);
+      }
+      log << e.name << " [" << multiplicity << " " << e.unit << "]: " << r.medianTime()
+          << " ns/call (min " << r.minimumTime() << ", " << n << " calls)\n";
+      results_.push_back(r);
+    }
+  }
+}
+
+const std::vector<Result>& Suite::results() const { return results_; }
+
+void Suite::writeJSON(std::ostream& out, const RunParameters& parameters) const {
+  out << "{\n";
+  out << "  \"falaise_version\": ";
+  write_json_string(out, falaise::version::get_version());
+  out << ",\n  \"falaise_commit\": ";
+  write_json_string(out, falaise::version::get_commit());
+  out << ",\n  \"minimum_time\": " << parameters.minimumTime;
+  out << ",\n  \"repetitions\": " << parameters.repetitions;
+  out << ",\n  \"benchmarks\": [";
+  for (std::size_t i = 0; i < results_.size(); ++i) {
+    const Result& r = results_[i];
+    out << (i == 0 ? "\n" : ",\n");
+    out << "    {\"name\": ";
+    write_json_string(out, r.name);
+    out << ", \"unit\": ";
+    write_json_string(out, r.unit);
+    out << ", \"multiplicity\": " << r.multiplicity << ", \"iterations\": " << r.iterations
+        << ", \"median_ns\": " << r.medianTime() << ", \"min_ns\": " << r.minimumTime()
+        << ", \"times_ns\": [";
+    for (std::size_t j = 0; j < r.timesPerCall.size(); ++j) {
+      out << (j == 0 ? "" : ", ") << r.timesPerCall[j];
+    }
+    out << "]}";
+  }
+  out << "\n  ]\n}\n";
+}
+
+}  // namespace FLBenchmarks
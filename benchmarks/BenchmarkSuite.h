@@ -0,0 +1,92 @@
+// BenchmarkSuite.h - Timing harness for the Falaise micro-benchmarks
+//
+// Copyright (c) 2013 by Ben Morgan <bmorgan.warwick@gmail.com>
+// Copyright (c) 2013 by The University of Warwick
+
+// Distributed under the OSI-approved BSD 3-Clause License (the "License");
+// see accompanying file License.txt for details.
+//
+// This software is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the License for more information.
+
+#ifndef FLBENCHMARKSUITE_H
+#define FLBENCHMARKSUITE_H
+
+// Standard Library:
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace FLBenchmarks {
+
+//! Kernel timed by a benchmark, processing one prepared "event" per call
+using Kernel = std::function<void()>;
+
+//! Prepare the data for a given multiplicity and return the kernel to time
+using Setup = std::function<Kernel(std::size_t multiplicity)>;
+
+//! Parameters of a benchmark run
+struct RunParameters {
+  std::vector<std::size_t> multiplicities = {1, 4, 16};  //!< Multiplicities to scan
+  double minimumTime = 0.2;     //!< Minimum timed duration of a repetition [s]
+  std::size_t repetitions = 5;  //!< Number of timed repetitions
+  std::string filter;           //!< Only run benchmarks whose name contains this
+};
+
+//! Timing of one benchmark at one multiplicity
+struct Result {
+  std::string name;                  //!< Benchmark name
+  std::string unit;                  //!< What the multiplicity counts
+  std::size_t multiplicity = 0;      //!< Multiplicity of the prepared data
+  std::size_t iterations = 0;        //!< Kernel calls per repetition
+  std::vector<double> timesPerCall;  //!< Mean time per call of each repetition [ns]
+
+  //! Return the median time per call [ns]
+  double medianTime() const;
+
+  //! Return the fastest time per call [ns]
+  double minimumTime() const;
+};
+
+//! \brief Collection of named benchmarks and their results
+//!
+//! Each benchmark has a setup function building synthetic input at a given
+//! multiplicity, outside of the timed region. The returned kernel is called
+//! once to warm up, then in batches of doubling size until the minimum time
+//! is reached, which fixes the number of iterations. That many calls are then
+//! timed for each repetition, and the median and fastest times per call are
+//! reported so that results can be compared across commits.
+class Suite {
+ public:
+  //! Register a benchmark, multiplicity counting the given unit (e.g. "tracks")
+  void add(const std::string& name, const std::string& unit, Setup setup);
+
+  //! Return the names of all registered benchmarks
+  std::vector<std::string> names() const;
+
+  //! Run all selected benchmarks, logging progress
+  void run(const RunParameters& parameters, std::ostream& log);
+
+  //! Return the results of the last run
+  const std::vector<Result>& results() const;
+
+  //! Write parameters and results of the last run as JSON
+  void writeJSON(std::ostream& out, const RunParameters& parameters) const;
+
+ private:
+  struct Entry {
+    std::string name;
+    std::string unit;
+    Setup setup;
+  };
+
+  std::vector<Entry> benchmarks_;
+  std::vector<Result> results_;
+};
+
+}  // namespace FLBenchmarks
+
+#endif  // FLBENCHMARKSUITE_H
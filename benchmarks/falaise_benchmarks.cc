@@ -0,0 +1,488 @@
+//! \file    falaise_benchmarks.cc
+//! \brief   Micro-benchmarks of the Falaise reconstruction kernels
+//! \details Time the hot kernels of simulation post-processing and
+//!          reconstruction on synthetic events of controllable
+//!          multiplicity, and write the results as JSON so that they
+//!          can be compared across commits.
+//
+// Copyright (c) 2013 by Ben Morgan <bmorgan.warwick@gmail.com>
+// Copyright (c) 2013 by The University of Warwick
+//
+// This file is part of Falaise.
+//
+// Falaise is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Falaise is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Falaise.  If not, see <http://www.gnu.org/licenses/>.
+
+// Standard Library
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Third Party
+// - Boost
+#include "boost/program_options.hpp"
+// - Bayeux
+#include "bayeux/datatools/clhep_units.h"
+#include "bayeux/datatools/exception.h"
+#include "bayeux/datatools/multi_properties.h"
+#include "bayeux/datatools/properties.h"
+#include "bayeux/datatools/service_manager.h"
+#include "bayeux/datatools/things.h"
+#include "bayeux/dpp/base_module.h"
+#include "bayeux/geomtools/manager.h"
+#include "bayeux/mctools/simulated_data.h"
+#include "bayeux/mygsl/rng.h"
+
+// This Project
+#include "falaise/exitcodes.h"
+#include "falaise/falaise.h"
+#include "falaise/snemo/datamodels/data_model.h"
+#include "falaise/snemo/datamodels/particle_track_data.h"
+#include "falaise/snemo/datamodels/tracker_trajectory_data.h"
+#include "falaise/snemo/geometry/locator_helpers.h"
+#include "falaise/snemo/geometry/locator_plugin.h"
+#include "falaise/snemo/processing/geiger_regime.h"
+#include "falaise/snemo/processing/mock_calorimeter_s2c_module.h"
+#include "falaise/snemo/processing/mock_tracker_s2c_module.h"
+#include "falaise/snemo/services/geometry.h"
+#include "falaise/snemo/services/service_handle.h"
+
+// Modules
+#include "CAT/cat_driver.h"
+#include "CAT/sultan_driver.h"
+#include "GammaClustering/gamma_clustering_driver.h"
+#include "GammaTracking/gamma_tracking_driver.h"
+#include "TrackFit/trackfit_driver.h"
+
+// Benchmarks
+#include "BenchmarkEvents.h"
+#include "BenchmarkSuite.h"
+
+namespace FLBenchmarks {
+
+namespace sdm = snemo::datamodel;
+namespace srt = snemo::reconstruction;
+
+//! Shared resources of all benchmarks
+struct Context {
+  datatools::service_manager services;
+  const geomtools::manager* geometry = nullptr;
+  const snemo::geometry::locator_plugin* locators = nullptr;
+  unsigned int seed = 314159;
+};
+
+//----------------------------------------------------------------------
+// Locators
+//----------------------------------------------------------------------
+void add_locator_benchmarks(Suite& suite, const Context& ctx) {
+  const snemo::geometry::gg_locator& ggloc = ctx.locators->geigerLocator();
+
+  suite.add("geometry.gg_locator.findCellGID", "points", [&ctx, &ggloc](std::size_t n) {
+    Engine engine(ctx.seed);
+    auto points = generate_tracker_points(ggloc, n, engine);
+    return Kernel([&ggloc, points]() {
+      geomtools::geom_id gid;
+      for (const auto& p : points) {
+        ggloc.findCellGID(p, gid);
+      }
+    });
+  });
+
+  suite.add("geometry.gg_locator.getNeighbourGIDs", "cells", [&ctx, &ggloc](std::size_t n) {
+    Engine engine(ctx.seed);
+    sdm::TrackerHitHdlCollection hits;
+    generate_tracks(ggloc, n, engine, hits);
+    std::vector<geomtools::geom_id> cells;
+    for (const auto& h : hits) {
+      cells.push_back(h->get_geom_id());
+    }
+    return Kernel([&ggloc, cells]() {
+      for (const auto& gid : cells) {
+        ggloc.getNeighbourGIDs(gid);
+      }
+    });
+  });
+
+  suite.add("geometry.calo_locator.findBlockGID", "points", [&ctx](std::size_t n) {
+    const snemo::geometry::calo_locator& loc = ctx.locators->caloLocator();
+    std::vector<geomtools::vector_3d> blocks;
+    for (uint32_t side = 0; side < loc.numberOfSides(); ++side) {
+      for (uint32_t column = 0; column < loc.numberOfColumns(side); ++column) {
+        for (uint32_t row = 0; row < loc.numberOfRows(side); ++row) {
+          blocks.push_back(loc.transformModuleToWorld(loc.getBlockPosition(side, column, row)));
+        }
+      }
+    }
+    Engine engine(ctx.seed);
+    std::uniform_int_distribution<std::size_t> pick(0, blocks.size() - 1);
+    std::vector<geomtools::vector_3d> points;
+    for (std::size_t i = 0; i < n; ++i) {
+      points.push_back(blocks[pick(engine)]);
+    }
+    return Kernel([&loc, points]() {
+      geomtools::geom_id gid;
+      for (const auto& p : points) {
+        loc.findBlockGID(p, gid);
+      }
+    });
+  });
+
+  suite.add("geometry.xcalo_locator.findBlockGID", "points", [&ctx](std::size_t n) {
+    const snemo::geometry::xcalo_locator& loc = ctx.locators->xcaloLocator();
+    std::vector<geomtools::vector_3d> blocks;
+    for (uint32_t side = 0; side < loc.numberOfSides(); ++side) {
+      for (uint32_t wall = 0; wall < loc.numberOfWalls(); ++wall) {
+        for (uint32_t column = 0; column < loc.numberOfColumns(side, wall); ++column) {
+          for (uint32_t row = 0; row < loc.numberOfRows(side, wall); ++row) {
+            blocks.push_back(
+                loc.transformModuleToWorld(loc.getBlockPosition(side, wall, column, row)));
+          }
+        }
+      }
+    }
+    Engine engine(ctx.seed);
+    std::uniform_int_distribution<std::size_t> pick(0, blocks.size() - 1);
+    std::vector<geomtools::vector_3d> points;
+    for (std::size_t i = 0; i < n; ++i) {
+      points.push_back(blocks[pick(engine)]);
+    }
+    return Kernel([&loc, points]() {
+      geomtools::geom_id gid;
+      for (const auto& p : points) {
+        loc.findBlockGID(p, gid);
+      }
+    });
+  });
+
+  suite.add("geometry.gveto_locator.findBlockGID", "points", [&ctx](std::size_t n) {
+    const snemo::geometry::gveto_locator& loc = ctx.locators->gvetoLocator();
+    std::vector<geomtools::vector_3d> blocks;
+    for (uint32_t side = 0; side < loc.numberOfSides(); ++side) {
+      for (uint32_t wall = 0; wall < loc.numberOfWalls(); ++wall) {
+        for (uint32_t column = 0; column < loc.numberOfColumns(side, wall); ++column) {
+          blocks.push_back(loc.transformModuleToWorld(loc.getBlockPosition(side, wall, column)));
+        }
+      }
+    }
+    Engine engine(ctx.seed);
+    std::uniform_int_distribution<std::size_t> pick(0, blocks.size() - 1);
+    std::vector<geomtools::vector_3d> points;
+    for (std::size_t i = 0; i < n; ++i) {
+      points.push_back(blocks[pick(engine)]);
+    }
+    return Kernel([&loc, points]() {
+      geomtools::geom_id gid;
+      for (const auto& p : points) {
+        loc.findBlockGID(p, gid);
+      }
+    });
+  });
+}
+
+//----------------------------------------------------------------------
+// Geiger regime and mock digitizers
+//----------------------------------------------------------------------
+void add_digitization_benchmarks(Suite& suite, Context& ctx) {
+  suite.add("processing.geiger_regime.calibrateRadiusFromTime", "hits", [&ctx](std::size_t n) {
+    std::shared_ptr<snemo::processing::geiger_regime> regime{
+        new snemo::processing::geiger_regime};
+    Engine engine(ctx.seed);
+    std::uniform_real_distribution<double> time(0.0, regime->getMaximumDriftTime());
+    std::vector<double> times;
+    for (std::size_t i = 0; i < n; ++i) {
+      times.push_back(time(engine));
+    }
+    return Kernel([regime, times]() {
+      double r = 0.0;
+      double sigma = 0.0;
+      for (double t : times) {
+        regime->calibrateRadiusFromTime(t, r, sigma);
+      }
+    });
+  });
+
+  suite.add("processing.geiger_regime.getRandomTimeGivenRadius", "hits", [&ctx](std::size_t n) {
+    std::shared_ptr<snemo::processing::geiger_regime> regime{
+        new snemo::processing::geiger_regime};
+    std::shared_ptr<mygsl::rng> rng{new mygsl::rng("mt19937", ctx.seed)};
+    Engine engine(ctx.seed);
+    std::uniform_real_distribution<double> radius(0.0, regime->getCellRadius());
+    std::vector<double> radii;
+    for (std::size_t i = 0; i < n; ++i) {
+      radii.push_back(radius(engine));
+    }
+    return Kernel([regime, rng, radii]() {
+      for (double r : radii) {
+        regime->getRandomTimeGivenRadius(*rng, r);
+      }
+    });
+  });
+
+  suite.add("processing.mock_tracker_s2c_module", "tracks", [&ctx](std::size_t n) {
+    std::shared_ptr<snemo::processing::mock_tracker_s2c_module> digitizer{
+        new snemo::processing::mock_tracker_s2c_module};
+    datatools::properties config;
+    config.store_integer("random.seed", ctx.seed);
+    dpp::module_handle_dict_type modules;
+    digitizer->initialize(config, ctx.services, modules);
+
+    std::shared_ptr<datatools::things> event{new datatools::things};
+    auto& simdata = event->add<mctools::simulated_data>(snedm::labels::simulated_data());
+    Engine engine(ctx.seed);
+    generate_tracker_steps(ctx.locators->geigerLocator(), n, engine, simdata);
+    return Kernel([digitizer, event]() { digitizer->process(*event); });
+  });
+
+  suite.add("processing.mock_calorimeter_s2c_module", "steps", [&ctx](std::size_t n) {
+    std::shared_ptr<snemo::processing::mock_calorimeter_s2c_module> digitizer{
+        new snemo::processing::mock_calorimeter_s2c_module};
+    datatools::properties config;
+    config.store_integer("random.seed", ctx.seed);
+    std::vector<std::string> categories{"calo"};
+    config.store("hit_categories", categories);
+    config.store_with_explicit_unit("calo.energy.resolution", 8 * CLHEP::perCent);
+    config.set_unit_symbol("calo.energy.resolution", "%");
+    config.store_with_explicit_unit("calo.energy.low_threshold", 50 * CLHEP::keV);
+    config.set_unit_symbol("calo.energy.low_threshold", "keV");
+    config.store_with_explicit_unit("calo.energy.high_threshold", 150 * CLHEP::keV);
+    config.set_unit_symbol("calo.energy.high_threshold", "keV");
+    std::vector<double> quenching{77.4, 0.639, 2.34};
+    config.store("calo.alpha_quenching_parameters", quenching);
+    config.store_with_explicit_unit("calo.scintillator_relaxation_time", 6.0 * CLHEP::ns);
+    config.set_unit_symbol("calo.scintillator_relaxation_time", "ns");
+    dpp::module_handle_dict_type modules;
+    digitizer->initialize(config, ctx.services, modules);
+
+    std::shared_ptr<datatools::things> event{new datatools::things};
+    auto& simdata = event->add<mctools::simulated_data>(snedm::labels::simulated_data());
+    Engine engine(ctx.seed);
+    generate_calorimeter_steps(n, engine, simdata);
+    return Kernel([digitizer, event]() { digitizer->process(*event); });
+  });
+}
+
+//----------------------------------------------------------------------
+// Tracker clustering and fitting
+//----------------------------------------------------------------------
+void add_tracker_benchmarks(Suite& suite, const Context& ctx) {
+  suite.add("reconstruction.cat_driver", "tracks", [&ctx](std::size_t n) {
+    datatools::properties config;
+    config.store_real("CAT.magnetic_field", 25 * CLHEP::gauss);
+    config.store_string("CAT.level", "mute");
+    config.store_real("CAT.max_time", 5000.0 * CLHEP::ms);
+    config.store_real("CAT.small_radius", 2.0 * CLHEP::mm);
+    config.store_real("CAT.probmin", 0.0);
+    config.store_integer("CAT.nofflayers", 1);
+    config.store_integer("CAT.first_event", -1);
+    config.store_real("CAT.ratio", 10000.0);
+    config.store_real("CAT.driver.sigma_z_factor", 1.0);
+    std::shared_ptr<srt::cat_driver> driver{new srt::cat_driver};
+    driver->set_geometry_manager(*ctx.geometry);
+    driver->initialize(config);
+
+    std::shared_ptr<sdm::TrackerHitHdlCollection> hits{new sdm::TrackerHitHdlCollection};
+    Engine engine(ctx.seed);
+    generate_tracks(ctx.locators->geigerLocator(), n, engine, *hits);
+    return Kernel([driver, hits]() {
+      sdm::CalorimeterHitHdlCollection calos;
+      sdm::tracker_clustering_data clustering;
+      driver->process(*hits, calos, clustering);
+    });
+  });
+
+  suite.add("reconstruction.sultan_driver", "tracks", [&ctx](std::size_t n) {
+    datatools::properties config;
+    config.store_real("SULTAN.magnetic_field", 25 * CLHEP::gauss);
+    config.store_string("SULTAN.clusterizer_level", "mute");
+    config.store_string("SULTAN.sequentiator_level", "mute");
+    config.store_real("SULTAN.max_time", 10000.0 * CLHEP::ms);
+    config.store_boolean("SULTAN.print_event_display", false);
+    config.store_real("SULTAN.Emin", 0.2 * CLHEP::MeV);
+    config.store_real("SULTAN.Emax", 7.0 * CLHEP::MeV);
+    config.store_real("SULTAN.probmin", 0.0);
+    config.store_real("SULTAN.nsigma_r", 5.0);
+    config.store_real("SULTAN.nsigma_z", 3.0);
+    config.store_integer("SULTAN.nofflayers", 0);
+    config.store_integer("SULTAN.first_event", -1);
+    config.store_integer("SULTAN.min_ncells_in_cluster", 0);
+    config.store_integer("SULTAN.ncells_between_triplet_min", 0);
+    config.store_integer("SULTAN.ncells_between_triplet_range", 0);
+    config.store_real("SULTAN.nsigmas", 1.0);
+    config.store_real("SULTAN.driver.sigma_z_factor", 1.0);
+    std::shared_ptr<srt::sultan_driver> driver{new srt::sultan_driver};
+    driver->set_geometry_manager(*ctx.geometry);
+    driver->initialize(config);
+
+    std::shared_ptr<sdm::TrackerHitHdlCollection> hits{new sdm::TrackerHitHdlCollection};
+    Engine engine(ctx.seed);
+    generate_tracks(ctx.locators->geigerLocator(), n, engine, *hits);
+    return Kernel([driver, hits]() {
+      sdm::CalorimeterHitHdlCollection calos;
+      sdm::tracker_clustering_data clustering;
+      driver->process(*hits, calos, clustering);
+    });
+  });
+
+  for (const std::string model : {"line", "helix"}) {
+    suite.add("reconstruction.trackfit_driver." + model, "tracks", [&ctx, model](std::size_t n) {
+      datatools::properties config;
+      config.store_string("drift_time_calibration_label", "snemo");
+      config.store("fitting_models", std::vector<std::string>{model});
+      std::shared_ptr<srt::trackfit_driver> driver{new srt::trackfit_driver};
+      driver->set_geometry_manager(*ctx.geometry);
+      driver->initialize(config);
+
+      std::shared_ptr<sdm::TrackerHitHdlCollection> hits{new sdm::TrackerHitHdlCollection};
+      std::shared_ptr<sdm::tracker_clustering_data> clustering{new sdm::tracker_clustering_data};
+      Engine engine(ctx.seed);
+      generate_tracks(ctx.locators->geigerLocator(), n, engine, *hits, clustering.get());
+      return Kernel([driver, hits, clustering]() {
+        sdm::tracker_trajectory_data trajectories;
+        driver->process(*clustering, trajectories);
+      });
+    });
+  }
+}
+
+//----------------------------------------------------------------------
+// Gamma clustering and tracking
+//----------------------------------------------------------------------
+void add_gamma_benchmarks(Suite& suite, const Context& ctx) {
+  suite.add("reconstruction.gamma_clustering_driver", "calorimeter hits", [&ctx](std::size_t n) {
+    std::shared_ptr<srt::gamma_clustering_driver> driver{new srt::gamma_clustering_driver};
+    driver->set_geometry_manager(*ctx.geometry);
+    driver->initialize(datatools::properties{});
+
+    std::shared_ptr<sdm::CalorimeterHitHdlCollection> hits{
+        new sdm::CalorimeterHitHdlCollection};
+    Engine engine(ctx.seed);
+    generate_calorimeter_hits(n, engine, *hits);
+    return Kernel([driver, hits]() {
+      sdm::particle_track_data particles;
+      driver->process(*hits, particles);
+    });
+  });
+
+  suite.add("reconstruction.gamma_tracking_driver", "calorimeter hits", [&ctx](std::size_t n) {
+    std::shared_ptr<srt::gamma_tracking_driver> driver{new srt::gamma_tracking_driver};
+    driver->set_geometry_manager(*ctx.geometry);
+    driver->initialize(datatools::properties{});
+
+    std::shared_ptr<sdm::CalorimeterHitHdlCollection> hits{
+        new sdm::CalorimeterHitHdlCollection};
+    Engine engine(ctx.seed);
+    generate_calorimeter_hits(n, engine, *hits);
+    return Kernel([driver, hits]() {
+      sdm::particle_track_data particles;
+      driver->process(*hits, particles);
+    });
+  });
+}
+
+//! Run the benchmarks selected on the command line
+falaise::exit_code do_benchmarks(int argc, char* argv[]) {
+  namespace bpo = boost::program_options;
+  RunParameters parameters;
+  std::string outputFile;
+  unsigned int seed = 314159;
+
+  bpo::options_description options("Options");
+  // clang-format off
+  options.add_options()
+    ("help,h", "print this help message")
+    ("list,l", "list available benchmarks")
+    ("filter,f", bpo::value<std::string>(&parameters.filter),
+     "only run benchmarks whose name contains this string")
+    ("multiplicity,m", bpo::value<std::vector<std::size_t>>(),
+     "multiplicity of the synthetic events (repeatable, default: 1 4 16)")
+    ("min-time,t", bpo::value<double>(&parameters.minimumTime)->default_value(0.2),
+     "minimum duration of each timed repetition in seconds")
+    ("repetitions,r", bpo::value<std::size_t>(&parameters.repetitions)->default_value(5),
+     "number of timed repetitions")
+    ("seed,s", bpo::value<unsigned int>(&seed)->default_value(314159),
+     "seed of the synthetic event generators")
+    ("output-file,o", bpo::value<std::string>(&outputFile),
+     "file in which to write JSON results (default: standard output)");
+  // clang-format on
+
+  bpo::variables_map vm;
+  try {
+    bpo::store(bpo::parse_command_line(argc, argv, options), vm);
+    bpo::notify(vm);
+  } catch (const bpo::error& e) {
+    std::cerr << "falaise_benchmarks: " << e.what() << "\n" << options << std::endl;
+    return falaise::EXIT_USAGE;
+  }
+  if (vm.count("help")) {
+    std::cout << "Usage: falaise_benchmarks [options]\n" << options << std::endl;
+    return falaise::EXIT_OK;
+  }
+  if (vm.count("multiplicity")) {
+    parameters.multiplicities = vm["multiplicity"].as<std::vector<std::size_t>>();
+  }
+
+  try {
+    Context ctx;
+    ctx.seed = seed;
+    datatools::multi_properties serviceConfig;
+    serviceConfig.add_section("geometry", "geomtools::geometry_service")
+        .store_path("manager.configuration_file",
+                    "@falaise:snemo/demonstrator/geometry/GeometryManager.conf");
+    ctx.services.load(serviceConfig);
+    ctx.services.initialize();
+    snemo::service_handle<snemo::geometry_svc> geometry{ctx.services};
+    ctx.geometry = geometry.operator->();
+    ctx.locators = snemo::geometry::getSNemoLocator(*ctx.geometry, "locators_driver");
+
+    Suite suite;
+    add_locator_benchmarks(suite, ctx);
+    add_digitization_benchmarks(suite, ctx);
+    add_tracker_benchmarks(suite, ctx);
+    add_gamma_benchmarks(suite, ctx);
+
+    if (vm.count("list")) {
+      for (const std::string& name : suite.names()) {
+        std::cout << name << "\n";
+      }
+      return falaise::EXIT_OK;
+    }
+
+    suite.run(parameters, std::clog);
+
+    if (outputFile.empty()) {
+      suite.writeJSON(std::cout, parameters);
+    } else {
+      std::ofstream out(outputFile);
+      DT_THROW_IF(!out, std::runtime_error, "Cannot open output file '" << outputFile << "'");
+      suite.writeJSON(out, parameters);
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "falaise_benchmarks: " << e.what() << std::endl;
+    return falaise::EXIT_UNAVAILABLE;
+  }
+  return falaise::EXIT_OK;
+}
+
+}  // namespace FLBenchmarks
+
+//----------------------------------------------------------------------
+// MAIN PROGRAM
+//----------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+  falaise::initialize(argc, argv);
+  falaise::exit_code ret = FLBenchmarks::do_benchmarks(argc, argv);
+  falaise::terminate();
+  return ret;
+}
@@ -0,0 +1,350 @@
+//! \file    falaise_throughput.cc
+//! \brief   Compare flreconstruct throughput reports with a baseline
+//! \details Read the reports written by `flreconstruct --profile-file` on
+//!          the frozen throughput corpus, and compare their event rate,
+//!          peak memory and per-module timings with the reference values
+//!          and tolerance bands of a baseline file. Can also print the
+//!          comparison as a Markdown table, or record the measurements
+//!          as a new baseline, together with the checksums of the corpus
+//!          files they were measured on.
+//
+// Copyright (c) 2013 by Ben Morgan <bmorgan.warwick@gmail.com>
+// Copyright (c) 2013 by The University of Warwick
+//
+// This file is part of Falaise.
+//
+// Falaise is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Falaise is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Falaise.  If not, see <http://www.gnu.org/licenses/>.
+
+// Standard Library
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Third Party
+// - Boost
+#include "boost/crc.hpp"
+#include "boost/filesystem.hpp"
+#include "boost/program_options.hpp"
+// - Bayeux
+#include "bayeux/datatools/exception.h"
+#include "bayeux/datatools/multi_properties.h"
+#include "bayeux/datatools/properties.h"
+#include "bayeux/datatools/utils.h"
+
+// This Project
+#include "falaise/exitcodes.h"
+#include "falaise/falaise.h"
+
+namespace FLThroughput {
+
+//! Exit code when at least one measurement is outside its tolerance band
+const int kExitRegression = 1;
+
+//! Exit code when the baseline holds no reference value for a corpus
+const int kExitNoReference = 2;
+
+//! Section of the baseline holding the default tolerances
+const std::string kTolerancesSection = "tolerances";
+
+//! Comparison of one measured quantity with its reference
+struct Comparison {
+  std::string corpus;
+  std::string metric;
+  std::string unit;
+  double measured;
+  bool hasReference;
+  double reference;
+  double tolerance;     //!< Relative tolerance
+  bool higherIsBetter;  //!< True for rates, false for times and memory
+
+  //! Relative change with respect to the reference
+  double change() const { return reference != 0.0 ? (measured - reference) / reference : 0.0; }
+
+  //! True if the change is worse than the tolerance allows
+  bool isRegression() const {
+    if (!hasReference) {
+      return false;
+    }
+    return higherIsBetter ? change() < -tolerance : change() > tolerance;
+  }
+};
+
+//! Reports of one run of the corpus, named after their corpus
+struct Report {
+  std::string corpus;
+  datatools::properties values;
+};
+
+//! Return the CRC-32 of a corpus file as an hexadecimal string
+std::string corpus_checksum(const std::string& corpusDir, const std::string& corpus) {
+  std::string path = corpusDir + "/" + corpus + ".brio";
+  datatools::fetch_path_with_env(path);
+  std::ifstream in(path.c_str(), std::ios::binary);
+  DT_THROW_IF(!in, std::runtime_error, "Cannot open corpus file '" << path << "'");
+  boost::crc_32_type crc;
+  char buffer[65536];
+  while (in.read(buffer, sizeof(buffer)) || in.gcount() > 0) {
+    crc.process_bytes(buffer, static_cast<std::size_t>(in.gcount()));
+  }
+  std::ostringstream os;
+  os << std::hex << std::setw(8) << std::setfill('0') << crc.checksum();
+  return os.str();
+}
+
+//! Load a report, the corpus name being the file name without extension
+Report load_report(const std::string& reportFile) {
+  Report r;
+  std::string path = reportFile;
+  datatools::fetch_path_with_env(path);
+  r.corpus = boost::filesystem::path(path).stem().string();
+  r.values.read_configuration(path);
+  return r;
+}
+
+//! Return the tolerance of a metric family, from the corpus section or the default ones
+double get_tolerance(const datatools::multi_properties& baseline, const std::string& corpus,
+                     const std::string& family) {
+  if (baseline.has_section(corpus)) {
+    const datatools::properties& section = baseline.get_section(corpus);
+    if (section.has_key("tolerance." + family)) {
+      return section.fetch_real("tolerance." + family);
+    }
+  }
+  DT_THROW_IF(!baseline.has_section(kTolerancesSection), std::logic_error,
+              "Baseline has no '" << kTolerancesSection << "' section");
+  return baseline.get_section(kTolerancesSection).fetch_real(family);
+}
+
+//! Compare the metrics of a report with the baseline
+/**
+ * If a corpus directory is given, the corpus file must also match the
+ * checksum recorded in the baseline.
+ */
+std::vector<Comparison> compare(const Report& report, const datatools::multi_properties& baseline,
+                                const std::string& corpusDir) {
+  const datatools::properties* reference = nullptr;
+  if (baseline.has_section(report.corpus)) {
+    reference = &baseline.get_section(report.corpus);
+    if (reference->has_key("numberOfEvents")) {
+      const int expected = reference->fetch_integer("numberOfEvents");
+      const int measured = report.values.fetch_integer("numberOfEvents");
+      DT_THROW_IF(expected != measured, std::logic_error,
+                  "Corpus '" << report.corpus << "' has " << measured << " events, baseline has "
+                             << expected << ": the corpus is not the reference one");
+    }
+    if (!corpusDir.empty() && reference->has_key("corpusChecksum")) {
+      const std::string expected = reference->fetch_string("corpusChecksum");
+      const std::string measured = corpus_checksum(corpusDir, report.corpus);
+      DT_THROW_IF(expected != measured, std::logic_error,
+                  "Corpus '" << report.corpus << "' has checksum " << measured
+                             << ", baseline has " << expected
+                             << ": the corpus is not the reference one");
+    }
+  }
+
+  auto make = [&](const std::string& metric, const std::string& unit, const std::string& family,
+                  bool higherIsBetter) -> Comparison {
+    Comparison c;
+    c.corpus = report.corpus;
+    c.metric = metric;
+    c.unit = unit;
+    c.measured = report.values.fetch_real(metric);
+    c.hasReference = (reference != nullptr) && reference->has_key(metric);
+    c.reference = c.hasReference ? reference->fetch_real(metric) : 0.0;
+    c.tolerance = get_tolerance(baseline, report.corpus, family);
+    c.higherIsBetter = higherIsBetter;
+    return c;
+  };
+
+  std::vector<Comparison> result;
+  result.push_back(make("eventsPerSecond", "events/s", "eventsPerSecond", true));
+  result.push_back(make("peakResidentMemory", "MiB", "peakResidentMemory", false));
+  std::vector<std::string> modules;
+  report.values.fetch("modules", modules);
+  for (const std::string& module : modules) {
+    result.push_back(make("module." + module + ".timePerEvent", "ms", "timePerEvent", false));
+  }
+  return result;
+}
+
+//! Format a relative change as a signed percentage
+std::string percent(double x) {
+  std::ostringstream os;
+  os << std::showpos << std::fixed << std::setprecision(1) << 100.0 * x << "%";
+  return os.str();
+}
+
+//! Print the comparisons as a Markdown table for release notes
+void print_table(std::ostream& os, const std::vector<Comparison>& comparisons) {
+  os << "| Corpus | Metric | Baseline | Measured | Change |\n";
+  os << "|--------|--------|---------:|---------:|-------:|\n";
+  os << std::fixed << std::setprecision(3);
+  for (const Comparison& c : comparisons) {
+    os << "| " << c.corpus << " | " << c.metric << " (" << c.unit << ") | ";
+    if (c.hasReference) {
+      os << c.reference << " | " << c.measured << " | " << percent(c.change())
+         << (c.isRegression() ? " **regression**" : "") << " |\n";
+    } else {
+      os << "- | " << c.measured << " | - |\n";
+    }
+  }
+}
+
+//! Record the measurements in the baseline, keeping its tolerances
+void update_baseline(datatools::multi_properties& baseline, const std::vector<Report>& reports,
+                     const std::string& corpusDir) {
+  for (const Report& report : reports) {
+    if (!baseline.has_section(report.corpus)) {
+      baseline.add_section(report.corpus, "throughput::reference");
+    }
+    datatools::properties& section = baseline.grab_section(report.corpus);
+    section.update("numberOfEvents", report.values.fetch_integer("numberOfEvents"));
+    if (!corpusDir.empty()) {
+      section.update("corpusChecksum", corpus_checksum(corpusDir, report.corpus));
+    }
+    section.update("eventsPerSecond", report.values.fetch_real("eventsPerSecond"));
+    section.update("peakResidentMemory", report.values.fetch_real("peakResidentMemory"));
+    std::vector<std::string> modules;
+    report.values.fetch("modules", modules);
+    for (const std::string& module : modules) {
+      const std::string key = "module." + module + ".timePerEvent";
+      section.update(key, report.values.fetch_real(key));
+    }
+  }
+}
+
+//! Compare the reports given on the command line with the baseline
+int do_throughput(int argc, char* argv[]) {
+  namespace bpo = boost::program_options;
+  std::string baselineFile;
+  std::string updateFile;
+  std::string corpusDir;
+  std::vector<std::string> reportFiles;
+
+  bpo::options_description options("Options");
+  // clang-format off
+  options.add_options()
+    ("help,h", "print this help message")
+    ("baseline,b", bpo::value<std::string>(&baselineFile)->required(),
+     "baseline file with reference values and tolerances")
+    ("table,t", "print a Markdown table of the changes and exit successfully")
+    ("update,u", bpo::value<std::string>(&updateFile),
+     "write the baseline updated with the measurements to this file")
+    ("corpus-dir,d", bpo::value<std::string>(&corpusDir),
+     "directory of the corpus files, whose checksums are recorded or checked")
+    ("report", bpo::value<std::vector<std::string>>(&reportFiles),
+     "report written by flreconstruct --profile-file (repeatable)");
+  // clang-format on
+  bpo::positional_options_description positional;
+  positional.add("report", -1);
+
+  bpo::variables_map vm;
+  try {
+    bpo::store(bpo::command_line_parser(argc, argv).options(options).positional(positional).run(),
+               vm);
+    if (vm.count("help")) {
+      std::cout << "Usage: falaise_throughput [options] report...\n" << options << std::endl;
+      return falaise::EXIT_OK;
+    }
+    bpo::notify(vm);
+  } catch (const bpo::error& e) {
+    std::cerr << "falaise_throughput: " << e.what() << "\n" << options << std::endl;
+    return falaise::EXIT_USAGE;
+  }
+  if (reportFiles.empty()) {
+    std::cerr << "falaise_throughput: no report given\n" << options << std::endl;
+    return falaise::EXIT_USAGE;
+  }
+
+  try {
+    datatools::multi_properties baseline("name", "type");
+    datatools::fetch_path_with_env(baselineFile);
+    baseline.read(baselineFile);
+
+    std::vector<Report> reports;
+    std::vector<Comparison> comparisons;
+    for (const std::string& reportFile : reportFiles) {
+      reports.push_back(load_report(reportFile));
+      std::vector<Comparison> c = compare(reports.back(), baseline, corpusDir);
+      comparisons.insert(comparisons.end(), c.begin(), c.end());
+    }
+
+    if (!updateFile.empty()) {
+      update_baseline(baseline, reports, corpusDir);
+      datatools::fetch_path_with_env(updateFile);
+      baseline.write(updateFile);
+      std::cout << "falaise_throughput: baseline written to " << updateFile << std::endl;
+      return falaise::EXIT_OK;
+    }
+
+    if (vm.count("table")) {
+      print_table(std::cout, comparisons);
+      return falaise::EXIT_OK;
+    }
+
+    std::size_t nReferences = 0;
+    std::size_t nMissing = 0;
+    std::size_t nRegressions = 0;
+    for (const Comparison& c : comparisons) {
+      if (!c.hasReference) {
+        // A module new to the pipeline has no reference yet, a corpus must have one
+        const bool isModule = (c.metric.compare(0, 7, "module.") == 0);
+        std::cout << (isModule ? "NEW " : "MISSING ") << c.corpus << " " << c.metric << ": "
+                  << c.measured << " " << c.unit << ", no baseline\n";
+        if (!isModule) {
+          nMissing++;
+        }
+        continue;
+      }
+      nReferences++;
+      if (c.isRegression()) {
+        nRegressions++;
+        std::cout << "REGRESSION " << c.corpus << " " << c.metric << ": " << c.measured << " "
+                  << c.unit << ", baseline " << c.reference << " " << c.unit << " ("
+                  << percent(c.change()) << ", tolerance " << percent(c.tolerance).substr(1)
+                  << ")\n";
+      }
+    }
+    if (nMissing > 0) {
+      std::cout << "falaise_throughput: baseline '" << baselineFile << "' misses " << nMissing
+                << " reference value(s), record them with --update" << std::endl;
+      return kExitNoReference;
+    }
+    std::cout << "falaise_throughput: " << nRegressions << " regression(s) in " << nReferences
+              << " compared measurements" << std::endl;
+    if (nRegressions > 0) {
+      return kExitRegression;
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "falaise_throughput: " << e.what() << std::endl;
+    return falaise::EXIT_UNAVAILABLE;
+  }
+  return falaise::EXIT_OK;
+}
+
+}  // namespace FLThroughput
+
+//----------------------------------------------------------------------
+// MAIN PROGRAM
+//----------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+  falaise::initialize(argc, argv);
+  int ret = FLThroughput::do_throughput(argc, argv);
+  falaise::terminate();
+  return ret;
+}
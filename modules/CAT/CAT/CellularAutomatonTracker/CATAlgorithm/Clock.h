@@ -17,6 +17,9 @@ class Clock {
   std::vector<clockable> clockables_;
 
  public:
+  //! Index of a clockable, valid as long as the Clock lives
+  typedef size_t handle;
+
   //! Default constructor
   Clock();
 
@@ -34,6 +37,17 @@ class Clock {
 
   void stop(const std::string &name);
 
+  //! Returns the handle of a clockable, adding it if it is not there
+  /** The name lookup is done once, so that probes in loops can then be
+   *  started and stopped by handle */
+  handle probe(const std::string &name);
+
+  //! Starts, cumulatively, the clockable of a handle
+  void start(handle h) { clockables_[h].start(); }
+
+  //! Stops the clockable of a handle
+  void stop(handle h) { clockables_[h].stop(); }
+
   double read(const std::string &name);
 
   void stop_all();
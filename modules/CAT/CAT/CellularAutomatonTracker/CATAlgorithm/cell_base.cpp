@@ -155,6 +155,9 @@ bool cell::same_cell(topology::cell c) const {
 bool cell::intersect(topology::cell c) const {
   double fraction_limit = 0.9;  /// fraction of radius after which cells intersect
 
+  // only values are compared
+  experimental_double::value_only_scope value_only;
+
   double dist = experimental_vector(ep(), c.ep()).hor().length().value();
   experimental_double rsum = r() + c.r();
 
@@ -11,6 +11,14 @@ namespace topology {
 
 using namespace std;
 
+namespace {
+// error of the results of value-only operations
+const double no_error = std::numeric_limits<double>::quiet_NaN();
+}  // namespace
+
+thread_local bool experimental_double::propagate_errors_ = true;
+thread_local bool experimental_double::value_only_enabled_ = true;
+
 bool experimental_double::is_valid() const { return is_value_valid() && is_error_valid(); }
 
 bool experimental_double::is_value_valid() const { return v_ == v_; }
@@ -70,7 +78,9 @@ const double& experimental_double::error() const { return e_; }
 experimental_double& experimental_double::operator+=(const experimental_double& p2) {
   experimental_double& p1 = *this;
   double val = p1.value() + p2.value();
-  double err = std::sqrt(mybhep::square(p1.error()) + mybhep::square(p2.error()));
+  double err = propagate_errors_
+                   ? std::sqrt(mybhep::square(p1.error()) + mybhep::square(p2.error()))
+                   : no_error;
   p1.set_value(val);
   p1.set_error(err);
   return p1;
@@ -80,7 +90,9 @@ experimental_double& experimental_double::operator+=(const experimental_double&
 experimental_double& experimental_double::operator-=(const experimental_double& p2) {
   experimental_double& p1 = *this;
   double val = p1.value() - p2.value();
-  double err = std::sqrt(mybhep::square(p1.error()) + mybhep::square(p2.error()));
+  double err = propagate_errors_
+                   ? std::sqrt(mybhep::square(p1.error()) + mybhep::square(p2.error()))
+                   : no_error;
   p1.set_value(val);
   p1.set_error(err);
 
@@ -91,8 +103,9 @@ experimental_double& experimental_double::operator-=(const experimental_double&
 experimental_double& experimental_double::operator*=(experimental_double a) {
   experimental_double& p1 = *this;
   double val = p1.value() * a.value();
-  double err =
-      std::sqrt(mybhep::square(a.value() * p1.error()) + mybhep::square(p1.value() * a.error()));
+  double err = propagate_errors_ ? std::sqrt(mybhep::square(a.value() * p1.error()) +
+                                             mybhep::square(p1.value() * a.error()))
+                                 : no_error;
 
   p1.set_value(val);
   p1.set_error(err);
@@ -123,8 +136,10 @@ experimental_double& experimental_double::operator/=(experimental_double a) {
   }
 
   double val = p1.value() / a.value();
-  double err = std::sqrt(mybhep::square(p1.error() / a.value()) +
-                         mybhep::square(p1.value() * a.error() / mybhep::square(a.value())));
+  double err = propagate_errors_
+                   ? std::sqrt(mybhep::square(p1.error() / a.value()) +
+                               mybhep::square(p1.value() * a.error() / mybhep::square(a.value())))
+                   : no_error;
   p1.set_value(val);
   p1.set_error(err);
   return p1;
@@ -152,7 +167,8 @@ experimental_double& experimental_double::operator/=(double a) {
 experimental_double experimental_sin(const experimental_double& v1) {
   experimental_double v;
   v.set_value(sin(v1.value()));
-  v.set_error(std::abs(cos(v1.value())) * v1.error());
+  v.set_error(experimental_double::propagates_errors() ? std::abs(cos(v1.value())) * v1.error()
+                                                       : no_error);
   return v;
 }
 
@@ -160,7 +176,8 @@ experimental_double experimental_sin(const experimental_double& v1) {
 experimental_double experimental_cos(const experimental_double& v1) {
   experimental_double v;
   v.set_value(cos(v1.value()));
-  v.set_error(std::abs(sin(v1.value())) * v1.error());
+  v.set_error(experimental_double::propagates_errors() ? std::abs(sin(v1.value())) * v1.error()
+                                                       : no_error);
   return v;
 }
 
@@ -168,7 +185,9 @@ experimental_double experimental_cos(const experimental_double& v1) {
 experimental_double experimental_tan(const experimental_double& v1) {
   experimental_double v;
   v.set_value(tan(v1.value()));
-  v.set_error((1. + mybhep::square(v.value())) * v1.error());
+  v.set_error(experimental_double::propagates_errors()
+                  ? (1. + mybhep::square(v.value())) * v1.error()
+                  : no_error);
   return v;
 }
 
@@ -176,7 +195,9 @@ experimental_double experimental_tan(const experimental_double& v1) {
 experimental_double experimental_asin(const experimental_double& v1) {
   experimental_double v;
   v.set_value(asin(v1.value()));
-  v.set_error(v1.error() / std::sqrt(1 - mybhep::square(v1.value())));
+  v.set_error(experimental_double::propagates_errors()
+                  ? v1.error() / std::sqrt(1 - mybhep::square(v1.value()))
+                  : no_error);
   return v;
 }
 
@@ -184,7 +205,9 @@ experimental_double experimental_asin(const experimental_double& v1) {
 experimental_double experimental_acos(const experimental_double& v1) {
   experimental_double v;
   v.set_value(acos(v1.value()));
-  v.set_error(v1.error() / std::sqrt(1 - mybhep::square(v1.value())));
+  v.set_error(experimental_double::propagates_errors()
+                  ? v1.error() / std::sqrt(1 - mybhep::square(v1.value()))
+                  : no_error);
   return v;
 }
 
@@ -194,7 +217,9 @@ experimental_double experimental_atan2(const experimental_double& v1,
   experimental_double v;
   v.set_value(atan2(v1.value(), v2.value()));
 
-  if (v2.value() == 0.) {  // if angle = 90 degrees,
+  if (!experimental_double::propagates_errors()) {
+    v.set_error(no_error);
+  } else if (v2.value() == 0.) {  // if angle = 90 degrees,
     // obtain error from angle = 180 - (other angle)
     double den = 1 + mybhep::square(v2.value() / v1.value());
     double num = mybhep::square(v2.error() / v1.value()) +
@@ -224,7 +249,8 @@ experimental_double experimental_atan2(const experimental_double& v1,
 experimental_double experimental_square(const experimental_double& v1) {
   experimental_double v;
   v.set_value(mybhep::square(v1.value()));
-  v.set_error(2 * std::abs(v1.value()) * v1.error());
+  v.set_error(experimental_double::propagates_errors() ? 2 * std::abs(v1.value()) * v1.error()
+                                                       : no_error);
   return v;
 }
 
@@ -232,7 +258,7 @@ experimental_double experimental_square(const experimental_double& v1) {
 experimental_double experimental_sqrt(const experimental_double& v1) {
   experimental_double v;
   v.set_value(std::sqrt(v1.value()));
-  v.set_error(v1.error() / (2 * v.value()));
+  v.set_error(experimental_double::propagates_errors() ? v1.error() / (2 * v.value()) : no_error);
   return v;
 }
 
@@ -240,7 +266,8 @@ experimental_double experimental_sqrt(const experimental_double& v1) {
 experimental_double experimental_cube(const experimental_double& v1) {
   experimental_double v;
   v.set_value(mybhep::cube(v1.value()));
-  v.set_error(3 * mybhep::square(v1.value()) * v1.error());
+  v.set_error(experimental_double::propagates_errors() ? 3 * mybhep::square(v1.value()) * v1.error()
+                                                       : no_error);
   return v;
 }
 
@@ -71,6 +71,53 @@ class experimental_double {
 
   //! operador /=
   experimental_double& operator/=(double a);
+
+  //! true if the operations propagate errors, false in a value_only_scope
+  static bool propagates_errors() { return propagate_errors_; }
+
+  //! \brief Value-only arithmetic for the lifetime of the object
+  //!
+  //! While it lives, the operations of the thread on experimental_doubles (and on
+  //! the points and vectors made of them) compute values only, and set NaN
+  //! errors. Meant for screening computations of which only values are used.
+  class value_only_scope {
+   public:
+    value_only_scope() : previous_(propagate_errors_) {
+      if (value_only_enabled_) propagate_errors_ = false;
+    }
+    ~value_only_scope() { propagate_errors_ = previous_; }
+    value_only_scope(const value_only_scope&) = delete;
+    value_only_scope& operator=(const value_only_scope&) = delete;
+
+   private:
+    bool previous_;
+  };
+
+  //! \brief Full error propagation for the lifetime of the object
+  //!
+  //! While it lives, the value_only_scopes of the thread have no effect, so that
+  //! results can be compared with those of the value-only tier.
+  class full_scope {
+   public:
+    full_scope() : previous_enabled_(value_only_enabled_), previous_(propagate_errors_) {
+      value_only_enabled_ = false;
+      propagate_errors_ = true;
+    }
+    ~full_scope() {
+      value_only_enabled_ = previous_enabled_;
+      propagate_errors_ = previous_;
+    }
+    full_scope(const full_scope&) = delete;
+    full_scope& operator=(const full_scope&) = delete;
+
+   private:
+    bool previous_enabled_;
+    bool previous_;
+  };
+
+ private:
+  static thread_local bool propagate_errors_;
+  static thread_local bool value_only_enabled_;
 };
 
 // Operations with experimental_points
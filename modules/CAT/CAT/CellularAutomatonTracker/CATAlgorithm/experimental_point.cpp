@@ -1,5 +1,7 @@
 #include <CATAlgorithm/experimental_point.h>
 
+#include <limits>
+
 namespace CAT {
 
 namespace topology {
@@ -164,6 +166,10 @@ experimental_double experimental_point::distance(const experimental_point &p2) c
   result.set_value(std::sqrt(mybhep::square(x_.value() - p2.x().value()) +
                              mybhep::square(y_.value() - p2.y().value()) +
                              mybhep::square(z_.value() - p2.z().value())));
+  if (!experimental_double::propagates_errors()) {
+    result.set_error(std::numeric_limits<double>::quiet_NaN());
+    return result;
+  }
   result.set_error(std::sqrt(mybhep::square(x_.value() * x_.error()) +
                              mybhep::square(p2.x().value() * p2.x().error()) +
                              mybhep::square(y_.value() * y_.error()) +
@@ -181,6 +187,10 @@ experimental_double experimental_point::hor_distance(const experimental_point &p
 
   result.set_value(std::sqrt(mybhep::square(x_.value() - p2.x().value()) +
                              mybhep::square(z_.value() - p2.z().value())));
+  if (!experimental_double::propagates_errors()) {
+    result.set_error(std::numeric_limits<double>::quiet_NaN());
+    return result;
+  }
   result.set_error(std::sqrt(mybhep::square(x_.value() * x_.error()) +
                              mybhep::square(p2.x().value() * p2.x().error()) +
                              mybhep::square(z_.value() * z_.error()) +
@@ -198,6 +208,11 @@ void experimental_point::set_radius() {
 
   double rr = std::sqrt(mybhep::square(x_.value()) + mybhep::square(z_.value()));
   if (std::isnan(rr)) rr = mybhep::small_neg;
+  if (!experimental_double::propagates_errors()) {
+    radius_.set_value(rr);
+    radius_.set_error(std::numeric_limits<double>::quiet_NaN());
+    return;
+  }
   double err =
       std::sqrt(mybhep::square(x_.value() * x_.error()) + mybhep::square(z_.value() * z_.error())) /
       rr;
@@ -1,6 +1,8 @@
 /* -*- mode: c++ -*- */
 #include <CATAlgorithm/experimental_vector.h>
 
+#include <limits>
+
 namespace CAT {
 namespace topology {
 
@@ -242,6 +244,10 @@ experimental_double experimental_vector::distance(const experimental_vector& p2)
   result.set_value(std::sqrt(mybhep::square(x_.value() - p2.x().value()) +
                              mybhep::square(y_.value() - p2.y().value()) +
                              mybhep::square(z_.value() - p2.z().value())));
+  if (!experimental_double::propagates_errors()) {
+    result.set_error(std::numeric_limits<double>::quiet_NaN());
+    return result;
+  }
   result.set_error(std::sqrt(mybhep::square(x_.value() * x_.error()) +
                              mybhep::square(p2.x().value() * p2.x().error()) +
                              mybhep::square(y_.value() * y_.error()) +
@@ -259,6 +265,10 @@ experimental_double experimental_vector::length() const {
 
   result.set_value(std::sqrt(mybhep::square(x_.value()) + mybhep::square(y_.value()) +
                              mybhep::square(z_.value())));
+  if (!experimental_double::propagates_errors()) {
+    result.set_error(std::numeric_limits<double>::quiet_NaN());
+    return result;
+  }
   result.set_error(std::sqrt(mybhep::square(x_.value() * x_.error()) +
                              mybhep::square(y_.value() * y_.error()) +
                              mybhep::square(z_.value() * z_.error())) /
@@ -295,7 +305,9 @@ experimental_double experimental_vector::kink_phi(const experimental_vector& v)
   double phi2 = p2.value();
   mybhep::fix_angles(&phi1, &phi2);
   result.set_value(phi2 - phi1);
-  result.set_error(std::sqrt(mybhep::square(p1.error()) + mybhep::square(p2.error())));
+  result.set_error(experimental_double::propagates_errors()
+                       ? std::sqrt(mybhep::square(p1.error()) + mybhep::square(p2.error()))
+                       : std::numeric_limits<double>::quiet_NaN());
 
   return result;
 }
@@ -308,7 +320,9 @@ experimental_double experimental_vector::kink_theta(const experimental_vector& v
   double theta2 = t2.value();
   mybhep::fix_angles(&theta1, &theta2);
   result.set_value(theta2 - theta1);
-  result.set_error(std::sqrt(mybhep::square(t1.error()) + mybhep::square(t2.error())));
+  result.set_error(experimental_double::propagates_errors()
+                       ? std::sqrt(mybhep::square(t1.error()) + mybhep::square(t2.error()))
+                       : std::numeric_limits<double>::quiet_NaN());
 
   return result;
 }
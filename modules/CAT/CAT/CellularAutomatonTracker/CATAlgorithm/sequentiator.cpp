@@ -75,6 +75,8 @@ sequentiator::sequentiator(mybhep::gstore st) {
 
   m = mybhep::messenger(level);
 
+  register_clock_probes();
+
   //-- read param --//
 
   pmax = st.fetch_dstore("pmax") * mybhep::MeV;
@@ -121,6 +123,24 @@ sequentiator::sequentiator(mybhep::gstore st) {
 sequentiator::sequentiator(void) {
   //*************************************************************
   _set_defaults();
+  register_clock_probes();
+  return;
+}
+
+//*************************************************************
+void sequentiator::register_clock_probes() {
+  //*************************************************************
+  probes_.set_free_level = clock.probe(" sequentiator: set free level ");
+  probes_.get_link_index = clock.probe(" sequentiator: get link index ");
+  probes_.evolve = clock.probe(" sequentiator: evolve ");
+  probes_.evolve_part_A = clock.probe(" sequentiator: evolve: part A ");
+  probes_.evolve_part_B = clock.probe(" sequentiator: evolve: part B ");
+  probes_.evolve_part_B_set_free_level =
+      clock.probe(" sequentiator: evolve: part B: set free level ");
+  probes_.evolve_part_B_noc = clock.probe(" sequentiator: evolve: part B: noc ");
+  probes_.evolve_part_C = clock.probe(" sequentiator: evolve: part C ");
+  probes_.increase_iterations = clock.probe(" sequentiator: increase_iterations ");
+  probes_.good_first_node = clock.probe(" sequentiator: good first node ");
   return;
 }
 
@@ -1089,7 +1109,7 @@ bool sequentiator::increase_iterations(
     std::vector<size_t> *iterations, int *block_which_is_increasing, int *first_augmented_block) {
   //*************************************************************
 
-  clock.start(" sequentiator: increase_iterations ", "cumulative");
+  clock.start(probes_.increase_iterations);
 
   iterations->at(*block_which_is_increasing)++;
   if (iterations->at(*block_which_is_increasing) ==
@@ -1097,7 +1117,7 @@ bool sequentiator::increase_iterations(
     iterations->at(*block_which_is_increasing) = 0;
     int prev_block = *block_which_is_increasing - 1;
     if (prev_block < 0) {
-      clock.stop(" sequentiator: increase_iterations ");
+      clock.stop(probes_.increase_iterations);
       return false;
     }
     while (true) {
@@ -1107,18 +1127,18 @@ bool sequentiator::increase_iterations(
         prev_block--;
         if (prev_block < 0) break;
       } else {
-        clock.stop(" sequentiator: increase_iterations ");
+        clock.stop(probes_.increase_iterations);
         return true;
       }
     }
     if (prev_block < 0) {
-      clock.stop(" sequentiator: increase_iterations ");
+      clock.stop(probes_.increase_iterations);
       return false;
     }
     if (prev_block < *first_augmented_block) *first_augmented_block = prev_block;
   }
 
-  clock.stop(" sequentiator: increase_iterations ");
+  clock.stop(probes_.increase_iterations);
   return true;
 }
 
@@ -1289,8 +1309,9 @@ void sequentiator::make_copy_sequence(topology::node &first_node) {
     clock.start(" sequentiator: make copy sequence: part A ", "cumulative");
     clock.start(" sequentiator: make copy sequence: part A: alpha ", "cumulative");
 
-    m.message("CAT::sequentiator::make_copy_sequence: begin, with cell", first_node.c().id(),
-              ", parallel track ", sequences_.size(), " to track ", isequence, mybhep::VERBOSE);
+    MYBHEP_MESSAGE(m, mybhep::VERBOSE, "CAT::sequentiator::make_copy_sequence: begin, with cell",
+                   first_node.c().id(), ", parallel track ", sequences_.size(), " to track ",
+                   isequence);
     fflush(stdout);
 
     if (level >= mybhep::VVERBOSE) {
@@ -1306,16 +1327,16 @@ void sequentiator::make_copy_sequence(topology::node &first_node) {
     clock.stop(" sequentiator: copy to lfn ");
 
     clock.start(" sequentiator: make copy sequence: part A: beta ", "cumulative");
-    m.message("CAT::sequentiator::make_copy_sequence: copied from sequence  ", isequence,
-              mybhep::VVERBOSE);
+    MYBHEP_MESSAGE(m, mybhep::VVERBOSE,
+                   "CAT::sequentiator::make_copy_sequence: copied from sequence  ", isequence);
     fflush(stdout);
 
     if (level >= mybhep::VVERBOSE) {
-      m.message("CAT::sequentiator::make_copy_sequence: original sequence after copy ",
-                mybhep::VVERBOSE);
+      MYBHEP_MESSAGE(m, mybhep::VVERBOSE,
+                     "CAT::sequentiator::make_copy_sequence: original sequence after copy ");
       fflush(stdout);
       print_a_sequence(sequences_[isequence]);
-      m.message("CAT::sequentiator::make_copy_sequence: new copy ", mybhep::VVERBOSE);
+      MYBHEP_MESSAGE(m, mybhep::VVERBOSE, "CAT::sequentiator::make_copy_sequence: new copy ");
       fflush(stdout);
       print_a_sequence(newcopy);
     }
@@ -1343,10 +1364,10 @@ void sequentiator::make_copy_sequence(topology::node &first_node) {
 
     // not adding: case 1: new sequence did not evolve
     if (newcopy.nodes().size() == ilfn + 1) {
-      m.message(
+      MYBHEP_MESSAGE(
+          m, mybhep::VERBOSE,
           "CAT::sequentiator::make_copy_sequence: not adding new sequence, since it couldn't "
-          "evolve past lfn ",
-          mybhep::VERBOSE);
+          "evolve past lfn ");
       fflush(stdout);
       clean_up_sequences();
     } else {
@@ -1354,11 +1375,12 @@ void sequentiator::make_copy_sequence(topology::node &first_node) {
       // is set to used in the original
       if (newcopy.nodes().size() > ilfn + 1) {
         if (!sequences_[isequence].nodes().empty()) {
-          clock.start(" sequentiator: get link index ", "cumulative");
+          clock.start(probes_.get_link_index);
           size_t it1 = newcopy.get_link_index_of_cell(ilfn, newcopy.nodes()[ilfn + 1].c());
-          clock.stop(" sequentiator: get link index ");
-          m.message("CAT::sequentiator::make_copy_sequence: setting as used original node ", ilfn,
-                    "  cc ", it1, mybhep::VVERBOSE);
+          clock.stop(probes_.get_link_index);
+          MYBHEP_MESSAGE(m, mybhep::VVERBOSE,
+                         "CAT::sequentiator::make_copy_sequence: setting as used original node ",
+                         ilfn, "  cc ", it1);
           if (ilfn == 0)
             sequences_[isequence].nodes_[ilfn].cc_[it1].set_all_used();
           else
@@ -1366,24 +1388,26 @@ void sequentiator::make_copy_sequence(topology::node &first_node) {
         }
         /*
           if( sequences_[isequence].nodes().size() > 1 && ilfn > 0){
-          clock.start(" sequentiator: get link index ","cumulative");
+          clock.start(probes_.get_link_index);
           size_t it2 = newcopy.get_link_index_of_cell(1, newcopy.nodes()[2].c());
-          clock.stop(" sequentiator: get link index ");
-          m.message(" setting as used original node 1  ccc ", it2, mybhep::VVERBOSE);
+          clock.stop(probes_.get_link_index);
+          MYBHEP_MESSAGE(m, mybhep::VVERBOSE, " setting as used original node 1  ccc ", it2);
           sequences_[isequence].nodes_[1].ccc_[it2].set_all_used();
           }
         */
-        clock.start(" sequentiator: set free level ", "cumulative");
+        clock.start(probes_.set_free_level);
         sequences_[isequence].set_free_level();
-        clock.stop(" sequentiator: set free level ");
+        clock.stop(probes_.set_free_level);
       }
 
       // not adding: case 2: new sequence contained
       if (newcopy.contained(sequences_[isequence]) &&
           !newcopy.Free())  // new copy is contained in original
       {
-        m.message("CAT::sequentiator::make_copy_sequence: not adding new sequence, contained in ",
-                  isequence, "from which it was copied", mybhep::VERBOSE);
+        MYBHEP_MESSAGE(
+            m, mybhep::VERBOSE,
+            "CAT::sequentiator::make_copy_sequence: not adding new sequence, contained in ",
+            isequence, "from which it was copied");
         fflush(stdout);
         clean_up_sequences();
       } else {                                           // adding: case 3
@@ -1510,14 +1534,15 @@ void sequentiator::make_copy_sequence(topology::node &first_node) {
               }
           }
 
-          clock.start(" sequentiator: set free level ", "cumulative");
+          clock.start(probes_.set_free_level);
           newcopy.set_free_level();
-          clock.stop(" sequentiator: set free level ");
+          clock.stop(probes_.set_free_level);
 
           sequences_.erase(sequences_.begin() + isequence);
-          m.message("CAT::sequentiator::make_copy_sequence: erased original sequence ", isequence,
-                    "contained in sequence", sequences_.size() + 1, "which was copied from it",
-                    mybhep::VERBOSE);
+          MYBHEP_MESSAGE(m, mybhep::VERBOSE,
+                         "CAT::sequentiator::make_copy_sequence: erased original sequence ",
+                         isequence, "contained in sequence", sequences_.size() + 1,
+                         "which was copied from it");
           fflush(stdout);
           clean_up_sequences();
         }
@@ -1526,8 +1551,9 @@ void sequentiator::make_copy_sequence(topology::node &first_node) {
         if (newcopy.nodes().size() != 2) {
           make_name(newcopy);
           sequences_.push_back(newcopy);
-          m.message("CAT::sequentiator::make_copy_sequence: finished track [",
-                    sequences_.size() - 1, "] ", mybhep::VERBOSE);
+          MYBHEP_MESSAGE(m, mybhep::VERBOSE,
+                         "CAT::sequentiator::make_copy_sequence: finished track [",
+                         sequences_.size() - 1, "] ");
           fflush(stdout);
           clean_up_sequences();
         } else {
@@ -1568,9 +1594,10 @@ void sequentiator::make_copy_sequence_after_sultan() {
     clock.start(" sequentiator: make copy sequence after sultan: part A ", "cumulative");
     clock.start(" sequentiator: make copy sequence after sultan: part A: alpha ", "cumulative");
 
-    m.message("CAT::sequentiator::make_copy_sequence_after_sultan: begin, with cell",
-              first_node.c().id(), ", parallel track ", sequences_.size(), " to track ", isequence,
-              mybhep::VERBOSE);
+    MYBHEP_MESSAGE(m, mybhep::VERBOSE,
+                   "CAT::sequentiator::make_copy_sequence_after_sultan: begin, with cell",
+                   first_node.c().id(), ", parallel track ", sequences_.size(), " to track ",
+                   isequence);
     fflush(stdout);
 
     if (level >= mybhep::VVERBOSE) {
@@ -1587,16 +1614,19 @@ void sequentiator::make_copy_sequence_after_sultan() {
     clock.stop(" sequentiator: copy to lfn ");
 
     clock.start(" sequentiator: make copy sequence after sultan: part A: beta ", "cumulative");
-    m.message("CAT::sequentiator::make_copy_sequence_after_sultan: copied from sequence  ",
-              isequence, mybhep::VVERBOSE);
+    MYBHEP_MESSAGE(m, mybhep::VVERBOSE,
+                   "CAT::sequentiator::make_copy_sequence_after_sultan: copied from sequence  ",
+                   isequence);
     fflush(stdout);
 
     if (level >= mybhep::VVERBOSE) {
-      m.message("CAT::sequentiator::make_copy_sequence_after_sultan: original sequence after copy ",
-                mybhep::VVERBOSE);
+      MYBHEP_MESSAGE(
+          m, mybhep::VVERBOSE,
+          "CAT::sequentiator::make_copy_sequence_after_sultan: original sequence after copy ");
       fflush(stdout);
       print_a_sequence(sequences_[isequence]);
-      m.message("CAT::sequentiator::make_copy_sequence_after_sultan: new copy ", mybhep::VVERBOSE);
+      MYBHEP_MESSAGE(m, mybhep::VVERBOSE,
+                     "CAT::sequentiator::make_copy_sequence_after_sultan: new copy ");
       fflush(stdout);
       print_a_sequence(newcopy);
     }
@@ -1624,10 +1654,10 @@ void sequentiator::make_copy_sequence_after_sultan() {
 
     // not adding: case 1: new sequence did not evolve
     if (newcopy.nodes().size() == ilfn + 1) {
-      m.message(
+      MYBHEP_MESSAGE(
+          m, mybhep::VERBOSE,
           "CAT::sequentiator::make_copy_sequence_after_sultan: not adding new sequence, since it "
-          "couldn't evolve past lfn ",
-          mybhep::VERBOSE);
+          "couldn't evolve past lfn ");
       fflush(stdout);
       clean_up_sequences();
     } else {
@@ -1635,12 +1665,13 @@ void sequentiator::make_copy_sequence_after_sultan() {
       // is set to used in the original
       if (newcopy.nodes().size() > ilfn + 1) {
         if (!sequences_[isequence].nodes().empty()) {
-          clock.start(" sequentiator: get link index ", "cumulative");
+          clock.start(probes_.get_link_index);
           size_t it1 = newcopy.get_link_index_of_cell(ilfn, newcopy.nodes()[ilfn + 1].c());
-          clock.stop(" sequentiator: get link index ");
-          m.message(
+          clock.stop(probes_.get_link_index);
+          MYBHEP_MESSAGE(
+              m, mybhep::VVERBOSE,
               "CAT::sequentiator::make_copy_sequence_after_sultan: setting as used original node ",
-              ilfn, "  cc ", it1, mybhep::VVERBOSE);
+              ilfn, "  cc ", it1);
           if (ilfn == 0)
             sequences_[isequence].nodes_[ilfn].cc_[it1].set_all_used();
           else
@@ -1648,26 +1679,26 @@ void sequentiator::make_copy_sequence_after_sultan() {
         }
         /*
           if( sequences_[isequence].nodes().size() > 1 && ilfn > 0){
-          clock.start(" sequentiator: get link index ","cumulative");
+          clock.start(probes_.get_link_index);
           size_t it2 = newcopy.get_link_index_of_cell(1, newcopy.nodes()[2].c());
-          clock.stop(" sequentiator: get link index ");
-          m.message(" setting as used original node 1  ccc ", it2, mybhep::VVERBOSE);
+          clock.stop(probes_.get_link_index);
+          MYBHEP_MESSAGE(m, mybhep::VVERBOSE, " setting as used original node 1  ccc ", it2);
           sequences_[isequence].nodes_[1].ccc_[it2].set_all_used();
           }
         */
-        clock.start(" sequentiator: set free level ", "cumulative");
+        clock.start(probes_.set_free_level);
         sequences_[isequence].set_free_level();
-        clock.stop(" sequentiator: set free level ");
+        clock.stop(probes_.set_free_level);
       }
 
       // not adding: case 2: new sequence contained
       if (newcopy.contained(sequences_[isequence]) &&
           !newcopy.Free())  // new copy is contained in original
       {
-        m.message(
+        MYBHEP_MESSAGE(
+            m, mybhep::VERBOSE,
             "CAT::sequentiator::make_copy_sequence_after_sultan: not adding new sequence, "
-            "contained in ",
-            isequence, "from which it was copied", mybhep::VERBOSE);
+            "contained in ", isequence, "from which it was copied");
         fflush(stdout);
         clean_up_sequences();
       } else {                                           // adding: case 3
@@ -1794,14 +1825,16 @@ void sequentiator::make_copy_sequence_after_sultan() {
               }
           }
 
-          clock.start(" sequentiator: set free level ", "cumulative");
+          clock.start(probes_.set_free_level);
           newcopy.set_free_level();
-          clock.stop(" sequentiator: set free level ");
+          clock.stop(probes_.set_free_level);
 
           sequences_.erase(sequences_.begin() + isequence);
-          m.message("CAT::sequentiator::make_copy_sequence_after_sultan: erased original sequence ",
-                    isequence, "contained in sequence", sequences_.size() + 1,
-                    "which was copied from it", mybhep::VERBOSE);
+          MYBHEP_MESSAGE(
+              m, mybhep::VERBOSE,
+              "CAT::sequentiator::make_copy_sequence_after_sultan: erased original sequence ",
+              isequence, "contained in sequence", sequences_.size() + 1,
+              "which was copied from it");
           fflush(stdout);
           clean_up_sequences();
         }
@@ -1810,8 +1843,9 @@ void sequentiator::make_copy_sequence_after_sultan() {
         if (newcopy.nodes().size() != 2) {
           make_name(newcopy);
           sequences_.push_back(newcopy);
-          m.message("CAT::sequentiator::make_copy_sequence_after_sultan: finished track [",
-                    sequences_.size() - 1, "] ", mybhep::VERBOSE);
+          MYBHEP_MESSAGE(m, mybhep::VERBOSE,
+                         "CAT::sequentiator::make_copy_sequence_after_sultan: finished track [",
+                         sequences_.size() - 1, "] ");
           fflush(stdout);
           clean_up_sequences();
         } else {
@@ -1877,9 +1911,9 @@ bool sequentiator::evolve(topology::sequence &sequence) {
 
   if (late()) return false;
 
-  clock.start(" sequentiator: evolve ", "cumulative");
+  clock.start(probes_.evolve);
 
-  clock.start(" sequentiator: evolve: part A ", "cumulative");
+  clock.start(probes_.evolve_part_A);
 
   const size_t sequence_size = sequence.nodes().size();
 
@@ -1889,40 +1923,41 @@ bool sequentiator::evolve(topology::sequence &sequence) {
          << "Sequence size = " << sequence_size << endl;
   }
 
-  m.message("CAT::sequentiator::evolve: evolving sequence of size", sequence_size,
-            mybhep::VVERBOSE);
+  MYBHEP_MESSAGE(m, mybhep::VVERBOSE, "CAT::sequentiator::evolve: evolving sequence of size",
+                 sequence_size);
   fflush(stdout);
 
   // protection
   if (sequence_size < 1) {
-    m.message("CAT::sequentiator::evolve: problem: sequence has length ", sequence_size,
-              "... stop evolving ", mybhep::NORMAL);
+    MYBHEP_MESSAGE(m, mybhep::NORMAL, "CAT::sequentiator::evolve: problem: sequence has length ",
+                   sequence_size, "... stop evolving ");
     fflush(stdout);
-    clock.stop(" sequentiator: evolve: part A ");
-    clock.stop(" sequentiator: evolve ");
+    clock.stop(probes_.evolve_part_A);
+    clock.stop(probes_.evolve);
     return false;
   }
 
   if (level >= mybhep::VVERBOSE) print_a_sequence(sequence);
 
   if (sequence_size == 3) {
-    clock.start(" sequentiator: get link index ", "cumulative");
+    clock.start(probes_.get_link_index);
     size_t it1 = sequence.get_link_index_of_cell(0, sequence.nodes()[1].c());
     if (it1 >= sequence.nodes_[0].cc_.size()) {
-      m.message("CAT::sequentiator::evolve: problem: it1 ", it1, " nodes size ",
-                sequence.nodes_.size(), " cc size ", sequence.nodes_[0].cc_.size(), mybhep::NORMAL);
+      MYBHEP_MESSAGE(m, mybhep::NORMAL, "CAT::sequentiator::evolve: problem: it1 ", it1,
+                     " nodes size ", sequence.nodes_.size(), " cc size ",
+                     sequence.nodes_[0].cc_.size());
       fflush(stdout);
-      clock.stop(" sequentiator: evolve: part A ");
-      clock.stop(" sequentiator: evolve ");
+      clock.stop(probes_.evolve_part_A);
+      clock.stop(probes_.evolve);
       return false;
     }
     sequence.nodes_[0].cc_[it1].set_all_used();
 
-    clock.stop(" sequentiator: get link index ");
+    clock.stop(probes_.get_link_index);
   }
 
-  clock.stop(" sequentiator: evolve: part A ");
-  clock.start(" sequentiator: evolve: part B ", "cumulative");
+  clock.stop(probes_.evolve_part_A);
+  clock.start(probes_.evolve_part_B);
 
   // check if there is a possible link
   size_t ilink;
@@ -1938,16 +1973,16 @@ bool sequentiator::evolve(topology::sequence &sequence) {
   }
 
   if (!there_is_link) {
-    m.message("CAT::sequentiator::evolve: no links could be added... stop evolving ",
-              mybhep::VERBOSE);
+    MYBHEP_MESSAGE(m, mybhep::VERBOSE,
+                   "CAT::sequentiator::evolve: no links could be added... stop evolving ");
     fflush(stdout);
-    clock.start(" sequentiator: evolve: part B: set free level ", "cumulative");
-    clock.start(" sequentiator: set free level ", "cumulative");
+    clock.start(probes_.evolve_part_B_set_free_level);
+    clock.start(probes_.set_free_level);
     sequence.set_free_level();
-    clock.stop(" sequentiator: set free level ");
-    clock.stop(" sequentiator: evolve: part B: set free level ");
-    clock.stop(" sequentiator: evolve: part B ");
-    clock.stop(" sequentiator: evolve ");
+    clock.stop(probes_.set_free_level);
+    clock.stop(probes_.evolve_part_B_set_free_level);
+    clock.stop(probes_.evolve_part_B);
+    clock.stop(probes_.evolve);
 
     if (sequence.nodes().size() == 1) {
       topology::experimental_point ep(sequence.nodes_[0].c().ep());
@@ -1960,14 +1995,14 @@ bool sequentiator::evolve(topology::sequence &sequence) {
   }
 
   topology::cell newcell = sequence.last_node().links()[ilink];
-  clock.start(" sequentiator: evolve: part B: noc ", "cumulative");
+  clock.start(probes_.evolve_part_B_noc);
   topology::node newnode = local_cluster_->node_of_cell(newcell);
   //  topology::node newnode = local_cluster_->nodes()[local_cluster_->node_index_of_cell(newcell)];
-  clock.stop(" sequentiator: evolve: part B: noc ");
+  clock.stop(probes_.evolve_part_B_noc);
   newnode.set_free(false);  // standard initialization
 
-  clock.stop(" sequentiator: evolve: part B ");
-  clock.start(" sequentiator: evolve: part C ", "cumulative");
+  clock.stop(probes_.evolve_part_B);
+  clock.start(probes_.evolve_part_C);
 
   if (sequence_size == 1) {
     // since it's the 2nd cell, only the four
@@ -1975,27 +2010,27 @@ bool sequentiator::evolve(topology::sequence &sequence) {
     // this link has no freedom left
 
     sequence.nodes_.push_back(newnode);
-    clock.start(" sequentiator: set free level ", "cumulative");
+    clock.start(probes_.set_free_level);
     sequence.set_free_level();
-    clock.stop(" sequentiator: set free level ");
+    clock.stop(probes_.set_free_level);
 
-    clock.stop(" sequentiator: evolve: part C ");
-    clock.stop(" sequentiator: evolve ");
+    clock.stop(probes_.evolve_part_C);
+    clock.stop(probes_.evolve);
     return true;
   }
 
   newnode.set_ep(newp);
 
   sequence.nodes_.push_back(newnode);
-  m.message("CAT::sequentiator::evolve: points have been added ", mybhep::VERBOSE);
+  MYBHEP_MESSAGE(m, mybhep::VERBOSE, "CAT::sequentiator::evolve: points have been added ");
   fflush(stdout);
 
-  clock.start(" sequentiator: set free level ", "cumulative");
+  clock.start(probes_.set_free_level);
   sequence.set_free_level();
-  clock.stop(" sequentiator: set free level ");
+  clock.stop(probes_.set_free_level);
 
-  clock.stop(" sequentiator: evolve: part C ");
-  clock.stop(" sequentiator: evolve ");
+  clock.stop(probes_.evolve_part_C);
+  clock.stop(probes_.evolve);
   return true;
 }
 
@@ -2003,15 +2038,15 @@ bool sequentiator::evolve(topology::sequence &sequence) {
 bool sequentiator::good_first_node(topology::node &node_) {
   //*************************************************************
 
-  clock.start(" sequentiator: good first node ", "cumulative");
+  clock.start(probes_.good_first_node);
 
   const string type = node_.topological_type();
 
   // check that node is not in the middle of a cell_triplet
   if (type != "VERTEX" && type != "MULTI_VERTEX" && type != "ISOLATED") {
-    // clock.stop(" sequentiator: good first node ");
-    m.message("CAT::sequentiator::good_first_node: not a good first node: type ", type,
-              mybhep::VVERBOSE);
+    // clock.stop(probes_.good_first_node);
+    MYBHEP_MESSAGE(m, mybhep::VVERBOSE,
+                   "CAT::sequentiator::good_first_node: not a good first node: type ", type);
     fflush(stdout);
     return false;
   }
@@ -2024,13 +2059,13 @@ bool sequentiator::good_first_node(topology::node &node_) {
        iseq != sequences_.end(); ++iseq) {
     if (iseq->has_cell(node_.c())) {
       if (type == "VERTEX") {
-        m.message(
+        MYBHEP_MESSAGE(
+            m, mybhep::VVERBOSE,
             "CAT::sequentiator::good_first_node: not a good first node: already used as vertex in "
-            "seuqence ",
-            iseq - sequences_.begin(), mybhep::VVERBOSE);
+            "seuqence ", iseq - sequences_.begin());
         fflush(stdout);
 
-        // clock.stop(" sequentiator: good first node ");
+        // clock.stop(probes_.good_first_node);
         return false;
       } else {  // multi-vertex
         if (iseq->nodes_.size() > 1) {
@@ -2039,9 +2074,10 @@ bool sequentiator::good_first_node(topology::node &node_) {
           else if (iseq->last_node().c().id() == node_.c().id()) {
             connection_node = iseq->nodes_.size() - 2;
           } else {
-            m.message("CAT::sequentiator::good_first_node: problem: multi-vertex ", node_.c().id(),
-                      " belongs to sequence ", iseq->name(), " but not as first or last cell",
-                      mybhep::NORMAL);
+            MYBHEP_MESSAGE(m, mybhep::NORMAL,
+                           "CAT::sequentiator::good_first_node: problem: multi-vertex ",
+                           node_.c().id(), " belongs to sequence ", iseq->name(),
+                           " but not as first or last cell");
             continue;
           }
           // add to done_connections cell ids of those cells
@@ -2061,20 +2097,20 @@ bool sequentiator::good_first_node(topology::node &node_) {
     for (size_t i = 0; i < done_connections.size(); i++) {
       cc_index = 0;
       if (!node_.has_couplet(done_connections[i], &cc_index))
-        m.message("CAT::sequentiator::good_first_node: problem: multi-vertex ", node_.c().id(),
-                  " should link to cell ", done_connections[i], " but has not such couplet",
-                  mybhep::NORMAL);
+        MYBHEP_MESSAGE(m, mybhep::NORMAL,
+                       "CAT::sequentiator::good_first_node: problem: multi-vertex ", node_.c().id(),
+                       " should link to cell ", done_connections[i], " but has not such couplet");
       else {
-        m.message("CAT::sequentiator::good_first_node: multi-vertex ", node_.c().id(),
-                  " has already been added to a sequence connecting to cell ", done_connections[i],
-                  " so couplet ", cc_index, " will be erased", mybhep::VERBOSE);
+        MYBHEP_MESSAGE(m, mybhep::VERBOSE, "CAT::sequentiator::good_first_node: multi-vertex ",
+                       node_.c().id(), " has already been added to a sequence connecting to cell ",
+                       done_connections[i], " so couplet ", cc_index, " will be erased");
         // node_.cc_.erase(node_.cc_.begin() + cc_index);
         node_.remove_couplet(cc_index);
       }
     }
   }
 
-  clock.stop(" sequentiator: good first node ");
+  clock.stop(probes_.good_first_node);
   return true;
 }
 
@@ -3544,9 +3580,9 @@ void sequentiator::add_pair(const topology::sequence &newsequence) {
         iccc->set_all_used();
     }
 
-    clock.start(" sequentiator: set free level ", "cumulative");
+    clock.start(probes_.set_free_level);
     pair.set_free_level();
-    clock.stop(" sequentiator: set free level ");
+    clock.stop(probes_.set_free_level);
 
     make_name(pair);
     sequences_.push_back(pair);
@@ -458,6 +458,25 @@ class sequentiator {
   std::vector<std::vector<size_t> > families_;
   std::vector<topology::scenario> scenarios_;
 
+  // clocks of the steps of the evolution of the sequences, started and
+  // stopped by handle rather than by name
+  struct clock_probes {
+    Clock::handle set_free_level;
+    Clock::handle get_link_index;
+    Clock::handle evolve;
+    Clock::handle evolve_part_A;
+    Clock::handle evolve_part_B;
+    Clock::handle evolve_part_B_set_free_level;
+    Clock::handle evolve_part_B_noc;
+    Clock::handle evolve_part_C;
+    Clock::handle increase_iterations;
+    Clock::handle good_first_node;
+  };
+  clock_probes probes_;
+
+  // register the clocks of the probes
+  void register_clock_probes();
+
   bool make_scenarios(topology::tracked_data &td, bool after_sultan = false);
   void interpret_physics(std::vector<topology::calorimeter_hit> &calos);
   void interpret_physics_after_sultan(std::vector<topology::calorimeter_hit> &calos,
@@ -24,6 +24,25 @@
 #include <iostream>
 #include <fstream>
 
+/// Most detailed print level compiled in
+/** Messages of a more detailed level are removed at compile time, whatever
+ * the level set at run time, e.g. -DMYBHEP_MESSENGER_MAX_LEVEL=mybhep::NORMAL
+ */
+#ifndef MYBHEP_MESSENGER_MAX_LEVEL
+#define MYBHEP_MESSENGER_MAX_LEVEL mybhep::DUMP
+#endif
+
+/// Sends a message through a messenger only if its level is enabled
+/** Unlike a direct call to message, the message and variables are not
+ * evaluated when the level is filtered out:
+ * MYBHEP_MESSAGE(m, mybhep::VVERBOSE, "distance", d.value());
+ */
+#define MYBHEP_MESSAGE(the_messenger, the_level, ...)                 \
+  do {                                                                \
+    if ((the_messenger).enabled(the_level))                           \
+      (the_messenger).message(__VA_ARGS__, the_level);                \
+  } while (0)
+
 namespace mybhep {
 /// Simple messenger class
 /**
@@ -31,7 +50,9 @@ namespace mybhep {
  *at construction time or any time later via the set_level method. The
  *message structure is:
  * message(string,Ta,Tb,Tc....,LEVEL) where Ta, Tb,Tc... are templated types
- *and level is the level of information for which this message will be output
+ *and level is the level of information for which this message will be output.
+ *In loops, the MYBHEP_MESSAGE macro avoids forming the message when its
+ *level is filtered out
  *\ingroup base
  */
 class messenger {
@@ -47,6 +68,10 @@ class messenger {
   void set_level(prlevel clevel) { level_ = clevel; }
   /// Returns the print level
   prlevel level() const { return level_; }
+  /// Most detailed print level compiled in
+  static constexpr prlevel max_level = MYBHEP_MESSENGER_MAX_LEVEL;
+  /// Checks whether messages of a given print level are output
+  inline bool enabled(prlevel clevel) const { return clevel <= max_level && clevel <= level_; }
   /// Sends a message
   /** The specified print level must be equal or smaller than the print level
    * set to the messenger. For example, if the messenger is set to VVERBOSE
@@ -54,17 +79,18 @@ class messenger {
    * only messages flagged as MUTE will print
    *\ingroup base
    */
-  inline void message(const std::string& the_message, prlevel clevel) const {
-    if (clevel <= level_) std::clog << the_message << std::endl;
+  template <class M>
+  inline void message(const M& the_message, prlevel clevel) const {
+    if (enabled(clevel)) std::clog << the_message << std::endl;
   }
   /// Sends a message followed by variable d
   /** The specified print level must be equal or smaller than the print level
    * set to the messenger.
    *\ingroup base
    */
-  template <class T>
-  inline void message(const std::string& the_message, const T& d, prlevel clevel) const {
-    if (clevel <= level_) std::clog << the_message << " " << d << std::endl;
+  template <class M, class T>
+  inline void message(const M& the_message, const T& d, prlevel clevel) const {
+    if (enabled(clevel)) std::clog << the_message << " " << d << std::endl;
   }
 
   /// Sends a message followed by variable d1 and d2
@@ -72,20 +98,20 @@ class messenger {
    * set to the messenger.
    *\ingroup base
    */
-  template <class A, class B>
-  inline void message(const std::string& the_message, const A& d1, const B& d2,
+  template <class M, class A, class B>
+  inline void message(const M& the_message, const A& d1, const B& d2,
                       prlevel clevel) const {
-    if (clevel <= level_) std::clog << the_message << " " << d1 << " " << d2 << std::endl;
+    if (enabled(clevel)) std::clog << the_message << " " << d1 << " " << d2 << std::endl;
   }
   /// Sends a message followed by variable d1 d2 and d3
   /** The specified print level must be equal or smaller than the print level
    * set to the messenger.
    *\ingroup base
    */
-  template <class A, class B, class C>
-  inline void message(const std::string& the_message, const A& d1, const B& d2, const C& d3,
+  template <class M, class A, class B, class C>
+  inline void message(const M& the_message, const A& d1, const B& d2, const C& d3,
                       prlevel clevel) const {
-    if (clevel <= level_)
+    if (enabled(clevel))
       std::clog << the_message << " " << d1 << " " << d2 << " " << d3 << std::endl;
   }
   /// Sends a message followed by variable d1 d2, d3 and d4
@@ -93,10 +119,10 @@ class messenger {
    * set to the messenger.
    *\ingroup base
    */
-  template <class A, class B, class C, class D>
-  inline void message(const std::string& the_message, const A& d1, const B& d2, const C& d3,
+  template <class M, class A, class B, class C, class D>
+  inline void message(const M& the_message, const A& d1, const B& d2, const C& d3,
                       const D& d4, prlevel clevel) const {
-    if (clevel <= level_)
+    if (enabled(clevel))
       std::clog << the_message << " " << d1 << " " << d2 << " " << d3 << " " << d4 << std::endl;
   }
   /// Sends a message followed by variable d1 d2, d3 d4 and d5
@@ -104,10 +130,10 @@ class messenger {
    * set to the messenger.
    *\ingroup base
    */
-  template <class A, class B, class C, class D, class E>
-  inline void message(const std::string& the_message, const A& d1, const B& d2, const C& d3,
+  template <class M, class A, class B, class C, class D, class E>
+  inline void message(const M& the_message, const A& d1, const B& d2, const C& d3,
                       const D& d4, const E& d5, prlevel clevel) const {
-    if (clevel <= level_)
+    if (enabled(clevel))
       std::clog << the_message << " " << d1 << " " << d2 << " " << d3 << " " << d4 << " " << d5
                 << std::endl;
   }
@@ -117,10 +143,10 @@ class messenger {
    * set to the messenger.
    *\ingroup base
    */
-  template <class A, class B, class C, class D, class E, class F>
-  inline void message(const std::string& the_message, const A& d1, const B& d2, const C& d3,
+  template <class M, class A, class B, class C, class D, class E, class F>
+  inline void message(const M& the_message, const A& d1, const B& d2, const C& d3,
                       const D& d4, const E& d5, const F& d6, prlevel clevel) const {
-    if (clevel <= level_)
+    if (enabled(clevel))
       std::clog << the_message << " " << d1 << " " << d2 << " " << d3 << " " << d4 << " " << d5
                 << " " << d6 << std::endl;
   }
@@ -129,10 +155,10 @@ class messenger {
    * set to the messenger.
    *\ingroup base
    */
-  template <class A, class B, class C, class D, class E, class F, class G>
-  inline void message(const std::string& the_message, const A& d1, const B& d2, const C& d3,
+  template <class M, class A, class B, class C, class D, class E, class F, class G>
+  inline void message(const M& the_message, const A& d1, const B& d2, const C& d3,
                       const D& d4, const E& d5, const F& d6, const G& d7, prlevel clevel) const {
-    if (clevel <= level_)
+    if (enabled(clevel))
       std::clog << the_message << " " << d1 << " " << d2 << " " << d3 << " " << d4 << " " << d5
                 << " " << d6 << " " << d7 << std::endl;
   }
@@ -141,11 +167,11 @@ class messenger {
    * set to the messenger.
    *\ingroup base
    */
-  template <class A, class B, class C, class D, class E, class F, class G, class H>
-  inline void message(const std::string& the_message, const A& d1, const B& d2, const C& d3,
+  template <class M, class A, class B, class C, class D, class E, class F, class G, class H>
+  inline void message(const M& the_message, const A& d1, const B& d2, const C& d3,
                       const D& d4, const E& d5, const F& d6, const G& d7, const H& d8,
                       prlevel clevel) const {
-    if (clevel <= level_)
+    if (enabled(clevel))
       std::clog << the_message << " " << d1 << " " << d2 << " " << d3 << " " << d4 << " " << d5
                 << " " << d6 << " " << d7 << " " << d8 << std::endl;
   }
@@ -154,11 +180,12 @@ class messenger {
    * set to the messenger.
    *\ingroup base
    */
-  template <class A, class B, class C, class D, class E, class F, class G, class H, class I>
-  inline void message(const std::string& the_message, const A& d1, const B& d2, const C& d3,
+  template <class M, class A, class B, class C, class D, class E, class F, class G, class H,
+            class I>
+  inline void message(const M& the_message, const A& d1, const B& d2, const C& d3,
                       const D& d4, const E& d5, const F& d6, const G& d7, const H& d8, const I& d9,
                       prlevel clevel) const {
-    if (clevel <= level_)
+    if (enabled(clevel))
       std::clog << the_message << " " << d1 << " " << d2 << " " << d3 << " " << d4 << " " << d5
                 << " " << d6 << " " << d7 << " " << d8 << " " << d9 << std::endl;
   }
@@ -167,12 +194,12 @@ class messenger {
    * set to the messenger.
    *\ingroup base
    */
-  template <class A, class B, class C, class D, class E, class F, class G, class H, class I,
-            class J>
-  inline void message(const std::string& the_message, const A& d1, const B& d2, const C& d3,
+  template <class M, class A, class B, class C, class D, class E, class F, class G, class H,
+            class I, class J>
+  inline void message(const M& the_message, const A& d1, const B& d2, const C& d3,
                       const D& d4, const E& d5, const F& d6, const G& d7, const H& d8, const I& d9,
                       const J& d10, prlevel clevel) const {
-    if (clevel <= level_)
+    if (enabled(clevel))
       std::clog << the_message << " " << d1 << " " << d2 << " " << d3 << " " << d4 << " " << d5
                 << " " << d6 << " " << d7 << " " << d8 << " " << d9 << " " << d10 << std::endl;
   }
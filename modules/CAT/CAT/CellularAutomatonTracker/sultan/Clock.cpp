@@ -15,18 +15,15 @@ Clock::~Clock() { return; }
 
 void Clock::dump(ostream & /* a_out */, const std::string & /* a_title */,
                  const std::string & /* a_indent */, bool /* a_inherit */) const {
-  // Trick to workaround the constness of the dump method :
-  // because 'this' is const, we cannot modify/sort the 'clockables_' STL collection,
-  // so we use 'mutable_this' :
-  Clock *mutable_this = const_cast<Clock *>(this);
-  if (mutable_this->clockables_.size()) {
-    std::sort(mutable_this->clockables_.begin(), mutable_this->clockables_.end(),
-              clockable::compare);
-
-    double max = clockables_.begin()->time_;
-
-    for (size_t i = 0; i < clockables_.size(); i++) {
-      this->clockables_[i].dump(max);
+  // Sort a copy, so that the handles of the clockables stay valid
+  std::vector<clockable> sorted(clockables_);
+  if (sorted.size()) {
+    std::sort(sorted.begin(), sorted.end(), clockable::compare);
+
+    double max = sorted.begin()->time_;
+
+    for (size_t i = 0; i < sorted.size(); i++) {
+      sorted[i].dump(max);
     }
   }
   return;
@@ -91,6 +88,15 @@ void Clock::stop(const std::string &name) {
               << "' which is not there " << std::endl;
 }
 
+Clock::handle Clock::probe(const std::string &name) {
+  size_t index = 0;
+  if (!has(name, &index)) {
+    index = clockables_.size();
+    clockables_.push_back(clockable(name));
+  }
+  return index;
+}
+
 double Clock::read(const std::string &name) {
   size_t index;
   if (has(name, &index)) return clockables()[index].read();
@@ -100,6 +100,7 @@ int calorimeter_hit::user_id() const { return user_id_; }
 double calorimeter_hit::layer() const { return layer_; }
 
 bool calorimeter_hit::same_calo(const calorimeter_hit& c) const {
+  experimental_double::value_only_scope value_only;
   double dist = (experimental_vector(pl().center(), c.pl().center())).length().value();
 
   if (dist < 0.1) return true;
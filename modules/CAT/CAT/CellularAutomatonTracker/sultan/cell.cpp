@@ -17,6 +17,9 @@ bool cell::intersect(cell c) const {
   // fraction of radius after which cells intersect
   double fraction_limit = 1.;
 
+  // only values are compared
+  experimental_double::value_only_scope value_only;
+
   // horizontal distance between cell centers
   double dist = experimental_vector(ep(), c.ep()).hor().length().value();
 
@@ -10,6 +10,14 @@ namespace topology {
 
 using namespace std;
 
+namespace {
+// error of the results of value-only operations
+const double no_error = std::numeric_limits<double>::quiet_NaN();
+}  // namespace
+
+thread_local bool experimental_double::propagate_errors_ = true;
+thread_local bool experimental_double::value_only_enabled_ = true;
+
 bool experimental_double::is_valid() const { return is_value_valid() && is_error_valid(); }
 
 bool experimental_double::is_value_valid() const { return v_ == v_; }
@@ -69,7 +77,8 @@ const double& experimental_double::error() const { return e_; }
 experimental_double& experimental_double::operator+=(const experimental_double& p2) {
   experimental_double& p1 = *this;
   double val = p1.value() + p2.value();
-  double err = std::sqrt(std::pow(p1.error(), 2) + std::pow(p2.error(), 2));
+  double err =
+      propagate_errors_ ? std::sqrt(std::pow(p1.error(), 2) + std::pow(p2.error(), 2)) : no_error;
   p1.set_value(val);
   p1.set_error(err);
   return p1;
@@ -79,7 +88,8 @@ experimental_double& experimental_double::operator+=(const experimental_double&
 experimental_double& experimental_double::operator-=(const experimental_double& p2) {
   experimental_double& p1 = *this;
   double val = p1.value() - p2.value();
-  double err = std::sqrt(std::pow(p1.error(), 2) + std::pow(p2.error(), 2));
+  double err =
+      propagate_errors_ ? std::sqrt(std::pow(p1.error(), 2) + std::pow(p2.error(), 2)) : no_error;
   p1.set_value(val);
   p1.set_error(err);
 
@@ -90,7 +100,9 @@ experimental_double& experimental_double::operator-=(const experimental_double&
 experimental_double& experimental_double::operator*=(experimental_double a) {
   experimental_double& p1 = *this;
   double val = p1.value() * a.value();
-  double err = std::sqrt(std::pow(a.value() * p1.error(), 2) + std::pow(p1.value() * a.error(), 2));
+  double err = propagate_errors_ ? std::sqrt(std::pow(a.value() * p1.error(), 2) +
+                                             std::pow(p1.value() * a.error(), 2))
+                                 : no_error;
 
   p1.set_value(val);
   p1.set_error(err);
@@ -119,8 +131,10 @@ experimental_double& experimental_double::operator/=(experimental_double a) {
   }
 
   double val = p1.value() / a.value();
-  double err = std::sqrt(std::pow(p1.error() / a.value(), 2) +
-                         std::pow(p1.value() * a.error() / std::pow(a.value(), 2), 2));
+  double err = propagate_errors_
+                   ? std::sqrt(std::pow(p1.error() / a.value(), 2) +
+                               std::pow(p1.value() * a.error() / std::pow(a.value(), 2), 2))
+                   : no_error;
   p1.set_value(val);
   p1.set_error(err);
   return p1;
@@ -248,10 +262,11 @@ bool experimental_double::is_equal_to__optimist(const experimental_double a,
 }
 
 bool experimental_double::is_zero__optimist(double nsigmas = 1) const {
-  topology::experimental_double zero(0., 0.);
-  experimental_double magn = experimental_fabs(*this);
-
-  return magn.is_less_than__optimist(zero, nsigmas);
+  // |this| is_less_than__optimist (0 +- 0), without the temporaries:
+  // the difference is |v| +- sqrt(e^2 + 0^2)
+  double delta_error = std::sqrt(std::pow(e_, 2) + std::pow(0., 2));
+  if (std::abs(v_) > nsigmas * delta_error) return false;
+  return true;
 }
 
 bool experimental_double::experimental_isnan() const {
@@ -268,7 +283,8 @@ bool experimental_double::experimental_isinf() const {
 experimental_double experimental_sin(const experimental_double& v1) {
   experimental_double v;
   v.set_value(sin(v1.value()));
-  v.set_error(std::abs(cos(v1.value())) * v1.error());
+  v.set_error(experimental_double::propagates_errors() ? std::abs(cos(v1.value())) * v1.error()
+                                                       : no_error);
   return v;
 }
 
@@ -276,7 +292,8 @@ experimental_double experimental_sin(const experimental_double& v1) {
 experimental_double experimental_cos(const experimental_double& v1) {
   experimental_double v;
   v.set_value(cos(v1.value()));
-  v.set_error(std::abs(sin(v1.value())) * v1.error());
+  v.set_error(experimental_double::propagates_errors() ? std::abs(sin(v1.value())) * v1.error()
+                                                       : no_error);
   return v;
 }
 
@@ -284,7 +301,9 @@ experimental_double experimental_cos(const experimental_double& v1) {
 experimental_double experimental_tan(const experimental_double& v1) {
   experimental_double v;
   v.set_value(tan(v1.value()));
-  v.set_error((1. + std::pow(v.value(), 2)) * v1.error());
+  v.set_error(experimental_double::propagates_errors()
+                  ? (1. + std::pow(v.value(), 2)) * v1.error()
+                  : no_error);
   return v;
 }
 
@@ -292,7 +311,9 @@ experimental_double experimental_tan(const experimental_double& v1) {
 experimental_double experimental_asin(const experimental_double& v1) {
   experimental_double v;
   v.set_value(asin(v1.value()));
-  v.set_error(v1.error() / std::sqrt(1 - std::pow(v1.value(), 2)));
+  v.set_error(experimental_double::propagates_errors()
+                  ? v1.error() / std::sqrt(1 - std::pow(v1.value(), 2))
+                  : no_error);
   return v;
 }
 
@@ -300,7 +321,9 @@ experimental_double experimental_asin(const experimental_double& v1) {
 experimental_double experimental_acos(const experimental_double& v1) {
   experimental_double v;
   v.set_value(acos(v1.value()));
-  v.set_error(v1.error() / std::sqrt(1 - std::pow(v1.value(), 2)));
+  v.set_error(experimental_double::propagates_errors()
+                  ? v1.error() / std::sqrt(1 - std::pow(v1.value(), 2))
+                  : no_error);
   return v;
 }
 
@@ -310,7 +333,9 @@ experimental_double experimental_atan2(const experimental_double& v1,
   experimental_double v;
   v.set_value(atan2(v1.value(), v2.value()));
 
-  if (v2.value() == 0.) {  // if angle = 90 degrees,
+  if (!experimental_double::propagates_errors()) {
+    v.set_error(no_error);
+  } else if (v2.value() == 0.) {  // if angle = 90 degrees,
     // obtain error from angle = 180 - (other angle)
     double den = 1 + std::pow(v2.value() / v1.value(), 2);
     double num = std::pow(v2.error() / v1.value(), 2) +
@@ -329,7 +354,8 @@ experimental_double experimental_atan2(const experimental_double& v1,
 experimental_double experimental_square(const experimental_double& v1) {
   experimental_double v;
   v.set_value(std::pow(v1.value(), 2));
-  v.set_error(2 * std::abs(v1.value()) * v1.error());
+  v.set_error(experimental_double::propagates_errors() ? 2 * std::abs(v1.value()) * v1.error()
+                                                       : no_error);
   return v;
 }
 
@@ -337,7 +363,7 @@ experimental_double experimental_square(const experimental_double& v1) {
 experimental_double experimental_sqrt(const experimental_double& v1) {
   experimental_double v;
   v.set_value(std::sqrt(v1.value()));
-  v.set_error(v1.error() / (2 * v.value()));
+  v.set_error(experimental_double::propagates_errors() ? v1.error() / (2 * v.value()) : no_error);
   return v;
 }
 
@@ -345,7 +371,8 @@ experimental_double experimental_sqrt(const experimental_double& v1) {
 experimental_double experimental_cube(const experimental_double& v1) {
   experimental_double v;
   v.set_value(pow(v1.value(), 3));
-  v.set_error(3 * std::pow(v1.value(), 2) * v1.error());
+  v.set_error(experimental_double::propagates_errors() ? 3 * std::pow(v1.value(), 2) * v1.error()
+                                                       : no_error);
   return v;
 }
 
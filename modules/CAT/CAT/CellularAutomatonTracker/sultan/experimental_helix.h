@@ -170,6 +170,11 @@ class experimental_helix : public tracking_object {
   void get_phi_of_point(topology::experimental_point input_p, topology::experimental_point *p,
                         double *angle);
 
+  // angle of a point wrt the circle center, without its position on the helix
+  double get_phi_of_point(const topology::experimental_point &input_p) const {
+    return atan2(input_p.y().value() - y0().value(), input_p.x().value() - x0().value());
+  }
+
   bool is_less_than__optimist(const topology::experimental_helix a, double nsigma) const;
 
   bool is_more_than__optimist(const topology::experimental_helix a, double nsigma) const;
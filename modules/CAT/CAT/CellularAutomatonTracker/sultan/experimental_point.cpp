@@ -1,6 +1,8 @@
 #include <sultan/experimental_point.h>
 #include <mybhep/utilities.h>
 
+#include <limits>
+
 namespace SULTAN {
 
 namespace topology {
@@ -126,6 +128,10 @@ experimental_double experimental_point::distance(const experimental_point &p2) c
   result.set_value(std::sqrt(pow(x_.value() - p2.x().value(), 2) +
                              pow(y_.value() - p2.y().value(), 2) +
                              pow(z_.value() - p2.z().value(), 2)));
+  if (!experimental_double::propagates_errors()) {
+    result.set_error(std::numeric_limits<double>::quiet_NaN());
+    return result;
+  }
   result.set_error(
       std::sqrt(pow(x_.value() * x_.error(), 2) + pow(p2.x().value() * p2.x().error(), 2) +
                 pow(y_.value() * y_.error(), 2) + pow(p2.y().value() * p2.y().error(), 2) +
@@ -141,6 +147,10 @@ experimental_double experimental_point::hor_distance(const experimental_point &p
 
   result.set_value(
       std::sqrt(pow(x_.value() - p2.x().value(), 2) + pow(y_.value() - p2.y().value(), 2)));
+  if (!experimental_double::propagates_errors()) {
+    result.set_error(std::numeric_limits<double>::quiet_NaN());
+    return result;
+  }
   result.set_error(
       std::sqrt(pow(x_.value() * x_.error(), 2) + pow(p2.x().value() * p2.x().error(), 2) +
                 pow(y_.value() * y_.error(), 2) + pow(p2.y().value() * p2.y().error(), 2)) /
@@ -157,6 +167,11 @@ void experimental_point::set_radius() {
 
   double rr = std::sqrt(pow(x_.value(), 2) + pow(y_.value(), 2));
   if (std::isnan(rr)) rr = mybhep::small_neg;
+  if (!experimental_double::propagates_errors()) {
+    radius_.set_value(rr);
+    radius_.set_error(std::numeric_limits<double>::quiet_NaN());
+    return;
+  }
   double err = std::sqrt(pow(x_.value() * x_.error(), 2) + pow(y_.value() * y_.error(), 2)) / rr;
   if (std::isnan(err)) err = mybhep::small_neg;
 
@@ -1,6 +1,8 @@
 /* -*- mode: c++ -*- */
 #include <sultan/experimental_vector.h>
 
+#include <limits>
+
 namespace SULTAN {
 namespace topology {
 
@@ -235,6 +237,10 @@ experimental_double experimental_vector::distance(const experimental_vector& p2)
   result.set_value(std::sqrt(pow(x_.value() - p2.x().value(), 2) +
                              pow(y_.value() - p2.y().value(), 2) +
                              pow(z_.value() - p2.z().value(), 2)));
+  if (!experimental_double::propagates_errors()) {
+    result.set_error(std::numeric_limits<double>::quiet_NaN());
+    return result;
+  }
   result.set_error(
       std::sqrt(pow(x_.value() * x_.error(), 2) + pow(p2.x().value() * p2.x().error(), 2) +
                 pow(y_.value() * y_.error(), 2) + pow(p2.y().value() * p2.y().error(), 2) +
@@ -249,6 +255,10 @@ experimental_double experimental_vector::length() const {
   experimental_double result;
 
   result.set_value(std::sqrt(pow(x_.value(), 2) + pow(y_.value(), 2) + pow(z_.value(), 2)));
+  if (!experimental_double::propagates_errors()) {
+    result.set_error(std::numeric_limits<double>::quiet_NaN());
+    return result;
+  }
   result.set_error(std::sqrt(pow(x_.value() * x_.error(), 2) + pow(y_.value() * y_.error(), 2) +
                              pow(z_.value() * z_.error(), 2)) /
                    result.value());
@@ -283,7 +293,9 @@ experimental_double experimental_vector::kink_phi(const experimental_vector& v)
   double phi1 = p1.value();
   double phi2 = p2.value();
   result.set_value(phi2 - phi1);
-  result.set_error(std::sqrt(pow(p1.error(), 2) + pow(p2.error(), 2)));
+  result.set_error(experimental_double::propagates_errors()
+                       ? std::sqrt(pow(p1.error(), 2) + pow(p2.error(), 2))
+                       : std::numeric_limits<double>::quiet_NaN());
 
   return result;
 }
@@ -295,7 +307,9 @@ experimental_double experimental_vector::kink_theta(const experimental_vector& v
   double theta1 = t1.value();
   double theta2 = t2.value();
   result.set_value(theta2 - theta1);
-  result.set_error(std::sqrt(pow(t1.error(), 2) + pow(t2.error(), 2)));
+  result.set_error(experimental_double::propagates_errors()
+                       ? std::sqrt(pow(t1.error(), 2) + pow(t2.error(), 2))
+                       : std::numeric_limits<double>::quiet_NaN());
 
   return result;
 }
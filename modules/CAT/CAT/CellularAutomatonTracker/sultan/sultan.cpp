@@ -1,9 +1,13 @@
 #include "sultan/sultan.h"
 
+#include <algorithm>
+#include <array>
 #include <vector>
 #include <cmath>
+#include <map>
 #include <sstream>
 #include <limits>
+#include <utility>
 #include <sys/time.h>
 
 #include <mybhep/system_of_units.h>
@@ -13,11 +17,20 @@ namespace SULTAN {
 using namespace std;
 using namespace mybhep;
 
+namespace {
+// value of the horizontal distance of the cells, as experimental_point::hor_distance
+double cell_hor_distance(const topology::cell &a, const topology::cell &b) {
+  return std::sqrt(pow(a.ep().x().value() - b.ep().x().value(), 2) +
+                   pow(a.ep().y().value() - b.ep().y().value(), 2));
+}
+}  // namespace
+
 //************************************************************
 // Default constructor :
 sultan::sultan(void) {
   //*************************************************************
   _set_defaults();
+  register_clock_probes();
   return;
 }
 
@@ -26,6 +39,22 @@ sultan::~sultan() {
   //*************************************************************
 }
 
+//*************************************************************
+void sultan::register_clock_probes() {
+  //*************************************************************
+  probes_.form_triplets_from_cells = clock.probe(" sultan: form_triplets_from_cells ");
+  probes_.form_helices_from_triplets = clock.probe(" sultan: form_helices_from_triplets ");
+  probes_.assign_nodes_based_on_experimental_helix =
+      clock.probe(" sultan: assign_nodes_based_on_experimental_helix ");
+  probes_.get_helix_cluster_from = clock.probe(" sultan: get_helix_cluster_from ");
+  probes_.add_cells_to_helix_cluster_from =
+      clock.probe(" sultan: add_cells_to_helix_cluster_from ");
+  probes_.helix_is_near_cell = clock.probe(" sultan: helix_is_near_cell ");
+  probes_.get_line_cluster_from = clock.probe(" sultan: get_line_cluster_from ");
+  probes_.add_cells_to_line_cluster_from = clock.probe(" sultan: add_cells_to_line_cluster_from ");
+  return;
+}
+
 void sultan::_set_defaults() {
   bfield = std::numeric_limits<double>::quiet_NaN();
   nsigmas = std::numeric_limits<double>::quiet_NaN();
@@ -422,6 +451,7 @@ void sultan::reduce_clusters() {
     // initialize clusters
     *full_cluster_ = *icluster;
     *leftover_cluster_ = *full_cluster_;
+    make_triplet_window(full_cluster_->nodes_, triplet_window_);
     status();
     m.message("SULTAN::sultan::reduce_clusters: prepare to reduce cluster ",
               icluster - clusters_.begin(), " of ", clusters_.size(), " having",
@@ -446,6 +476,7 @@ void sultan::reduce_clusters() {
       // sequentiate_cluster_with_experimental_vector_4(a_cluster, icluster - clusters_.begin());
     }
   }
+  triplet_window_.clear();
 
   if (use_endpoints && assign_helices_to_clusters_) {
     assign_helices_to_clusters();
@@ -592,7 +623,7 @@ bool sultan::assign_nodes_based_on_experimental_helix(
     topology::experimental_helix *b, std::vector<topology::experimental_helix> *helices) {
   //*************************************************************
 
-  if (use_clocks) clock.start(" sultan: assign_nodes_based_on_experimental_helix ", "cumulative");
+  if (use_clocks) clock.start(probes_.assign_nodes_based_on_experimental_helix);
 
   topology::experimental_double dr, dh;
   topology::cluster assigned_cluster;
@@ -675,12 +706,14 @@ bool sultan::assign_nodes_based_on_experimental_helix(
     // add cluster to list of clusters
     made_clusters_.push_back(assigned_cluster);
     leftover_cluster_->remove_nodes(assigned_cluster.nodes());
-    m.message("SULTAN::sultan::sequentiate_cluster_with_experimental_vector:  finished cluster [",
-              made_clusters_.size() - 1, "] with ", assigned_cluster.nodes_.size(), " nodes, so ",
-              leftover_cluster_->nodes_.size(), " remain unassigned", mybhep::VERBOSE);
+    MYBHEP_MESSAGE(
+        m, mybhep::VERBOSE,
+        "SULTAN::sultan::sequentiate_cluster_with_experimental_vector:  finished cluster [",
+        made_clusters_.size() - 1, "] with ", assigned_cluster.nodes_.size(), " nodes, so ",
+        leftover_cluster_->nodes_.size(), " remain unassigned");
   }
 
-  if (use_clocks) clock.stop(" sultan: assign_nodes_based_on_experimental_helix ");
+  if (use_clocks) clock.stop(probes_.assign_nodes_based_on_experimental_helix);
 
   return ok;
 }
@@ -690,7 +723,7 @@ bool sultan::assign_nodes_based_on_experimental_helix(topology::experimental_hel
                                                       std::vector<size_t> *neighbouring_cells) {
   //*************************************************************
 
-  if (use_clocks) clock.start(" sultan: assign_nodes_based_on_experimental_helix ", "cumulative");
+  if (use_clocks) clock.start(probes_.assign_nodes_based_on_experimental_helix);
 
   topology::experimental_double dr, dh;
   vector<topology::node> leftover_nodes_copy = leftover_cluster_->nodes_;
@@ -748,13 +781,14 @@ bool sultan::assign_nodes_based_on_experimental_helix(topology::experimental_hel
 
   bool ok = check_continous_cells(&assigned_cluster, b);
 
-  m.message("SULTAN::sultan::assign_nodes_based_on_experimental_helix: associated ",
-            assigned_cluster_->nodes_.size(), " nodes to this helix out of ",
-            full_cluster_->nodes_.size(), " so ", leftover_cluster_->nodes_.size(),
-            " remain unassigned - initially there were ", leftover_nodes_copy.size(),
-            " -, continous ", ok, mybhep::VERBOSE);
+  MYBHEP_MESSAGE(m, mybhep::VERBOSE,
+                 "SULTAN::sultan::assign_nodes_based_on_experimental_helix: associated ",
+                 assigned_cluster_->nodes_.size(), " nodes to this helix out of ",
+                 full_cluster_->nodes_.size(), " so ", leftover_cluster_->nodes_.size(),
+                 " remain unassigned - initially there were ", leftover_nodes_copy.size(),
+                 " -, continous ", ok);
 
-  if (use_clocks) clock.stop(" sultan: assign_nodes_based_on_experimental_helix ");
+  if (use_clocks) clock.stop(probes_.assign_nodes_based_on_experimental_helix);
 
   return ok && (leftover_cluster_->nodes_.size() < leftover_nodes_copy.size()) &&
          (assigned_cluster_->nodes_.size());
@@ -856,117 +890,199 @@ bool sultan::form_triplets_from_cells(bool after_cat) {
   // to produce triplets (A, B, C) such that
   // the distances A-B and B-C are in specified range
 
-  if (use_clocks) clock.start(" sultan: form_triplets_from_cells ", "cumulative");
+  if (use_clocks) clock.start(probes_.form_triplets_from_cells);
 
   reset_triplets();
 
-  m.message("SULTAN::sultan::form_triplets_from_cells: calculate triples for ",
-            leftover_cluster_->nodes_.size(), " nodes, minimum ", min_ncells_in_cluster,
-            " min layer in triplet ", min_layer_for_triplet, mybhep::VVERBOSE);
+  MYBHEP_MESSAGE(m, mybhep::VVERBOSE,
+                 "SULTAN::sultan::form_triplets_from_cells: calculate triples for ",
+                 leftover_cluster_->nodes_.size(), " nodes, minimum ", min_ncells_in_cluster,
+                 " min layer in triplet ", min_layer_for_triplet);
 
   if (leftover_cluster_->nodes_.size() < min_ncells_in_cluster) {
     // not enough cells to form a cluster
-    if (use_clocks) clock.stop(" sultan: form_triplets_from_cells ");
+    if (use_clocks) clock.stop(probes_.form_triplets_from_cells);
     return false;
   }
 
-  topology::cell_triplet *ccc;
-  topology::experimental_helix best_helix;
+  if (!SuperNemoChannel) {
+    form_triplets_from_blocks(after_cat);
+    if (use_clocks) clock.stop(probes_.form_triplets_from_cells);
+    MYBHEP_MESSAGE(m, mybhep::VERBOSE, "SULTAN::sultan::form_triplets_from_cells: sultan: the ",
+                   leftover_cluster_->nodes_.size(), " cells have been combined into ",
+                   triplets_.size(), " triplets ");
+    return true;
+  }
 
-  std::vector<topology::node> assigned_nodes_best;
-  double distance12 = std::numeric_limits<double>::infinity();
-  double distance23 = std::numeric_limits<double>::infinity();
-  double distance13 = std::numeric_limits<double>::infinity();
-  int block1 = -1, block2 = -1, block3 = -1;
-  double dmin1, dmin2;
-  size_t min_triplet_layer;
+  const std::vector<topology::node> &nodes = leftover_cluster_->nodes_;
 
-  for (std::vector<topology::node>::const_iterator inode = leftover_cluster_->nodes_.begin();
-       inode != leftover_cluster_->nodes_.end() - 2; ++inode) {
-    if (!SuperNemoChannel) block1 = inode->c().block();
+  // slots of the leftover nodes in the window of the cluster under study,
+  // or in a window of their own if it does not hold them all
+  triplet_window local_window;
+  const triplet_window *window = &triplet_window_;
+  std::vector<size_t> slot_of(nodes.size());
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    std::map<size_t, size_t>::const_iterator islot = window->slots.find(nodes[i].c().id());
+    if (islot == window->slots.end()) {
+      make_triplet_window(nodes, local_window);
+      window = &local_window;
+      for (size_t l = 0; l < nodes.size(); ++l) slot_of[l] = l;
+      break;
+    }
+    slot_of[i] = islot->second;
+  }
 
-    if (after_cat) {
-      min_triplet_layer = abs(inode->c().layer());
-      if (min_triplet_layer < min_layer_for_triplet) {
-        m.message(" cell ", inode->c().id(), " layer ", inode->c().layer(),
-                  " cannot be in triplet, min layer ", min_layer_for_triplet, mybhep::VVERBOSE);
-        continue;
+  // position in the leftover nodes of each slot, -1 for cells which have
+  // left them or cannot be in a triplet
+  std::vector<int> position(window->neighbours.size(), -1);
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    if (after_cat && (size_t)abs(nodes[i].c().layer()) < min_layer_for_triplet) {
+      MYBHEP_MESSAGE(m, mybhep::VVERBOSE, " cell ", nodes[i].c().id(), " layer ",
+                     nodes[i].c().layer(), " cannot be in triplet, min layer ",
+                     min_layer_for_triplet);
+      continue;
+    }
+    position[slot_of[i]] = i;
+  }
+
+  // a triplet passing the distance cuts has two pairs of close cells, so one
+  // of its cells is close to the two others: expand the pairs of close cells
+  // of each node, in the node order of the leftover cluster
+  std::vector<std::array<size_t, 3> > candidates;
+  std::vector<size_t> close;
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    if (position[slot_of[i]] < 0) continue;
+    close.clear();
+    for (std::vector<size_t>::const_iterator islot = window->neighbours[slot_of[i]].begin();
+         islot != window->neighbours[slot_of[i]].end(); ++islot) {
+      if (position[*islot] >= 0) close.push_back(position[*islot]);
+    }
+    for (size_t a = 0; a < close.size(); ++a) {
+      for (size_t b = a + 1; b < close.size(); ++b) {
+        std::array<size_t, 3> t = {{i, close[a], close[b]}};
+        std::sort(t.begin(), t.end());
+        candidates.push_back(t);
       }
     }
+  }
+  std::sort(candidates.begin(), candidates.end());
+  candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+  double distance12, distance23, distance13;
+  double dmin1, dmin2;
+  triplets_.reserve(candidates.size());
+  for (std::vector<std::array<size_t, 3> >::const_iterator it = candidates.begin();
+       it != candidates.end(); ++it) {
+    const topology::cell &c1 = nodes[(*it)[0]].c();
+    const topology::cell &c2 = nodes[(*it)[1]].c();
+    const topology::cell &c3 = nodes[(*it)[2]].c();
+    distance12 = cell_hor_distance(c1, c2);
+    distance23 = cell_hor_distance(c2, c3);
+    distance13 = cell_hor_distance(c1, c3);
 
-    for (std::vector<topology::node>::const_iterator jnode = inode + 1;
-         jnode != leftover_cluster_->nodes_.end() - 1; ++jnode) {
-      if (jnode == inode) continue;
+    dmin1 = std::min(distance12, distance13);
+    dmin2 = std::min(distance12, distance23);
+    if (dmin1 == dmin2) dmin2 = std::min(distance13, distance23);
 
-      if (SuperNemoChannel)
-        distance12 = (inode->c().ep().hor_distance(jnode->c().ep())).value();
-      else {
-        block2 = jnode->c().block();
-        m.message(" (triplet ", inode->c().id(), ", ", jnode->c().id(), ", ... ) block1 ", block1,
-                  " block2 ", block2, mybhep::VVERBOSE);
-        if (block1 == block2) continue;
-      }
+    MYBHEP_MESSAGE(m, mybhep::VVERBOSE, " (triplet ", c1.id(), ", ", c2.id(), ", ", c3.id(),
+                   ") dmin1 ", dmin1, " dmin2 ", dmin2);
 
-      if (after_cat) {
-        min_triplet_layer = abs(jnode->c().layer());
-        if (min_triplet_layer < min_layer_for_triplet) {
-          m.message(" cell ", jnode->c().id(), " layer ", jnode->c().layer(),
-                    " cannot be in triplet, min layer ", min_layer_for_triplet, mybhep::VVERBOSE);
-          continue;
-        }
-      }
+    if (dmin1 < dist_limit_inf || dmin1 > dist_limit_sup) continue;
+    if (dmin2 < dist_limit_inf || dmin2 > dist_limit_sup) continue;
 
-      for (std::vector<topology::node>::const_iterator knode = jnode + 1;
-           knode != leftover_cluster_->nodes_.end(); ++knode) {
-        if (knode == inode) continue;
-        if (knode == jnode) continue;
-
-        if (after_cat) {
-          min_triplet_layer = abs(knode->c().layer());
-          if (min_triplet_layer < min_layer_for_triplet) {
-            m.message(" cell ", knode->c().id(), " layer ", knode->c().layer(),
-                      " cannot be in triplet, min layer ", min_layer_for_triplet, mybhep::VVERBOSE);
-            continue;
-          }
-        }
+    triplets_.emplace_back(c1, c2, c3, level);
 
-        if (SuperNemoChannel) {
-          distance23 = (jnode->c().ep().hor_distance(knode->c().ep())).value();
-          distance13 = (inode->c().ep().hor_distance(knode->c().ep())).value();
+    MYBHEP_MESSAGE(m, mybhep::VVERBOSE, " adding triplet, total ", triplets_.size());
+  }
 
-          dmin1 = std::min(distance12, distance13);
-          dmin2 = std::min(distance12, distance23);
-          if (dmin1 == dmin2) dmin2 = std::min(distance13, distance23);
+  if (use_clocks) clock.stop(probes_.form_triplets_from_cells);
 
-          m.message(" (triplet ", inode->c().id(), ", ", jnode->c().id(), ", ", knode->c().id(),
-                    ") dmin1 ", dmin1, " dmin2 ", dmin2, mybhep::VVERBOSE);
+  MYBHEP_MESSAGE(m, mybhep::VERBOSE, "SULTAN::sultan::form_triplets_from_cells: sultan: the ",
+                 leftover_cluster_->nodes_.size(), " cells have been combined into ",
+                 triplets_.size(), " triplets ");
 
-          if (dmin1 < dist_limit_inf || dmin1 > dist_limit_sup) continue;
-          if (dmin2 < dist_limit_inf || dmin2 > dist_limit_sup) continue;
-        } else {
-          block3 = knode->c().block();
-          m.message(" (triplet ", inode->c().id(), ", ", jnode->c().id(), ", ", knode->c().id(),
-                    ") block2 ", block2, " block3 ", block3, mybhep::VVERBOSE);
-          if (block2 == block3) continue;
-        }
+  return true;
+}
 
-        ccc = new topology::cell_triplet(inode->c(), jnode->c(), knode->c(), level);
-        triplets_.push_back(*ccc);
+//*************************************************************
+void sultan::form_triplets_from_blocks(bool after_cat) {
+  //*************************************************************
+  // Nemo3: triplets (A, B, C) such that A-B and B-C are on different blocks
 
-        delete ccc;
+  const std::vector<topology::node> &nodes = leftover_cluster_->nodes_;
+  int block1 = -1, block2 = -1, block3 = -1;
+
+  for (std::vector<topology::node>::const_iterator inode = nodes.begin(); inode != nodes.end() - 2;
+       ++inode) {
+    block1 = inode->c().block();
+    if (after_cat && (size_t)abs(inode->c().layer()) < min_layer_for_triplet) continue;
+
+    for (std::vector<topology::node>::const_iterator jnode = inode + 1; jnode != nodes.end() - 1;
+         ++jnode) {
+      block2 = jnode->c().block();
+      m.message(" (triplet ", inode->c().id(), ", ", jnode->c().id(), ", ... ) block1 ", block1,
+                " block2 ", block2, mybhep::VVERBOSE);
+      if (block1 == block2) continue;
+      if (after_cat && (size_t)abs(jnode->c().layer()) < min_layer_for_triplet) continue;
+
+      for (std::vector<topology::node>::const_iterator knode = jnode + 1; knode != nodes.end();
+           ++knode) {
+        if (after_cat && (size_t)abs(knode->c().layer()) < min_layer_for_triplet) continue;
+
+        block3 = knode->c().block();
+        m.message(" (triplet ", inode->c().id(), ", ", jnode->c().id(), ", ", knode->c().id(),
+                  ") block2 ", block2, " block3 ", block3, mybhep::VVERBOSE);
+        if (block2 == block3) continue;
+
+        triplets_.emplace_back(inode->c(), jnode->c(), knode->c(), level);
 
         m.message(" adding triplet, total ", triplets_.size(), mybhep::VVERBOSE);
       }
     }
   }
+}
 
-  if (use_clocks) clock.stop(" sultan: form_triplets_from_cells ");
-
-  m.message("SULTAN::sultan::form_triplets_from_cells: sultan: the ",
-            leftover_cluster_->nodes_.size(), " cells have been combined into ", triplets_.size(),
-            " triplets ", mybhep::VERBOSE);
-
-  return true;
+//*************************************************************
+void sultan::make_triplet_window(const std::vector<topology::node> &nodes,
+                                 triplet_window &window) const {
+  //*************************************************************
+  // bins of side dist_limit_sup: close cells are in the same or adjacent bins
+
+  window.clear();
+  window.neighbours.resize(nodes.size());
+
+  double bin_size = 1.;
+  if (dist_limit_sup > 0.) bin_size = dist_limit_sup;
+  bool single_bin = std::isinf(dist_limit_sup);
+
+  std::map<std::pair<long, long>, std::vector<size_t> > bins;
+  std::vector<std::pair<long, long> > bin_of(nodes.size());
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    window.slots.insert(std::make_pair(nodes[i].c().id(), i));
+    const topology::experimental_point &p = nodes[i].c().ep();
+    if (!single_bin) {
+      bin_of[i] = std::make_pair((long)std::floor(p.x().value() / bin_size),
+                                 (long)std::floor(p.y().value() / bin_size));
+    }
+    bins[bin_of[i]].push_back(i);
+  }
+
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    for (long bx = bin_of[i].first - 1; bx <= bin_of[i].first + 1; ++bx) {
+      for (long by = bin_of[i].second - 1; by <= bin_of[i].second + 1; ++by) {
+        std::map<std::pair<long, long>, std::vector<size_t> >::const_iterator ibin =
+            bins.find(std::make_pair(bx, by));
+        if (ibin == bins.end()) continue;
+        for (std::vector<size_t>::const_iterator j = ibin->second.begin();
+             j != ibin->second.end(); ++j) {
+          if (*j == i) continue;
+          if (cell_hor_distance(nodes[i].c(), nodes[*j].c()) <= dist_limit_sup) {
+            window.neighbours[i].push_back(*j);
+          }
+        }
+      }
+    }
+  }
 }
 
 //*************************************************************
@@ -989,8 +1105,6 @@ bool sultan::form_triplets_from_cells_with_endpoints() {
     return false;
   }
 
-  topology::cell_triplet *ccc;
-
   const topology::cell A = leftover_cluster_->nodes_.begin()->c();
   const topology::cell C = leftover_cluster_->nodes_.back().c();
 
@@ -1004,10 +1118,7 @@ bool sultan::form_triplets_from_cells_with_endpoints() {
     if (jnode->c().id() == A.id()) continue;
     if (jnode->c().id() == C.id()) continue;
 
-    ccc = new topology::cell_triplet(A, jnode->c(), C, level);
-    triplets_.push_back(*ccc);
-
-    delete ccc;
+    triplets_.emplace_back(A, jnode->c(), C, level);
 
     m.message(" adding triplet, total ", triplets_.size(), mybhep::VVERBOSE);
   }
@@ -1026,15 +1137,16 @@ bool sultan::form_helices_from_triplets(std::vector<topology::experimental_helix
                                         size_t icluster, bool after_cat) {
   //*************************************************************
 
-  if (use_clocks) clock.start(" sultan: form_helices_from_triplets ", "cumulative");
+  if (use_clocks) clock.start(probes_.form_helices_from_triplets);
 
-  m.message("SULTAN::sultan::form_helices_from_triplets:  calculate helices for ", triplets_.size(),
-            " triplets ", mybhep::VVERBOSE);
+  MYBHEP_MESSAGE(m, mybhep::VVERBOSE,
+                 "SULTAN::sultan::form_helices_from_triplets:  calculate helices for ",
+                 triplets_.size(), " triplets ");
 
   the_helices->clear();
 
   if (triplets_.size() == 0) {
-    if (use_clocks) clock.stop(" sultan: form_helices_from_triplets ");
+    if (use_clocks) clock.stop(probes_.form_helices_from_triplets);
     return false;
   }
 
@@ -1132,11 +1244,11 @@ bool sultan::form_helices_from_triplets(std::vector<topology::experimental_helix
 
     the_helices->insert(the_helices->end(), helices.begin(), helices.end());
 
-    m.message("SULTAN::sultan::form_helices_from_triplets:  adding ", helices.size(),
-              " helices, total ", the_helices->size(), mybhep::VVERBOSE);
+    MYBHEP_MESSAGE(m, mybhep::VVERBOSE, "SULTAN::sultan::form_helices_from_triplets:  adding ",
+                   helices.size(), " helices, total ", the_helices->size());
   }
 
-  if (use_clocks) clock.stop(" sultan: form_helices_from_triplets ");
+  if (use_clocks) clock.stop(probes_.form_helices_from_triplets);
 
   if (print_event_display && event_number < 10) {
     if (use_clocks)
@@ -1221,8 +1333,9 @@ bool sultan::form_helices_from_triplets(std::vector<topology::experimental_helix
     if (use_clocks) clock.stop(" sultan: form_helices_from_triplets : print_event_display ");
   }
 
-  m.message("SULTAN::sultan::form_helices_from_triplets:  sultan: the", triplets_.size(),
-            " triplets have given rise to ", the_helices->size(), " helices ", mybhep::VVERBOSE);
+  MYBHEP_MESSAGE(m, mybhep::VVERBOSE, "SULTAN::sultan::form_helices_from_triplets:  sultan: the",
+                 triplets_.size(), " triplets have given rise to ", the_helices->size(),
+                 " helices ");
 
   return true;
 }
@@ -2615,11 +2728,11 @@ topology::cluster sultan::get_helix_cluster_from(topology::cell_triplet t,
                                                  topology::experimental_helix helix) {
   //*************************************************************
   // make a cluster with the nodes intercepted by helix
-  if (use_clocks) clock.start(" sultan: get_helix_cluster_from ", "cumulative");
-  m.message(
+  if (use_clocks) clock.start(probes_.get_helix_cluster_from);
+  MYBHEP_MESSAGE(
+      m, mybhep::VVERBOSE,
       "SULTAN::sultan::get_helix_cluster_from: , make a cluster with the nodes intercepted by "
-      "helix through ",
-      t.ca().id(), " - ", t.cb().id(), " - ", t.cc().id(), mybhep::VVERBOSE);
+      "helix through ", t.ca().id(), " - ", t.cb().id(), " - ", t.cc().id());
 
   topology::cluster c;
   topology::experimental_double DR, DH;
@@ -2655,8 +2768,10 @@ topology::cluster sultan::get_helix_cluster_from(topology::cell_triplet t,
     std::clog << " " << std::endl;
   }
 
-  m.message("SULTAN::sultan::get_helix_cluster_from: , a cluster for the helix has been made with ",
-            c.nodes().size(), " nodes", mybhep::VVERBOSE);
+  MYBHEP_MESSAGE(
+      m, mybhep::VVERBOSE,
+      "SULTAN::sultan::get_helix_cluster_from: , a cluster for the helix has been made with ",
+      c.nodes().size(), " nodes");
 
   if (c.is_good()) {
     // add to cluster from full nodes
@@ -2673,7 +2788,7 @@ topology::cluster sultan::get_helix_cluster_from(topology::cell_triplet t,
     c.nodes_.clear();
   }
 
-  if (use_clocks) clock.stop(" sultan: get_helix_cluster_from ");
+  if (use_clocks) clock.stop(probes_.get_helix_cluster_from);
   return c;
 }
 
@@ -2683,11 +2798,10 @@ topology::cluster sultan::add_cells_to_helix_cluster_from(topology::cluster clus
                                                           topology::experimental_helix helix) {
   //*************************************************************
   // make a cluster with the nodes intercepted by helix
-  if (use_clocks) clock.start(" sultan: add_cells_to_helix_cluster_from ", "cumulative");
-  m.message(
-      "SULTAN::sultan::add_cells_to_helix_cluster_from: , make a cluster with the nodes "
-      "intercepted by helix ",
-      mybhep::VVERBOSE);
+  if (use_clocks) clock.start(probes_.add_cells_to_helix_cluster_from);
+  MYBHEP_MESSAGE(m, mybhep::VVERBOSE,
+                 "SULTAN::sultan::add_cells_to_helix_cluster_from: , make a cluster with the nodes "
+                 "intercepted by helix ");
 
   topology::cluster c = cluster;
   topology::experimental_double DR, DH;
@@ -2716,12 +2830,12 @@ topology::cluster sultan::add_cells_to_helix_cluster_from(topology::cluster clus
     c.nodes_.push_back(*inode);
   }
 
-  m.message(
+  MYBHEP_MESSAGE(
+      m, mybhep::VVERBOSE,
       "SULTAN::sultan::add_cells_to_helix_cluster_from: , a cluster for the helix has been made "
-      "with ",
-      c.nodes().size(), " nodes", mybhep::VVERBOSE);
+      "with ", c.nodes().size(), " nodes");
 
-  if (use_clocks) clock.stop(" sultan: add_cells_to_helix_cluster_from ");
+  if (use_clocks) clock.stop(probes_.add_cells_to_helix_cluster_from);
   return c;
 }
 
@@ -2773,7 +2887,7 @@ bool sultan::helix_is_near_cell(topology::cell_triplet t, topology::experimental
                                 topology::experimental_double *DH, topology::node *node) {
   //*************************************************************
 
-  if (use_clocks) clock.start(" sultan: helix_is_near_cell ", "cumulative");
+  if (use_clocks) clock.start(probes_.helix_is_near_cell);
 
   bool chosen = false;
 
@@ -2782,47 +2896,50 @@ bool sultan::helix_is_near_cell(topology::cell_triplet t, topology::experimental
   // helix.distance_from_cell_center(inode->c(), &DR, &DH);
   helix.distance_from_cell_measurement(node->c(), DR, DH);
 
-  m.message("SULTAN::sultan::helix_is_near_cell: ..., cell ", node->c().id(), " has distance DR ",
-            DR->value(), " +- ", DR->error(), " DH ", DH->value(), " +- ", DH->error(),
-            " from helix ", mybhep::VVERBOSE);
+  MYBHEP_MESSAGE(m, mybhep::VVERBOSE, "SULTAN::sultan::helix_is_near_cell: ..., cell ",
+                 node->c().id(), " has distance DR ", DR->value(), " +- ", DR->error(), " DH ",
+                 DH->value(), " +- ", DH->error(), " from helix ");
 
   if (!DR->is_zero__optimist(nsigma_r)) {
-    if (use_clocks) clock.stop(" sultan: helix_is_near_cell ");
+    if (use_clocks) clock.stop(probes_.helix_is_near_cell);
     return chosen;
   }
   if (!DH->is_zero__optimist(nsigma_z)) {
-    if (use_clocks) clock.stop(" sultan: helix_is_near_cell ");
+    if (use_clocks) clock.stop(probes_.helix_is_near_cell);
     return chosen;
   }
 
   double angle, angle_a, angle_b;
 
-  helix.get_phi_of_point(t.ca().ep(), &p_circle, &angle_a);
-  helix.get_phi_of_point(t.cc().ep(), &p_circle, &angle_b);
+  // angles only: the position of the cell on the helix, with its errors, is
+  // computed for chosen cells
+  angle_a = helix.get_phi_of_point(t.ca().ep());
+  angle_b = helix.get_phi_of_point(t.cc().ep());
   if (angle_a > angle_b) {  // swap, ensure angle_a < angle_b
     angle = angle_a;
     angle_a = angle_b;
     angle_b = angle;
   }
 
-  helix.get_phi_of_point(node->c().ep(), &p_circle, &angle);
+  angle = helix.get_phi_of_point(node->c().ep());
 
   if (angle < angle_a || angle > angle_b) {
-    if (use_clocks) clock.stop(" sultan: helix_is_near_cell ");
+    if (use_clocks) clock.stop(probes_.helix_is_near_cell);
     return chosen;
   }
 
+  p_circle = helix.position(node->c().ep());
   chosen = true;
 
   // cell is close to helix
-  m.message("SULTAN::sultan::helix_is_near_cell: ... ..., cell ", node->c().id(),
-            " is intercepted, angle ", angle, mybhep::VVERBOSE);
+  MYBHEP_MESSAGE(m, mybhep::VVERBOSE, "SULTAN::sultan::helix_is_near_cell: ... ..., cell ",
+                 node->c().id(), " is intercepted, angle ", angle);
 
   // add circle position: in case of helix it is parameter along helix
   node->set_circle_phi(angle);
   node->set_ep(p_circle);
 
-  if (use_clocks) clock.stop(" sultan: helix_is_near_cell ");
+  if (use_clocks) clock.stop(probes_.helix_is_near_cell);
 
   return chosen;
 }
@@ -2831,11 +2948,13 @@ bool sultan::helix_is_near_cell(topology::cell_triplet t, topology::experimental
 topology::cluster sultan::get_line_cluster_from(topology::node a_node, topology::node b_node) {
   //*************************************************************
   // get cluster with cells intercepted by line ab
-  m.message("SULTAN::sultan::get_line_cluster_from: get cluster with cells intercepted by line ab ",
-            a_node.c().id(), "-", b_node.c().id(), " in ", leftover_cluster_->nodes_.size(),
-            " leftover cells ", mybhep::VVERBOSE);
+  MYBHEP_MESSAGE(
+      m, mybhep::VVERBOSE,
+      "SULTAN::sultan::get_line_cluster_from: get cluster with cells intercepted by line ab ",
+      a_node.c().id(), "-", b_node.c().id(), " in ", leftover_cluster_->nodes_.size(),
+      " leftover cells ");
 
-  if (use_clocks) clock.start(" sultan: get_line_cluster_from ", "cumulative");
+  if (use_clocks) clock.start(probes_.get_line_cluster_from);
 
   /////////////////////////////////
   ///   built thick line a->b   ///
@@ -2892,8 +3011,9 @@ topology::cluster sultan::get_line_cluster_from(topology::node a_node, topology:
   b_node.set_circle_phi(1);
   c.nodes_.push_back(b_node);
 
-  m.message("SULTAN::sultan::get_line_cluster_from: the line ", a_node.c().id(), " - ",
-            b_node.c().id(), " intercepts ", c.nodes_.size(), " nodes ", mybhep::VVERBOSE);
+  MYBHEP_MESSAGE(m, mybhep::VVERBOSE, "SULTAN::sultan::get_line_cluster_from: the line ",
+                 a_node.c().id(), " - ", b_node.c().id(), " intercepts ", c.nodes_.size(),
+                 " nodes ");
 
   if (c.is_good()) {
     c = add_cells_to_line_cluster_from(line, a_node.c().id(), b_node.c().id(), c);
@@ -2908,7 +3028,7 @@ topology::cluster sultan::get_line_cluster_from(topology::node a_node, topology:
     c.nodes_.clear();
   }
 
-  if (use_clocks) clock.stop(" sultan: get_line_cluster_from ");
+  if (use_clocks) clock.stop(probes_.get_line_cluster_from);
   return c;
 }
 
@@ -2918,11 +3038,11 @@ topology::cluster sultan::add_cells_to_line_cluster_from(topology::experimental_
                                                          topology::cluster cluster) {
   //*************************************************************
   // add to line (obtained from cluster) cells from full_cluster
-  if (use_clocks) clock.start(" sultan: add_cells_to_line_cluster_from ", "cumulative");
-  m.message(
+  if (use_clocks) clock.start(probes_.add_cells_to_line_cluster_from);
+  MYBHEP_MESSAGE(
+      m, mybhep::VVERBOSE,
       "SULTAN::sultan::add_cells_to_line_cluster_from: get cluster with cells intercepted by line "
-      "ab ",
-      mybhep::VVERBOSE);
+      "ab ");
 
   topology::cluster c = cluster;
 
@@ -2952,16 +3072,18 @@ topology::cluster sultan::add_cells_to_line_cluster_from(topology::experimental_
     if (!chosen) continue;
 
     // cell is close to line
-    m.message("SULTAN::sultan::add_cells_to_line_cluster_from: ... ..., cell ", inode->c().id(),
-              " is intercepted ", mybhep::VVERBOSE);
+    MYBHEP_MESSAGE(m, mybhep::VVERBOSE,
+                   "SULTAN::sultan::add_cells_to_line_cluster_from: ... ..., cell ",
+                   inode->c().id(), " is intercepted ");
 
     c.nodes_.push_back(*inode);
   }
 
-  m.message("SULTAN::sultan::add_cells_to_line_cluster_from: the line intercepts ", c.nodes_.size(),
-            " nodes ", mybhep::VVERBOSE);
+  MYBHEP_MESSAGE(m, mybhep::VVERBOSE,
+                 "SULTAN::sultan::add_cells_to_line_cluster_from: the line intercepts ",
+                 c.nodes_.size(), " nodes ");
 
-  if (use_clocks) clock.stop(" sultan: add_cells_to_line_cluster_from ");
+  if (use_clocks) clock.stop(probes_.add_cells_to_line_cluster_from);
   return c;
 }
 
@@ -8,6 +8,7 @@
 #include <cstdlib>
 #include <cmath>
 #include <limits>
+#include <map>
 
 #include <boost/cstdint.hpp>
 
@@ -414,6 +415,39 @@ class sultan {
   void status();
 
  private:
+  // cells within dist_limit_sup of each other, the only pairs that can be
+  // part of a triplet
+  struct triplet_window {
+    std::map<size_t, size_t> slots;               // slot of each cell, by cell id
+    std::vector<std::vector<size_t> > neighbours;  // slots of the close cells, by slot
+    void clear() {
+      slots.clear();
+      neighbours.clear();
+    }
+  };
+
+  // clocks of the functions called once per cell, cluster or triplet,
+  // started and stopped by handle rather than by name
+  struct clock_probes {
+    Clock::handle form_triplets_from_cells;
+    Clock::handle form_helices_from_triplets;
+    Clock::handle assign_nodes_based_on_experimental_helix;
+    Clock::handle get_helix_cluster_from;
+    Clock::handle add_cells_to_helix_cluster_from;
+    Clock::handle helix_is_near_cell;
+    Clock::handle get_line_cluster_from;
+    Clock::handle add_cells_to_line_cluster_from;
+  };
+
+  // register the clocks of the probes
+  void register_clock_probes();
+
+  // form the Nemo3 triplets of the leftover cluster, from cells on different blocks
+  void form_triplets_from_blocks(bool after_cat);
+
+  // fill the window of a set of nodes, binning their cells on a 2D grid
+  void make_triplet_window(const std::vector<topology::node> &nodes, triplet_window &window) const;
+
   // vector of clusters of neighbouring cells (input)
   std::vector<topology::cluster> clusters_;
 
@@ -441,6 +475,12 @@ class sultan {
   // cluster of neighbouring cells under study: leftover hits
   topology::cluster *leftover_cluster_;
 
+  // window of the cluster under study, reused while its leftover hits shrink
+  triplet_window triplet_window_;
+
+  // handles of the clocks of the functions called in loops
+  clock_probes probes_;
+
   // cluster of neighbouring cells under study: assigned hits
   topology::cluster *assigned_cluster_;
 
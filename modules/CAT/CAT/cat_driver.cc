@@ -4,8 +4,10 @@
 #include <CAT/cat_driver.h>
 
 // Standard library:
+#include <algorithm>
 #include <sstream>
 #include <stdexcept>
+#include <vector>
 
 // Third party:
 // - Boost :
@@ -19,6 +21,7 @@
 #include <geomtools/manager.h>
 
 // This project :
+#include <CAT/helix_seed.h>
 #include <falaise/snemo/datamodels/tracker_clustering_data.h>
 #include <falaise/snemo/geometry/calo_locator.h>
 #include <falaise/snemo/geometry/gg_locator.h>
@@ -74,6 +77,7 @@ void cat_driver::reset() {
   _CAT_clusterizer_.finalize();
   _CAT_sequentiator_.finalize();
   _CAT_setup_.reset();
+  _cluster_pool_.clear();
   _set_defaults();
   this->base_tracker_clusterizer::_reset();
 }
@@ -249,6 +253,9 @@ int cat_driver::_process_algo(const base_tracker_clusterizer::hit_collection_typ
   namespace ct = CAT::topology;
   namespace sdm = snemo::datamodel;
 
+  // Clusters of previous events can now be reused:
+  _cluster_pool_.recycle();
+
   // CAT input data model :
   _CAT_input_.cells.clear();
   if (_CAT_input_.cells.capacity() < gg_hits_.size()) {
@@ -256,34 +263,40 @@ int cat_driver::_process_algo(const base_tracker_clusterizer::hit_collection_typ
   }
   size_t ihit = 0;
 
-  // Hit accounting :
-  std::map<int, sdm::TrackerHitHdl> hits_mapping;
-  std::map<int, int> hits_status;
+  // Columns of the hit values of the event, shared by the clusterizer base :
+  const sdm::tracker_hit_view& hv = _get_hit_view();
+  const snemo::geometry::gg_locator& gg_locator = get_gg_locator();
+  const uint32_t gg_cell_type = gg_locator.getCellType();
+  const int32_t gg_module = static_cast<int32_t>(gg_locator.getModuleNumber());
+
+  // Hit accounting, indexed by CAT cell id :
+  std::vector<sdm::TrackerHitHdl> hits_mapping;
+  hits_mapping.reserve(gg_hits_.size());
+  std::vector<int> hits_status;
+  hits_status.reserve(gg_hits_.size());
 
   // GG hit loop :
-  BOOST_FOREACH (const sdm::TrackerHitHdl& gg_handle, gg_hits_) {
+  for (const sdm::TrackerHitHdl& gg_handle : gg_hits_) {
     // Skip NULL handle :
-    if (!gg_handle) {
+    if (!gg_handle.has_data()) {
       continue;
     }
-
-    // Get a const reference on the calibrated Geiger hit :
-    const sdm::calibrated_tracker_hit& snemo_gg_hit = gg_handle.get();
+    const size_t i = hv.find(gg_handle);
+    DT_THROW_IF(i == sdm::tracker_hit_view::npos, std::logic_error,
+                "Calibrated tracker hit is not in the hit view of the event !");
 
     // Check the geometry ID as a Geiger cell :
-    const snemo::geometry::gg_locator& gg_locator = get_gg_locator();
-    const geomtools::geom_id& gg_hit_gid = snemo_gg_hit.get_geom_id();
-    DT_THROW_IF(!gg_locator.isGeigerCell(gg_hit_gid), std::logic_error,
+    DT_THROW_IF(hv.geom_type()[i] != gg_cell_type, std::logic_error,
                 "Calibrated tracker hit can not be located inside detector !");
 
-    if (!gg_locator.isGeigerCellInThisModule(gg_hit_gid)) {
+    if (hv.module()[i] != gg_module) {
       continue;
     }
 
     // Extract the numbering scheme of the cell from its geom ID :
-    const int side = gg_locator.getSideAddress(gg_hit_gid);
-    const int layer = gg_locator.getLayerAddress(gg_hit_gid);
-    const int row = gg_locator.getRowAddress(gg_hit_gid);
+    const int side = hv.side()[i];
+    const int layer = hv.layer()[i];
+    const int row = hv.row()[i];
 
     // Translate into the CAT's numbering scheme :
     // -1 : negative X side; +1 : positive X side
@@ -301,23 +314,23 @@ int cat_driver::_process_algo(const base_tracker_clusterizer::hit_collection_typ
     CAT::topology::experimental_double x;  // == Y in sngeometry SN module frame
 
     // Center of the cell set in CAT's own reference frame:
-    z.set_value(snemo_gg_hit.get_x());
+    z.set_value(hv.x()[i]);
     z.set_error(0.0);
-    x.set_value(snemo_gg_hit.get_y());
+    x.set_value(hv.y()[i]);
     x.set_error(0.0);
 
     // Transverse Geiger drift distance :
     CAT::topology::experimental_double y;
     // Plasma longitudinal origin along the anode wire :
-    y.set_value(snemo_gg_hit.get_z());
-    y.set_error(_sigma_z_factor_ * snemo_gg_hit.get_sigma_z());
+    y.set_value(hv.z()[i]);
+    y.set_error(_sigma_z_factor_ * hv.sigma_z()[i]);
 
     // Prompt/delayed trait of the hit :
-    const bool fast = snemo_gg_hit.is_prompt();
+    const bool fast = hv.is_prompt(i);
 
     // Transverse Geiger drift distance :
-    const double rdrift = snemo_gg_hit.get_r();
-    const double rdrift_err = snemo_gg_hit.get_sigma_r();
+    const double rdrift = hv.r()[i];
+    const double rdrift_err = hv.sigma_r()[i];
 
     // Build the Geiger hit position :
     CAT::topology::experimental_point gg_hit_position(x, y, z);
@@ -337,14 +350,14 @@ int cat_driver::_process_algo(const base_tracker_clusterizer::hit_collection_typ
     c.set_small_radius(_CAT_setup_.SmallRadius);
 
     // Store mapping info between both data models :
-    hits_mapping[c.id()] = gg_handle;
-    hits_status[c.id()] = 0;
-  }  // BOOST_FOREACH(gg_hits_)
+    hits_mapping.push_back(gg_handle);
+    hits_status.push_back(0);
+  }  // for (hits)
 
   // Take into account calo hits:
   _CAT_input_.calo_cells.clear();
   // Calo hit accounting :
-  std::map<int, sdm::CalorimeterHitHdl> calo_hits_mapping;
+  std::vector<sdm::CalorimeterHitHdl> calo_hits_mapping;
   if (_process_calo_hits_) {
     if (_CAT_input_.calo_cells.capacity() < calo_hits_.size()) {
       _CAT_input_.calo_cells.reserve(calo_hits_.size());
@@ -424,7 +437,7 @@ int cat_driver::_process_algo(const base_tracker_clusterizer::hit_collection_typ
       c.set_id(jhit++);
 
       // Store mapping info between both data models :
-      calo_hits_mapping[c.id()] = calo_handle;
+      calo_hits_mapping.push_back(calo_handle);
     }
   }
 
@@ -453,9 +466,7 @@ int cat_driver::_process_algo(const base_tracker_clusterizer::hit_collection_typ
   const std::vector<CAT::topology::scenario>& tss = _CAT_output_.tracked_data.get_scenarios();
 
   for (const CAT::topology::scenario& iscenario : tss) {
-    for (auto& ihs : hits_status) {
-      ihs.second = 0;
-    }
+    std::fill(hits_status.begin(), hits_status.end(), 0);
 
     auto htcs = datatools::make_handle<sdm::TrackerClusteringSolution>();
     clustering_.push_back(htcs, true);
@@ -476,11 +487,16 @@ int cat_driver::_process_algo(const base_tracker_clusterizer::hit_collection_typ
         // A CAT cluster with more than one hit/cell(node) :
         {
           // Append a new cluster :
-          sdm::TrackerClusterHdl tch(new sdm::tracker_cluster);
+          sdm::TrackerClusterHdl tch = _cluster_pool_.make();
           clustering_solution.get_clusters().push_back(tch);
         }
         sdm::TrackerClusterHdl& cluster_handle = clustering_solution.get_clusters().back();
         cluster_handle->set_cluster_id(clustering_solution.get_clusters().size() - 1);
+        // Seed the track fit with the helix of the sequence:
+        sdm::tracker_cluster::helix_seed seed;
+        if (make_helix_seed(a_sequence.get_helix(), seed)) {
+          cluster_handle->set_helix_seed(seed);
+        }
         if (_store_result_as_properties_) {
           // 2012/06/28 XG : Adding
           // - tangency points
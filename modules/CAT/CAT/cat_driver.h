@@ -36,6 +36,8 @@
 
 // This project
 #include <CATAlgorithm/CAT_interface.h>
+#include <falaise/snemo/datamodels/handle_pool.h>
+#include <falaise/snemo/datamodels/tracker_cluster.h>
 #include <falaise/snemo/processing/base_tracker_clusterizer.h>
 
 // Forward declaration :
@@ -106,6 +108,9 @@ class cat_driver : public ::snemo::processing::base_tracker_clusterizer {
   bool _process_calo_hits_;  ///< Flag to process associated calorimeter hits
   bool _store_result_as_properties_;  ///< Flag to store CAT result as data properties
 
+  /// Pool of reusable clusters
+  snedm::handle_pool<snemo::datamodel::tracker_cluster> _cluster_pool_;
+
   /// Calorimeter locators
   const snemo::geometry::calo_locator* _calo_locator_;
   const snemo::geometry::xcalo_locator* _xcalo_locator_;
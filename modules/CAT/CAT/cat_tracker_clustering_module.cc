@@ -153,8 +153,7 @@ void cat_tracker_clustering_module::_process(
     const snemo::datamodel::calibrated_data& calib_data,
     snemo::datamodel::tracker_clustering_data& clustering_data) {
   // Process the clusterizer driver :
-  catAlgo_->process(calib_data.tracker_hits(), calib_data.calorimeter_hits(),
-                    clustering_data);
+  catAlgo_->process(calib_data, clustering_data);
 }
 
 }  // namespace reconstruction
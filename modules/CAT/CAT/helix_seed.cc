@@ -0,0 +1,49 @@
+/// \file falaise/snemo/reconstruction/helix_seed.cc
+
+// Ourselves:
+#include <CAT/helix_seed.h>
+
+// Standard library:
+#include <cmath>
+
+namespace snemo {
+
+namespace reconstruction {
+
+bool make_helix_seed(const CAT::topology::helix& helix_,
+                     snemo::datamodel::tracker_cluster::helix_seed& seed_) {
+  const CAT::topology::experimental_point& center = helix_.center();
+  const CAT::topology::experimental_double& pitch = helix_.pitch();
+  // A CAT point at angle phi is (x0 + R sin(phi), y0 + R cos(phi), z0 + pitch * phi)
+  // in the SuperNEMO frame, i.e. the SuperNEMO angle is theta = pi/2 - phi:
+  seed_.x0 = center.z().value();
+  seed_.y0 = center.x().value();
+  seed_.z0 = center.y().value() + 0.5 * M_PI * pitch.value();
+  seed_.r = helix_.radius().value();
+  seed_.step = -2. * M_PI * pitch.value();
+  seed_.err_x0 = std::abs(center.z().error());
+  seed_.err_y0 = std::abs(center.x().error());
+  seed_.err_z0 = std::hypot(center.y().error(), 0.5 * M_PI * pitch.error());
+  seed_.err_r = std::abs(helix_.radius().error());
+  seed_.err_step = 2. * M_PI * std::abs(pitch.error());
+  return seed_.is_valid();
+}
+
+bool make_helix_seed(const SULTAN::topology::experimental_helix& helix_,
+                     snemo::datamodel::tracker_cluster::helix_seed& seed_) {
+  seed_.x0 = helix_.x0().value();
+  seed_.y0 = helix_.y0().value();
+  seed_.z0 = helix_.z0().value();
+  seed_.r = helix_.R().value();
+  seed_.step = 2. * M_PI * helix_.H().value();
+  seed_.err_x0 = std::abs(helix_.x0().error());
+  seed_.err_y0 = std::abs(helix_.y0().error());
+  seed_.err_z0 = std::abs(helix_.z0().error());
+  seed_.err_r = std::abs(helix_.R().error());
+  seed_.err_step = 2. * M_PI * std::abs(helix_.H().error());
+  return seed_.is_valid();
+}
+
+}  // end of namespace reconstruction
+
+}  // end of namespace snemo
@@ -0,0 +1,69 @@
+/** \file falaise/snemo/reconstruction/helix_seed.h
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * Description:
+ *
+ *   Conversion of the CAT and SULTAN sequence helices to tracker cluster helix seeds.
+ *
+ * History:
+ *
+ */
+
+#ifndef FALAISE_CAT_PLUGIN_SNEMO_RECONSTRUCTION_HELIX_SEED_H
+#define FALAISE_CAT_PLUGIN_SNEMO_RECONSTRUCTION_HELIX_SEED_H 1
+
+// This project
+#include <CATAlgorithm/helix.h>
+#include <falaise/snemo/datamodels/tracker_cluster.h>
+#include <sultan/experimental_helix.h>
+
+namespace snemo {
+
+namespace reconstruction {
+
+/// Compute the seed of a cluster from the helix of its CAT sequence
+/*!
+ * The CAT helix is expressed in the CAT frame (xcat -> y_snemo,
+ * ycat -> z_snemo, zcat -> x_snemo), and its angle runs the opposite way
+ * from the SuperNEMO one, starting a quarter turn away.
+ * Return true if the seed is valid.
+ */
+bool make_helix_seed(const CAT::topology::helix& helix_,
+                     snemo::datamodel::tracker_cluster::helix_seed& seed_);
+
+/// Compute the seed of a cluster from the helix of its SULTAN sequence
+/*!
+ * The SULTAN helix is expressed in the SuperNEMO frame, with a z shift per
+ * radian instead of per turn.
+ * Return true if the seed is valid.
+ */
+bool make_helix_seed(const SULTAN::topology::experimental_helix& helix_,
+                     snemo::datamodel::tracker_cluster::helix_seed& seed_);
+
+}  // end of namespace reconstruction
+
+}  // end of namespace snemo
+
+#endif  // FALAISE_CAT_PLUGIN_SNEMO_RECONSTRUCTION_HELIX_SEED_H
+
+/*
+** Local Variables: --
+** mode: c++ --
+** c-file-style: "gnu" --
+** tab-width: 2 --
+** End: --
+*/
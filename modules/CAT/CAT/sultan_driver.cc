@@ -6,6 +6,7 @@
 // Standard library:
 #include <sstream>
 #include <stdexcept>
+#include <vector>
 
 // Third party:
 // - Boost :
@@ -19,6 +20,7 @@
 #include <geomtools/manager.h>
 
 // This project :
+#include <CAT/helix_seed.h>
 #include <falaise/snemo/datamodels/tracker_clustering_data.h>
 #include <falaise/snemo/geometry/calo_locator.h>
 #include <falaise/snemo/geometry/gg_locator.h>
@@ -73,6 +75,7 @@ void sultan_driver::reset() {
   _set_initialized(false);
   _SULTAN_clusterizer_.finalize();
   _SULTAN_sultan_.finalize();
+  _cluster_pool_.clear();
   _set_defaults();
   this->base_tracker_clusterizer::_reset();
 }
@@ -313,6 +316,9 @@ int sultan_driver::_process_algo(
   namespace st = SULTAN::topology;
   namespace sdm = snemo::datamodel;
 
+  // Clusters of previous events can now be reused:
+  _cluster_pool_.recycle();
+
   // SULTAN input data model :
   _SULTAN_input_.cells.clear();
   if (_SULTAN_input_.cells.capacity() < gg_hits_.size()) {
@@ -321,33 +327,38 @@ int sultan_driver::_process_algo(
   _SULTAN_output_.tracked_data.reset();
   size_t ihit = 0;
 
-  // Hit accounting :
-  std::map<int, sdm::TrackerHitHdl> gg_hits_mapping;
+  // Columns of the hit values of the event, shared by the clusterizer base :
+  const sdm::tracker_hit_view& hv = _get_hit_view();
+  const snemo::geometry::gg_locator& gg_locator = get_gg_locator();
+  const uint32_t gg_cell_type = gg_locator.getCellType();
+  const int32_t gg_module = static_cast<int32_t>(gg_locator.getModuleNumber());
+
+  // Hit accounting, indexed by SULTAN cell id :
+  std::vector<sdm::TrackerHitHdl> gg_hits_mapping;
+  gg_hits_mapping.reserve(gg_hits_.size());
 
   // GG hit loop :
-  BOOST_FOREACH (const sdm::TrackerHitHdl& gg_handle, gg_hits_) {
+  for (const sdm::TrackerHitHdl& gg_handle : gg_hits_) {
     // Skip NULL handle :
     if (!gg_handle.has_data()) {
       continue;
     }
-
-    // Get a const reference on the calibrated Geiger hit :
-    const sdm::calibrated_tracker_hit& snemo_gg_hit = gg_handle.get();
+    const size_t i = hv.find(gg_handle);
+    DT_THROW_IF(i == sdm::tracker_hit_view::npos, std::logic_error,
+                "Calibrated tracker hit is not in the hit view of the event !");
 
     // Check the geometry ID as a Geiger cell :
-    const snemo::geometry::gg_locator& gg_locator = get_gg_locator();
-    const geomtools::geom_id& gg_hit_gid = snemo_gg_hit.get_geom_id();
-    DT_THROW_IF(!gg_locator.isGeigerCell(gg_hit_gid), std::logic_error,
+    DT_THROW_IF(hv.geom_type()[i] != gg_cell_type, std::logic_error,
                 "Calibrated tracker hit can not be located inside detector !");
 
-    if (!gg_locator.isGeigerCellInThisModule(gg_hit_gid)) {
+    if (hv.module()[i] != gg_module) {
       continue;
     }
 
     // Extract the numbering scheme of the cell from its geom ID :
-    const int side = gg_locator.getSideAddress(gg_hit_gid);
-    const int layer = gg_locator.getLayerAddress(gg_hit_gid);
-    const int row = gg_locator.getRowAddress(gg_hit_gid);
+    const int side = hv.side()[i];
+    const int layer = hv.layer()[i];
+    const int row = hv.row()[i];
 
     // Translate into the SULTAN's numbering scheme :
     // -1 : negative X side; +1 : positive X side
@@ -365,23 +376,23 @@ int sultan_driver::_process_algo(
     st::experimental_double y;
 
     // Center of the cell set in SULTAN's own reference frame:
-    x.set_value(snemo_gg_hit.get_x());
+    x.set_value(hv.x()[i]);
     x.set_error(0.0);
-    y.set_value(snemo_gg_hit.get_y());
+    y.set_value(hv.y()[i]);
     y.set_error(0.0);
 
     // Transverse Geiger drift distance :
     st::experimental_double z;
     // Plasma longitudinal origin along the anode wire :
-    z.set_value(snemo_gg_hit.get_z());
-    z.set_error(_sigma_z_factor_ * snemo_gg_hit.get_sigma_z());
+    z.set_value(hv.z()[i]);
+    z.set_error(_sigma_z_factor_ * hv.sigma_z()[i]);
 
     // Prompt/delayed trait of the hit :
-    const bool fast = snemo_gg_hit.is_prompt();
+    const bool fast = hv.is_prompt(i);
 
     // Transverse Geiger drift distance :
-    const double rdrift = snemo_gg_hit.get_r();
-    const double rdrift_err = snemo_gg_hit.get_sigma_r();
+    const double rdrift = hv.r()[i];
+    const double rdrift_err = hv.sigma_r()[i];
 
     // Build the Geiger hit position :
     st::experimental_point gg_hit_position(x, y, z);
@@ -400,13 +411,13 @@ int sultan_driver::_process_algo(
     c.set_fast(fast);
 
     // Store mapping info between both data models :
-    gg_hits_mapping[c.id()] = gg_handle;
+    gg_hits_mapping.push_back(gg_handle);
   }
 
   // Take into account calo hits:
   _SULTAN_input_.calo_cells.clear();
   // Calo hit accounting :
-  std::map<int, sdm::CalorimeterHitHdl> calo_hits_mapping;
+  std::vector<sdm::CalorimeterHitHdl> calo_hits_mapping;
   if (_process_calo_hits_) {
     if (_SULTAN_input_.calo_cells.capacity() < calo_hits_.size()) {
       _SULTAN_input_.calo_cells.reserve(calo_hits_.size());
@@ -486,7 +497,7 @@ int sultan_driver::_process_algo(
       c.set_id(jhit++);
 
       // Store mapping info between both data models :
-      calo_hits_mapping[c.id()] = calo_handle;
+      calo_hits_mapping.push_back(calo_handle);
     }
   }
 
@@ -529,12 +540,18 @@ int sultan_driver::_process_algo(
         continue;
       }
       // Append a new cluster :
-      sdm::TrackerClusterHdl tch(new sdm::tracker_cluster);
+      sdm::TrackerClusterHdl tch = _cluster_pool_.make();
       clustering_solution.get_clusters().push_back(tch);
       sdm::TrackerClusterHdl& cluster_handle = clustering_solution.get_clusters().back();
       cluster_handle.grab().set_cluster_id(clustering_solution.get_clusters().size() - 1);
       const st::experimental_helix& seq_helix = the_sequence.get_helix();
 
+      // Seed the track fit with the helix of the sequence:
+      sdm::tracker_cluster::helix_seed seed;
+      if (make_helix_seed(seq_helix, seed)) {
+        cluster_handle->set_helix_seed(seed);
+      }
+
       // Adding points
       // from SULTAN algorithm. Since it is a none generic
       // information, this info will be added to
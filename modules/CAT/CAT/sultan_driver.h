@@ -35,6 +35,8 @@
 #include <string>
 
 // This project
+#include <falaise/snemo/datamodels/handle_pool.h>
+#include <falaise/snemo/datamodels/tracker_cluster.h>
 #include <falaise/snemo/processing/base_tracker_clusterizer.h>
 #include <sultan/SULTAN_interface.h>
 
@@ -105,6 +107,9 @@ class sultan_driver : public ::snemo::processing::base_tracker_clusterizer {
   double _magfield_dir_;     ///< Enforced magnetic field (direction along the Z axis +1/-1)
   bool _process_calo_hits_;  /// Flag to process associated calorimeter hits
 
+  /// Pool of reusable clusters
+  snedm::handle_pool<snemo::datamodel::tracker_cluster> _cluster_pool_;
+
   /// Calorimeter locators
   const snemo::geometry::calo_locator* _calo_locator_;
   const snemo::geometry::xcalo_locator* _xcalo_locator_;
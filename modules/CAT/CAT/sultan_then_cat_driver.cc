@@ -19,6 +19,7 @@
 #include <geomtools/manager.h>
 
 // This project :
+#include <CAT/helix_seed.h>
 #include <falaise/snemo/datamodels/tracker_clustering_data.h>
 #include <falaise/snemo/geometry/calo_locator.h>
 #include <falaise/snemo/geometry/gg_locator.h>
@@ -68,6 +69,7 @@ void sultan_then_cat_driver::reset() {
   _CAT_clusterizer_.finalize();
   _CAT_sequentiator_.finalize();
   _CAT_setup_.reset();
+  _cluster_pool_.clear();
   _sigma_z_factor_ = 1.0;
   datatools::invalidate(_magfield_);
   this->base_tracker_clusterizer::_reset();
@@ -646,6 +648,9 @@ int sultan_then_cat_driver::_process_algo(
   namespace st = SULTAN::topology;
   namespace sdm = snemo::datamodel;
 
+  // Clusters of previous events can now be reused:
+  _cluster_pool_.recycle();
+
   // input data model :
   _CAT_input_.cells.clear();
   _CAT_input_.calo_cells.clear();
@@ -926,7 +931,7 @@ int sultan_then_cat_driver::_process_algo(
         // A CAT cluster with more than one hit/cell (node) :
         {
           // Append a new cluster :
-          sdm::TrackerClusterHdl tch(new sdm::tracker_cluster);
+          sdm::TrackerClusterHdl tch = _cluster_pool_.make();
           clustering_solution.get_clusters().push_back(tch);
         }
         sdm::TrackerClusterHdl& cluster_handle = clustering_solution.get_clusters().back();
@@ -944,6 +949,12 @@ int sultan_then_cat_driver::_process_algo(
         const SULTAN::topology::experimental_vector& CAT_sultan_helix_momentum =
             sultan_sequences[index_of_sultan_sequence].helix_momentum();
 
+        // Seed the track fit with the helix of the sequence, or else with the SULTAN one:
+        sdm::tracker_cluster::helix_seed seed;
+        if (make_helix_seed(seq_helix, seed) || make_helix_seed(sultan_helix, seed)) {
+          cluster_handle->set_helix_seed(seed);
+        }
+
         // 2012/06/28 XG : Adding
         // - tangency points
         // - helix points
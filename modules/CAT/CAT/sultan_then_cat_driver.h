@@ -33,6 +33,8 @@
 
 // This project
 #include <CATAlgorithm/CAT_interface.h>
+#include <falaise/snemo/datamodels/handle_pool.h>
+#include <falaise/snemo/datamodels/tracker_cluster.h>
 #include <falaise/snemo/processing/base_tracker_clusterizer.h>
 #include <sultan/SULTAN_interface.h>
 #include <string>
@@ -116,6 +118,9 @@ class sultan_then_cat_driver : public ::snemo::processing::base_tracker_clusteri
   double _magfield_;         /// Enforced magnetic field
   bool _process_calo_hits_;  /// Flag to process associated calorimeter hits
 
+  /// Pool of reusable clusters
+  snedm::handle_pool<snemo::datamodel::tracker_cluster> _cluster_pool_;
+
   /// Calorimeter locators
   const snemo::geometry::calo_locator* _calo_locator_;
   const snemo::geometry::xcalo_locator* _xcalo_locator_;
@@ -159,8 +159,7 @@ void sultan_tracker_clustering_module::_process(
     const snemo::datamodel::calibrated_data& calib_data,
     snemo::datamodel::tracker_clustering_data& clustering_data) {
   // Process the clusterizer driver :
-  sultanAlgo_->process(calib_data.tracker_hits(),
-                       calib_data.calorimeter_hits(), clustering_data);
+  sultanAlgo_->process(calib_data, clustering_data);
 }
 
 }  // end of namespace reconstruction
@@ -0,0 +1,258 @@
+// Standard library:
+#include <cmath>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Third party:
+// - Bayeux/datatools:
+#include <datatools/clhep_units.h>
+#include <datatools/logger.h>
+#include <datatools/properties.h>
+#include <datatools/utils.h>
+// - Bayeux/geomtools:
+#include <geomtools/manager.h>
+
+// Falaise:
+#include <falaise/falaise.h>
+#include <falaise/snemo/datamodels/tracker_clustering_data.h>
+#include <falaise/snemo/geometry/gg_locator.h>
+#include <falaise/snemo/geometry/locator_plugin.h>
+
+// This project:
+#include <CAT/cat_driver.h>
+#include <CAT/sultan_driver.h>
+#include <CATAlgorithm/experimental_double.h>
+#include <CATAlgorithm/experimental_vector.h>
+#include <sultan/experimental_double.h>
+#include <sultan/experimental_vector.h>
+
+// Testing resources:
+#include <utilities.h>
+
+namespace {
+int n_failures = 0;
+
+void check(bool test_, const std::string& what_) {
+  if (!test_) {
+    std::cerr << "error: " << what_ << std::endl;
+    n_failures++;
+  }
+}
+
+// Values of the value-only tier must be those of the full tier, bit for bit
+template <typename Double>
+void check_tiers(const std::string& name_) {
+  Double a(0.9, 0.1);
+  Double b(2., 0.2);
+
+  const Double full[] = {a + b, a - b, a * b, a / b,
+                         experimental_sin(a), experimental_cos(a),
+                         experimental_tan(a), experimental_asin(a),
+                         experimental_acos(a), experimental_atan2(a, b),
+                         experimental_square(a), experimental_sqrt(b),
+                         experimental_cube(b)};
+  check(Double::propagates_errors(), name_ + ": errors are propagated by default");
+  {
+    typename Double::value_only_scope value_only;
+    check(!Double::propagates_errors(), name_ + ": value-only scope is active");
+    const Double fast[] = {a + b, a - b, a * b, a / b,
+                           experimental_sin(a), experimental_cos(a),
+                           experimental_tan(a), experimental_asin(a),
+                           experimental_acos(a), experimental_atan2(a, b),
+                           experimental_square(a), experimental_sqrt(b),
+                           experimental_cube(b)};
+    for (size_t i = 0; i < sizeof(full) / sizeof(full[0]); ++i) {
+      check(fast[i].value() == full[i].value(),
+            name_ + ": same value in both tiers, operation " + std::to_string(i));
+      check(std::isnan(fast[i].error()),
+            name_ + ": no error in the value-only tier, operation " + std::to_string(i));
+      check(!std::isnan(full[i].error()),
+            name_ + ": error in the full tier, operation " + std::to_string(i));
+    }
+  }
+  check(Double::propagates_errors(), name_ + ": full tier restored at the end of the scope");
+  {
+    typename Double::full_scope full;
+    typename Double::value_only_scope value_only;
+    check(Double::propagates_errors(), name_ + ": value-only scope disabled in a full scope");
+  }
+}
+
+bool same_real(double a_, double b_) { return a_ == b_ || (std::isnan(a_) && std::isnan(b_)); }
+
+// Same scenarios (solutions) made of the same sequences (clusters), hit for hit
+void check_same_clustering(const snemo::datamodel::tracker_clustering_data& full_,
+                           const snemo::datamodel::tracker_clustering_data& fast_,
+                           const std::string& name_) {
+  check(full_.size() == fast_.size(), name_ + ": same number of scenarios");
+  for (size_t i = 0; i < full_.size() && i < fast_.size(); ++i) {
+    const snemo::datamodel::tracker_clustering_solution& full_solution = *(full_.solutions()[i]);
+    const snemo::datamodel::tracker_clustering_solution& fast_solution = *(fast_.solutions()[i]);
+    const std::string scenario = name_ + ", scenario " + std::to_string(i);
+    check(full_solution.get_unclustered_hits().size() ==
+              fast_solution.get_unclustered_hits().size(),
+          scenario + ": same number of unclustered hits");
+    const snemo::datamodel::TrackerClusterHdlCollection& full_clusters =
+        full_solution.get_clusters();
+    const snemo::datamodel::TrackerClusterHdlCollection& fast_clusters =
+        fast_solution.get_clusters();
+    check(full_clusters.size() == fast_clusters.size(), scenario + ": same number of sequences");
+    for (size_t j = 0; j < full_clusters.size() && j < fast_clusters.size(); ++j) {
+      const snemo::datamodel::tracker_cluster& full_cluster = *(full_clusters[j]);
+      const snemo::datamodel::tracker_cluster& fast_cluster = *(fast_clusters[j]);
+      const std::string sequence = scenario + ", sequence " + std::to_string(j);
+      const snemo::datamodel::TrackerHitHdlCollection& full_hits = full_cluster.hits();
+      const snemo::datamodel::TrackerHitHdlCollection& fast_hits = fast_cluster.hits();
+      check(full_hits.size() == fast_hits.size(), sequence + ": same number of hits");
+      for (size_t k = 0; k < full_hits.size() && k < fast_hits.size(); ++k) {
+        check(&(full_hits[k].get()) == &(fast_hits[k].get()), sequence + ": same hits");
+      }
+      check(full_cluster.has_helix_seed() == fast_cluster.has_helix_seed(),
+            sequence + ": same helix seeding");
+      if (full_cluster.has_helix_seed() && fast_cluster.has_helix_seed()) {
+        const snemo::datamodel::tracker_cluster::helix_seed& a = full_cluster.get_helix_seed();
+        const snemo::datamodel::tracker_cluster::helix_seed& b = fast_cluster.get_helix_seed();
+        check(same_real(a.x0, b.x0) && same_real(a.y0, b.y0) && same_real(a.z0, b.z0) &&
+                  same_real(a.r, b.r) && same_real(a.step, b.step),
+              sequence + ": same helix seed");
+        check(same_real(a.err_x0, b.err_x0) && same_real(a.err_y0, b.err_y0) &&
+                  same_real(a.err_z0, b.err_z0) && same_real(a.err_r, b.err_r) &&
+                  same_real(a.err_step, b.err_step),
+              sequence + ": same helix seed errors");
+      }
+    }
+  }
+}
+
+// Run a clusterizer on each event of the corpus with full error propagation,
+// then with its value-only screening, and compare the results
+void check_driver_tiers(snemo::processing::base_tracker_clusterizer& driver_,
+                        const std::vector<snemo::datamodel::TrackerHitHdlCollection>& corpus_,
+                        const std::string& name_) {
+  for (size_t i = 0; i < corpus_.size(); ++i) {
+    const std::string event = name_ + ", event " + std::to_string(i);
+    snemo::processing::base_tracker_clusterizer::calo_hit_collection_type calohits;
+    snemo::datamodel::tracker_clustering_data full_data;
+    {
+      CAT::topology::experimental_double::full_scope cat_full;
+      SULTAN::topology::experimental_double::full_scope sultan_full;
+      check(driver_.process(corpus_[i], calohits, full_data) == 0,
+            event + ": processed in the full tier");
+    }
+    snemo::datamodel::tracker_clustering_data fast_data;
+    check(driver_.process(corpus_[i], calohits, fast_data) == 0,
+          event + ": processed with value-only screening");
+    check_same_clustering(full_data, fast_data, event);
+  }
+}
+}  // namespace
+
+int main(int argc_, char** argv_) {
+  falaise::initialize(argc_, argv_);
+  check_tiers<CAT::topology::experimental_double>("CAT");
+  check_tiers<SULTAN::topology::experimental_double>("SULTAN");
+
+  {
+    CAT::topology::experimental_vector v(1., 2., 3., 0.1, 0.2, 0.3);
+    double length = v.length().value();
+    CAT::topology::experimental_double::value_only_scope value_only;
+    check(v.length().value() == length, "CAT: same vector length in both tiers");
+    check(std::isnan(v.length().error()), "CAT: no vector length error in value-only tier");
+  }
+  {
+    SULTAN::topology::experimental_vector v(1., 2., 3., 0.1, 0.2, 0.3);
+    double length = v.length().value();
+    SULTAN::topology::experimental_double::value_only_scope value_only;
+    check(v.length().value() == length, "SULTAN: same vector length in both tiers");
+    check(std::isnan(v.length().error()), "SULTAN: no vector length error in value-only tier");
+  }
+
+  // is_zero__optimist is |v| - (0 +- 0) compared with its propagated error
+  const double values[] = {0., 0.05, -0.05, 0.3, -0.3, 1.e-300};
+  const double errors[] = {0., 0.1, 1.e-200, 0.29};
+  for (double v : values) {
+    for (double e : errors) {
+      SULTAN::topology::experimental_double x(v, e);
+      SULTAN::topology::experimental_double zero(0., 0.);
+      SULTAN::topology::experimental_double delta = experimental_fabs(x) - zero;
+      bool expected = !(delta.value() > 2. * delta.error());
+      check(x.is_zero__optimist(2.) == expected, "SULTAN: is_zero__optimist");
+    }
+  }
+
+  // Driver level: same sequences and scenarios on the corpus of the driver tests
+  try {
+    geomtools::manager Geo;
+    std::string GeoConfigFile = "@falaise:snemo/demonstrator/geometry/GeometryManager.conf";
+    datatools::fetch_path_with_env(GeoConfigFile);
+    datatools::properties GeoConfig;
+    datatools::properties::read_config(GeoConfigFile, GeoConfig);
+    Geo.initialize(GeoConfig);
+    const snemo::geometry::locator_plugin& lp =
+        Geo.get_plugin<snemo::geometry::locator_plugin>("locators_driver");
+    const snemo::geometry::gg_locator& gg_locator =
+        dynamic_cast<const snemo::geometry::gg_locator&>(lp.geigerLocator());
+
+    srand48(314159);
+    std::vector<snemo::datamodel::TrackerHitHdlCollection> corpus(3);
+    for (snemo::datamodel::TrackerHitHdlCollection& gghits : corpus) {
+      generate_gg_hits(gg_locator, gghits);
+    }
+
+    // Parameters of test_cat_driver:
+    datatools::properties CATconfig;
+    CATconfig.store_real("CAT.magnetic_field", 25 * CLHEP::gauss);
+    CATconfig.store_string("CAT.level", "normal");
+    CATconfig.store_real("CAT.max_time", 5000.0 * CLHEP::ms);
+    CATconfig.store_real("CAT.small_radius", 2.0 * CLHEP::mm);
+    CATconfig.store_real("CAT.probmin", 0.0);
+    CATconfig.store_integer("CAT.nofflayers", 1);
+    CATconfig.store_integer("CAT.first_event", -1);
+    CATconfig.store_real("CAT.ratio", 10000.0);
+    CATconfig.store_real("CAT.driver.sigma_z_factor", 1.0);
+    snemo::reconstruction::cat_driver CAT;
+    CAT.set_logging_priority(datatools::logger::PRIO_FATAL);
+    CAT.set_geometry_manager(Geo);
+    CAT.initialize(CATconfig);
+    check_driver_tiers(CAT, corpus, "CAT driver");
+    CAT.reset();
+
+    // Parameters of test_sultan_driver:
+    datatools::properties SULTANconfig;
+    SULTANconfig.store_real("SULTAN.magnetic_field", 25 * CLHEP::gauss);
+    SULTANconfig.store_string("SULTAN.clusterizer_level", "normal");
+    SULTANconfig.store_string("SULTAN.sequentiator_level", "normal");
+    SULTANconfig.store_real("SULTAN.max_time", 10000.0 * CLHEP::ms);
+    SULTANconfig.store_boolean("SULTAN.print_event_display", 0);
+    SULTANconfig.store_real("SULTAN.Emin", 0.2 * CLHEP::MeV);
+    SULTANconfig.store_real("SULTAN.Emax", 7.0 * CLHEP::MeV);
+    SULTANconfig.store_real("SULTAN.probmin", 0.0);
+    SULTANconfig.store_real("SULTAN.nsigma_r", 5.0);
+    SULTANconfig.store_real("SULTAN.nsigma_z", 3.0);
+    SULTANconfig.store_integer("SULTAN.nofflayers", 0);
+    SULTANconfig.store_integer("SULTAN.first_event", -1);
+    SULTANconfig.store_integer("SULTAN.min_ncells_in_cluster", 0);
+    SULTANconfig.store_integer("SULTAN.ncells_between_triplet_min", 0);
+    SULTANconfig.store_integer("SULTAN.ncells_between_triplet_range", 0);
+    SULTANconfig.store_real("SULTAN.nsigmas", 1.0);
+    SULTANconfig.store_real("SULTAN.driver.sigma_z_factor", 1.0);
+    snemo::reconstruction::sultan_driver SULTAN;
+    SULTAN.set_logging_priority(datatools::logger::PRIO_FATAL);
+    SULTAN.set_geometry_manager(Geo);
+    SULTAN.initialize(SULTANconfig);
+    check_driver_tiers(SULTAN, corpus, "SULTAN driver");
+    SULTAN.reset();
+  } catch (std::exception& error) {
+    check(false, std::string("driver comparison: ") + error.what());
+  }
+  falaise::terminate();
+
+  if (n_failures != 0) {
+    std::cerr << n_failures << " failure(s)" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,74 @@
+// Standard library:
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+// This project:
+#include <CAT/helix_seed.h>
+
+namespace {
+int n_failures = 0;
+
+void check(bool test_, const std::string& what_) {
+  if (!test_) {
+    std::cerr << "error: " << what_ << std::endl;
+    n_failures++;
+  }
+}
+
+// Check that a point of the SuperNEMO frame lies on the helix described by a seed
+void check_on_seed(const snemo::datamodel::tracker_cluster::helix_seed& seed_, double x_,
+                   double y_, double z_, const std::string& name_) {
+  const double tolerance = 1.e-9;
+  check(std::abs(std::hypot(x_ - seed_.x0, y_ - seed_.y0) - seed_.r) < tolerance,
+        name_ + ": point at the seed radius");
+  // The angle is only known modulo a turn:
+  const double theta = std::atan2(y_ - seed_.y0, x_ - seed_.x0);
+  const double turns = (z_ - seed_.z0) / seed_.step - theta / (2. * M_PI);
+  check(std::abs(turns - std::round(turns)) < tolerance, name_ + ": point at the seed height");
+}
+}  // namespace
+
+int main() {
+  const double phis[] = {-2.5, -0.7, 0., 0.4, 1.9, 3.0};
+  snemo::datamodel::tracker_cluster::helix_seed seed;
+
+  {
+    // xcat -> y_snemo, ycat -> z_snemo, zcat -> x_snemo
+    const CAT::topology::experimental_point center(110., -35., 240., 1., 2., 3.);
+    const CAT::topology::experimental_double radius(420., 5.);
+    const CAT::topology::experimental_double pitch(-27., 0.5);
+    const CAT::topology::helix cat_helix(center, radius, pitch);
+    check(snemo::reconstruction::make_helix_seed(cat_helix, seed), "CAT: valid seed");
+    check(seed.err_x0 == 3. && seed.err_y0 == 1. && seed.err_r == 5., "CAT: seed errors");
+    for (double phi : phis) {
+      const CAT::topology::experimental_point p =
+          cat_helix.position(CAT::topology::experimental_double(phi, 0.));
+      check_on_seed(seed, p.z().value(), p.x().value(), p.y().value(), "CAT");
+    }
+    check(!snemo::reconstruction::make_helix_seed(CAT::topology::helix(), seed),
+          "CAT: no seed from an unset helix");
+  }
+
+  {
+    const SULTAN::topology::experimental_helix sultan_helix(
+        SULTAN::topology::experimental_double(240., 3.),
+        SULTAN::topology::experimental_double(110., 1.),
+        SULTAN::topology::experimental_double(-35., 2.),
+        SULTAN::topology::experimental_double(420., 5.),
+        SULTAN::topology::experimental_double(27., 0.5));
+    check(snemo::reconstruction::make_helix_seed(sultan_helix, seed), "SULTAN: valid seed");
+    for (double phi : phis) {
+      const SULTAN::topology::experimental_point p =
+          sultan_helix.position(SULTAN::topology::experimental_double(phi, 0.));
+      check_on_seed(seed, p.x().value(), p.y().value(), p.z().value(), "SULTAN");
+    }
+  }
+
+  if (n_failures != 0) {
+    std::cerr << n_failures << " failure(s)" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,63 @@
+// Standard library:
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+// This project:
+#include <CATAlgorithm/Clock.h>
+#include <mybhep/messenger.h>
+#include <sultan/Clock.h>
+
+namespace {
+int n_failures = 0;
+int n_evaluations = 0;
+
+void check(bool test_, const std::string& what_) {
+  if (!test_) {
+    std::cerr << "error: " << what_ << std::endl;
+    n_failures++;
+  }
+}
+
+int evaluate() { return ++n_evaluations; }
+
+template <typename ClockType>
+void check_handles(const std::string& name_) {
+  ClockType clock;
+  clock.dump();
+  typename ClockType::handle h = clock.probe(" probe ");
+  check(clock.probe(" probe ") == h, name_ + ": same handle for the same name");
+  check(clock.clockables().size() == 1, name_ + ": probe registered once");
+  clock.start(" other ", "cumulative");
+  clock.stop(" other ");
+  for (int i = 0; i < 3; ++i) {
+    clock.start(h);
+    clock.stop(h);
+  }
+  clock.dump();
+  check(clock.clockables()[h].name() == " probe ", name_ + ": handle still valid after dump");
+  check(clock.clockables()[h].time_ >= 0., name_ + ": cumulated time");
+}
+}  // namespace
+
+int main() {
+  mybhep::messenger m(mybhep::NORMAL);
+  check(m.enabled(mybhep::NORMAL), "messenger: NORMAL enabled at NORMAL level");
+  check(!m.enabled(mybhep::VVERBOSE), "messenger: VVERBOSE disabled at NORMAL level");
+  MYBHEP_MESSAGE(m, mybhep::VVERBOSE, "not formed", evaluate());
+  check(n_evaluations == 0, "messenger: arguments of a filtered message are not evaluated");
+  m.set_level(mybhep::DUMP);
+  MYBHEP_MESSAGE(m, mybhep::VVERBOSE, "formed", evaluate(), std::string("string"));
+  check(n_evaluations == (mybhep::VVERBOSE <= mybhep::messenger::max_level ? 1 : 0),
+        "messenger: arguments of an enabled message are evaluated once");
+  m.message("direct message", 1, 2.5, mybhep::NORMAL);
+
+  check_handles<CAT::Clock>("CAT");
+  check_handles<SULTAN::Clock>("SULTAN");
+
+  if (n_failures != 0) {
+    std::cerr << n_failures << " failure(s)" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -4,7 +4,12 @@
 #include <ChargedParticleTracking/alpha_finder_driver.h>
 
 // Standard library:
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <sstream>
+#include <unordered_map>
+#include <vector>
 
 // Third party:
 // - Bayeux/datatools:
@@ -33,6 +38,78 @@ namespace snemo {
 
 namespace reconstruction {
 
+/// Prompt Geiger hits and trajectory extremities are hashed by the xy cell of a
+/// grid whose pitch is the search distance, so that all the entries closer
+/// than this distance to a point lie in the 3x3 cells around it. Entries are
+/// stored in the order of the trajectories, which sets the precedence of equal
+/// candidates.
+struct alpha_finder_driver::prompt_index {
+  /// Prompt Geiger hit of a default trajectory
+  struct hit_entry {
+    double x;
+    double y;
+    double z;
+    double sigmaZ;
+    size_t track;  //!< Rank of the default trajectory
+  };
+
+  /// Extremity of a default trajectory
+  struct vertex_entry {
+    geomtools::vector_3d position;
+    size_t track;  //!< Rank of the default trajectory
+  };
+
+  typedef std::unordered_map<uint64_t, std::vector<size_t> > grid_type;
+
+  /// Return the key of the grid cell of a point, false if it has no cell
+  static bool cellKey(double cellSize, double x, double y, int dx, int dy, uint64_t &key) {
+    if (!(cellSize > 0.0) || !std::isfinite(x) || !std::isfinite(y)) {
+      return false;
+    }
+    // Clamping merges the far away cells, which keeps the 3x3 neighbourhoods
+    const double limit = 1.0e9;
+    const double ix = std::max(-limit, std::min(limit, std::floor(x / cellSize))) + dx;
+    const double iy = std::max(-limit, std::min(limit, std::floor(y / cellSize))) + dy;
+    key = (static_cast<uint64_t>(static_cast<int64_t>(ix)) << 32) ^
+          (static_cast<uint64_t>(static_cast<int64_t>(iy)) & 0xffffffffu);
+    return true;
+  }
+
+  static void insert(grid_type &grid, double cellSize, double x, double y, size_t entry) {
+    uint64_t key = 0;
+    if (cellKey(cellSize, x, y, 0, 0, key)) {
+      grid[key].push_back(entry);
+    }
+  }
+
+  /// Collect, in storage order, the entries of the 3x3 cells around a point
+  static void collect(const grid_type &grid, double cellSize, double x, double y,
+                      std::vector<size_t> &entries) {
+    entries.clear();
+    uint64_t key = 0;
+    for (int dx = -1; dx <= 1; dx++) {
+      for (int dy = -1; dy <= 1; dy++) {
+        if (!cellKey(cellSize, x, y, dx, dy, key)) {
+          return;
+        }
+        auto found = grid.find(key);
+        if (found != grid.end()) {
+          entries.insert(entries.end(), found->second.begin(), found->second.end());
+        }
+      }
+    }
+    std::sort(entries.begin(), entries.end());
+  }
+
+  size_t nTracks = 0;  //!< Number of prompt default trajectories
+  double hitCellSize = 0.0;
+  std::vector<hit_entry> hits;
+  grid_type hitGrid;
+  double vertexCellSize = 0.0;
+  std::vector<vertex_entry> vertices;
+  grid_type vertexGrid;
+};
+
 const std::string &alpha_finder_driver::short_alpha_key() {
   static const std::string s("short_alpha");
   return s;
@@ -68,13 +145,80 @@ alpha_finder_driver::alpha_finder_driver(const falaise::property_set &ps,
 void alpha_finder_driver::process(
     const snemo::datamodel::tracker_trajectory_data &tracker_trajectory_data_,
     snemo::datamodel::particle_track_data &particle_track_data_) {
-  this->_find_delayed_unfitted_cluster_(tracker_trajectory_data_, particle_track_data_);
-  this->_find_delayed_unclustered_hit_(tracker_trajectory_data_, particle_track_data_);
+  prompt_index index;
+  if (tracker_trajectory_data_.has_solutions()) {
+    this->_build_prompt_index_(tracker_trajectory_data_.get_default_solution(), index);
+  }
+  this->_find_delayed_unfitted_cluster_(tracker_trajectory_data_, index, particle_track_data_);
+  this->_find_delayed_unclustered_hit_(tracker_trajectory_data_, index, particle_track_data_);
+}
+
+void alpha_finder_driver::_build_prompt_index_(
+    const snemo::datamodel::tracker_trajectory_solution &solution_, prompt_index &index_) const {
+  namespace snedm = snemo::datamodel;
+
+  index_.hitCellSize = minXYSearchDistance_;
+  index_.vertexCellSize = minVertexDistance_;
+  if (!solution_.has_trajectories()) {
+    return;
+  }
+  const snedm::TrackerTrajectoryHdlCollection &the_trajectories = solution_.get_trajectories();
+  for (const datatools::handle<snedm::tracker_trajectory> &a_trajectory : the_trajectories) {
+    // Look into properties to find the default trajectory. Here,
+    // default means the one with the best chi2. This flag is set by the
+    // 'fitting' module.
+    if (!a_trajectory->get_auxiliaries().has_flag("default")) {
+      continue;
+    }
+
+    if (!a_trajectory->has_cluster()) {
+      continue;
+    }
+
+    const snedm::tracker_cluster &a_prompt_cluster = a_trajectory->get_cluster();
+    if (a_prompt_cluster.is_delayed()) {
+      continue;
+    }
+
+    const size_t track = index_.nTracks++;
+    for (const datatools::handle<snedm::calibrated_tracker_hit> &a_prompt_gg_hit :
+         a_prompt_cluster.hits()) {
+      const prompt_index::hit_entry a_hit{a_prompt_gg_hit->get_x(), a_prompt_gg_hit->get_y(),
+                                          a_prompt_gg_hit->get_z(),
+                                          a_prompt_gg_hit->get_sigma_z(), track};
+      prompt_index::insert(index_.hitGrid, index_.hitCellSize, a_hit.x, a_hit.y,
+                           index_.hits.size());
+      index_.hits.push_back(a_hit);
+    }
+
+    // Look for trajectories extremities
+    geomtools::vector_3d first = geomtools::invalid_vector_3d();
+    geomtools::vector_3d last = geomtools::invalid_vector_3d();
+    const snedm::base_trajectory_pattern &a_pattern = a_trajectory->get_pattern();
+    const std::string &a_pattern_id = a_pattern.get_pattern_id();
+    if (a_pattern_id == snedm::line_trajectory_pattern::pattern_id()) {
+      const auto &ltp = dynamic_cast<const snedm::line_trajectory_pattern &>(a_pattern);
+      first = ltp.get_segment().get_first();
+      last = ltp.get_segment().get_last();
+    } else if (a_pattern_id == snedm::helix_trajectory_pattern::pattern_id()) {
+      const auto &htp = dynamic_cast<const snedm::helix_trajectory_pattern &>(a_pattern);
+      first = htp.get_helix().get_first();
+      last = htp.get_helix().get_last();
+    }
+    for (const geomtools::vector_3d &a_vertex : {first, last}) {
+      if (!geomtools::is_valid(a_vertex)) {
+        continue;
+      }
+      prompt_index::insert(index_.vertexGrid, index_.vertexCellSize, a_vertex.x(), a_vertex.y(),
+                           index_.vertices.size());
+      index_.vertices.push_back(prompt_index::vertex_entry{a_vertex, track});
+    }
+  }
 }
 
 void alpha_finder_driver::_find_delayed_unfitted_cluster_(
     const snemo::datamodel::tracker_trajectory_data &tracker_trajectory_data_,
-    snemo::datamodel::particle_track_data &particle_track_data_) {
+    const prompt_index &index_, snemo::datamodel::particle_track_data &particle_track_data_) {
   namespace snedm = snemo::datamodel;
 
   // Check if the solution exist
@@ -102,7 +246,7 @@ void alpha_finder_driver::_find_delayed_unfitted_cluster_(
 
     geomtools::vector_3d associated_vertex = geomtools::invalid_vector_3d();
 
-    this->_find_short_track_(delayed_gg_hits, a_solution, particle_track_data_);
+    this->_find_short_track_(delayed_gg_hits, index_, particle_track_data_);
 
     // Add tracker cluster handle to trajectory
     if (particle_track_data_.hasParticles()) {
@@ -119,7 +263,7 @@ void alpha_finder_driver::_find_delayed_unfitted_cluster_(
 
 void alpha_finder_driver::_find_delayed_unclustered_hit_(
     const snemo::datamodel::tracker_trajectory_data &tracker_trajectory_data_,
-    snemo::datamodel::particle_track_data &particle_track_data_) {
+    const prompt_index &index_, snemo::datamodel::particle_track_data &particle_track_data_) {
   namespace snedm = snemo::datamodel;
 
   // Check if the solution exist
@@ -141,17 +285,17 @@ void alpha_finder_driver::_find_delayed_unclustered_hit_(
   const snedm::TrackerHitHdlCollection &unclustered_gg_hits =
       a_clustering_solution.get_unclustered_hits();
 
-  this->_find_short_track_(unclustered_gg_hits, a_solution, particle_track_data_, false);
+  this->_find_short_track_(unclustered_gg_hits, index_, particle_track_data_, false);
 }
 
 void alpha_finder_driver::_find_short_track_(
-    const snemo::datamodel::TrackerHitHdlCollection &hits_,
-    const snemo::datamodel::tracker_trajectory_solution &solution_,
+    const snemo::datamodel::TrackerHitHdlCollection &hits_, const prompt_index &index_,
     snemo::datamodel::particle_track_data &particle_track_data_, const bool hits_from_cluster) {
   namespace snedm = snemo::datamodel;
 
   geomtools::vector_3d associated_vertex = geomtools::invalid_vector_3d();
   bool has_associated_alpha = false;
+  std::vector<size_t> near_entries;
   // Loop on all the geiger hits of the unfitted cluster
   for (auto ihit = hits_.begin(); ihit != hits_.end(); ++ihit) {
     const snedm::calibrated_tracker_hit &a_delayed_gg_hit = ihit->get();
@@ -170,35 +314,22 @@ void alpha_finder_driver::_find_short_track_(
     }
 
     // Get prompt trajectories
-    if (!solution_.has_trajectories()) {
+    if (index_.nTracks == 0) {
       return;
     }
-    const snedm::TrackerTrajectoryHdlCollection &the_trajectories = solution_.get_trajectories();
-    // Loop on all the trajectories
-    for (const datatools::handle<snedm::tracker_trajectory> &a_trajectory : the_trajectories) {
-      // Look into properties to find the default trajectory. Here,
-      // default means the one with the best chi2. This flag is set by the
-      // 'fitting' module.
-      if (!a_trajectory->get_auxiliaries().has_flag("default")) {
-        continue;
-      }
-
-      if (!a_trajectory->has_cluster()) {
-        continue;
-      }
 
-      const snedm::tracker_cluster &a_prompt_cluster = a_trajectory->get_cluster();
-      if (a_prompt_cluster.is_delayed()) {
-        continue;
-      }
-
-      const snedm::TrackerHitHdlCollection &prompt_gg_hits = a_prompt_cluster.hits();
-      for (const datatools::handle<snedm::calibrated_tracker_hit> &a_prompt_gg_hit :
-           prompt_gg_hits) {
-        const geomtools::vector_2d a_prompt_position(a_prompt_gg_hit->get_x(),
-                                                     a_prompt_gg_hit->get_y());
-        const geomtools::vector_2d a_delayed_position(a_delayed_gg_hit.get_x(),
-                                                      a_delayed_gg_hit.get_y());
+    // Rank of the first default trajectory with a prompt hit close to the
+    // delayed hit: its extremities and those of the following trajectories
+    // are candidate vertices
+    size_t first_track = has_associated_alpha ? 0 : index_.nTracks;
+    if (!has_associated_alpha) {
+      const geomtools::vector_2d a_delayed_position(a_delayed_gg_hit.get_x(),
+                                                    a_delayed_gg_hit.get_y());
+      prompt_index::collect(index_.hitGrid, index_.hitCellSize, a_delayed_gg_hit.get_x(),
+                            a_delayed_gg_hit.get_y(), near_entries);
+      for (size_t ientry : near_entries) {
+        const prompt_index::hit_entry &a_prompt_hit = index_.hits[ientry];
+        const geomtools::vector_2d a_prompt_position(a_prompt_hit.x, a_prompt_hit.y);
         const double distance_xy = (a_delayed_position - a_prompt_position).mag();
 
         bool has_minimal_xy_search = false;
@@ -208,58 +339,42 @@ void alpha_finder_driver::_find_short_track_(
 
         const double z_delayed = a_delayed_gg_hit.get_z();
         const double sigma_z_delayed = a_delayed_gg_hit.get_sigma_z();
-        const double z_prompt = a_prompt_gg_hit->get_z();
-        const double sigma_z_prompt = a_prompt_gg_hit->get_sigma_z();
-        const double distance_z = std::abs(z_delayed - z_prompt);
-        const double sigma = sigma_z_delayed + sigma_z_prompt;
+        const double distance_z = std::abs(z_delayed - a_prompt_hit.z);
+        const double sigma = sigma_z_delayed + a_prompt_hit.sigmaZ;
         bool has_minimal_z_search = false;
         if ((distance_z - minZSearchDistance_) < sigma) {
           has_minimal_z_search = true;
         }
 
         if (has_minimal_xy_search && has_minimal_z_search) {
+          first_track = a_prompt_hit.track;
           has_associated_alpha = true;
           break;
         }
       }  // end of prompt gg hits
+    }
 
-      // Look for trajectories extremities
-      if (has_associated_alpha) {
-        geomtools::vector_3d first = geomtools::invalid_vector_3d();
-        geomtools::vector_3d last = geomtools::invalid_vector_3d();
-        const snedm::base_trajectory_pattern &a_pattern = a_trajectory->get_pattern();
-        const std::string &a_pattern_id = a_pattern.get_pattern_id();
-        if (a_pattern_id == snedm::line_trajectory_pattern::pattern_id()) {
-          auto ltp = dynamic_cast<const snedm::line_trajectory_pattern &>(a_pattern);
-          first = ltp.get_segment().get_first();
-          last = ltp.get_segment().get_last();
-        } else if (a_pattern_id == snedm::helix_trajectory_pattern::pattern_id()) {
-          auto htp = dynamic_cast<const snedm::helix_trajectory_pattern &>(a_pattern);
-          first = htp.get_helix().get_first();
-          last = htp.get_helix().get_last();
-        }
-        const geomtools::vector_3d a_delayed_position(
-            a_delayed_gg_hit.get_x(), a_delayed_gg_hit.get_y(), a_delayed_gg_hit.get_z());
-        if (geomtools::is_valid(first)) {
-          const double distance = (first - a_delayed_position).mag();
-          if (distance < minVertexDistance_ && distance < closest_vertex_distance) {
-            // set a new value for the closest vertex
-            closest_vertex_distance = distance;
-            associated_vertex = first;
-          }
+    // Look for trajectories extremities
+    if (has_associated_alpha) {
+      const geomtools::vector_3d a_delayed_position(
+          a_delayed_gg_hit.get_x(), a_delayed_gg_hit.get_y(), a_delayed_gg_hit.get_z());
+      prompt_index::collect(index_.vertexGrid, index_.vertexCellSize, a_delayed_gg_hit.get_x(),
+                            a_delayed_gg_hit.get_y(), near_entries);
+      for (size_t ientry : near_entries) {
+        const prompt_index::vertex_entry &a_vertex = index_.vertices[ientry];
+        if (a_vertex.track < first_track) {
+          continue;
         }
-        if (geomtools::is_valid(last)) {
-          const double distance = (last - a_delayed_position).mag();
-          // previous check was against the minimal vertex distance, but
-          // we want to check against the already asigned distance to see
-          // if this vertex is closer
-          if (distance < minVertexDistance_ && distance < closest_vertex_distance) {
-            closest_vertex_distance = distance;
-            associated_vertex = last;
-          }
+        // check against the already assigned distance to see if this vertex
+        // is closer
+        const double distance = (a_vertex.position - a_delayed_position).mag();
+        if (distance < minVertexDistance_ && distance < closest_vertex_distance) {
+          // set a new value for the closest vertex
+          closest_vertex_distance = distance;
+          associated_vertex = a_vertex.position;
         }
       }
-    }  // end of trajectories
+    }
 
     if (has_associated_alpha && geomtools::is_valid(associated_vertex)) {
       if (hits_from_cluster) {
@@ -95,22 +95,29 @@ class alpha_finder_driver {
   static void init_ocd(datatools::object_configuration_description& ocd_);
 
  private:
+  /// Per event index of the prompt default trajectories
+  struct prompt_index;
+
   /// Return a valid reference to the geometry manager
   const geomtools::manager& geoManager() const;
 
+  /// Index the prompt hits and the extremities of the default trajectories
+  void _build_prompt_index_(const snemo::datamodel::tracker_trajectory_solution& solution_,
+                            prompt_index& index_) const;
+
   /// Find the unfitted cluster (cluster with 1 or 2 Geiger hits)
   void _find_delayed_unfitted_cluster_(
       const snemo::datamodel::tracker_trajectory_data& tracker_trajectory_data_,
-      snemo::datamodel::particle_track_data& particle_track_data_);
+      const prompt_index& index_, snemo::datamodel::particle_track_data& particle_track_data_);
 
   /// Find the delayed unclustered hits
   void _find_delayed_unclustered_hit_(
       const snemo::datamodel::tracker_trajectory_data& tracker_trajectory_data_,
-      snemo::datamodel::particle_track_data& particle_track_data_);
+      const prompt_index& index_, snemo::datamodel::particle_track_data& particle_track_data_);
 
   /// Dedicated method to find short track
   void _find_short_track_(const snemo::datamodel::TrackerHitHdlCollection& hits_,
-                          const snemo::datamodel::tracker_trajectory_solution& solution_,
+                          const prompt_index& index_,
                           snemo::datamodel::particle_track_data& particle_track_data_,
                           const bool hits_from_cluster = true);
 
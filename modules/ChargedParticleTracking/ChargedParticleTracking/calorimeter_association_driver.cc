@@ -4,6 +4,7 @@
 #include <ChargedParticleTracking/calorimeter_association_driver.h>
 
 // Standard library:
+#include <algorithm>
 #include <sstream>
 
 // Third party:
@@ -72,27 +73,55 @@ calorimeter_association_driver::calorimeter_association_driver(const falaise::pr
   auto lpname = ps.get<std::string>("locator_plugin_name", "");
   geoLocator_ = snemo::geometry::getSNemoLocator(geoManager(), lpname);
   matchTolerance_ = ps.get<falaise::length_t>("matching_tolerance", {50, "mm"})();
+  engine_ = extrapolation_engine{*geoLocator_};
 }
 
 void calorimeter_association_driver::process(
     const snemo::datamodel::CalorimeterHitHdlCollection& calorimeter_hits_,
     snemo::datamodel::particle_track& particle_) {
+  // Calorimeter hits are only indexed and flagged for a particle with vertices
+  if (!particle_.has_vertices()) {
+    return;
+  }
+  this->_index_calorimeters_(calorimeter_hits_);
   this->_measure_matching_calorimeters_(calorimeter_hits_, particle_);
 }
 
-void calorimeter_association_driver::_measure_matching_calorimeters_(
+void calorimeter_association_driver::process(
     const snemo::datamodel::CalorimeterHitHdlCollection& calorimeter_hits_,
-    snemo::datamodel::particle_track& particle_) {
-  namespace snedm = snemo::datamodel;
-
-  if (!particle_.has_vertices()) {
+    snemo::datamodel::ParticleHdlCollection& particles_) {
+  // Calorimeter hits are only indexed and flagged if some particle has vertices
+  bool has_vertices = false;
+  for (const datatools::handle<snemo::datamodel::particle_track>& a_particle : particles_) {
+    if (a_particle->has_vertices()) {
+      has_vertices = true;
+      break;
+    }
+  }
+  if (!has_vertices) {
     return;
   }
+  this->_index_calorimeters_(calorimeter_hits_);
+  for (datatools::handle<snemo::datamodel::particle_track>& a_particle : particles_) {
+    this->_measure_matching_calorimeters_(calorimeter_hits_, *a_particle);
+  }
+}
+
+void calorimeter_association_driver::_index_calorimeters_(
+    const snemo::datamodel::CalorimeterHitHdlCollection& calorimeter_hits_) {
+  namespace snedm = snemo::datamodel;
+  hitIndex_.clear();
+  for (size_t i = 0; i < calorimeter_hits_.size(); i++) {
+    const extrapolation_engine::block_key key = engine_.key_of(calorimeter_hits_[i]->get_geom_id());
+    if (key != 0) {
+      hitIndex_.insert(std::make_pair(key, i));
+    }
+  }
 
   // When considering calorimeter hits, there might be some of them that are
   // neighbors. To avoid double count of same calorimeter due to tolerance
-  // matching in calorimeter association driver, we first compute the list
-  // of neighborhood calorimeter hits and if a vertex matches two of them,
+  // matching in calorimeter association driver, we first flag the
+  // neighbourhood calorimeter hits and if a vertex matches two of them,
   // we only keep the closest non-associated one.
   //
   //                     |-------
@@ -110,11 +139,9 @@ void calorimeter_association_driver::_measure_matching_calorimeters_(
   const snemo::geometry::calo_locator& calo_locator = geoLocator_->caloLocator();
   const snemo::geometry::xcalo_locator& xcalo_locator = geoLocator_->xcaloLocator();
   const snemo::geometry::gveto_locator& gveto_locator = geoLocator_->gvetoLocator();
-  // Get a list of neighbouring calorimeter hits
-  std::set<geomtools::geom_id> list_of_neighbours;
 
-  for (auto icalo = calorimeter_hits_.begin(); icalo != calorimeter_hits_.end(); ++icalo) {
-    const snedm::calibrated_calorimeter_hit& i_calo_hit = icalo->get();
+  for (size_t i = 0; i < calorimeter_hits_.size(); i++) {
+    const snedm::calibrated_calorimeter_hit& i_calo_hit = calorimeter_hits_[i].get();
     const geomtools::geom_id& a_current_gid = i_calo_hit.get_geom_id();
 
     std::vector<geomtools::geom_id> neighbour_ids;
@@ -126,18 +153,33 @@ void calorimeter_association_driver::_measure_matching_calorimeters_(
       neighbour_ids = gveto_locator.getNeighbourGIDs(a_current_gid);
     }
 
-    for (auto jcalo = std::next(icalo); jcalo != calorimeter_hits_.end(); ++jcalo) {
-      const snedm::calibrated_calorimeter_hit& j_calo_hit = jcalo->get();
-      const geomtools::geom_id& a_gid = j_calo_hit.get_geom_id();
-
-      if (std::find(neighbour_ids.begin(), neighbour_ids.end(), a_gid) != neighbour_ids.end()) {
-        list_of_neighbours.insert(a_gid);
-        list_of_neighbours.insert(a_current_gid);
-        calorimeter_utils::flag_as(i_calo_hit, calorimeter_utils::neighbor_flag());
-        calorimeter_utils::flag_as(j_calo_hit, calorimeter_utils::neighbor_flag());
+    // Neighbouring blocks with a hit, looked up by block
+    for (const geomtools::geom_id& a_gid : neighbour_ids) {
+      auto range = hitIndex_.equal_range(engine_.key_of(a_gid));
+      for (auto it = range.first; it != range.second; ++it) {
+        const snedm::calibrated_calorimeter_hit& j_calo_hit = calorimeter_hits_[it->second].get();
+        if (it->second != i && j_calo_hit.get_geom_id() == a_gid) {
+          calorimeter_utils::flag_as(i_calo_hit, calorimeter_utils::neighbor_flag());
+          calorimeter_utils::flag_as(j_calo_hit, calorimeter_utils::neighbor_flag());
+        }
       }
     }
   }
+}
+
+void calorimeter_association_driver::_measure_matching_calorimeters_(
+    const snemo::datamodel::CalorimeterHitHdlCollection& calorimeter_hits_,
+    snemo::datamodel::particle_track& particle_) {
+  namespace snedm = snemo::datamodel;
+
+  if (!particle_.has_vertices()) {
+    return;
+  }
+
+  // Set the calorimeter locators :
+  const snemo::geometry::calo_locator& calo_locator = geoLocator_->caloLocator();
+  const snemo::geometry::xcalo_locator& xcalo_locator = geoLocator_->xcaloLocator();
+  const snemo::geometry::gveto_locator& gveto_locator = geoLocator_->gvetoLocator();
 
   // Loop over reconstructed vertices
   snedm::particle_track::vertex_collection_type& the_vertices = particle_.get_vertices();
@@ -154,8 +196,24 @@ void calorimeter_association_driver::_measure_matching_calorimeters_(
 
     calo_collection_type calo_collection;
 
-    for (const datatools::handle<snedm::calibrated_calorimeter_hit>& a_calo_hit :
-         calorimeter_hits_) {
+    // Only the hits of the blocks close to the vertex can match, taken in
+    // their collection order
+    candidates_.clear();
+    engine_.candidate_blocks(a_vertex->get_position(), matchTolerance_, candidates_);
+    std::vector<size_t> candidate_hits;
+    for (const extrapolation_engine::block_key key : candidates_) {
+      auto range = hitIndex_.equal_range(key);
+      for (auto it = range.first; it != range.second; ++it) {
+        candidate_hits.push_back(it->second);
+      }
+    }
+    std::sort(candidate_hits.begin(), candidate_hits.end());
+    candidate_hits.erase(std::unique(candidate_hits.begin(), candidate_hits.end()),
+                         candidate_hits.end());
+
+    for (const size_t ihit : candidate_hits) {
+      const datatools::handle<snedm::calibrated_calorimeter_hit>& a_calo_hit =
+          calorimeter_hits_[ihit];
       const geomtools::geom_id& a_current_gid = a_calo_hit->get_geom_id();
 
       // Getting geometry mapping for parted block
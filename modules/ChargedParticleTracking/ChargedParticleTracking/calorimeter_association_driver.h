@@ -32,11 +32,19 @@
 #ifndef FALAISE_CHARGEDPARTICLETRACKING_PLUGIN_RECONSTRUCTION_CALORIMETER_ASSOCIATION_DRIVER_H
 #define FALAISE_CHARGEDPARTICLETRACKING_PLUGIN_RECONSTRUCTION_CALORIMETER_ASSOCIATION_DRIVER_H 1
 
+// Standard library:
+#include <unordered_map>
+#include <vector>
+
 #include <CLHEP/Units/SystemOfUnits.h>
 
 // this project
 #include <falaise/property_set.h>
 #include <falaise/snemo/datamodels/calibrated_data.h>
+#include <falaise/snemo/datamodels/particle_track.h>
+
+// This plugin
+#include <ChargedParticleTracking/extrapolation_engine.h>
 
 namespace datatools {
 class properties;
@@ -46,10 +54,6 @@ class manager;
 }
 namespace snemo {
 
-namespace datamodel {
-class particle_track;
-}
-
 namespace geometry {
 class locator_plugin;
 }
@@ -107,6 +111,10 @@ class calorimeter_association_driver {
   void process(const snemo::datamodel::CalorimeterHitHdlCollection& calorimeter_hits_,
                snemo::datamodel::particle_track& particle_);
 
+  /// Associate all particles of an event, indexing the calorimeter hits once
+  void process(const snemo::datamodel::CalorimeterHitHdlCollection& calorimeter_hits_,
+               snemo::datamodel::ParticleHdlCollection& particles_);
+
   /// OCD support:
   static void init_ocd(datatools::object_configuration_description& ocd_);
 
@@ -114,7 +122,11 @@ class calorimeter_association_driver {
   /// Return a valid reference to the geometry manager
   const geomtools::manager& geoManager() const;
 
-  /// Find matching calorimeters:
+  /// Index the calorimeter hits by block and flag the neighbouring ones
+  void _index_calorimeters_(
+      const snemo::datamodel::CalorimeterHitHdlCollection& calorimeter_hits_);
+
+  /// Find matching calorimeters among the indexed ones:
   void _measure_matching_calorimeters_(
       const snemo::datamodel::CalorimeterHitHdlCollection& calorimeter_hits_,
       snemo::datamodel::particle_track& particle_);
@@ -124,6 +136,10 @@ class calorimeter_association_driver {
   const geomtools::manager* geoManager_ = nullptr;               //<! The SuperNEMO geometry manager
   const snemo::geometry::locator_plugin* geoLocator_ = nullptr;  //!< The SuperNEMO locator plugin
   double matchTolerance_ = 50 * CLHEP::mm;  //<! Matching distance between vertex and calorimeter
+  extrapolation_engine engine_ = {};        //<! Calorimeter blocks close to a vertex
+  /// Indices of the calorimeter hits of the event, by block
+  std::unordered_multimap<extrapolation_engine::block_key, size_t> hitIndex_ = {};
+  std::vector<extrapolation_engine::block_key> candidates_ = {};  //<! Work buffer
 };
 
 }  // end of namespace reconstruction
@@ -4,8 +4,11 @@
 #include <ChargedParticleTracking/charged_particle_tracking_module.h>
 
 // Standard library:
+#include <algorithm>
 #include <sstream>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 // Third party:
 // - Bayeux/datatools:
@@ -21,6 +24,7 @@
 #include <falaise/snemo/datamodels/particle_track_data.h>
 #include <falaise/snemo/datamodels/tracker_clustering_data.h>
 #include <falaise/snemo/datamodels/tracker_trajectory_data.h>
+#include <falaise/snemo/geometry/locator_helpers.h>
 #include <falaise/snemo/services/services.h>
 
 // This plugin (ChargedParticleTracking):
@@ -43,6 +47,7 @@ void charged_particle_tracking_module::_set_defaults() {
   PTDTag_ = snedm::labels::particle_track_data();
 
   geoManager_ = snemo::service_handle<snemo::geometry_svc>{};
+  frontCells_.reset();
 
   VEAlgo_.reset();
   CCAlgo_.reset();
@@ -73,6 +78,14 @@ void charged_particle_tracking_module::initialize(
   // Geometry manager :
   geoManager_ = snemo::service_handle<snemo::geometry_svc>{service_manager_};
 
+  // Geiger cells in front of the scintillator blocks. Tolerance must be
+  // understood as 'skin' tolerance so must be multiplied by a factor of 2
+  const geomtools::manager& geo_mgr = *(geoManager_.operator->());
+  auto locator_plugin_name = ps.get<std::string>("locator_plugin_name", "");
+  frontCells_.initialize(geo_mgr,
+                         *snemo::geometry::getSNemoLocator(geo_mgr, locator_plugin_name),
+                         100 * CLHEP::mm);
+
   auto driver_names = ps.get<std::vector<std::string>>("drivers", {
                                                                       VertexExtrapolator::get_id(),
                                                                       ChargeCalculator::get_id(),
@@ -184,10 +197,11 @@ void charged_particle_tracking_module::_process(
     if (VEAlgo_) {
       VEAlgo_->process(*a_trajectory, *hPT);
     }
-    // Associate vertices to calorimeter hits
-    if (CAAlgo_) {
-      CAAlgo_->process(calibrated_data_.calorimeter_hits(), *hPT);
-    }
+  }
+
+  // Associate vertices of all particles to calorimeter hits
+  if (CAAlgo_) {
+    CAAlgo_->process(calibrated_data_.calorimeter_hits(), particle_track_data_.particles());
   }
 
   // Alpha finder
@@ -224,43 +238,87 @@ void charged_particle_tracking_module::_post_process(
   // consequently
   const snedm::TrackerHitHdlCollection& thits = calibrated_data_.tracker_hits();
   snedm::CalorimeterHitHdlCollection& chits = particle_track_data_.isolatedCalorimeters();
+  const double tolerance = frontCells_.getTolerance();
+
+  // Located tracker hits with their cell number, and the set of their cells
+  std::vector<std::pair<const snedm::calibrated_tracker_hit*, size_t>> located_hits;
+  snemo::geometry::front_cell_table::cell_set hit_cells(frontCells_.numberOfCells());
+  for (const datatools::handle<snedm::calibrated_tracker_hit>& a_tracker_hit : thits) {
+    if (!a_tracker_hit->has_xy()) {
+      continue;
+    }
+    const size_t cell = frontCells_.getCellNumber(a_tracker_hit->get_geom_id());
+    located_hits.emplace_back(a_tracker_hit.operator->(), cell);
+    if (cell < hit_cells.size()) {
+      hit_cells.set(cell);
+    }
+  }
+  // Located hits out of the cells of the table are always tested
+  const bool has_hits_out_of_table = std::any_of(
+      located_hits.begin(), located_hits.end(),
+      [&hit_cells](const std::pair<const snedm::calibrated_tracker_hit*, size_t>& located) {
+        return located.second >= hit_cells.size();
+      });
+
+  // Check if a located tracker hit is inside the tolerance volume of a block part
+  auto isInFront = [tolerance](const geomtools::geom_info& part,
+                               const snedm::calibrated_tracker_hit& a_tracker_hit) {
+    const geomtools::vector_3d cell_pos(a_tracker_hit.get_x(), a_tracker_hit.get_y(),
+                                        a_tracker_hit.get_z());
+    return geomtools::mapping::check_inside(part, cell_pos, tolerance, true);
+  };
 
   for (datatools::handle<snedm::calibrated_calorimeter_hit>& a_calo_hit : chits) {
     const bool has_neighbors =
         calorimeter_utils::has_flag(*a_calo_hit, calorimeter_utils::neighbor_flag());
     bool has_gg_in_front = false;
 
-    // Getting geometry mapping for parted block
-    const geomtools::mapping& the_mapping = geoManager_->get_mapping();
-    std::vector<geomtools::geom_id> gids;
-    the_mapping.compute_matching_geom_id(a_calo_hit->get_geom_id(), gids);
-
-    for (const geomtools::geom_id& a_gid : gids) {
-      const geomtools::geom_info* ginfo_ptr = the_mapping.get_geom_info_ptr(a_gid);
-      if (ginfo_ptr == nullptr) {
-        DT_LOG_WARNING(get_logging_priority(), "Unmapped geom id " << a_gid << "!");
-        continue;
+    const snemo::geometry::front_cell_table::block_entry* block =
+        frontCells_.findBlock(a_calo_hit->get_geom_id());
+    if (block != nullptr) {
+      // Only the hits of the cells in front of the block may be inside
+      const snemo::geometry::front_cell_table::cell_set candidates = block->cells & hit_cells;
+      if (candidates.any() || has_hits_out_of_table) {
+        for (const geomtools::geom_info* part : block->parts) {
+          for (const auto& located : located_hits) {
+            if (located.second < candidates.size() && !candidates.test(located.second)) {
+              continue;
+            }
+            if (isInFront(*part, *located.first)) {
+              has_gg_in_front = true;
+              break;
+            }
+          }
+          if (has_gg_in_front) {
+            break;
+          }
+        }
       }
-      // Loop over all calibrated geiger hits to find one close enough
-      for (const datatools::handle<snedm::calibrated_tracker_hit>& a_tracker_hit : thits) {
-        if (!a_tracker_hit->has_xy()) {
+    } else {
+      // Block out of the table: scan the mapping for its parts
+      const geomtools::mapping& the_mapping = geoManager_->get_mapping();
+      std::vector<geomtools::geom_id> gids;
+      the_mapping.compute_matching_geom_id(a_calo_hit->get_geom_id(), gids);
+
+      for (const geomtools::geom_id& a_gid : gids) {
+        const geomtools::geom_info* ginfo_ptr = the_mapping.get_geom_info_ptr(a_gid);
+        if (ginfo_ptr == nullptr) {
+          DT_LOG_WARNING(get_logging_priority(), "Unmapped geom id " << a_gid << "!");
           continue;
         }
-        const geomtools::vector_3d cell_pos(a_tracker_hit->get_x(), a_tracker_hit->get_y(),
-                                            a_tracker_hit->get_z());
-        // Tolerance must be understood as 'skin' tolerance so must be
-        // multiplied by a factor of 2
-        const double tolerance = 100 * CLHEP::mm;
-        if (geomtools::mapping::check_inside(*ginfo_ptr, cell_pos, tolerance, true)) {
-          has_gg_in_front = true;
+        // Loop over all calibrated geiger hits to find one close enough
+        for (const datatools::handle<snedm::calibrated_tracker_hit>& a_tracker_hit : thits) {
+          if (a_tracker_hit->has_xy() && isInFront(*ginfo_ptr, *a_tracker_hit)) {
+            has_gg_in_front = true;
+            break;
+          }
+        }  // end of tracker hits
+
+        if (has_gg_in_front) {
           break;
         }
-      }  // end of tracker hits
-
-      if (has_gg_in_front) {
-        break;
-      }
-    }  // end of calorimeter geom ids
+      }  // end of calorimeter geom ids
+    }
 
     if (!has_gg_in_front || (has_neighbors && has_gg_in_front)) {
       calorimeter_utils::flag_as(*a_calo_hit, calorimeter_utils::isolated_flag());
@@ -349,6 +407,24 @@ DOCD_CLASS_IMPLEMENT_LOAD_BEGIN(snemo::reconstruction::charged_particle_tracking
             "                                \n");
   }
 
+  {
+    // Description of the 'locator_plugin_name' configuration property :
+    datatools::configuration_property_description& cpd = ocd_.add_property_info();
+    cpd.set_name_pattern("locator_plugin_name")
+        .set_terse_description("The name of the geometry locator plugin")
+        .set_traits(datatools::TYPE_STRING)
+        .set_mandatory(false)
+        .set_long_description(
+            "The locators give the Geiger cells in front of each  \n"
+            "scintillator block, used to tag isolated calorimeter \n"
+            "hits. The first locator plugin is used by default.   \n")
+        .add_example(
+            "Use a given locator plugin::                 \n"
+            "                                             \n"
+            "  locator_plugin_name : string = \"locators_driver\" \n"
+            "                                             \n");
+  }
+
   {
     // Description of the 'drivers' configuration property :
     datatools::configuration_property_description& cpd = ocd_.add_property_info();
@@ -42,6 +42,7 @@
 // - Bayeux/dpp:
 #include <dpp/base_module.h>
 
+#include "falaise/snemo/geometry/front_cell_table.h"
 #include "falaise/snemo/services/geometry.h"
 #include "falaise/snemo/services/service_handle.h"
 
@@ -100,6 +101,9 @@ class charged_particle_tracking_module : public dpp::base_module {
   std::string TTDTag_;  //!< The label of the tracker trajectory data bank
   std::string PTDTag_;  //!< The label of the particle track data bank
 
+  /// Geiger cells in front of each scintillator block, for isolated calorimeter tagging
+  snemo::geometry::front_cell_table frontCells_;
+
   /// Vertex Extrapolation Driver :
   std::unique_ptr<snemo::reconstruction::vertex_extrapolation_driver> VEAlgo_;
 
@@ -0,0 +1,309 @@
+/// \file falaise/snemo/reconstruction/extrapolation_engine.cc
+
+// Ourselves:
+#include <ChargedParticleTracking/extrapolation_engine.h>
+
+// Standard library:
+#include <algorithm>
+#include <cmath>
+
+// Third party:
+// - Bayeux/datatools:
+#include <datatools/exception.h>
+#include <datatools/utils.h>
+// - Bayeux/geomtools:
+#include <geomtools/helix_3d.h>
+#include <geomtools/line_3d.h>
+
+// This project (Falaise):
+#include <falaise/snemo/geometry/calo_locator.h>
+#include <falaise/snemo/geometry/gveto_locator.h>
+#include <falaise/snemo/geometry/locator_plugin.h>
+#include <falaise/snemo/geometry/xcalo_locator.h>
+
+namespace snemo {
+
+namespace reconstruction {
+
+namespace {
+using snedm_pt = snemo::datamodel::particle_track;
+
+/// Coordinate of a point along an axis
+double coordinate(const geomtools::vector_3d& point_, int axis_) {
+  return axis_ == 0 ? point_.x() : (axis_ == 1 ? point_.y() : point_.z());
+}
+}  // namespace
+
+extrapolation_engine::extrapolation_engine(const snemo::geometry::locator_plugin& locators) {
+  namespace sng = snemo::geometry;
+  locators_ = &locators;
+  const sng::calo_locator& calo_locator = locators.caloLocator();
+  const sng::xcalo_locator& xcalo_locator = locators.xcaloLocator();
+  const sng::gveto_locator& gveto_locator = locators.gvetoLocator();
+
+  const uint32_t sides[2] = {sng::side_t::BACK, sng::side_t::FRONT};
+  const uint32_t xwalls[2] = {sng::xcalo_wall_t::LEFT, sng::xcalo_wall_t::RIGHT};
+  const uint32_t gwalls[2] = {sng::gveto_wall_t::BOTTOM, sng::gveto_wall_t::TOP};
+
+  // Surfaces, in the order the vertex extrapolation has always considered them:
+  for (const uint32_t side : sides) {
+    std::vector<surface>& surfaces = surfaces_[side];
+    surfaces.push_back({snedm_pt::VERTEX_ON_SOURCE_FOIL, 0, 0.0 * CLHEP::mm});
+    for (const uint32_t s : sides) {
+      surfaces.push_back(
+          {snedm_pt::VERTEX_ON_MAIN_CALORIMETER, 0, calo_locator.getXCoordOfWallWindow(s)});
+    }
+    for (const uint32_t w : xwalls) {
+      surfaces.push_back(
+          {snedm_pt::VERTEX_ON_X_CALORIMETER, 1, xcalo_locator.getYCoordOfWallWindow(side, w)});
+    }
+    for (const uint32_t w : gwalls) {
+      surfaces.push_back(
+          {snedm_pt::VERTEX_ON_GAMMA_VETO, 2, gveto_locator.getZCoordOfWallWindow(side, w)});
+    }
+  }
+
+  // Block grids of the calorimeter walls:
+  auto sorted = [](std::vector<std::pair<double, uint32_t> >& coordinates) {
+    std::sort(coordinates.begin(), coordinates.end());
+  };
+  for (const uint32_t side : sides) {
+    if (calo_locator.hasSubmodule(side)) {
+      block_grid grid{snedm_pt::VERTEX_ON_MAIN_CALORIMETER,
+                      side,
+                      0,
+                      0,
+                      calo_locator.getXCoordOfWallWindow(side),
+                      1,
+                      2,
+                      {},
+                      {}};
+      for (uint32_t c = 0; c < calo_locator.numberOfColumns(side); c++) {
+        grid.columns.push_back({calo_locator.getYCoordOfColumn(side, c), c});
+      }
+      for (uint32_t r = 0; r < calo_locator.numberOfRows(side); r++) {
+        grid.rows.push_back({calo_locator.getZCoordOfRow(side, r), r});
+      }
+      sorted(grid.columns);
+      sorted(grid.rows);
+      grids_.push_back(grid);
+    }
+    if (xcalo_locator.hasSubmodule(side)) {
+      for (const uint32_t w : xwalls) {
+        block_grid grid{snedm_pt::VERTEX_ON_X_CALORIMETER,
+                        side,
+                        w,
+                        1,
+                        xcalo_locator.getYCoordOfWallWindow(side, w),
+                        0,
+                        2,
+                        {},
+                        {}};
+        for (uint32_t c = 0; c < xcalo_locator.numberOfColumns(side, w); c++) {
+          grid.columns.push_back({xcalo_locator.getXCoordOfColumn(side, w, c), c});
+        }
+        for (uint32_t r = 0; r < xcalo_locator.numberOfRows(side, w); r++) {
+          grid.rows.push_back({xcalo_locator.getZCoordOfRow(side, w, r), r});
+        }
+        sorted(grid.columns);
+        sorted(grid.rows);
+        grids_.push_back(grid);
+      }
+    }
+    if (gveto_locator.hasSubmodule(side)) {
+      for (const uint32_t w : gwalls) {
+        block_grid grid{snedm_pt::VERTEX_ON_GAMMA_VETO,
+                        side,
+                        w,
+                        2,
+                        gveto_locator.getZCoordOfWallWindow(side, w),
+                        1,
+                        -1,
+                        {},
+                        {}};
+        for (uint32_t c = 0; c < gveto_locator.numberOfColumns(side, w); c++) {
+          grid.columns.push_back({gveto_locator.getYCoordOfColumn(side, w, c), c});
+        }
+        sorted(grid.columns);
+        grids_.push_back(grid);
+      }
+    }
+  }
+}
+
+void extrapolation_engine::intersect(const geomtools::line_3d& line_, uint32_t side_,
+                                     std::vector<intersection>& intersections_) const {
+  DT_THROW_IF(side_ > 1, std::range_error, "Invalid side " << side_ << " !");
+  const geomtools::vector_3d& first = line_.get_first();
+  const geomtools::vector_3d& last = line_.get_last();
+  const geomtools::vector_3d direction = first - last;
+
+  const size_t offset = intersections_.size();
+  for (const surface& s : surfaces_[side_]) {
+    double x = 0.0;
+    double y = 0.0;
+    double z = 0.0;
+    if (s.axis == 0) {
+      x = s.coordinate;
+      y = direction.y() / direction.x() * (x - first.x()) + first.y();
+      z = direction.z() / direction.y() * (y - first.y()) + first.z();
+    } else if (s.axis == 1) {
+      y = s.coordinate;
+      z = direction.z() / direction.y() * (y - first.y()) + first.z();
+      x = direction.x() / direction.y() * (y - first.y()) + first.x();
+    } else {
+      z = s.coordinate;
+      y = direction.y() / direction.z() * (z - first.z()) + first.y();
+      x = direction.x() / direction.y() * (y - first.y()) + first.x();
+    }
+    intersections_.push_back(
+        {s.category, geomtools::vector_3d(x, y, z), datatools::invalid_real()});
+  }
+
+  // Order by position, keeping the first of identical points
+  auto begin = intersections_.begin() + offset;
+  auto less = [](const intersection& a, const intersection& b) {
+    return a.position < b.position;
+  };
+  std::stable_sort(begin, intersections_.end(), less);
+  auto same = [&less](const intersection& a, const intersection& b) {
+    return !less(a, b) && !less(b, a);
+  };
+  intersections_.erase(std::unique(begin, intersections_.end(), same), intersections_.end());
+}
+
+void extrapolation_engine::intersect(const geomtools::helix_3d& helix_, uint32_t side_,
+                                     std::vector<intersection>& intersections_) const {
+  DT_THROW_IF(side_ > 1, std::range_error, "Invalid side " << side_ << " !");
+  const geomtools::vector_3d& hcenter = helix_.get_center();
+  const double hradius = helix_.get_radius();
+  const geomtools::vector_3d no_position = geomtools::invalid_vector_3d();
+
+  const size_t offset = intersections_.size();
+  for (const surface& s : surfaces_[side_]) {
+    if (s.axis == 0) {
+      const double cangle = (s.coordinate - hcenter.x()) / hradius;
+      if (std::fabs(cangle) < 1.0) {
+        const double angle = std::acos(cangle);
+        intersections_.push_back(
+            {s.category, no_position, geomtools::helix_3d::angle_to_t(+angle)});
+        intersections_.push_back(
+            {s.category, no_position, geomtools::helix_3d::angle_to_t(-angle)});
+      }
+    } else if (s.axis == 1) {
+      const double cangle = (s.coordinate - hcenter.y()) / hradius;
+      if (std::fabs(cangle) < 1.0) {
+        double angle = std::asin(cangle);
+        intersections_.push_back({s.category, no_position, geomtools::helix_3d::angle_to_t(angle)});
+        const double mean_angle = (helix_.get_angle1() + helix_.get_angle2()) / 2.0;
+        angle = (mean_angle < 0.0) ? (-M_PI - angle) : (+M_PI - angle);
+        intersections_.push_back({s.category, no_position, geomtools::helix_3d::angle_to_t(angle)});
+      }
+    } else {
+      intersections_.push_back({s.category, no_position, helix_.get_t_from_z(s.coordinate)});
+    }
+  }
+
+  // Order by helix parameter, keeping the first of identical values
+  auto begin = intersections_.begin() + offset;
+  std::stable_sort(begin, intersections_.end(),
+                   [](const intersection& a, const intersection& b) { return a.t < b.t; });
+  intersections_.erase(
+      std::unique(begin, intersections_.end(),
+                  [](const intersection& a, const intersection& b) { return a.t == b.t; }),
+      intersections_.end());
+}
+
+extrapolation_engine::block_key extrapolation_engine::make_key(vertex_type category_,
+                                                               uint32_t side_, uint32_t wall_,
+                                                               uint32_t column_, uint32_t row_) {
+  return (static_cast<block_key>(category_) << 56) | (static_cast<block_key>(side_ & 0xFF) << 48) |
+         (static_cast<block_key>(wall_ & 0xFF) << 40) |
+         (static_cast<block_key>(column_ & 0xFFFFF) << 20) | static_cast<block_key>(row_ & 0xFFFFF);
+}
+
+extrapolation_engine::block_key extrapolation_engine::key_of(
+    const geomtools::geom_id& gid_) const {
+  DT_THROW_IF(locators_ == nullptr, std::logic_error, "Extrapolation engine has no locators !");
+  const snemo::geometry::calo_locator& calo_locator = locators_->caloLocator();
+  if (calo_locator.isCaloBlockInThisModule(gid_)) {
+    return make_key(snedm_pt::VERTEX_ON_MAIN_CALORIMETER, calo_locator.getSideAddress(gid_), 0,
+                    calo_locator.getColumnAddress(gid_), calo_locator.getRowAddress(gid_));
+  }
+  const snemo::geometry::xcalo_locator& xcalo_locator = locators_->xcaloLocator();
+  if (xcalo_locator.isCaloBlockInThisModule(gid_)) {
+    return make_key(snedm_pt::VERTEX_ON_X_CALORIMETER, xcalo_locator.getSideAddress(gid_),
+                    xcalo_locator.getWallAddress(gid_), xcalo_locator.getColumnAddress(gid_),
+                    xcalo_locator.getRowAddress(gid_));
+  }
+  const snemo::geometry::gveto_locator& gveto_locator = locators_->gvetoLocator();
+  if (gveto_locator.isCaloBlockInThisModule(gid_)) {
+    return make_key(snedm_pt::VERTEX_ON_GAMMA_VETO, gveto_locator.getSideAddress(gid_),
+                    gveto_locator.getWallAddress(gid_), gveto_locator.getColumnAddress(gid_), 0);
+  }
+  return 0;
+}
+
+void extrapolation_engine::nearest_(const std::vector<std::pair<double, uint32_t> >& coordinates_,
+                                    double x_, double distance_,
+                                    std::vector<uint32_t>& numbers_) {
+  numbers_.clear();
+  if (coordinates_.empty()) {
+    return;
+  }
+  auto it = std::lower_bound(coordinates_.begin(), coordinates_.end(),
+                             std::make_pair(x_, uint32_t(0)));
+  size_t i = it - coordinates_.begin();
+  if (i == coordinates_.size() ||
+      (i > 0 && x_ - coordinates_[i - 1].first < coordinates_[i].first - x_)) {
+    i--;
+  }
+  // The point lies within half a pitch of the nearest block, so the window of
+  // the k-th neighbour is within the distance if (k - 1) * pitch <= distance
+  size_t span = coordinates_.size();
+  const double pitch = (i + 1 < coordinates_.size())
+                           ? coordinates_[i + 1].first - coordinates_[i].first
+                           : (i > 0 ? coordinates_[i].first - coordinates_[i - 1].first : 0.0);
+  if (pitch > 0.0) {
+    span = std::min(span, static_cast<size_t>(std::floor(distance_ / pitch)) + 1);
+  }
+  // Nearest one, then its neighbours on both sides
+  numbers_.push_back(coordinates_[i].second);
+  for (size_t k = 1; k <= span; k++) {
+    if (i >= k) {
+      numbers_.push_back(coordinates_[i - k].second);
+    }
+    if (i + k < coordinates_.size()) {
+      numbers_.push_back(coordinates_[i + k].second);
+    }
+  }
+}
+
+void extrapolation_engine::candidate_blocks(const geomtools::vector_3d& point_, double distance_,
+                                            std::vector<block_key>& keys_) const {
+  std::vector<uint32_t> columns;
+  std::vector<uint32_t> rows;
+  for (const block_grid& grid : grids_) {
+    // Blocks lie behind their entrance window, as seen from the tracker
+    if (std::abs(coordinate(point_, grid.normal_axis) - grid.window) > distance_) {
+      continue;
+    }
+    nearest_(grid.columns, coordinate(point_, grid.column_axis), distance_, columns);
+    if (grid.row_axis < 0) {
+      rows.assign(1, 0);
+    } else {
+      nearest_(grid.rows, coordinate(point_, grid.row_axis), distance_, rows);
+    }
+    for (const uint32_t c : columns) {
+      for (const uint32_t r : rows) {
+        keys_.push_back(make_key(grid.category, grid.side, grid.wall, c, r));
+      }
+    }
+  }
+}
+
+}  // end of namespace reconstruction
+
+}  // end of namespace snemo
+
+// end of falaise/snemo/reconstruction/extrapolation_engine.cc
@@ -0,0 +1,138 @@
+/// \file falaise/snemo/reconstruction/extrapolation_engine.h
+/* Description:
+ *
+ *   Intersections of tracker trajectories with the detector surfaces, and
+ *   calorimeter blocks close to a point, shared by the vertex extrapolation
+ *   and calorimeter association drivers.
+ *
+ */
+
+#ifndef FALAISE_CHARGEDPARTICLETRACKING_PLUGIN_RECONSTRUCTION_EXTRAPOLATION_ENGINE_H
+#define FALAISE_CHARGEDPARTICLETRACKING_PLUGIN_RECONSTRUCTION_EXTRAPOLATION_ENGINE_H 1
+
+// Standard library:
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Third party:
+// - Bayeux/geomtools:
+#include <geomtools/clhep.h>
+#include <geomtools/geom_id.h>
+
+// This project:
+#include "falaise/snemo/datamodels/particle_track.h"
+
+namespace geomtools {
+class helix_3d;
+class line_3d;
+}  // namespace geomtools
+
+namespace snemo {
+
+namespace geometry {
+class locator_plugin;
+}
+
+namespace reconstruction {
+
+/// \brief Extrapolation of tracker trajectories to the detector surfaces
+/*!
+ * The coordinates of the source foil, calorimeter walls, X-walls and gamma
+ * vetoes of both sides, together with the grids of calorimeter blocks, are
+ * read once from the locators at construction. Intersections are then
+ * computed against this table without any further geometry lookup.
+ *
+ * Calorimeter blocks are identified by a block_key, an integer packing the
+ * vertex category, side, wall, column and row of the block (the part of
+ * partitioned blocks is ignored), so that calorimeter hits can be indexed
+ * in hash tables and looked up from an extrapolated position.
+ */
+class extrapolation_engine {
+ public:
+  /// Typed category of a surface, and of the vertices on it
+  using vertex_type = snemo::datamodel::particle_track::vertex_type;
+
+  /// Packed address of a calorimeter block (0 for none)
+  using block_key = uint64_t;
+
+  /// Intersection of a trajectory with a detector surface
+  struct intersection {
+    vertex_type category;           //!< Surface category
+    geomtools::vector_3d position;  //!< Intersection point (line trajectories)
+    double t;                       //!< Helix parameter (helix trajectories)
+  };
+
+  /// Default constructor
+  extrapolation_engine() = default;
+
+  /// Construct from the locators of a module
+  explicit extrapolation_engine(const snemo::geometry::locator_plugin& locators);
+
+  /// Compute the intersections of a line with the surfaces seen from a side
+  void intersect(const geomtools::line_3d& line_, uint32_t side_,
+                 std::vector<intersection>& intersections_) const;
+
+  /// Compute the intersections of a helix with the surfaces seen from a side
+  void intersect(const geomtools::helix_3d& helix_, uint32_t side_,
+                 std::vector<intersection>& intersections_) const;
+
+  /// Return the key of a calorimeter block of the module, 0 otherwise
+  block_key key_of(const geomtools::geom_id& gid_) const;
+
+  /// Append the keys of the calorimeter blocks whose entrance window may lie
+  /// within a distance of a point
+  ///
+  /// The block facing the point is returned with its neighbours, as many on
+  /// each side as needed to cover the distance with blocks of the local pitch.
+  void candidate_blocks(const geomtools::vector_3d& point_, double distance_,
+                        std::vector<block_key>& keys_) const;
+
+  /// Pack the address of a calorimeter block
+  static block_key make_key(vertex_type category_, uint32_t side_, uint32_t wall_,
+                            uint32_t column_, uint32_t row_);
+
+ private:
+  /// Plane of constant coordinate along one axis
+  struct surface {
+    vertex_type category;
+    int axis;
+    double coordinate;
+  };
+
+  /// Grid of blocks of one calorimeter wall
+  struct block_grid {
+    vertex_type category;
+    uint32_t side;
+    uint32_t wall;
+    int normal_axis;    //!< Axis normal to the entrance windows
+    double window;      //!< Coordinate of the entrance windows along the normal axis
+    int column_axis;    //!< Axis along which columns are numbered
+    int row_axis;       //!< Axis along which rows are numbered (-1 if the wall has a single row)
+    std::vector<std::pair<double, uint32_t> > columns;  //!< Sorted column coordinates and numbers
+    std::vector<std::pair<double, uint32_t> > rows;     //!< Sorted row coordinates and numbers
+  };
+
+  /// Set the numbers of the nearest column or row and of its neighbours within a distance
+  static void nearest_(const std::vector<std::pair<double, uint32_t> >& coordinates_, double x_,
+                       double distance_, std::vector<uint32_t>& numbers_);
+
+  const snemo::geometry::locator_plugin* locators_ = nullptr;  //!< Locators of the module
+  std::vector<surface> surfaces_[2] = {};                       //!< Surfaces seen from each side
+  std::vector<block_grid> grids_ = {};                          //!< Calorimeter walls
+};
+
+}  // end of namespace reconstruction
+
+}  // end of namespace snemo
+
+#endif  // FALAISE_CHARGEDPARTICLETRACKING_PLUGIN_RECONSTRUCTION_EXTRAPOLATION_ENGINE_H
+
+// end of falaise/snemo/reconstruction/extrapolation_engine.h
+/*
+** Local Variables: --
+** mode: c++ --
+** c-file-style: "gnu" --
+** tab-width: 2 --
+** End: --
+*/
@@ -17,12 +17,9 @@
 #include <falaise/snemo/datamodels/line_trajectory_pattern.h>
 #include <falaise/snemo/datamodels/tracker_trajectory.h>
 
-#include <falaise/snemo/geometry/calo_locator.h>
 #include <falaise/snemo/geometry/gg_locator.h>
-#include <falaise/snemo/geometry/gveto_locator.h>
 #include <falaise/snemo/geometry/locator_helpers.h>
 #include <falaise/snemo/geometry/locator_plugin.h>
-#include <falaise/snemo/geometry/xcalo_locator.h>
 
 namespace snemo {
 
@@ -46,6 +43,7 @@ vertex_extrapolation_driver::vertex_extrapolation_driver(const falaise::property
   geoManager_ = gm;
   auto locator_plugin_name = ps.get<std::string>("locator_plugin_name", "");
   geoLocator_ = snemo::geometry::getSNemoLocator(geoManager(), locator_plugin_name);
+  engine_ = extrapolation_engine{*geoLocator_};
 }
 
 void vertex_extrapolation_driver::process(const snemo::datamodel::tracker_trajectory &trajectory_,
@@ -71,21 +69,6 @@ void vertex_extrapolation_driver::_measure_vertices_(
   }
   const int side = id_mgr.get(gid, "side");
 
-  // Set the calorimeter locators :
-  const snemo::geometry::calo_locator &calo_locator = geoLocator_->caloLocator();
-  const snemo::geometry::xcalo_locator &xcalo_locator = geoLocator_->xcaloLocator();
-  const snemo::geometry::gveto_locator &gveto_locator = geoLocator_->gvetoLocator();
-  // TODO: Add source strip locator...
-
-  const double xcalo_bd[2] = {calo_locator.getXCoordOfWallWindow(snemo::geometry::side_t::BACK),
-                              calo_locator.getXCoordOfWallWindow(snemo::geometry::side_t::FRONT)};
-  const double ycalo_bd[2] = {
-      xcalo_locator.getYCoordOfWallWindow(side, snemo::geometry::xcalo_wall_t::LEFT),
-      xcalo_locator.getYCoordOfWallWindow(side, snemo::geometry::xcalo_wall_t::RIGHT)};
-  const double zcalo_bd[2] = {
-      gveto_locator.getZCoordOfWallWindow(side, snemo::geometry::gveto_wall_t::BOTTOM),
-      gveto_locator.getZCoordOfWallWindow(side, snemo::geometry::gveto_wall_t::TOP)};
-
   // Check Geiger cell location wrt to vertex extrapolation
   this->_check_vertices_(trajectory_);
 
@@ -94,11 +77,10 @@ void vertex_extrapolation_driver::_measure_vertices_(
   const std::string &a_pattern_id = a_track_pattern.get_pattern_id();
 
   // Extrapolated vertices:
-  using vertex_dict_type = std::vector<std::pair<std::string, geomtools::vector_3d> >;
+  using vertex_type = snedm::particle_track::vertex_type;
+  using vertex_dict_type = std::vector<std::pair<vertex_type, geomtools::vector_3d> >;
   vertex_dict_type vertices;
-
-  // Add a property into 'blur_spot' auxiliaries to refer to the hit calo:
-  std::string calo_category_flag;
+  auto is_used = [this](vertex_type category) { return (usedVertices_ & category) != 0u; };
 
   // ----- Start of line pattern handling
   if (a_pattern_id == snedm::line_trajectory_pattern::pattern_id()) {
@@ -106,72 +88,21 @@ void vertex_extrapolation_driver::_measure_vertices_(
     const geomtools::line_3d &a_line = ltp.get_segment();
     const geomtools::vector_3d &first = a_line.get_first();
     const geomtools::vector_3d &last = a_line.get_last();
-    const geomtools::vector_3d direction = first - last;
 
     // Calculate intersection on each geometric object
-    using vertex_list_type = std::map<geomtools::vector_3d, std::string>;
-    vertex_list_type vtxlist;
-    // Source foil:
-    {
-      const double x = 0.0 * CLHEP::mm;
-      const double y = direction.y() / direction.x() * (x - first.x()) + first.y();
-      const double z = direction.z() / direction.y() * (y - first.y()) + first.z();
-
-      // Extrapolated vertex:
-      const geomtools::vector_3d a_vertex(x, y, z);
-      vtxlist.insert(
-          std::make_pair(a_vertex, snedm::particle_track::vertex_on_source_foil_label()));
-    }
-
-    // Calorimeter walls:
-    {
-      for (const double x : xcalo_bd) {
-        const double y = direction.y() / direction.x() * (x - first.x()) + first.y();
-        const double z = direction.z() / direction.y() * (y - first.y()) + first.z();
-
-        // Extrapolated vertex
-        const geomtools::vector_3d a_vertex(x, y, z);
-        vtxlist.insert(
-            std::make_pair(a_vertex, snedm::particle_track::vertex_on_main_calorimeter_label()));
-      }
-    }
-
-    // Calorimeter on xwalls
-    {
-      for (const double y : ycalo_bd) {
-        const double z = direction.z() / direction.y() * (y - first.y()) + first.z();
-        const double x = direction.x() / direction.y() * (y - first.y()) + first.x();
-
-        // Extrapolate vertex
-        const geomtools::vector_3d a_vertex(x, y, z);
-        vtxlist.insert(
-            std::make_pair(a_vertex, snedm::particle_track::vertex_on_x_calorimeter_label()));
-      }
-    }
-
-    // Calorimeter on gveto
-    {
-      for (const double z : zcalo_bd) {
-        const double y = direction.y() / direction.z() * (z - first.z()) + first.y();
-        const double x = direction.x() / direction.y() * (y - first.y()) + first.x();
-
-        // Extrapolate vertex
-        const geomtools::vector_3d a_vertex(x, y, z);
-        vtxlist.insert(
-            std::make_pair(a_vertex, snedm::particle_track::vertex_on_gamma_veto_label()));
-      }
-    }
+    intersections_.clear();
+    engine_.intersect(a_line, side, intersections_);
 
     // This *looks* like it finds the two vertices closest to the end points of
     // the line pattern
     std::pair<double, double> min_distances;
     datatools::infinity(min_distances.first);
     datatools::infinity(min_distances.second);
-    auto jt1 = vtxlist.begin();
-    auto jt2 = vtxlist.begin();
-    for (auto it = vtxlist.begin(); it != vtxlist.end(); ++it) {
-      const double l1 = (first - it->first).mag();
-      const double l2 = (last - it->first).mag();
+    auto jt1 = intersections_.begin();
+    auto jt2 = intersections_.begin();
+    for (auto it = intersections_.begin(); it != intersections_.end(); ++it) {
+      const double l1 = (first - it->position).mag();
+      const double l2 = (last - it->position).mag();
 
       if (l1 < l2) {
         if (l1 > min_distances.first) {
@@ -190,87 +121,27 @@ void vertex_extrapolation_driver::_measure_vertices_(
 
     // Create a mutable line object to set the new position
     auto a_mutable_line = const_cast<geomtools::line_3d *>(&a_line);
-    if (_use_vertices_[jt1->second]) {
-      a_mutable_line->set_first(jt1->first);
-      vertices.push_back(std::make_pair(jt1->second, jt1->first));
+    if (is_used(jt1->category)) {
+      a_mutable_line->set_first(jt1->position);
+      vertices.push_back(std::make_pair(jt1->category, jt1->position));
     } else {
-      vertices.push_back(
-          std::make_pair(snedm::particle_track::vertex_on_wire_label(), a_line.get_first()));
+      vertices.push_back(std::make_pair(snedm::particle_track::VERTEX_ON_WIRE, a_line.get_first()));
     }
-    if (_use_vertices_[jt2->second]) {
-      a_mutable_line->set_last(jt2->first);
-      vertices.push_back(std::make_pair(jt2->second, jt2->first));
+    if (is_used(jt2->category)) {
+      a_mutable_line->set_last(jt2->position);
+      vertices.push_back(std::make_pair(jt2->category, jt2->position));
     } else {
-      vertices.push_back(
-          std::make_pair(snedm::particle_track::vertex_on_wire_label(), a_line.get_last()));
+      vertices.push_back(std::make_pair(snedm::particle_track::VERTEX_ON_WIRE, a_line.get_last()));
     }
   }  // ----- end of line pattern handling
   // ---- start of helix pattern handling
   else if (a_pattern_id == snedm::helix_trajectory_pattern::pattern_id()) {
     const auto &htp = dynamic_cast<const snedm::helix_trajectory_pattern &>(a_track_pattern);
     const geomtools::helix_3d &a_helix = htp.get_helix();
-    const geomtools::vector_3d &hcenter = a_helix.get_center();
-    const double hradius = a_helix.get_radius();
-
-    // Store all the computed t parameter values
-    std::map<double, std::string> tparams;
-
-    // Source foil
-    {
-      const double xfoil = 0.0 * CLHEP::mm;
-      const double xcenter = hcenter.x();
-      const double cangle = (xfoil - xcenter) / hradius;
-
-      if (std::fabs(cangle) < 1.0) {
-        const double angle = std::acos(cangle);
-        tparams.insert(std::make_pair(geomtools::helix_3d::angle_to_t(+angle),
-                                      snedm::particle_track::vertex_on_source_foil_label()));
-        tparams.insert(std::make_pair(geomtools::helix_3d::angle_to_t(-angle),
-                                      snedm::particle_track::vertex_on_source_foil_label()));
-      }
-    }
-
-    // Calorimeter walls
-    {
-      for (const double xwall : xcalo_bd) {
-        const double xcenter = hcenter.x();
-        const double cangle = (xwall - xcenter) / hradius;
-
-        if (std::fabs(cangle) < 1.0) {
-          const double angle = std::acos(cangle);
-          tparams.insert(std::make_pair(geomtools::helix_3d::angle_to_t(+angle),
-                                        snedm::particle_track::vertex_on_main_calorimeter_label()));
-          tparams.insert(std::make_pair(geomtools::helix_3d::angle_to_t(-angle),
-                                        snedm::particle_track::vertex_on_main_calorimeter_label()));
-        }
-      }
-    }
 
-    // X-walls
-    {
-      for (const double ywall : ycalo_bd) {
-        const double ycenter = hcenter.y();
-        const double cangle = (ywall - ycenter) / hradius;
-
-        if (std::fabs(cangle) < 1.0) {
-          double angle = std::asin(cangle);
-          tparams.insert(std::make_pair(geomtools::helix_3d::angle_to_t(angle),
-                                        snedm::particle_track::vertex_on_x_calorimeter_label()));
-          const double mean_angle = (a_helix.get_angle1() + a_helix.get_angle2()) / 2.0;
-          angle = (mean_angle < 0.0) ? (-M_PI - angle) : (+M_PI - angle);
-          tparams.insert(std::make_pair(geomtools::helix_3d::angle_to_t(angle),
-                                        snedm::particle_track::vertex_on_x_calorimeter_label()));
-        }
-      }
-    }
-
-    // Gvetos
-    {
-      for (const double gwall : zcalo_bd) {
-        const double t = a_helix.get_t_from_z(gwall);
-        tparams.insert(std::make_pair(t, snedm::particle_track::vertex_on_gamma_veto_label()));
-      }
-    }
+    // Compute the t parameter values of all intersections, in increasing order
+    intersections_.clear();
+    engine_.intersect(a_helix, side, intersections_);
 
     // Choose which helix angle to change
     const double t1 = a_helix.get_t1();
@@ -280,11 +151,12 @@ void vertex_extrapolation_driver::_measure_vertices_(
     std::pair<double, double> min_distances;
     datatools::infinity(min_distances.first);
     datatools::infinity(min_distances.second);
-    std::pair<std::string, std::string> category_flags;
+    std::pair<vertex_type, vertex_type> category_flags(snedm::particle_track::VERTEX_NONE,
+                                                       snedm::particle_track::VERTEX_NONE);
 
-    for (const auto &tp : tparams) {
-      const double t = tp.first;
-      const std::string &category = tp.second;
+    for (const extrapolation_engine::intersection &tp : intersections_) {
+      const double t = tp.t;
+      const vertex_type category = tp.category;
 
       // Calculate delta t values as well as new lengths
       const double delta1 = std::fabs(t1 - t);
@@ -316,24 +188,24 @@ void vertex_extrapolation_driver::_measure_vertices_(
     auto a_mutable_helix = const_cast<geomtools::helix_3d *>(&a_helix);
     if (datatools::is_valid(new_ts.first)) {
       const double new_length = delta2length * std::abs(new_ts.first - a_helix.get_t1());
-      const std::string &category = category_flags.first;
-      if (_use_vertices_[category] && new_length < length) {
+      const vertex_type category = category_flags.first;
+      if (is_used(category) && new_length < length) {
         a_mutable_helix->set_t1(new_ts.first);
         vertices.push_back(std::make_pair(category, a_mutable_helix->get_first()));
       } else {
         vertices.push_back(
-            std::make_pair(snedm::particle_track::vertex_on_wire_label(), a_helix.get_first()));
+            std::make_pair(snedm::particle_track::VERTEX_ON_WIRE, a_helix.get_first()));
       }
     }
     if (datatools::is_valid(new_ts.second)) {
       const double new_length = delta2length * std::abs(new_ts.second - a_helix.get_t2());
-      const std::string &category = category_flags.second;
-      if (_use_vertices_[category] && new_length < length) {
+      const vertex_type category = category_flags.second;
+      if (is_used(category) && new_length < length) {
         a_mutable_helix->set_t2(new_ts.second);
         vertices.push_back(std::make_pair(category, a_mutable_helix->get_last()));
       } else {
         vertices.push_back(
-            std::make_pair(snedm::particle_track::vertex_on_wire_label(), a_helix.get_last()));
+            std::make_pair(snedm::particle_track::VERTEX_ON_WIRE, a_helix.get_last()));
       }
     }
   }
@@ -341,7 +213,7 @@ void vertex_extrapolation_driver::_measure_vertices_(
 
   // Save new vertices
   for (const auto &vertice : vertices) {
-    const std::string &flag = vertice.first;
+    const std::string &flag = snedm::particle_track::vertex_type_to_label(vertice.first);
     const geomtools::vector_3d &pos = vertice.second;
     // Check vertex side is on the same side as the trajectory
     if ((side == snemo::geometry::side_t::BACK && pos.x() > 0.0) ||
@@ -414,12 +286,9 @@ void vertex_extrapolation_driver::_check_vertices_(
   if (!trajectory_.has_cluster()) {
     return;
   }
-  // Reset values of booleans
+  // Reset reliability of all vertex types
   namespace snedm = snemo::datamodel;
-  _use_vertices_[snedm::particle_track::vertex_on_source_foil_label()] = false;
-  _use_vertices_[snedm::particle_track::vertex_on_main_calorimeter_label()] = false;
-  _use_vertices_[snedm::particle_track::vertex_on_x_calorimeter_label()] = false;
-  _use_vertices_[snedm::particle_track::vertex_on_gamma_veto_label()] = false;
+  usedVertices_ = 0;
 
   const snedm::tracker_cluster &a_cluster = trajectory_.get_cluster();
   const snedm::TrackerHitHdlCollection &the_hits = a_cluster.hits();
@@ -431,17 +300,17 @@ void vertex_extrapolation_driver::_check_vertices_(
     const uint32_t layer = gg_locator.getLayerAddress(a_gid);
     if (layer < 1) {
       // Extrapolate vertex to the foil if the first GG layers are fired
-      _use_vertices_[snedm::particle_track::vertex_on_source_foil_label()] = true;
+      usedVertices_ |= snedm::particle_track::VERTEX_ON_SOURCE_FOIL;
     }
 
     const uint32_t side = gg_locator.getSideAddress(a_gid);
     if (layer >= gg_locator.numberOfLayers(side) - 1) {
-      _use_vertices_[snedm::particle_track::vertex_on_main_calorimeter_label()] = true;
+      usedVertices_ |= snedm::particle_track::VERTEX_ON_MAIN_CALORIMETER;
     }
 
     const uint32_t row = gg_locator.getRowAddress(a_gid);
     if (row <= 1 || row >= gg_locator.numberOfRows(side) - 1) {
-      _use_vertices_[snedm::particle_track::vertex_on_x_calorimeter_label()] = true;
+      usedVertices_ |= snedm::particle_track::VERTEX_ON_X_CALORIMETER;
     }
   }
 }
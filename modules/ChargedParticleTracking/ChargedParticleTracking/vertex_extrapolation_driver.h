@@ -37,6 +37,9 @@
 #include "falaise/property_set.h"
 #include "falaise/snemo/datamodels/particle_track.h"
 
+// This plugin
+#include "ChargedParticleTracking/extrapolation_engine.h"
+
 namespace geomtools {
 class manager;
 }
@@ -99,7 +102,9 @@ class vertex_extrapolation_driver {
   datatools::logger::priority logPriority_ = datatools::logger::PRIO_WARNING;  //!< Logging priority
   const geomtools::manager* geoManager_ = nullptr;               //!< The SuperNEMO geometry manager
   const snemo::geometry::locator_plugin* geoLocator_ = nullptr;  //!< The SuperNEMO locator plugin
-  std::map<std::string, bool> _use_vertices_ = {};               //!< Vertices reliability
+  extrapolation_engine engine_ = {};                             //!< Detector surfaces
+  uint32_t usedVertices_ = 0;  //!< Reliable vertex types of the current trajectory (bit mask)
+  std::vector<extrapolation_engine::intersection> intersections_ = {};  //!< Work buffer
 };
 
 }  // end of namespace reconstruction
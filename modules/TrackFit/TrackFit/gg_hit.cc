@@ -66,6 +66,12 @@ void gg_hit::set_first(bool first_) {
   _first_ = first_;
 }
 
+bool gg_hit::is_delayed() const { return _delayed_; }
+
+void gg_hit::set_delayed(bool delayed_) {
+  _delayed_ = delayed_;
+}
+
 double gg_hit::get_x() const { return _x_; }
 
 void gg_hit::set_x(double new_value_) {
@@ -148,6 +154,7 @@ void gg_hit::_set_defaults() {
   _phi_ref_ = std::numeric_limits<double>::quiet_NaN();
   _first_ = false;
   _last_ = false;
+  _delayed_ = false;
   _properties_.clear();
 }
 
@@ -182,6 +189,7 @@ void gg_hit::tree_dump(std::ostream& out_, const std::string& title_, const std:
        << " mm" << std::endl;
   out_ << indent << datatools::i_tree_dumpable::tag << "first      = " << _first_ << std::endl;
   out_ << indent << datatools::i_tree_dumpable::tag << "last       = " << _last_ << std::endl;
+  out_ << indent << datatools::i_tree_dumpable::tag << "delayed    = " << _delayed_ << std::endl;
   out_ << indent << datatools::i_tree_dumpable::inherit_tag(inherit_) << "Properties : ";
   if (_properties_.empty()) {
     out_ << "<empty>";
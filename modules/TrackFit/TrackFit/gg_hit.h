@@ -76,6 +76,12 @@ class gg_hit : public datatools::i_tree_dumpable {
   /// Set the first flag
   void set_first(bool);
 
+  /// Check the delayed flag
+  bool is_delayed() const;
+
+  /// Set the delayed flag, for hits whose drift time is fitted together with their start time
+  void set_delayed(bool);
+
   /// Return the X position
   double get_x() const;
 
@@ -182,6 +188,7 @@ class gg_hit : public datatools::i_tree_dumpable {
   double _phi_ref_;                    /// Reference angle
   bool _first_;                        /// Flag for the first cell along a trajectory
   bool _last_;                         /// Flag for the last cell along a trajectory
+  bool _delayed_;                      /// Flag for a delayed hit
   datatools::properties _properties_;  /// Auxiliary properties
 };
 
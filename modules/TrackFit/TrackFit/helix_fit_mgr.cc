@@ -4,6 +4,7 @@
 #include <TrackFit/helix_fit_mgr.h>
 
 // Standard library:
+#include <cmath>
 #include <limits>
 
 // Third party:
@@ -271,12 +272,12 @@ void helix_fit_mgr::draw_solution(std::ostream &out_, const helix_fit_solution &
 void helix_fit_mgr::draw_temporary_solution(std::ostream &out_) const {
   helix_fit_solution sol;
   sol.start_time = _t0_;
-  sol.x0 = gsl_vector_get(_fit_mf_fdf_solver_->x, helix_fit_params::PARAM_INDEX_X0);
-  sol.y0 = gsl_vector_get(_fit_mf_fdf_solver_->x, helix_fit_params::PARAM_INDEX_Y0);
-  sol.z0 = gsl_vector_get(_fit_mf_fdf_solver_->x, helix_fit_params::PARAM_INDEX_Z0);
-  sol.r = gsl_vector_get(_fit_mf_fdf_solver_->x, helix_fit_params::PARAM_INDEX_R);
-  sol.step = gsl_vector_get(_fit_mf_fdf_solver_->x, helix_fit_params::PARAM_INDEX_STEP);
-  sol.chi = gsl_blas_dnrm2(_fit_mf_fdf_solver_->f);
+  sol.x0 = _fit_x_(helix_fit_params::PARAM_INDEX_X0);
+  sol.y0 = _fit_x_(helix_fit_params::PARAM_INDEX_Y0);
+  sol.z0 = _fit_x_(helix_fit_params::PARAM_INDEX_Z0);
+  sol.r = _fit_x_(helix_fit_params::PARAM_INDEX_R);
+  sol.step = _fit_x_(helix_fit_params::PARAM_INDEX_STEP);
+  sol.chi = _fit_chi_();
   sol.ndof = _fit_npoints_ - _fit_npars_;
   sol.niter = _fit_iter_;
   compute_angles(*_hits_, sol);
@@ -348,6 +349,29 @@ void helix_fit_mgr::set_fit_max_iter(size_t fit_max_iter_) { _fit_max_iter_ = fi
 
 void helix_fit_mgr::set_fit_eps(double eps_) { _fit_eps_ = eps_; }
 
+void helix_fit_mgr::set_fixed_solver(bool fixed_solver_) { _fixed_solver_ = fixed_solver_; }
+
+bool helix_fit_mgr::is_using_fixed_solver() const { return _fixed_solver_; }
+
+double helix_fit_mgr::get_current_chi() const {
+  DT_THROW_IF(!is_initialized(), std::logic_error, "Fit manager is not initialized !");
+  return _fit_chi_();
+}
+
+double helix_fit_mgr::_fit_x_(int param_index_) const {
+  if (_fixed_solver_) {
+    return _fit_lm_solver_.get_x(param_index_);
+  }
+  return gsl_vector_get(_fit_mf_fdf_solver_->x, param_index_);
+}
+
+double helix_fit_mgr::_fit_chi_() const {
+  if (_fixed_solver_) {
+    return _fit_lm_solver_.get_chi();
+  }
+  return gsl_blas_dnrm2(_fit_mf_fdf_solver_->f);
+}
+
 void helix_fit_mgr::set_guess(const helix_fit_params &guess_) {
   _fit_x_init_[helix_fit_params::PARAM_INDEX_X0] = guess_.x0;
   _fit_x_init_[helix_fit_params::PARAM_INDEX_Y0] = guess_.y0;
@@ -363,6 +387,7 @@ void helix_fit_mgr::_set_defaults_() {
   _fit_npoints_ = 0;
   _fit_mf_fdf_solver_ = nullptr;
   _fit_covar_ = nullptr;
+  _fixed_solver_ = false;
   _fit_iter_ = 0;
   _fit_max_iter_ = helix_fit_mgr::constants::default_fit_max_iter();
   _fit_eps_ = helix_fit_mgr::constants::default_fit_eps();
@@ -415,6 +440,53 @@ void helix_fit_mgr::initialize(const datatools::properties &config_) { init(conf
 void helix_fit_mgr::init(const datatools::properties &config_) {
   DT_THROW_IF(is_initialized(), std::logic_error, "Already initialized !");
 
+  _configure_(config_);
+
+  if (_fixed_solver_) {
+    // A starting point where the residuals cannot be evaluated fails the fit
+    const int set_status =
+        _fit_lm_solver_.set(&residual_lm, &_fit_data_, _fit_npars_, _fit_x_init_);
+    _fit_status_ = (set_status == GSL_SUCCESS) ? GSL_CONTINUE : set_status;
+    set_initialized(true);
+    return;
+  }
+
+  _fit_covar_ = gsl_matrix_alloc(_fit_npars_, _fit_npars_);
+
+  _fit_mf_fdf_function_.f = &residual_f;
+  _fit_mf_fdf_function_.df = &residual_df;
+  _fit_mf_fdf_function_.fdf = &residual_fdf;
+  _fit_mf_fdf_function_.p = _fit_npars_;
+  _fit_mf_fdf_function_.n = _fit_npoints_;
+  _fit_mf_fdf_function_.params = &_fit_data_;
+
+  const gsl_multifit_fdfsolver_type *T = gsl_multifit_fdfsolver_lmder;
+  _fit_mf_fdf_solver_ = gsl_multifit_fdfsolver_alloc(T, _fit_npoints_, _fit_npars_);
+  DT_THROW_IF(_fit_mf_fdf_solver_ == nullptr, std::logic_error, "Cannot create solver !");
+  const std::string fdsolver_name = gsl_multifit_fdfsolver_name(_fit_mf_fdf_solver_);
+
+  _fit_vview_ = gsl_vector_view_array(_fit_x_init_, _fit_npars_);
+
+  gsl_multifit_fdfsolver_set(_fit_mf_fdf_solver_, &_fit_mf_fdf_function_, &_fit_vview_.vector);
+
+  set_initialized(true);
+}
+
+double helix_fit_mgr::compute_guess_chi(const helix_fit_params &guess_,
+                                        const datatools::properties &config_) {
+  DT_THROW_IF(is_initialized(), std::logic_error, "Already initialized !");
+  _configure_(config_);
+  set_guess(guess_);
+  lm_normal_equations<helix_fit_params::HELIX_FIT_FIXED_START_TIME_NOPARS> eqs;
+  eqs.reset(_fit_npars_);
+  if (residual_lm(_fit_x_init_, &_fit_data_, eqs, false) != GSL_SUCCESS ||
+      !std::isfinite(eqs.chi2)) {
+    return std::numeric_limits<double>::infinity();
+  }
+  return std::sqrt(eqs.chi2);
+}
+
+void helix_fit_mgr::_configure_(const datatools::properties &config_) {
   // 2013-06-03 XG: Sanity checks but you may want to be less strict on that
   // and just warn people.. to be continued...
   DT_THROW_IF(_hits_ == nullptr, std::logic_error, "No hits !");
@@ -425,7 +497,13 @@ void helix_fit_mgr::init(const datatools::properties &config_) {
 
   _fit_npoints_ = 2 * nhits;
   _fit_npars_ = helix_fit_params::HELIX_FIT_FIXED_START_TIME_NOPARS;
-  _fit_covar_ = gsl_matrix_alloc(_fit_npars_, _fit_npars_);
+
+  if (config_.has_key("solver")) {
+    const std::string solver = config_.fetch_string("solver");
+    DT_THROW_IF(solver != "gsl" && solver != "fixed", std::logic_error,
+                "Invalid solver '" << solver << "' !");
+    _fixed_solver_ = (solver == "fixed");
+  }
 
   if (config_.has_flag("step_print_status")) {
     _step_print_status_ = true;
@@ -455,24 +533,6 @@ void helix_fit_mgr::init(const datatools::properties &config_) {
   _fit_data_.hits = _hits_;
   _fit_data_.calibration = _calibration_;
   _fit_data_.start_time = _t0_;
-
-  _fit_mf_fdf_function_.f = &residual_f;
-  _fit_mf_fdf_function_.df = &residual_df;
-  _fit_mf_fdf_function_.fdf = &residual_fdf;
-  _fit_mf_fdf_function_.p = _fit_npars_;
-  _fit_mf_fdf_function_.n = _fit_npoints_;
-  _fit_mf_fdf_function_.params = &_fit_data_;
-
-  const gsl_multifit_fdfsolver_type *T = gsl_multifit_fdfsolver_lmder;
-  _fit_mf_fdf_solver_ = gsl_multifit_fdfsolver_alloc(T, _fit_npoints_, _fit_npars_);
-  DT_THROW_IF(_fit_mf_fdf_solver_ == nullptr, std::logic_error, "Cannot create solver !");
-  const std::string fdsolver_name = gsl_multifit_fdfsolver_name(_fit_mf_fdf_solver_);
-
-  _fit_vview_ = gsl_vector_view_array(_fit_x_init_, _fit_npars_);
-
-  gsl_multifit_fdfsolver_set(_fit_mf_fdf_solver_, &_fit_mf_fdf_function_, &_fit_vview_.vector);
-
-  set_initialized(true);
 }
 
 void helix_fit_mgr::reset() {
@@ -508,27 +568,27 @@ void helix_fit_mgr::print_fit_status(std::ostream &out_) const {
        << "status: " << gsl_strerror(_fit_status_) << std::endl;
   out_ << "|   "
        << "|-- "
-       << "x0= " << gsl_vector_get(_fit_mf_fdf_solver_->x, helix_fit_params::PARAM_INDEX_X0)
+       << "x0= " << _fit_x_(helix_fit_params::PARAM_INDEX_X0)
        << std::endl;
   out_ << "|   "
        << "|-- "
-       << "y0= " << gsl_vector_get(_fit_mf_fdf_solver_->x, helix_fit_params::PARAM_INDEX_Y0)
+       << "y0= " << _fit_x_(helix_fit_params::PARAM_INDEX_Y0)
        << std::endl;
   out_ << "|   "
        << "|-- "
-       << "z0= " << gsl_vector_get(_fit_mf_fdf_solver_->x, helix_fit_params::PARAM_INDEX_Z0)
+       << "z0= " << _fit_x_(helix_fit_params::PARAM_INDEX_Z0)
        << std::endl;
   out_ << "|   "
        << "|-- "
-       << "r= " << gsl_vector_get(_fit_mf_fdf_solver_->x, helix_fit_params::PARAM_INDEX_R)
+       << "r= " << _fit_x_(helix_fit_params::PARAM_INDEX_R)
        << std::endl;
   out_ << "|   "
        << "|-- "
-       << "step= " << gsl_vector_get(_fit_mf_fdf_solver_->x, helix_fit_params::PARAM_INDEX_STEP)
+       << "step= " << _fit_x_(helix_fit_params::PARAM_INDEX_STEP)
        << std::endl;
   out_ << "|   "
        << "`-- "
-       << "f= " << gsl_blas_dnrm2(_fit_mf_fdf_solver_->f) << std::endl;
+       << "f= " << _fit_chi_() << std::endl;
   out_ << "`-- "
        << "Solution: "
        << "[NOT IMPLEMENTED]" << std::endl;
@@ -573,6 +633,11 @@ void helix_fit_mgr::at_fit_step_do() {
 void helix_fit_mgr::fit() {
   DT_THROW_IF(!is_initialized(), std::logic_error, "Fit manager is not initialized !");
 
+  if (_fixed_solver_ && _fit_iter_ == 0 && _fit_status_ != GSL_CONTINUE) {
+    _solution_.ok = false;
+    return;
+  }
+
   const double r_crit = 10. * CLHEP::km;
   double r_ref = -std::numeric_limits<double>::infinity();
   size_t count_r_crit = 0;
@@ -581,7 +646,11 @@ void helix_fit_mgr::fit() {
 
   do {
     _fit_iter_++;
-    _fit_status_ = gsl_multifit_fdfsolver_iterate(_fit_mf_fdf_solver_);
+    if (_fixed_solver_) {
+      _fit_status_ = _fit_lm_solver_.iterate();
+    } else {
+      _fit_status_ = gsl_multifit_fdfsolver_iterate(_fit_mf_fdf_solver_);
+    }
 
     // Do not break fit loop for GSL_SUCCESS but also when iteration
     // does not make progress towards solution. Then, redo the fit
@@ -591,11 +660,15 @@ void helix_fit_mgr::fit() {
     if (_fit_status_ != GSL_SUCCESS && _fit_status_ != GSL_ENOPROG) {
       break;
     }
-    _fit_status_ = gsl_multifit_test_delta(_fit_mf_fdf_solver_->dx, _fit_mf_fdf_solver_->x,
-                                           _fit_eps_, _fit_eps_);
+    if (_fixed_solver_) {
+      _fit_status_ = _fit_lm_solver_.test_delta(_fit_eps_, _fit_eps_);
+    } else {
+      _fit_status_ = gsl_multifit_test_delta(_fit_mf_fdf_solver_->dx, _fit_mf_fdf_solver_->x,
+                                             _fit_eps_, _fit_eps_);
+    }
     at_fit_step_do();
 
-    const double r = gsl_vector_get(_fit_mf_fdf_solver_->x, helix_fit_params::PARAM_INDEX_R);
+    const double r = _fit_x_(helix_fit_params::PARAM_INDEX_R);
     if (r > r_crit) {
       if (r < r_ref) {
         r_ref = -1.;
@@ -612,37 +685,47 @@ void helix_fit_mgr::fit() {
   } while ((_fit_status_ == GSL_CONTINUE) && (_fit_iter_ < _fit_max_iter_));
 
   if (_fit_status_ <= GSL_SUCCESS && under_r_crit_limit) {
+    if (_fixed_solver_) {
+      // A singular J^T.J leaves the parameter errors undefined
+      if (!_fit_lm_solver_.covariance(_fit_lm_covar_)) {
+        _fit_status_ = GSL_ESING;
+        _solution_.ok = false;
+        return;
+      }
+    } else {
 #if GSL_MAJOR_VERSION > 1
-    gsl_matrix *J = gsl_matrix_alloc(_fit_npoints_, _fit_npars_);
-    gsl_multifit_fdfsolver_jac(_fit_mf_fdf_solver_, J);
-    gsl_multifit_covar(J, 0.0, _fit_covar_);
-    gsl_matrix_free(J);
+      gsl_matrix *J = gsl_matrix_alloc(_fit_npoints_, _fit_npars_);
+      gsl_multifit_fdfsolver_jac(_fit_mf_fdf_solver_, J);
+      gsl_multifit_covar(J, 0.0, _fit_covar_);
+      gsl_matrix_free(J);
 #else
-    gsl_multifit_covar(_fit_mf_fdf_solver_->J, 0.0, _fit_covar_);
+      gsl_multifit_covar(_fit_mf_fdf_solver_->J, 0.0, _fit_covar_);
 #endif
+    }
+    auto covar = [this](int param_index_) -> double {
+      if (_fixed_solver_) {
+        return _fit_lm_covar_[param_index_][param_index_];
+      }
+      return gsl_matrix_get(_fit_covar_, param_index_, param_index_);
+    };
 
     _solution_.ok = true;
     _solution_.start_time = _t0_;
-    _solution_.x0 = gsl_vector_get(_fit_mf_fdf_solver_->x, helix_fit_params::PARAM_INDEX_X0);
-    _solution_.y0 = gsl_vector_get(_fit_mf_fdf_solver_->x, helix_fit_params::PARAM_INDEX_Y0);
-    _solution_.z0 = gsl_vector_get(_fit_mf_fdf_solver_->x, helix_fit_params::PARAM_INDEX_Z0);
-    _solution_.r = gsl_vector_get(_fit_mf_fdf_solver_->x, helix_fit_params::PARAM_INDEX_R);
-    _solution_.step = gsl_vector_get(_fit_mf_fdf_solver_->x, helix_fit_params::PARAM_INDEX_STEP);
-
-    _solution_.err_x0 = sqrt(gsl_matrix_get(_fit_covar_, helix_fit_params::PARAM_INDEX_X0,
-                                            helix_fit_params::PARAM_INDEX_X0));
-    _solution_.err_y0 = sqrt(gsl_matrix_get(_fit_covar_, helix_fit_params::PARAM_INDEX_Y0,
-                                            helix_fit_params::PARAM_INDEX_Y0));
-    _solution_.err_z0 = sqrt(gsl_matrix_get(_fit_covar_, helix_fit_params::PARAM_INDEX_Z0,
-                                            helix_fit_params::PARAM_INDEX_Z0));
-    _solution_.err_r = sqrt(gsl_matrix_get(_fit_covar_, helix_fit_params::PARAM_INDEX_R,
-                                           helix_fit_params::PARAM_INDEX_R));
-    _solution_.err_step = sqrt(gsl_matrix_get(_fit_covar_, helix_fit_params::PARAM_INDEX_STEP,
-                                              helix_fit_params::PARAM_INDEX_STEP));
+    _solution_.x0 = _fit_x_(helix_fit_params::PARAM_INDEX_X0);
+    _solution_.y0 = _fit_x_(helix_fit_params::PARAM_INDEX_Y0);
+    _solution_.z0 = _fit_x_(helix_fit_params::PARAM_INDEX_Z0);
+    _solution_.r = _fit_x_(helix_fit_params::PARAM_INDEX_R);
+    _solution_.step = _fit_x_(helix_fit_params::PARAM_INDEX_STEP);
+
+    _solution_.err_x0 = sqrt(covar(helix_fit_params::PARAM_INDEX_X0));
+    _solution_.err_y0 = sqrt(covar(helix_fit_params::PARAM_INDEX_Y0));
+    _solution_.err_z0 = sqrt(covar(helix_fit_params::PARAM_INDEX_Z0));
+    _solution_.err_r = sqrt(covar(helix_fit_params::PARAM_INDEX_R));
+    _solution_.err_step = sqrt(covar(helix_fit_params::PARAM_INDEX_STEP));
 
     compute_angles(_fit_data_.get_hits(), _solution_);
 
-    _solution_.chi = gsl_blas_dnrm2(_fit_mf_fdf_solver_->f);
+    _solution_.chi = _fit_chi_();
     _solution_.ndof = _fit_npoints_ - _fit_npars_;
     _solution_.niter = _fit_iter_;
   } else {
@@ -866,11 +949,11 @@ void helix_fit_mgr::get_residuals_per_hit(size_t hit_index_, double &alpha_resid
   helix_fit_residual_function_param param;
   // initialize the line parameters:
   if (!at_solution_) {
-    param.x0 = gsl_vector_get(_fit_mf_fdf_solver_->x, helix_fit_params::PARAM_INDEX_X0);
-    param.y0 = gsl_vector_get(_fit_mf_fdf_solver_->x, helix_fit_params::PARAM_INDEX_Y0);
-    param.z0 = gsl_vector_get(_fit_mf_fdf_solver_->x, helix_fit_params::PARAM_INDEX_Z0);
-    param.r = gsl_vector_get(_fit_mf_fdf_solver_->x, helix_fit_params::PARAM_INDEX_R);
-    param.step = gsl_vector_get(_fit_mf_fdf_solver_->x, helix_fit_params::PARAM_INDEX_STEP);
+    param.x0 = _fit_x_(helix_fit_params::PARAM_INDEX_X0);
+    param.y0 = _fit_x_(helix_fit_params::PARAM_INDEX_Y0);
+    param.z0 = _fit_x_(helix_fit_params::PARAM_INDEX_Z0);
+    param.r = _fit_x_(helix_fit_params::PARAM_INDEX_R);
+    param.step = _fit_x_(helix_fit_params::PARAM_INDEX_STEP);
   } else {
     DT_THROW_IF(!_solution_.ok, std::logic_error, "No available solution !");
     param.x0 = _solution_.x0;
@@ -1069,6 +1152,72 @@ int helix_fit_mgr::residual_fdf(const gsl_vector *x_, void *params_, gsl_vector
   return GSL_SUCCESS;
 }
 
+int helix_fit_mgr::residual_lm(
+    const double *x_, void *params_,
+    lm_normal_equations<helix_fit_params::HELIX_FIT_FIXED_START_TIME_NOPARS> &eqs_,
+    bool with_jacobian_) {
+  // initialize the helix parameters:
+  helix_fit_residual_function_param param;
+  param.x0 = x_[helix_fit_params::PARAM_INDEX_X0];
+  param.y0 = x_[helix_fit_params::PARAM_INDEX_Y0];
+  param.z0 = x_[helix_fit_params::PARAM_INDEX_Z0];
+  param.r = x_[helix_fit_params::PARAM_INDEX_R];
+  param.step = x_[helix_fit_params::PARAM_INDEX_STEP];
+  const auto *lf_data = static_cast<const helix_fit_data *>(params_);
+  param.start_time = lf_data->start_time;
+  param.dtc = lf_data->calibration;
+  param.using_first = lf_data->using_first;
+  param.using_last = lf_data->using_last;
+  param.using_drift_time = lf_data->using_drift_time;
+
+  // Same derivative steps as residual_df:
+  const double h_distance = 0.25 * CLHEP::mm;
+  const double h_step = 0.25 * CLHEP::mm / CLHEP::radian;
+  double *const param_values[helix_fit_params::HELIX_FIT_FIXED_START_TIME_NOPARS] = {
+      &param.x0, &param.y0, &param.z0, &param.r, &param.step};
+  const double param_h[helix_fit_params::HELIX_FIT_FIXED_START_TIME_NOPARS] = {
+      h_distance, h_distance, h_distance, h_distance, h_step};
+  const int residual_types[2] = {helix_fit_residual_function_param::RESIDUAL_ALPHA,
+                                 helix_fit_residual_function_param::RESIDUAL_BETA};
+
+  gsl_function F;
+  F.function = &residual_function;
+  F.params = &param;
+
+  const auto *hits = static_cast<const gg_hits_col *>(lf_data->hits);
+  for (const auto &hit : *hits) {
+    // pick up useful values from the hit:
+    param.last = hit.is_last();
+    param.first = hit.is_first();
+    param.xi = hit.get_x();
+    param.yi = hit.get_y();
+    param.zi = hit.get_z();
+    param.szi = hit.get_sigma_z();
+    param.ti = hit.get_t();
+    param.ri = hit.get_r();
+    param.dri = hit.get_sigma_r();
+    param.rmaxi = hit.get_rmax();
+    for (int residual_type : residual_types) {
+      param.residual_type = residual_type;
+      param.mode = helix_fit_params::PARAM_INDEX_X0;
+      const double residual = residual_function(param.x0, &param);
+      if (!with_jacobian_) {
+        eqs_.add(residual, nullptr);
+        continue;
+      }
+      double gradient[helix_fit_params::HELIX_FIT_FIXED_START_TIME_NOPARS];
+      for (size_t ipar = 0; ipar < helix_fit_params::HELIX_FIT_FIXED_START_TIME_NOPARS; ipar++) {
+        double result, abserr;
+        param.mode = static_cast<int>(ipar);
+        gsl_deriv_central(&F, *param_values[ipar], param_h[ipar], &result, &abserr);
+        gradient[ipar] = result;
+      }
+      eqs_.add(residual, gradient);
+    }
+  }
+  return GSL_SUCCESS;
+}
+
 std::string helix_fit_mgr::guess_utils::guess_mode_label(int guess_mode_) {
   switch (guess_mode_) {
     case GUESS_MODE_BBB:
@@ -1167,7 +1316,7 @@ bool helix_fit_mgr::guess_utils::compute_guess(const gg_hits_col &hits_, int gue
   // Check if the cluster is or not delayed
   bool is_cluster_delayed = true;
   for (const auto &a_hit : hits_) {
-    if (!a_hit.get_properties().has_flag(gg_hit::delayed_flag())) {
+    if (!a_hit.is_delayed()) {
       is_cluster_delayed = false;
       break;
     }
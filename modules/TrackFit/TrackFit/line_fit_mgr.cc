@@ -4,6 +4,7 @@
 #include <TrackFit/line_fit_mgr.h>
 
 // Standard library:
+#include <cmath>
 #include <limits>
 
 // Third party:
@@ -233,16 +234,16 @@ void line_fit_mgr::draw_temporary_solution(std::ostream &out_) const {
   line_fit_solution sol;
 
   if (is_fitting_start_time()) {
-    sol.t0 = gsl_vector_get(_fit_mf_fdf_solver_->x, line_fit_params::PARAM_INDEX_T0);
+    sol.t0 = _fit_x_(line_fit_params::PARAM_INDEX_T0);
   } else {
     sol.t0 = _t0_;
   }
 
-  sol.z0 = gsl_vector_get(_fit_mf_fdf_solver_->x, line_fit_params::PARAM_INDEX_Z0);
-  sol.y0 = gsl_vector_get(_fit_mf_fdf_solver_->x, line_fit_params::PARAM_INDEX_Y0);
-  sol.phi = gsl_vector_get(_fit_mf_fdf_solver_->x, line_fit_params::PARAM_INDEX_PHI);
-  sol.theta = gsl_vector_get(_fit_mf_fdf_solver_->x, line_fit_params::PARAM_INDEX_THETA);
-  sol.chi = gsl_blas_dnrm2(_fit_mf_fdf_solver_->f);
+  sol.z0 = _fit_x_(line_fit_params::PARAM_INDEX_Z0);
+  sol.y0 = _fit_x_(line_fit_params::PARAM_INDEX_Y0);
+  sol.phi = _fit_x_(line_fit_params::PARAM_INDEX_PHI);
+  sol.theta = _fit_x_(line_fit_params::PARAM_INDEX_THETA);
+  sol.chi = _fit_chi_();
   sol.ndof = _fit_npoints_ - _fit_npars_;
   sol.niter = _fit_iter_;
 
@@ -309,6 +310,29 @@ void line_fit_mgr::set_t0(double t0_) { _t0_ = t0_; }
 
 void line_fit_mgr::set_fit_eps(double eps_) { _fit_eps_ = eps_; }
 
+void line_fit_mgr::set_fixed_solver(bool fixed_solver_) { _fixed_solver_ = fixed_solver_; }
+
+bool line_fit_mgr::is_using_fixed_solver() const { return _fixed_solver_; }
+
+double line_fit_mgr::get_current_chi() const {
+  DT_THROW_IF(!is_initialized(), std::logic_error, "Fit manager is not initialized !");
+  return _fit_chi_();
+}
+
+double line_fit_mgr::_fit_x_(int param_index_) const {
+  if (_fixed_solver_) {
+    return _fit_lm_solver_.get_x(param_index_);
+  }
+  return gsl_vector_get(_fit_mf_fdf_solver_->x, param_index_);
+}
+
+double line_fit_mgr::_fit_chi_() const {
+  if (_fixed_solver_) {
+    return _fit_lm_solver_.get_chi();
+  }
+  return gsl_blas_dnrm2(_fit_mf_fdf_solver_->f);
+}
+
 void line_fit_mgr::set_guess(const line_fit_params &guess_) {
   // 2012-11-02 XG: Initialize start time even if it will not be used later
   _fit_x_init_[line_fit_params::PARAM_INDEX_T0] = guess_.t0;
@@ -324,6 +348,7 @@ void line_fit_mgr::_set_defaults_() {
   _fit_npoints_ = 0;
   _fit_mf_fdf_solver_ = nullptr;
   _fit_covar_ = nullptr;
+  _fixed_solver_ = false;
   _fit_iter_ = 0;
   _fit_max_iter_ = line_fit_mgr::constants::default_fit_max_iter();
   _fit_eps_ = line_fit_mgr::constants::default_fit_eps();
@@ -375,6 +400,53 @@ void line_fit_mgr::initialize(const datatools::properties &config_) { init(confi
 void line_fit_mgr::init(const datatools::properties &config_) {
   DT_THROW_IF(is_initialized(), std::logic_error, "Already initialized !");
 
+  _configure_(config_);
+
+  if (_fixed_solver_) {
+    // A starting point where the residuals cannot be evaluated fails the fit
+    const int set_status =
+        _fit_lm_solver_.set(&residual_lm, &_fit_data_, _fit_npars_, _fit_x_init_);
+    _fit_status_ = (set_status == GSL_SUCCESS) ? GSL_CONTINUE : set_status;
+    _set_initialized(true);
+    return;
+  }
+
+  _fit_covar_ = gsl_matrix_alloc(_fit_npars_, _fit_npars_);
+
+  _fit_mf_fdf_function_.f = &residual_f;
+  _fit_mf_fdf_function_.df = &residual_df;
+  _fit_mf_fdf_function_.fdf = &residual_fdf;
+  _fit_mf_fdf_function_.p = _fit_npars_;
+  _fit_mf_fdf_function_.n = _fit_npoints_;
+  _fit_mf_fdf_function_.params = &_fit_data_;
+
+  const gsl_multifit_fdfsolver_type *T = gsl_multifit_fdfsolver_lmder;
+  _fit_mf_fdf_solver_ = gsl_multifit_fdfsolver_alloc(T, _fit_npoints_, _fit_npars_);
+  DT_THROW_IF(_fit_mf_fdf_solver_ == nullptr, std::logic_error, "Cannot create solver !");
+  const std::string fdsolver_name = gsl_multifit_fdfsolver_name(_fit_mf_fdf_solver_);
+
+  _fit_vview_ = gsl_vector_view_array(_fit_x_init_, _fit_npars_);
+
+  gsl_multifit_fdfsolver_set(_fit_mf_fdf_solver_, &_fit_mf_fdf_function_, &_fit_vview_.vector);
+
+  _set_initialized(true);
+}
+
+double line_fit_mgr::compute_guess_chi(const line_fit_params &guess_,
+                                       const datatools::properties &config_) {
+  DT_THROW_IF(is_initialized(), std::logic_error, "Already initialized !");
+  _configure_(config_);
+  set_guess(guess_);
+  lm_normal_equations<line_fit_params::LINE_FIT_NOPARS> eqs;
+  eqs.reset(_fit_npars_);
+  if (residual_lm(_fit_x_init_, &_fit_data_, eqs, false) != GSL_SUCCESS ||
+      !std::isfinite(eqs.chi2)) {
+    return std::numeric_limits<double>::infinity();
+  }
+  return std::sqrt(eqs.chi2);
+}
+
+void line_fit_mgr::_configure_(const datatools::properties &config_) {
   DT_THROW_IF(_hits_ == nullptr, std::logic_error, "No hits !");
 
   const size_t nhits = _hits_->size();
@@ -406,6 +478,13 @@ void line_fit_mgr::init(const datatools::properties &config_) {
     _using_drift_time_ = true;
   }
 
+  if (config_.has_key("solver")) {
+    const std::string solver = config_.fetch_string("solver");
+    DT_THROW_IF(solver != "gsl" && solver != "fixed", std::logic_error,
+                "Invalid solver '" << solver << "' !");
+    _fixed_solver_ = (solver == "fixed");
+  }
+
   DT_THROW_IF(_using_drift_time_ && !has_calibration(), std::logic_error,
               "Missing drift time calibration !");
 
@@ -414,7 +493,7 @@ void line_fit_mgr::init(const datatools::properties &config_) {
   // enabled by default
   bool is_cluster_delayed = true;
   for (const auto &a_hit : *_hits_) {
-    if (!a_hit.get_properties().has_flag(gg_hit::delayed_flag())) {
+    if (!a_hit.is_delayed()) {
       is_cluster_delayed = false;
       break;
     }
@@ -437,7 +516,6 @@ void line_fit_mgr::init(const datatools::properties &config_) {
     // Only use 4 parameters
     _fit_npars_--;
   }
-  _fit_covar_ = gsl_matrix_alloc(_fit_npars_, _fit_npars_);
 
   // init fit params
   _fit_data_.using_first = _using_first_;
@@ -446,24 +524,6 @@ void line_fit_mgr::init(const datatools::properties &config_) {
   _fit_data_.fit_start_time = _fit_start_time_;
   _fit_data_.hits = _hits_;
   _fit_data_.calibration = _calibration_;
-
-  _fit_mf_fdf_function_.f = &residual_f;
-  _fit_mf_fdf_function_.df = &residual_df;
-  _fit_mf_fdf_function_.fdf = &residual_fdf;
-  _fit_mf_fdf_function_.p = _fit_npars_;
-  _fit_mf_fdf_function_.n = _fit_npoints_;
-  _fit_mf_fdf_function_.params = &_fit_data_;
-
-  const gsl_multifit_fdfsolver_type *T = gsl_multifit_fdfsolver_lmder;
-  _fit_mf_fdf_solver_ = gsl_multifit_fdfsolver_alloc(T, _fit_npoints_, _fit_npars_);
-  DT_THROW_IF(_fit_mf_fdf_solver_ == nullptr, std::logic_error, "Cannot create solver !");
-  const std::string fdsolver_name = gsl_multifit_fdfsolver_name(_fit_mf_fdf_solver_);
-
-  _fit_vview_ = gsl_vector_view_array(_fit_x_init_, _fit_npars_);
-
-  gsl_multifit_fdfsolver_set(_fit_mf_fdf_solver_, &_fit_mf_fdf_function_, &_fit_vview_.vector);
-
-  _set_initialized(true);
 }
 
 void line_fit_mgr::reset() {
@@ -503,28 +563,28 @@ void line_fit_mgr::print_fit_status(std::ostream &out_) const {
   if (is_fitting_start_time()) {
     out_ << "|   "
          << "|-- "
-         << "t0= " << gsl_vector_get(_fit_mf_fdf_solver_->x, line_fit_params::PARAM_INDEX_T0)
+         << "t0= " << _fit_x_(line_fit_params::PARAM_INDEX_T0)
          << std::endl;
   }
   out_ << "|   "
        << "|-- "
-       << "z0= " << gsl_vector_get(_fit_mf_fdf_solver_->x, line_fit_params::PARAM_INDEX_Z0)
+       << "z0= " << _fit_x_(line_fit_params::PARAM_INDEX_Z0)
        << std::endl;
   out_ << "|   "
        << "|-- "
-       << "y0= " << gsl_vector_get(_fit_mf_fdf_solver_->x, line_fit_params::PARAM_INDEX_Y0)
+       << "y0= " << _fit_x_(line_fit_params::PARAM_INDEX_Y0)
        << std::endl;
   out_ << "|   "
        << "|-- "
-       << "phi= " << gsl_vector_get(_fit_mf_fdf_solver_->x, line_fit_params::PARAM_INDEX_PHI)
+       << "phi= " << _fit_x_(line_fit_params::PARAM_INDEX_PHI)
        << std::endl;
   out_ << "|   "
        << "|-- "
-       << "theta= " << gsl_vector_get(_fit_mf_fdf_solver_->x, line_fit_params::PARAM_INDEX_THETA)
+       << "theta= " << _fit_x_(line_fit_params::PARAM_INDEX_THETA)
        << std::endl;
   out_ << "|   "
        << "`-- "
-       << "f= " << gsl_blas_dnrm2(_fit_mf_fdf_solver_->f) << std::endl;
+       << "f= " << _fit_chi_() << std::endl;
   out_ << "`-- "
        << "Solution: "
        << "[NOT IMPLEMENTED]" << std::endl;
@@ -568,52 +628,75 @@ void line_fit_mgr::at_fit_step_do() {
 void line_fit_mgr::fit() {
   DT_THROW_IF(!is_initialized(), std::logic_error, "Fit manager is not initialized !");
 
+  if (_fixed_solver_ && _fit_iter_ == 0 && _fit_status_ != GSL_CONTINUE) {
+    _solution_.ok = false;
+    return;
+  }
+
   do {
     _fit_iter_++;
-    _fit_status_ = gsl_multifit_fdfsolver_iterate(_fit_mf_fdf_solver_);
+    if (_fixed_solver_) {
+      _fit_status_ = _fit_lm_solver_.iterate();
+    } else {
+      _fit_status_ = gsl_multifit_fdfsolver_iterate(_fit_mf_fdf_solver_);
+    }
 
     if (_fit_status_ != GSL_SUCCESS && _fit_status_ != GSL_ENOPROG) {
       break;
     }
-    _fit_status_ = gsl_multifit_test_delta(_fit_mf_fdf_solver_->dx, _fit_mf_fdf_solver_->x,
-                                           _fit_eps_, _fit_eps_);
+    if (_fixed_solver_) {
+      _fit_status_ = _fit_lm_solver_.test_delta(_fit_eps_, _fit_eps_);
+    } else {
+      _fit_status_ = gsl_multifit_test_delta(_fit_mf_fdf_solver_->dx, _fit_mf_fdf_solver_->x,
+                                             _fit_eps_, _fit_eps_);
+    }
     at_fit_step_do();
 
   } while ((_fit_status_ == GSL_CONTINUE) && (_fit_iter_ < _fit_max_iter_));
 
   if (_fit_status_ <= GSL_SUCCESS) {
+    if (_fixed_solver_) {
+      // A singular J^T.J leaves the parameter errors undefined
+      if (!_fit_lm_solver_.covariance(_fit_lm_covar_)) {
+        _fit_status_ = GSL_ESING;
+        _solution_.ok = false;
+        return;
+      }
+    } else {
 #if GSL_MAJOR_VERSION > 1
-    gsl_matrix *J = gsl_matrix_alloc(_fit_npoints_, _fit_npars_);
-    gsl_multifit_fdfsolver_jac(_fit_mf_fdf_solver_, J);
-    gsl_multifit_covar(J, 0.0, _fit_covar_);
-    gsl_matrix_free(J);
+      gsl_matrix *J = gsl_matrix_alloc(_fit_npoints_, _fit_npars_);
+      gsl_multifit_fdfsolver_jac(_fit_mf_fdf_solver_, J);
+      gsl_multifit_covar(J, 0.0, _fit_covar_);
+      gsl_matrix_free(J);
 #else
-    gsl_multifit_covar(_fit_mf_fdf_solver_->J, 0.0, _fit_covar_);
+      gsl_multifit_covar(_fit_mf_fdf_solver_->J, 0.0, _fit_covar_);
 #endif
+    }
+    auto covar = [this](int param_index_) -> double {
+      if (_fixed_solver_) {
+        return _fit_lm_covar_[param_index_][param_index_];
+      }
+      return gsl_matrix_get(_fit_covar_, param_index_, param_index_);
+    };
 
     _solution_.ok = true;
-    _solution_.z0 = gsl_vector_get(_fit_mf_fdf_solver_->x, line_fit_params::PARAM_INDEX_Z0);
-    _solution_.y0 = gsl_vector_get(_fit_mf_fdf_solver_->x, line_fit_params::PARAM_INDEX_Y0);
-    _solution_.phi = gsl_vector_get(_fit_mf_fdf_solver_->x, line_fit_params::PARAM_INDEX_PHI);
-    _solution_.theta = gsl_vector_get(_fit_mf_fdf_solver_->x, line_fit_params::PARAM_INDEX_THETA);
+    _solution_.z0 = _fit_x_(line_fit_params::PARAM_INDEX_Z0);
+    _solution_.y0 = _fit_x_(line_fit_params::PARAM_INDEX_Y0);
+    _solution_.phi = _fit_x_(line_fit_params::PARAM_INDEX_PHI);
+    _solution_.theta = _fit_x_(line_fit_params::PARAM_INDEX_THETA);
     if (!is_fitting_start_time()) {
       _solution_.t0 = _t0_;
       _solution_.err_t0 = 0.0 * CLHEP::ns;
     } else {
-      _solution_.t0 = gsl_vector_get(_fit_mf_fdf_solver_->x, line_fit_params::PARAM_INDEX_T0);
-      _solution_.err_t0 = std::sqrt(gsl_matrix_get(_fit_covar_, line_fit_params::PARAM_INDEX_T0,
-                                                   line_fit_params::PARAM_INDEX_T0));
+      _solution_.t0 = _fit_x_(line_fit_params::PARAM_INDEX_T0);
+      _solution_.err_t0 = std::sqrt(covar(line_fit_params::PARAM_INDEX_T0));
     }
 
-    _solution_.err_z0 = std::sqrt(gsl_matrix_get(_fit_covar_, line_fit_params::PARAM_INDEX_Z0,
-                                                 line_fit_params::PARAM_INDEX_Z0));
-    _solution_.err_y0 = std::sqrt(gsl_matrix_get(_fit_covar_, line_fit_params::PARAM_INDEX_Y0,
-                                                 line_fit_params::PARAM_INDEX_Y0));
-    _solution_.err_phi = std::sqrt(gsl_matrix_get(_fit_covar_, line_fit_params::PARAM_INDEX_PHI,
-                                                  line_fit_params::PARAM_INDEX_PHI));
-    _solution_.err_theta = std::sqrt(gsl_matrix_get(_fit_covar_, line_fit_params::PARAM_INDEX_THETA,
-                                                    line_fit_params::PARAM_INDEX_THETA));
-    _solution_.chi = gsl_blas_dnrm2(_fit_mf_fdf_solver_->f);
+    _solution_.err_z0 = std::sqrt(covar(line_fit_params::PARAM_INDEX_Z0));
+    _solution_.err_y0 = std::sqrt(covar(line_fit_params::PARAM_INDEX_Y0));
+    _solution_.err_phi = std::sqrt(covar(line_fit_params::PARAM_INDEX_PHI));
+    _solution_.err_theta = std::sqrt(covar(line_fit_params::PARAM_INDEX_THETA));
+    _solution_.chi = _fit_chi_();
     _solution_.ndof = _fit_npoints_ - _fit_npars_;
     _solution_.niter = _fit_iter_;
   } else {
@@ -870,12 +953,12 @@ void line_fit_mgr::get_residuals_per_hit(size_t hit_index_, double &alpha_residu
 
   // initialize the line parameters:
   if (!at_solution_) {
-    param.z0 = gsl_vector_get(_fit_mf_fdf_solver_->x, line_fit_params::PARAM_INDEX_Z0);
-    param.y0 = gsl_vector_get(_fit_mf_fdf_solver_->x, line_fit_params::PARAM_INDEX_Y0);
-    param.phi = gsl_vector_get(_fit_mf_fdf_solver_->x, line_fit_params::PARAM_INDEX_PHI);
-    param.theta = gsl_vector_get(_fit_mf_fdf_solver_->x, line_fit_params::PARAM_INDEX_THETA);
+    param.z0 = _fit_x_(line_fit_params::PARAM_INDEX_Z0);
+    param.y0 = _fit_x_(line_fit_params::PARAM_INDEX_Y0);
+    param.phi = _fit_x_(line_fit_params::PARAM_INDEX_PHI);
+    param.theta = _fit_x_(line_fit_params::PARAM_INDEX_THETA);
     if (is_fitting_start_time()) {
-      param.t0 = gsl_vector_get(_fit_mf_fdf_solver_->x, line_fit_params::PARAM_INDEX_T0);
+      param.t0 = _fit_x_(line_fit_params::PARAM_INDEX_T0);
     }
   } else {
     DT_THROW_IF(!_solution_.ok, std::logic_error, "No available solution !");
@@ -1088,6 +1171,77 @@ int line_fit_mgr::residual_fdf(const gsl_vector *x_, void *params_, gsl_vector *
   return GSL_SUCCESS;
 }
 
+int line_fit_mgr::residual_lm(const double *x_, void *params_,
+                              lm_normal_equations<line_fit_params::LINE_FIT_NOPARS> &eqs_,
+                              bool with_jacobian_) {
+  // initialize the line parameters:
+  line_fit_residual_function_param param;
+  param.z0 = x_[line_fit_params::PARAM_INDEX_Z0];
+  param.y0 = x_[line_fit_params::PARAM_INDEX_Y0];
+  param.phi = x_[line_fit_params::PARAM_INDEX_PHI];
+  param.theta = x_[line_fit_params::PARAM_INDEX_THETA];
+
+  const auto *lf_data = static_cast<const line_fit_data *>(params_);
+  param.dtc = lf_data->calibration;
+  param.using_first = lf_data->using_first;
+  param.using_last = lf_data->using_last;
+  param.using_drift_time = lf_data->using_drift_time;
+  param.fit_start_time = lf_data->fit_start_time;
+  if (param.fit_start_time) {
+    param.t0 = x_[line_fit_params::PARAM_INDEX_T0];
+  }
+  const size_t npars =
+      param.fit_start_time ? line_fit_params::LINE_FIT_NOPARS : line_fit_params::LINE_FIT_NOPARS - 1;
+
+  // Same derivative steps as residual_df:
+  const double h_distance = 0.25 * CLHEP::mm;
+  const double h_angle = M_PI / 100 * CLHEP::radian;
+  const double h_time = 0.5 * CLHEP::ns;
+  double *const param_values[line_fit_params::LINE_FIT_NOPARS] = {&param.z0, &param.y0, &param.phi,
+                                                                  &param.theta, &param.t0};
+  const double param_h[line_fit_params::LINE_FIT_NOPARS] = {h_distance, h_distance, h_angle,
+                                                            h_angle, h_time};
+  const int residual_types[2] = {line_fit_residual_function_param::RESIDUAL_ALPHA,
+                                 line_fit_residual_function_param::RESIDUAL_BETA};
+
+  gsl_function F;
+  F.function = &residual_function;
+  F.params = &param;
+
+  const auto *hits = static_cast<const gg_hits_col *>(lf_data->hits);
+  for (const auto &hit : *hits) {
+    // pick up useful values from the hit:
+    param.last = hit.is_last();
+    param.first = hit.is_first();
+    param.xi = hit.get_x();
+    param.yi = hit.get_y();
+    param.zi = hit.get_z();
+    param.szi = hit.get_sigma_z();
+    param.ti = hit.get_t();
+    param.ri = hit.get_r();
+    param.dri = hit.get_sigma_r();
+    param.rmaxi = hit.get_rmax();
+    for (int residual_type : residual_types) {
+      param.residual_type = residual_type;
+      param.mode = line_fit_params::PARAM_INDEX_Z0;
+      const double residual = residual_function(param.z0, &param);
+      if (!with_jacobian_) {
+        eqs_.add(residual, nullptr);
+        continue;
+      }
+      double gradient[line_fit_params::LINE_FIT_NOPARS];
+      for (size_t ipar = 0; ipar < npars; ipar++) {
+        double result, abserr;
+        param.mode = static_cast<int>(ipar);
+        gsl_deriv_central(&F, *param_values[ipar], param_h[ipar], &result, &abserr);
+        gradient[ipar] = result;
+      }
+      eqs_.add(residual, gradient);
+    }
+  }
+  return GSL_SUCCESS;
+}
+
 void line_fit_mgr::convert_solution(const gg_hits_col &hits_ref_, const line_fit_solution &sol_,
                                     const geomtools::placement &pl_, geomtools::line_3d &line_) {
   const bool draw = false;
@@ -1234,7 +1388,7 @@ bool line_fit_mgr::guess_utils::compute_guess(const gg_hits_col &hits_, int gues
   // Check if the cluster is or not delayed
   bool is_cluster_delayed = true;
   for (const auto &a_hit : hits_) {
-    if (!a_hit.get_properties().has_flag(gg_hit::delayed_flag())) {
+    if (!a_hit.is_delayed()) {
       is_cluster_delayed = false;
       break;
     }
@@ -43,6 +43,7 @@
 
 // This project:
 #include <TrackFit/gg_hit.h>
+#include <TrackFit/lm_solver.h>
 
 namespace geomtools {
 class placement;
@@ -205,6 +206,15 @@ class line_fit_mgr : boost::noncopyable {
   /// Set the fit tolerance
   void set_fit_eps(double eps_);
 
+  /// Set the flag to use the fixed-size solver in place of the GSL one
+  void set_fixed_solver(bool);
+
+  /// Check if the fit uses the fixed-size solver
+  bool is_using_fixed_solver() const;
+
+  /// Return the norm of the residuals at the current fit step (at the guess before the fit)
+  double get_current_chi() const;
+
   /// Set the reference time of the hits(if not part of the free parameters)
   void set_t0(double);
 
@@ -238,6 +248,12 @@ class line_fit_mgr : boost::noncopyable {
   /// Initialization from parameters
   void init(const datatools::properties &config_);
 
+  /// Return the norm of the residuals at a guess, without initializing the fit
+  ///
+  /// The configuration is the one the fit would be initialized with. No solver
+  /// is allocated, so that the guesses can be ranked before any fit starts.
+  double compute_guess_chi(const line_fit_params &guess_, const datatools::properties &config_);
+
   /// Reset
   void reset();
 
@@ -336,6 +352,11 @@ class line_fit_mgr : boost::noncopyable {
   /// Compute residual and difference(GSL interface)
   static int residual_fdf(const gsl_vector *x_, void *params_, gsl_vector *f_, gsl_matrix *J_);
 
+  /// Compute residual and difference (fixed-size solver interface)
+  static int residual_lm(const double *x_, void *params_,
+                         lm_normal_equations<line_fit_params::LINE_FIT_NOPARS> &eqs_,
+                         bool with_jacobian_);
+
   /// Access to residual parameters associated to an individual hit
   void get_residuals_per_hit(size_t hit_index_, double &alpha_residual_, double &beta_residual_,
                              bool at_solution_ = false) const;
@@ -361,6 +382,15 @@ class line_fit_mgr : boost::noncopyable {
   /// Set default attribute values
   void _set_defaults_();
 
+  /// Parse the configuration and set up the fit data
+  void _configure_(const datatools::properties &config_);
+
+  /// Return the current value of a fitted parameter
+  double _fit_x_(int param_index_) const;
+
+  /// Return the norm of the residuals at the current fit step
+  double _fit_chi_() const;
+
  private:
   datatools::logger::priority _logging_priority_;  /// Logging priority threshold
 
@@ -377,6 +407,10 @@ class line_fit_mgr : boost::noncopyable {
   double _fit_eps_;                                       /// Fit tolerance
   size_t _fit_max_iter_;                                  /// Maximum number of fit iterations
   gsl_matrix *_fit_covar_;                                /// Covariance matrix of the fit
+  bool _fixed_solver_;  /// Flag to use the fixed-size solver in place of the GSL one
+  lm_solver<line_fit_params::LINE_FIT_NOPARS> _fit_lm_solver_;  /// Fixed-size solver
+  double _fit_lm_covar_[line_fit_params::LINE_FIT_NOPARS]
+                       [line_fit_params::LINE_FIT_NOPARS];  /// Fixed-size fit covariance
   int _fit_status_;                                       /// Current fit status
   line_fit_data _fit_data_;                               /// Fit data for a line
 
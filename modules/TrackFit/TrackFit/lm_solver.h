@@ -0,0 +1,302 @@
+// -*- mode: c++ ; -*-
+/** \file falaise/TrackFit/lm_solver.h
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public  License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * Description:
+ *   Allocation-free Levenberg-Marquardt solver for small least-squares fits
+ *
+ * History:
+ *
+ */
+
+#ifndef FALAISE_TRACKFIT_LM_SOLVER_H
+#define FALAISE_TRACKFIT_LM_SOLVER_H 1
+
+// Standard library:
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+
+// Third party:
+// - GSL:
+#include <gsl/gsl_errno.h>
+// - Bayeux/datatools:
+#include <datatools/exception.h>
+
+namespace TrackFit {
+
+/// \brief Normal equations (J^T.J, J^T.f) of a least-squares problem
+/**
+ *  Residuals are added one at a time with their gradient so that the
+ *  Jacobian matrix itself is never stored.
+ */
+template <std::size_t N>
+struct lm_normal_equations {
+  /// Clear the equations for a problem with npars_ free parameters
+  void reset(std::size_t npars_) {
+    npars = npars_;
+    chi2 = 0.0;
+    for (std::size_t i = 0; i < N; i++) {
+      jtf[i] = 0.0;
+      for (std::size_t j = 0; j < N; j++) {
+        jtj[i][j] = 0.0;
+      }
+    }
+  }
+
+  /// Add a residual and its gradient (may be null if only the chi2 is needed)
+  void add(double f_, const double *grad_) {
+    chi2 += f_ * f_;
+    if (grad_ == nullptr) {
+      return;
+    }
+    for (std::size_t i = 0; i < npars; i++) {
+      jtf[i] += grad_[i] * f_;
+      for (std::size_t j = 0; j < npars; j++) {
+        jtj[i][j] += grad_[i] * grad_[j];
+      }
+    }
+  }
+
+  // Attributes:
+  std::size_t npars;  /// Number of free parameters
+  double chi2;        /// Sum of the squared residuals
+  double jtj[N][N];   /// J^T.J matrix
+  double jtf[N];      /// J^T.f vector
+};
+
+/// \brief Levenberg-Marquardt solver with storage for at most N parameters
+/**
+ *  This solver is an alternative to the GSL 'lmder' solver for the helix
+ *  and line fits, which have at most five free parameters. All its working
+ *  storage has a fixed size, so that no memory is allocated along the fit.
+ *  It follows the GSL fdfsolver usage: set the function and starting point,
+ *  then iterate and test the last step with test_delta until convergence.
+ *
+ *  The function fills the normal equations at a given point. Each step
+ *  solves (J^T.J + lambda.D) dx = -J^T.f, with D the diagonal of J^T.J,
+ *  by Cholesky decomposition. The step is accepted if the chi2 decreases,
+ *  otherwise lambda is increased and a new step is tried. Status codes
+ *  are the GSL ones.
+ */
+template <std::size_t N>
+class lm_solver {
+ public:
+  /// Function filling the normal equations at point x_ (with gradients only if with_jacobian_)
+  typedef int (*function_type)(const double *x_, void *params_, lm_normal_equations<N> &eqs_,
+                               bool with_jacobian_);
+
+  /// Maximum number of rejected steps within one iteration
+  static const unsigned int MAX_TRIALS = 10;
+
+  /// Default constructor
+  lm_solver() : _function_(nullptr), _params_(nullptr), _npars_(0), _lambda_(0.0) {
+    for (std::size_t i = 0; i < N; i++) {
+      _x_[i] = 0.0;
+      _dx_[i] = 0.0;
+    }
+    _eqs_.reset(0);
+  }
+
+  /// Set the function to minimize, the number of free parameters and the starting point
+  int set(function_type function_, void *params_, std::size_t npars_, const double *x_) {
+    DT_THROW_IF(function_ == nullptr, std::logic_error, "Missing function !");
+    DT_THROW_IF(npars_ == 0 || npars_ > N, std::range_error,
+                "Invalid number of parameters (" << npars_ << ") !");
+    _function_ = function_;
+    _params_ = params_;
+    _npars_ = npars_;
+    _lambda_ = 1.e-3;
+    for (std::size_t i = 0; i < N; i++) {
+      _x_[i] = i < _npars_ ? x_[i] : 0.0;
+      _dx_[i] = 0.0;
+    }
+    return _evaluate_(_x_, _eqs_, true);
+  }
+
+  /// Perform one iteration
+  int iterate() {
+    if (_function_ == nullptr) {
+      return GSL_EINVAL;
+    }
+    double scale[N];
+    for (std::size_t i = 0; i < _npars_; i++) {
+      scale[i] = _eqs_.jtj[i][i] > 0.0 ? _eqs_.jtj[i][i] : 1.0;
+    }
+    double step[N];
+    double x_trial[N];
+    lm_normal_equations<N> trial;
+    for (unsigned int itrial = 0; itrial < MAX_TRIALS; itrial++) {
+      double a[N][N];
+      for (std::size_t i = 0; i < _npars_; i++) {
+        for (std::size_t j = 0; j < _npars_; j++) {
+          a[i][j] = _eqs_.jtj[i][j];
+        }
+        a[i][i] += _lambda_ * scale[i];
+      }
+      if (!_cholesky_decomp_(a, _npars_)) {
+        _lambda_ *= 10.0;
+        continue;
+      }
+      double minus_jtf[N];
+      for (std::size_t i = 0; i < _npars_; i++) {
+        minus_jtf[i] = -_eqs_.jtf[i];
+      }
+      _cholesky_solve_(a, _npars_, minus_jtf, step);
+      for (std::size_t i = 0; i < _npars_; i++) {
+        x_trial[i] = _x_[i] + step[i];
+        _dx_[i] = step[i];
+      }
+      const int status = _evaluate_(x_trial, trial, false);
+      if (status == GSL_SUCCESS && trial.chi2 < _eqs_.chi2) {
+        for (std::size_t i = 0; i < _npars_; i++) {
+          _x_[i] = x_trial[i];
+        }
+        _lambda_ = std::max(0.1 * _lambda_, 1.e-12);
+        return _evaluate_(_x_, _eqs_, true);
+      }
+      _lambda_ *= 10.0;
+    }
+    // The last rejected step is kept in dx, as the GSL solver does
+    return GSL_ENOPROG;
+  }
+
+  /// Test the convergence of the last step (same criterion as gsl_multifit_test_delta)
+  int test_delta(double epsabs_, double epsrel_) const {
+    if (epsrel_ < 0.0) {
+      return GSL_EBADTOL;
+    }
+    for (std::size_t i = 0; i < _npars_; i++) {
+      const double tolerance = epsabs_ + epsrel_ * std::abs(_x_[i]);
+      if (!(std::abs(_dx_[i]) < tolerance)) {
+        return GSL_CONTINUE;
+      }
+    }
+    return GSL_SUCCESS;
+  }
+
+  /// Compute the covariance matrix (J^T.J)^-1 at the current point, return false if singular
+  bool covariance(double (&covar_)[N][N]) const {
+    for (std::size_t i = 0; i < N; i++) {
+      for (std::size_t j = 0; j < N; j++) {
+        covar_[i][j] = 0.0;
+      }
+    }
+    double l[N][N];
+    for (std::size_t i = 0; i < _npars_; i++) {
+      for (std::size_t j = 0; j < _npars_; j++) {
+        l[i][j] = _eqs_.jtj[i][j];
+      }
+    }
+    if (!_cholesky_decomp_(l, _npars_)) {
+      return false;
+    }
+    for (std::size_t k = 0; k < _npars_; k++) {
+      double e[N];
+      double column[N];
+      for (std::size_t i = 0; i < _npars_; i++) {
+        e[i] = (i == k) ? 1.0 : 0.0;
+      }
+      _cholesky_solve_(l, _npars_, e, column);
+      for (std::size_t i = 0; i < _npars_; i++) {
+        covar_[i][k] = column[i];
+      }
+    }
+    return true;
+  }
+
+  /// Return the number of free parameters
+  std::size_t get_npars() const { return _npars_; }
+
+  /// Return the current value of a parameter
+  double get_x(std::size_t i_) const { return _x_[i_]; }
+
+  /// Return the last step of a parameter
+  double get_dx(std::size_t i_) const { return _dx_[i_]; }
+
+  /// Return the norm of the residuals at the current point
+  double get_chi() const { return std::sqrt(_eqs_.chi2); }
+
+ private:
+  /// Evaluate the function, rejecting non finite chi2 values
+  int _evaluate_(const double *x_, lm_normal_equations<N> &eqs_, bool with_jacobian_) const {
+    eqs_.reset(_npars_);
+    const int status = _function_(x_, _params_, eqs_, with_jacobian_);
+    if (status != GSL_SUCCESS) {
+      return status;
+    }
+    if (!std::isfinite(eqs_.chi2)) {
+      return GSL_EBADFUNC;
+    }
+    return GSL_SUCCESS;
+  }
+
+  /// In place Cholesky decomposition A = L.L^T, L stored in the lower triangle
+  static bool _cholesky_decomp_(double (&a_)[N][N], std::size_t n_) {
+    for (std::size_t j = 0; j < n_; j++) {
+      double d = a_[j][j];
+      for (std::size_t k = 0; k < j; k++) {
+        d -= a_[j][k] * a_[j][k];
+      }
+      if (!(d > 0.0)) {
+        return false;
+      }
+      a_[j][j] = std::sqrt(d);
+      for (std::size_t i = j + 1; i < n_; i++) {
+        double s = a_[i][j];
+        for (std::size_t k = 0; k < j; k++) {
+          s -= a_[i][k] * a_[j][k];
+        }
+        a_[i][j] = s / a_[j][j];
+      }
+    }
+    return true;
+  }
+
+  /// Solve L.L^T x = b from a Cholesky decomposition
+  static void _cholesky_solve_(const double (&l_)[N][N], std::size_t n_, const double *b_,
+                               double *x_) {
+    for (std::size_t i = 0; i < n_; i++) {
+      double s = b_[i];
+      for (std::size_t k = 0; k < i; k++) {
+        s -= l_[i][k] * x_[k];
+      }
+      x_[i] = s / l_[i][i];
+    }
+    for (std::size_t ii = n_; ii-- > 0;) {
+      double s = x_[ii];
+      for (std::size_t k = ii + 1; k < n_; k++) {
+        s -= l_[k][ii] * x_[k];
+      }
+      x_[ii] = s / l_[ii][ii];
+    }
+  }
+
+ private:
+  function_type _function_;     /// Function filling the normal equations
+  void *_params_;               /// Parameters of the function
+  std::size_t _npars_;          /// Number of free parameters
+  double _lambda_;              /// Damping factor
+  double _x_[N];                /// Current point
+  double _dx_[N];               /// Last step
+  lm_normal_equations<N> _eqs_; /// Normal equations at the current point
+};
+
+}  // end of namespace TrackFit
+
+#endif  // FALAISE_TRACKFIT_LM_SOLVER_H
@@ -1,7 +1,9 @@
 // Standard library:
+#include <cmath>
 #include <cstdlib>
 #include <exception>
 #include <iostream>
+#include <map>
 #include <string>
 
 // Third party:
@@ -15,6 +17,7 @@
 
 // Falaise:
 #include <falaise/falaise.h>
+#include <falaise/snemo/datamodels/helix_trajectory_pattern.h>
 #include <falaise/snemo/datamodels/tracker_clustering_data.h>
 #include <falaise/snemo/datamodels/tracker_trajectory_data.h>
 #include <falaise/snemo/geometry/gg_locator.h>
@@ -26,6 +29,59 @@
 // Testing resources:
 #include <utilities.h>
 
+// Return the best chi2 among all trajectories of the first solution
+double best_chi2(const snemo::datamodel::tracker_trajectory_data& ttd_) {
+  double best = -1.0;
+  if (ttd_.get_solutions().empty()) {
+    return best;
+  }
+  for (const auto& a_trajectory : ttd_.get_solutions().front().get().get_trajectories()) {
+    const double chi2 = a_trajectory.get().get_auxiliaries().fetch_real("chi2");
+    if (best < 0.0 || chi2 < best) {
+      best = chi2;
+    }
+  }
+  return best;
+}
+
+// Return the number of fits performed for the first solution
+int number_of_fits(const snemo::datamodel::tracker_trajectory_data& ttd_) {
+  return ttd_.get_solutions().front().get().get_auxiliaries().fetch_integer("trackfit.fits");
+}
+
+// Return the number of trajectories of the first solution
+int number_of_trajectories(const snemo::datamodel::tracker_trajectory_data& ttd_) {
+  return ttd_.get_solutions().front().get().get_trajectories().size();
+}
+
+// Seed each cluster with its best fitted helix, as a clusterizer would
+void seed_clusters(snemo::datamodel::tracker_trajectory_data& ttd_) {
+  namespace sdm = snemo::datamodel;
+  std::map<const sdm::tracker_cluster*, double> best_chi2s;
+  for (auto& a_trajectory : ttd_.get_solutions().front().grab().grab_trajectories()) {
+    const auto* htp =
+        dynamic_cast<const sdm::helix_trajectory_pattern*>(&a_trajectory->get_pattern());
+    if (htp == nullptr) {
+      continue;
+    }
+    sdm::tracker_cluster& a_cluster = a_trajectory.grab().get_cluster();
+    const double chi2 = a_trajectory->get_auxiliaries().fetch_real("chi2");
+    auto found = best_chi2s.find(&a_cluster);
+    if (found != best_chi2s.end() && found->second <= chi2) {
+      continue;
+    }
+    best_chi2s[&a_cluster] = chi2;
+    const geomtools::helix_3d& a_helix = htp->get_helix();
+    sdm::tracker_cluster::helix_seed seed;
+    seed.x0 = a_helix.get_center().x();
+    seed.y0 = a_helix.get_center().y();
+    seed.z0 = a_helix.get_center().z();
+    seed.r = a_helix.get_radius();
+    seed.step = a_helix.get_step();
+    a_cluster.set_helix_seed(seed);
+  }
+}
+
 int main(int argc_, char** argv_) {
   falaise::initialize(argc_, argv_);
   int error_code = EXIT_SUCCESS;
@@ -90,6 +146,33 @@ int main(int argc_, char** argv_) {
     TF.set_geometry_manager(Geo);
     TF.initialize(TrackFitconfig);
 
+    // The same driver, ranking and rejecting guesses and merging solutions:
+    datatools::properties TrackFitFastConfig = TrackFitconfig;
+    TrackFitFastConfig.store_real("line.guess_rejection_factor", 1000.0);
+    TrackFitFastConfig.store_real("line.merge_nsigma", 1.0);
+    TrackFitFastConfig.store_real("helix.guess_rejection_factor", 1000.0);
+    TrackFitFastConfig.store_real("helix.merge_nsigma", 1.0);
+    snemo::reconstruction::trackfit_driver TFFast;
+    TFFast.set_logging_priority(logging);
+    TFFast.set_geometry_manager(Geo);
+    TFFast.initialize(TrackFitFastConfig);
+
+    // The fast driver, fitting the helix seed of the clusters first:
+    datatools::properties TrackFitSeededConfig = TrackFitFastConfig;
+    TrackFitSeededConfig.store_boolean("helix.use_cluster_seed", true);
+    snemo::reconstruction::trackfit_driver TFSeeded;
+    TFSeeded.set_logging_priority(logging);
+    TFSeeded.set_geometry_manager(Geo);
+    TFSeeded.initialize(TrackFitSeededConfig);
+
+    // The default driver, fitting the helix seed of the clusters in place of the guesses:
+    datatools::properties TrackFitSeededOnlyConfig = TrackFitconfig;
+    TrackFitSeededOnlyConfig.store_boolean("helix.use_cluster_seed", true);
+    snemo::reconstruction::trackfit_driver TFSeededOnly;
+    TFSeededOnly.set_logging_priority(logging);
+    TFSeededOnly.set_geometry_manager(Geo);
+    TFSeededOnly.initialize(TrackFitSeededOnlyConfig);
+
     // Event loop:
     for (int i = 0; i < 3; i++) {
       std::clog << "Processing event #" << i << "\n";
@@ -102,6 +185,60 @@ int main(int argc_, char** argv_) {
         break;
       }
       TTD.tree_dump(std::clog, "Trajectory data: ", "", true);
+
+      // Skipping and merging solutions must not change the best one:
+      snemo::datamodel::tracker_trajectory_data TTDFast;
+      code = TFFast.process(TCD, TTDFast);
+      DT_THROW_IF(code != 0, std::logic_error, "Processing with guess rejection failed !");
+      const double chi2 = best_chi2(TTD);
+      const double chi2_fast = best_chi2(TTDFast);
+      std::clog << "Best chi2: " << chi2 << " (with guess rejection: " << chi2_fast << ")\n";
+      DT_THROW_IF(std::abs(chi2_fast - chi2) > 1.e-6 * std::abs(chi2), std::logic_error,
+                  "Best solution changed with guess rejection !");
+
+      // Starting from the best helices must find them again, the guesses competing with them:
+      seed_clusters(TTD);
+      snemo::datamodel::tracker_trajectory_data TTDSeeded;
+      code = TFSeeded.process(TCD, TTDSeeded);
+      DT_THROW_IF(code != 0, std::logic_error, "Processing with cluster seeds failed !");
+      const double chi2_seeded = best_chi2(TTDSeeded);
+      const int seeded_fits =
+          TTDSeeded.get_solutions().front().get().get_auxiliaries().fetch_integer(
+              "trackfit.seeded_fits");
+      std::clog << "Best chi2 with cluster seeds: " << chi2_seeded << " ("
+                << number_of_fits(TTDSeeded) << " fits including " << seeded_fits
+                << " seeded ones, " << number_of_fits(TTDFast) << " without seeds, "
+                << number_of_fits(TTD) << " without rejection)\n";
+      DT_THROW_IF(std::abs(chi2_seeded - chi2) > 1.e-3 * std::abs(chi2), std::logic_error,
+                  "Best solution changed with cluster seeds !");
+      DT_THROW_IF(seeded_fits == 0, std::logic_error, "No cluster fitted from its seed !");
+      DT_THROW_IF(number_of_fits(TTDSeeded) > number_of_fits(TTD) + seeded_fits, std::logic_error,
+                  "Cluster seeds fitted more guesses !");
+
+      // Cluster seeds are ignored with default options:
+      snemo::datamodel::tracker_trajectory_data TTDDefault;
+      code = TF.process(TCD, TTDDefault);
+      DT_THROW_IF(code != 0, std::logic_error, "Processing of seeded clusters failed !");
+      DT_THROW_IF(number_of_trajectories(TTDDefault) != number_of_trajectories(TTD) ||
+                      number_of_fits(TTDDefault) != number_of_fits(TTD),
+                  std::logic_error, "Cluster seeds changed the default solutions !");
+
+      // A converged seed replaces the guesses, with no more solutions:
+      snemo::datamodel::tracker_trajectory_data TTDSeededOnly;
+      code = TFSeededOnly.process(TCD, TTDSeededOnly);
+      DT_THROW_IF(code != 0, std::logic_error, "Processing with cluster seeds only failed !");
+      const double chi2_seeded_only = best_chi2(TTDSeededOnly);
+      std::clog << "Best chi2 with cluster seeds only: " << chi2_seeded_only << " ("
+                << number_of_fits(TTDSeededOnly) << " fits, "
+                << number_of_trajectories(TTDSeededOnly) << " trajectories, "
+                << number_of_trajectories(TTD) << " without seeds)\n";
+      DT_THROW_IF(std::abs(chi2_seeded_only - chi2) > 1.e-3 * std::abs(chi2), std::logic_error,
+                  "Best solution changed with cluster seeds only !");
+      DT_THROW_IF(number_of_fits(TTDSeededOnly) >= number_of_fits(TTD), std::logic_error,
+                  "Cluster seeds did not replace the guesses !");
+      DT_THROW_IF(number_of_trajectories(TTDSeededOnly) > number_of_trajectories(TTD),
+                  std::logic_error, "Cluster seeds added solutions !");
+
       for (int j = 0; j < (int)TTD.get_solutions().size(); j++) {
         std::string indent = "|   ";
         if (j == (int)TTD.get_solutions().size() - 1) {
@@ -118,6 +255,9 @@ int main(int argc_, char** argv_) {
 
     // Terminate the TrackFit driver:
     TF.reset();
+    TFFast.reset();
+    TFSeeded.reset();
+    TFSeededOnly.reset();
 
     std::clog << "The end.\n";
   } catch (std::exception& error) {
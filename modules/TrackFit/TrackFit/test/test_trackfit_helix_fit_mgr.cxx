@@ -12,6 +12,7 @@
 
 // Third party:
 // - Bayeux/datatools:
+#include <datatools/exception.h>
 #include <datatools/temporary_files.h>
 // - Bayeux/mygsl:
 #include <mygsl/rng.h>
@@ -37,6 +38,20 @@ geomtools::helix_3d generate_helix_geiger_hits(mygsl::rng& random_, TrackFit::gg
 
 // std::string gp_macro(const std::string & filename_);
 
+// Check that a parameter fitted by the fixed-size solver matches the GSL one:
+// the value within one GSL standard deviation plus the fit tolerance, the error within 10%
+void check_same_parameter(const std::string& name_, double gsl_value_, double gsl_error_,
+                          double fixed_value_, double fixed_error_, double eps_) {
+  const double tolerance = gsl_error_ + eps_ * (1.0 + std::abs(gsl_value_));
+  DT_THROW_IF(!(std::abs(fixed_value_ - gsl_value_) <= tolerance), std::logic_error,
+              "Parameter '" << name_ << "' with the fixed-size solver (" << fixed_value_
+                            << ") differs from the GSL one (" << gsl_value_ << ") !");
+  DT_THROW_IF(!(std::abs(fixed_error_ - gsl_error_) <= 0.1 * gsl_error_ + 1.e-9),
+              std::logic_error,
+              "Error on parameter '" << name_ << "' with the fixed-size solver (" << fixed_error_
+                                     << ") differs from the GSL one (" << gsl_error_ << ") !");
+}
+
 int main(int argc_, char** argv_) {
   int error_code = EXIT_SUCCESS;
   try {
@@ -225,6 +240,12 @@ int main(int argc_, char** argv_) {
         config.store_flag("ignore_drift_time");
       }
 
+      // Best chi found by the GSL and fixed-size solvers:
+      double best_gsl_chi = -1.0;
+      double best_fixed_chi = -1.0;
+      TrackFit::helix_fit_solution best_gsl_solution;
+      TrackFit::helix_fit_solution best_fixed_solution;
+      double eps = 1.e-2;
       for (int iguess = 0; iguess < max_guess; iguess++) {
         if (only_guess >= 0) {
           if (iguess != only_guess) continue;
@@ -235,10 +256,20 @@ int main(int argc_, char** argv_) {
         HFM.set_hits(hits_ref);
         HFM.set_calibration(dtc);
         HFM.set_t0(0.0 * CLHEP::ns);
-        double eps = 1.e-2;
         HFM.set_fit_eps(eps);
         HFM.set_guess(guess[iguess]);
         HFM.init(config);
+
+        // The chi used to rank the guesses must be the one of the initialized fit:
+        TrackFit::helix_fit_mgr probe;
+        probe.set_hits(hits_ref);
+        probe.set_calibration(dtc);
+        probe.set_t0(0.0 * CLHEP::ns);
+        const double guess_chi = probe.compute_guess_chi(guess[iguess], config);
+        DT_THROW_IF(std::abs(guess_chi - HFM.get_current_chi()) > 1.e-9 * (1.0 + guess_chi),
+                    std::logic_error,
+                    "Chi at the guess (" << guess_chi << ") differs from the initialized fit ("
+                                         << HFM.get_current_chi() << ") !");
         HFM.fit();
 
         if (HFM.get_solution().ok) {
@@ -258,11 +289,55 @@ int main(int argc_, char** argv_) {
             std::clog << std::endl;
           }
           solutions.push_back(HFM.get_solution());
+
+          // Same fit with the fixed-size solver:
+          TrackFit::helix_fit_mgr HFM2;
+          HFM2.set_hits(hits_ref);
+          HFM2.set_calibration(dtc);
+          HFM2.set_t0(0.0 * CLHEP::ns);
+          HFM2.set_fit_eps(eps);
+          HFM2.set_guess(guess[iguess]);
+          HFM2.set_fixed_solver(true);
+          HFM2.init(config);
+          HFM2.fit();
+          const double chi = HFM.get_solution().chi;
+          const double fixed_chi = HFM2.get_solution().ok ? HFM2.get_solution().chi : -1.0;
+          std::clog << "NOTICE:   Chi (fixed-size solver) = " << fixed_chi << std::endl;
+          if ((best_gsl_chi < 0.0) || (chi < best_gsl_chi)) {
+            best_gsl_chi = chi;
+            best_gsl_solution = HFM.get_solution();
+          }
+          if ((fixed_chi >= 0.0) && ((best_fixed_chi < 0.0) || (fixed_chi < best_fixed_chi))) {
+            best_fixed_chi = fixed_chi;
+            best_fixed_solution = HFM2.get_solution();
+          }
+          HFM2.reset();
         } else {
           std::clog << "NOTICE: No solution has been found !" << std::endl;
         }
         HFM.reset();
       }
+      // The fixed-size solver must find a minimum as good as the GSL one:
+      DT_THROW_IF(best_gsl_chi >= 0.0 && best_fixed_chi < 0.0, std::logic_error,
+                  "No solution found with the fixed-size solver !");
+      DT_THROW_IF(best_gsl_chi >= 0.0 && best_fixed_chi > 1.05 * best_gsl_chi + 1.e-3,
+                  std::logic_error,
+                  "Best chi with the fixed-size solver (" << best_fixed_chi
+                                                          << ") is worse than the GSL one ("
+                                                          << best_gsl_chi << ") !");
+      // ... and the same parameters and errors at that minimum:
+      if (best_gsl_chi >= 0.0) {
+        check_same_parameter("x0", best_gsl_solution.x0, best_gsl_solution.err_x0,
+                             best_fixed_solution.x0, best_fixed_solution.err_x0, eps);
+        check_same_parameter("y0", best_gsl_solution.y0, best_gsl_solution.err_y0,
+                             best_fixed_solution.y0, best_fixed_solution.err_y0, eps);
+        check_same_parameter("z0", best_gsl_solution.z0, best_gsl_solution.err_z0,
+                             best_fixed_solution.z0, best_fixed_solution.err_z0, eps);
+        check_same_parameter("r", best_gsl_solution.r, best_gsl_solution.err_r,
+                             best_fixed_solution.r, best_fixed_solution.err_r, eps);
+        check_same_parameter("step", best_gsl_solution.step, best_gsl_solution.err_step,
+                             best_fixed_solution.step, best_fixed_solution.err_step, eps);
+      }
     }
 
     TrackFit::helix_fit_solution best_solution;
@@ -12,6 +12,7 @@
 
 // Third party:
 // - Bayeux/datatools:
+#include <datatools/exception.h>
 #include <datatools/temporary_files.h>
 // - Bayeux/mygsl:
 #include <mygsl/rng.h>
@@ -37,6 +38,20 @@ geomtools::line_3d generate_aligned_geiger_hits(mygsl::rng& random_, TrackFit::g
 
 std::string gp_macro(const std::string& filename_);
 
+// Check that a parameter fitted by the fixed-size solver matches the GSL one:
+// the value within one GSL standard deviation plus the fit tolerance, the error within 10%
+void check_same_parameter(const std::string& name_, double gsl_value_, double gsl_error_,
+                          double fixed_value_, double fixed_error_, double eps_) {
+  const double tolerance = gsl_error_ + eps_ * (1.0 + std::abs(gsl_value_));
+  DT_THROW_IF(!(std::abs(fixed_value_ - gsl_value_) <= tolerance), std::logic_error,
+              "Parameter '" << name_ << "' with the fixed-size solver (" << fixed_value_
+                            << ") differs from the GSL one (" << gsl_value_ << ") !");
+  DT_THROW_IF(!(std::abs(fixed_error_ - gsl_error_) <= 0.1 * gsl_error_ + 1.e-9),
+              std::logic_error,
+              "Error on parameter '" << name_ << "' with the fixed-size solver (" << fixed_error_
+                                     << ") differs from the GSL one (" << gsl_error_ << ") !");
+}
+
 int main(int argc_, char** argv_) {
   int error_code = EXIT_SUCCESS;
   try {
@@ -199,6 +214,12 @@ int main(int argc_, char** argv_) {
         config.store_flag("ignore_drift_time");
       }
 
+      // Best chi found by the GSL and fixed-size solvers:
+      double best_gsl_chi = -1.0;
+      double best_fixed_chi = -1.0;
+      TrackFit::line_fit_solution best_gsl_solution;
+      TrackFit::line_fit_solution best_fixed_solution;
+      double eps = 1.e-2;
       for (int iguess = 0; iguess < max_guess; iguess++) {
         if (only_guess >= 0) {
           if (iguess != only_guess) continue;
@@ -209,10 +230,20 @@ int main(int argc_, char** argv_) {
         LFM.set_calibration(dtc);
         LFM.set_t0(0.0 * CLHEP::ns);
         LFM.set_debug(debug);
-        double eps = 1.e-2;
         LFM.set_fit_eps(eps);
         LFM.set_guess(guess[iguess]);
         LFM.init(config);
+
+        // The chi used to rank the guesses must be the one of the initialized fit:
+        TrackFit::line_fit_mgr probe;
+        probe.set_hits(hits_ref);
+        probe.set_calibration(dtc);
+        probe.set_t0(0.0 * CLHEP::ns);
+        const double guess_chi = probe.compute_guess_chi(guess[iguess], config);
+        DT_THROW_IF(std::abs(guess_chi - LFM.get_current_chi()) > 1.e-9 * (1.0 + guess_chi),
+                    std::logic_error,
+                    "Chi at the guess (" << guess_chi << ") differs from the initialized fit ("
+                                         << LFM.get_current_chi() << ") !");
         LFM.fit();
 
         if (LFM.get_solution().ok) {
@@ -235,11 +266,53 @@ int main(int argc_, char** argv_) {
           if (LFM.get_solution().probability_q() > 0.1) {
             solutions.push_back(LFM.get_solution());
           }
+
+          // Same fit with the fixed-size solver:
+          TrackFit::line_fit_mgr LFM2;
+          LFM2.set_hits(hits_ref);
+          LFM2.set_calibration(dtc);
+          LFM2.set_t0(0.0 * CLHEP::ns);
+          LFM2.set_fit_eps(eps);
+          LFM2.set_guess(guess[iguess]);
+          LFM2.set_fixed_solver(true);
+          LFM2.init(config);
+          LFM2.fit();
+          const double chi = LFM.get_solution().chi;
+          const double fixed_chi = LFM2.get_solution().ok ? LFM2.get_solution().chi : -1.0;
+          std::clog << "NOTICE:   Chi (fixed-size solver) = " << fixed_chi << std::endl;
+          if ((best_gsl_chi < 0.0) || (chi < best_gsl_chi)) {
+            best_gsl_chi = chi;
+            best_gsl_solution = LFM.get_solution();
+          }
+          if ((fixed_chi >= 0.0) && ((best_fixed_chi < 0.0) || (fixed_chi < best_fixed_chi))) {
+            best_fixed_chi = fixed_chi;
+            best_fixed_solution = LFM2.get_solution();
+          }
+          LFM2.reset();
         } else {
           std::clog << "NOTICE: No solution has been found !" << std::endl;
         }
         LFM.reset();
       }
+      // The fixed-size solver must find a minimum as good as the GSL one:
+      DT_THROW_IF(best_gsl_chi >= 0.0 && best_fixed_chi < 0.0, std::logic_error,
+                  "No solution found with the fixed-size solver !");
+      DT_THROW_IF(best_gsl_chi >= 0.0 && best_fixed_chi > 1.05 * best_gsl_chi + 1.e-3,
+                  std::logic_error,
+                  "Best chi with the fixed-size solver (" << best_fixed_chi
+                                                          << ") is worse than the GSL one ("
+                                                          << best_gsl_chi << ") !");
+      // ... and the same parameters and errors at that minimum:
+      if (best_gsl_chi >= 0.0) {
+        check_same_parameter("z0", best_gsl_solution.z0, best_gsl_solution.err_z0,
+                             best_fixed_solution.z0, best_fixed_solution.err_z0, eps);
+        check_same_parameter("y0", best_gsl_solution.y0, best_gsl_solution.err_y0,
+                             best_fixed_solution.y0, best_fixed_solution.err_y0, eps);
+        check_same_parameter("phi", best_gsl_solution.phi, best_gsl_solution.err_phi,
+                             best_fixed_solution.phi, best_fixed_solution.err_phi, eps);
+        check_same_parameter("theta", best_gsl_solution.theta, best_gsl_solution.err_theta,
+                             best_fixed_solution.theta, best_fixed_solution.err_theta, eps);
+      }
     }
     // ftmp.out() << std::endl;
 
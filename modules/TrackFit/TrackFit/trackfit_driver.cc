@@ -3,6 +3,11 @@
 // Ourselves:
 #include <TrackFit/trackfit_driver.h>
 
+// Standard library:
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
 // Third party:
 // - Bayeux/geomtools:
 #include <bayeux/geomtools/manager.h>
@@ -27,6 +32,82 @@ namespace snemo {
 
 namespace reconstruction {
 
+namespace {
+
+/// Guess waiting to be fitted
+template <typename FitParams>
+struct fit_candidate {
+  std::string guess;   /// Label of the guess
+  FitParams params;    /// Fit parameters of the guess
+  double initial_chi;  /// Norm of the residuals at the guess
+};
+
+/// Sort candidates by increasing residual norm at the guess
+template <typename FitParams>
+void rank_candidates(std::vector<fit_candidate<FitParams>>& candidates_) {
+  std::stable_sort(candidates_.begin(), candidates_.end(),
+                   [](const fit_candidate<FitParams>& a_, const fit_candidate<FitParams>& b_) {
+                     return a_.initial_chi < b_.initial_chi;
+                   });
+}
+
+/// Check if a guess cannot compete with the best chi2 found so far
+bool reject_guess(double initial_chi_, double best_chi_, double rejection_factor_) {
+  if (rejection_factor_ <= 0.0 || best_chi_ < 0.0) {
+    return false;
+  }
+  return initial_chi_ * initial_chi_ > rejection_factor_ * best_chi_ * best_chi_;
+}
+
+/// Check if two fitted values agree within nsigma standard deviations
+bool values_agree(double a_, double err_a_, double b_, double err_b_, double nsigma_) {
+  return std::abs(a_ - b_) <= nsigma_ * std::hypot(err_a_, err_b_);
+}
+
+/// Check if two helix solutions agree within their errors
+bool solutions_agree(const TrackFit::helix_fit_solution& a_, const TrackFit::helix_fit_solution& b_,
+                     double nsigma_) {
+  return values_agree(a_.x0, a_.err_x0, b_.x0, b_.err_x0, nsigma_) &&
+         values_agree(a_.y0, a_.err_y0, b_.y0, b_.err_y0, nsigma_) &&
+         values_agree(a_.z0, a_.err_z0, b_.z0, b_.err_z0, nsigma_) &&
+         values_agree(a_.r, a_.err_r, b_.r, b_.err_r, nsigma_) &&
+         values_agree(a_.step, a_.err_step, b_.step, b_.err_step, nsigma_);
+}
+
+/// Check if two line solutions agree within their errors
+bool solutions_agree(const TrackFit::line_fit_solution& a_, const TrackFit::line_fit_solution& b_,
+                     double nsigma_) {
+  return values_agree(a_.z0, a_.err_z0, b_.z0, b_.err_z0, nsigma_) &&
+         values_agree(a_.y0, a_.err_y0, b_.y0, b_.err_y0, nsigma_) &&
+         values_agree(a_.phi, a_.err_phi, b_.phi, b_.err_phi, nsigma_) &&
+         values_agree(a_.theta, a_.err_theta, b_.theta, b_.err_theta, nsigma_) &&
+         values_agree(a_.t0, a_.err_t0, b_.t0, b_.err_t0, nsigma_);
+}
+
+/// Add a converged solution, merging it with an agreeing one if any
+/**
+ * When two solutions agree, only the one with the lowest chi is kept.
+ * Return true if the solution has been merged.
+ */
+template <typename Solution>
+bool add_solution(std::list<Solution>& solutions_, const Solution& solution_,
+                  double merge_nsigma_) {
+  if (merge_nsigma_ > 0.0) {
+    for (Solution& a_solution : solutions_) {
+      if (solutions_agree(a_solution, solution_, merge_nsigma_)) {
+        if (solution_.chi < a_solution.chi) {
+          a_solution = solution_;
+        }
+        return true;
+      }
+    }
+  }
+  solutions_.push_back(solution_);
+  return false;
+}
+
+}  // namespace
+
 /// SuperNEMO drift time calibration
 snemo_drift_time_calibration::snemo_drift_time_calibration() {
   _gg_regime_.reset(new snemo::processing::geiger_regime);
@@ -75,6 +156,12 @@ void trackfit_driver::set_use_helix_fit(const bool use_helix_fit_) {
 
 bool trackfit_driver::use_helix_fit() const { return _use_helix_fit_; }
 
+void trackfit_driver::set_use_cluster_seed(const bool use_cluster_seed_) {
+  _use_cluster_seed_ = use_cluster_seed_;
+}
+
+bool trackfit_driver::use_cluster_seed() const { return _use_cluster_seed_; }
+
 void trackfit_driver::set_line_only_guesses(const std::vector<std::string>& only_guesses_) {
   for (size_t i = 0; i < TrackFit::line_fit_mgr::guess_utils::NUMBER_OF_GUESS; ++i) {
     const std::string key = TrackFit::line_fit_mgr::guess_utils::guess_mode_label(i);
@@ -140,6 +227,16 @@ void trackfit_driver::_set_defaults_() {
   _helix_guess_driver_.reset();
   _helix_guess_dict_.clear();
   _helix_fit_setup_.reset();
+  _line_guess_rejection_factor_ = 0.0;
+  _line_merge_nsigma_ = 0.0;
+  _helix_guess_rejection_factor_ = 0.0;
+  _helix_merge_nsigma_ = 0.0;
+  _use_cluster_seed_ = false;
+
+  _number_of_fits_ = 0;
+  _number_of_rejected_guesses_ = 0;
+  _number_of_merged_solutions_ = 0;
+  _number_of_seeded_fits_ = 0;
 }
 
 // Reset the fitter
@@ -164,6 +261,7 @@ void trackfit_driver::reset() {
   }
 
   _gg_hits_referential_.clear();
+  _trajectory_pool_.clear();
 
   _set_defaults_();
 }
@@ -204,6 +302,10 @@ void trackfit_driver::initialize(const datatools::properties& setup_) {
     _line_guess_driver_.initialize(lg_setup);
     // Extract the setup of the line fit algo :
     setup_.export_and_rename_starting_with(_line_fit_setup_, "line.fit.", "");
+    _line_guess_rejection_factor_ = ps.get<double>("line.guess_rejection_factor", 0.0);
+    _line_merge_nsigma_ = ps.get<double>("line.merge_nsigma", 0.0);
+    DT_THROW_IF(_line_guess_rejection_factor_ < 0.0 || _line_merge_nsigma_ < 0.0,
+                std::domain_error, "Invalid line guess rejection or merging parameter !");
   }
 
   if (use_helix_fit()) {
@@ -213,6 +315,11 @@ void trackfit_driver::initialize(const datatools::properties& setup_) {
     _helix_guess_driver_.initialize(hg_setup);
     // Extract the setup of the helix fit algo :
     setup_.export_and_rename_starting_with(_helix_fit_setup_, "helix.fit.", "");
+    _helix_guess_rejection_factor_ = ps.get<double>("helix.guess_rejection_factor", 0.0);
+    _helix_merge_nsigma_ = ps.get<double>("helix.merge_nsigma", 0.0);
+    set_use_cluster_seed(ps.get<bool>("helix.use_cluster_seed", false));
+    DT_THROW_IF(_helix_guess_rejection_factor_ < 0.0 || _helix_merge_nsigma_ < 0.0,
+                std::domain_error, "Invalid helix guess rejection or merging parameter !");
   }
 
   _install_drift_time_calibration_driver_();
@@ -240,6 +347,9 @@ int trackfit_driver::_process_algo(const snemo::datamodel::tracker_clustering_da
   // by trackfit algorithm)
   const double gg_cell_diameter = get_gg_locator().cellDiameter() / CLHEP::mm;
 
+  // Trajectories of previous events can now be reused:
+  _trajectory_pool_.recycle();
+
   // Get cluster solutions:
   const snemo::datamodel::TrackerClusteringSolutionHdlCollection& cluster_solutions =
       clustering_.solutions();
@@ -251,26 +361,39 @@ int trackfit_driver::_process_algo(const snemo::datamodel::tracker_clustering_da
     trajectory_.add_solution(a_trajectory_solution);
     a_trajectory_solution->set_solution_id(a_cluster_solution->get_solution_id());
     a_trajectory_solution->set_clustering_solution(a_cluster_solution);
+    _number_of_fits_ = 0;
+    _number_of_rejected_guesses_ = 0;
+    _number_of_merged_solutions_ = 0;
+    _number_of_seeded_fits_ = 0;
 
     // Get clusters stored in the current tracker solution:
     const snemo::datamodel::TrackerClusterHdlCollection& clusters =
         a_cluster_solution->get_clusters();
 
     for (const datatools::handle<snemo::datamodel::tracker_cluster>& a_cluster : clusters) {
-      // Get tracker hits stored in the current tracker cluster:
+      // Get the tracker hits stored in the current tracker cluster, and find their values
+      // in the view of the hits of the event:
       const snemo::datamodel::TrackerHitHdlCollection& hits = a_cluster->hits();
+      const snemo::datamodel::tracker_hit_view& hv = _get_hit_view();
 
-      // Home made Geiger hit model for 'trackfit':
-      TrackFit::gg_hits_col gg_hits;
-      for (const datatools::handle<snemo::datamodel::calibrated_tracker_hit>& a_gg_hit : hits) {
+      // Home made Geiger hit model for 'trackfit', reusing the storage of the previous cluster:
+      TrackFit::gg_hits_col& gg_hits = _gg_hits_;
+      gg_hits.clear();
+      for (const snemo::datamodel::TrackerHitHdl& a_hit : hits) {
+        if (!a_hit.has_data()) {
+          continue;
+        }
+        const size_t i = hv.find(a_hit);
+        DT_THROW_IF(i == snemo::datamodel::tracker_hit_view::npos, std::logic_error,
+                    "Clustered tracker hit is not in the hit view of the event !");
         TrackFit::gg_hit hit;
 
-        hit.set_x(a_gg_hit->get_x());
-        hit.set_y(a_gg_hit->get_y());
-        hit.set_z(a_gg_hit->get_z());
-        hit.set_sigma_z(a_gg_hit->get_sigma_z());
-        hit.set_r(a_gg_hit->get_r());
-        hit.set_sigma_r(a_gg_hit->get_sigma_r());
+        hit.set_x(hv.x()[i]);
+        hit.set_y(hv.y()[i]);
+        hit.set_z(hv.z()[i]);
+        hit.set_sigma_z(hv.sigma_z()[i]);
+        hit.set_r(hv.r()[i]);
+        hit.set_sigma_r(hv.sigma_r()[i]);
         hit.set_rmax(gg_cell_diameter / 2.0);
 
         // 2012-06-05 XG: if particle is delayed then set the
@@ -280,12 +403,11 @@ int trackfit_driver::_process_algo(const snemo::datamodel::tracker_clustering_da
         //
         // 2012-11-03 XG: Flag the delayed hit to fit also the start
         // time
-        if (a_gg_hit->has_delayed_time()) {
-          hit.set_t(a_gg_hit->get_delayed_time());
-          hit.grab_properties().store_flag(TrackFit::gg_hit::delayed_flag());
-        } else {
-          hit.set_t(a_gg_hit->get_anode_time());
-        }
+        //
+        // The time column holds the delayed time of delayed hits and the
+        // anode time of the others.
+        hit.set_t(hv.time()[i]);
+        hit.set_delayed(hv.is_delayed(i));
 
         // Add the hit to the fitter's collection
         gg_hits.push_back(hit);
@@ -294,7 +416,15 @@ int trackfit_driver::_process_algo(const snemo::datamodel::tracker_clustering_da
       // Helix fit solutions:
       std::list<TrackFit::helix_fit_solution> helix_solutions;
       if (use_helix_fit()) {
-        this->do_helix_fit(gg_hits, helix_solutions);
+        // Start from the helix of the clusterizer. Its solution replaces the guesses, except
+        // those which can still compete with it when the guess rejection is set:
+        bool seeded = false;
+        if (use_cluster_seed() && a_cluster->has_helix_seed()) {
+          seeded = this->do_seeded_helix_fit(gg_hits, a_cluster->get_helix_seed(), helix_solutions);
+        }
+        if (!seeded || _helix_guess_rejection_factor_ > 0.0) {
+          this->do_helix_fit(gg_hits, helix_solutions);
+        }
       }
 
       bool helix_fit_succeed = false;
@@ -305,7 +435,7 @@ int trackfit_driver::_process_algo(const snemo::datamodel::tracker_clustering_da
         helix_fit_succeed = true;
 
         // Create new 'tracker_trajectory' handle:
-        auto h_trajectory = datatools::make_handle<snemo::datamodel::tracker_trajectory>();
+        auto h_trajectory = _trajectory_pool_.make();
         a_trajectory_solution->grab_trajectories().push_back(h_trajectory);
 
         // 2012/05/11 XG : this work if all cells are clusterized on
@@ -355,7 +485,7 @@ int trackfit_driver::_process_algo(const snemo::datamodel::tracker_clustering_da
         line_fit_succeed = true;
 
         // Create new 'tracker_trajectory' handle:
-        auto h_trajectory = datatools::make_handle<snemo::datamodel::tracker_trajectory>();
+        auto h_trajectory = _trajectory_pool_.make();
         a_trajectory_solution->grab_trajectories().push_back(h_trajectory);
 
         // Set trajectory geom_id using the first geiger
@@ -394,7 +524,16 @@ int trackfit_driver::_process_algo(const snemo::datamodel::tracker_clustering_da
         cct.push_back(a_cluster);
       }
     }  // end of 'tracker_cluster'
-  }    // end of 'tracker_solution'
+
+    // Record how much fitting work has been saved:
+    datatools::properties& solution_aux = a_trajectory_solution->get_auxiliaries();
+    solution_aux.update("trackfit.fits", static_cast<int>(_number_of_fits_));
+    solution_aux.update("trackfit.rejected_guesses",
+                        static_cast<int>(_number_of_rejected_guesses_));
+    solution_aux.update("trackfit.merged_solutions",
+                        static_cast<int>(_number_of_merged_solutions_));
+    solution_aux.update("trackfit.seeded_fits", static_cast<int>(_number_of_seeded_fits_));
+  }  // end of 'tracker_solution'
   return 0;
 }
 
@@ -407,6 +546,37 @@ void trackfit_driver::do_helix_fit(const TrackFit::gg_hits_col& gg_hits_,
   _compute_helix_fit_solutions_(gg_hits_, guesses, solutions_);
 }
 
+bool trackfit_driver::do_seeded_helix_fit(
+    const TrackFit::gg_hits_col& gg_hits_,
+    const snemo::datamodel::tracker_cluster::helix_seed& seed_,
+    std::list<TrackFit::helix_fit_solution>& solutions_) {
+  TrackFit::helix_fit_params hf_params;
+  hf_params.x0 = seed_.x0;
+  hf_params.y0 = seed_.y0;
+  hf_params.z0 = seed_.z0;
+  hf_params.r = seed_.r;
+  hf_params.step = seed_.step;
+  hf_params.start_time = 0.;
+  // The seed angle origin may be turns away from the hits:
+  TrackFit::helix_fit_mgr::compute_angles(gg_hits_, hf_params);
+
+  std::unique_ptr<TrackFit::helix_fit_mgr> hfm = _make_helix_fit_mgr_(gg_hits_);
+  hfm->set_guess(hf_params);
+  hfm->initialize(_helix_fit_setup_);
+  hfm->fit();
+  _number_of_fits_++;
+
+  const bool converged = hfm->get_solution().ok;
+  if (converged) {
+    TrackFit::helix_fit_solution& the_solution = hfm->grab_solution();
+    the_solution.auxiliaries.store_string("guess", "seed");
+    solutions_.push_back(the_solution);
+    _number_of_seeded_fits_++;
+  }
+  hfm->reset();
+  return converged;
+}
+
 void trackfit_driver::do_line_fit(const TrackFit::gg_hits_col& gg_hits_,
                                   std::list<TrackFit::line_fit_solution>& solutions_) {
   // Line fit parameters initialization:
@@ -478,59 +648,133 @@ void trackfit_driver::_compute_line_guesses_(const TrackFit::gg_hits_col& gg_hit
   }
 }
 
+std::unique_ptr<TrackFit::helix_fit_mgr> trackfit_driver::_make_helix_fit_mgr_(
+    const TrackFit::gg_hits_col& gg_hits_) const {
+  std::unique_ptr<TrackFit::helix_fit_mgr> hfm(new TrackFit::helix_fit_mgr);
+  hfm->set_logging_priority(get_logging_priority());
+  hfm->set_hits(gg_hits_);
+  if (_dtc_.get() != nullptr) {
+    hfm->set_calibration(*_dtc_);
+  }
+  hfm->set_t0(0.0 * CLHEP::ns);
+  const double eps = 1.0e-2;
+  hfm->set_fit_eps(eps);
+  return hfm;
+}
+
+std::unique_ptr<TrackFit::line_fit_mgr> trackfit_driver::_make_line_fit_mgr_(
+    const TrackFit::gg_hits_col& gg_hits_) const {
+  std::unique_ptr<TrackFit::line_fit_mgr> lfm(new TrackFit::line_fit_mgr);
+  lfm->set_logging_priority(get_logging_priority());
+  if (_dtc_.get() != nullptr) {
+    lfm->set_calibration(*_dtc_);
+  }
+  lfm->set_hits(gg_hits_);
+  lfm->set_t0(0.0 * CLHEP::ns);
+  const double eps = 1.0e-2;
+  lfm->set_fit_eps(eps);
+  return lfm;
+}
+
 void trackfit_driver::_compute_helix_fit_solutions_(
     const TrackFit::gg_hits_col& gg_hits_, const helix_guess_dict_type& guesses_,
     std::list<TrackFit::helix_fit_solution>& solutions_) {
+  std::vector<fit_candidate<TrackFit::helix_fit_params>> candidates;
+  candidates.reserve(guesses_.size());
   for (const auto& iguess : guesses_) {
-    TrackFit::helix_fit_mgr hfm;
-    hfm.set_logging_priority(get_logging_priority());
-    hfm.set_hits(gg_hits_);
-    if (_dtc_.get() != nullptr) {
-      hfm.set_calibration(*_dtc_);
+    candidates.push_back({iguess.first, iguess.second, 0.0});
+  }
+  if (_helix_guess_rejection_factor_ > 0.0) {
+    // Try the most promising guesses first, ranked without allocating any solver:
+    std::unique_ptr<TrackFit::helix_fit_mgr> probe = _make_helix_fit_mgr_(gg_hits_);
+    for (fit_candidate<TrackFit::helix_fit_params>& candidate : candidates) {
+      candidate.initial_chi = probe->compute_guess_chi(candidate.params, _helix_fit_setup_);
     }
-    hfm.set_t0(0.0 * CLHEP::ns);
-    const double eps = 1.0e-2;
-    hfm.set_fit_eps(eps);
-    hfm.set_guess(iguess.second);
-    hfm.initialize(_helix_fit_setup_);
-    hfm.fit();
+    rank_candidates(candidates);
+  }
 
-    if (hfm.get_solution().ok) {
-      TrackFit::helix_fit_solution& the_solution = hfm.grab_solution();
+  // Guesses must compete with the solutions already found, e.g. from the cluster seed:
+  double best_chi = -1.0;
+  for (const TrackFit::helix_fit_solution& a_solution : solutions_) {
+    if (best_chi < 0.0 || a_solution.chi < best_chi) {
+      best_chi = a_solution.chi;
+    }
+  }
+  for (size_t icandidate = 0; icandidate < candidates.size(); ++icandidate) {
+    const fit_candidate<TrackFit::helix_fit_params>& candidate = candidates[icandidate];
+    if (reject_guess(candidate.initial_chi, best_chi, _helix_guess_rejection_factor_)) {
+      // Remaining guesses start even further from the data
+      _number_of_rejected_guesses_ += candidates.size() - icandidate;
+      break;
+    }
+    // Only the guesses which are actually fitted get a fit manager:
+    std::unique_ptr<TrackFit::helix_fit_mgr> hfm = _make_helix_fit_mgr_(gg_hits_);
+    hfm->set_guess(candidate.params);
+    hfm->initialize(_helix_fit_setup_);
+    hfm->fit();
+    _number_of_fits_++;
+
+    if (hfm->get_solution().ok) {
+      TrackFit::helix_fit_solution& the_solution = hfm->grab_solution();
 
       // Store initial guess as properties:
-      the_solution.auxiliaries.store_string("guess", iguess.first);
-      solutions_.push_back(the_solution);
+      the_solution.auxiliaries.store_string("guess", candidate.guess);
+      if (add_solution(solutions_, the_solution, _helix_merge_nsigma_)) {
+        _number_of_merged_solutions_++;
+      }
+      if (best_chi < 0.0 || the_solution.chi < best_chi) {
+        best_chi = the_solution.chi;
+      }
     }
-    hfm.reset();
+    hfm->reset();
   }
 }
 
 void trackfit_driver::_compute_line_fit_solutions_(
     const TrackFit::gg_hits_col& gg_hits_, const line_guess_dict_type& guesses_,
     std::list<TrackFit::line_fit_solution>& solutions_) {
+  std::vector<fit_candidate<TrackFit::line_fit_params>> candidates;
+  candidates.reserve(guesses_.size());
   for (const auto& iguess : guesses_) {
-    TrackFit::line_fit_mgr lfm;
-    lfm.set_logging_priority(get_logging_priority());
-    if (_dtc_.get() != nullptr) {
-      lfm.set_calibration(*_dtc_);
+    candidates.push_back({iguess.first, iguess.second, 0.0});
+  }
+  if (_line_guess_rejection_factor_ > 0.0) {
+    // Try the most promising guesses first, ranked without allocating any solver:
+    std::unique_ptr<TrackFit::line_fit_mgr> probe = _make_line_fit_mgr_(gg_hits_);
+    for (fit_candidate<TrackFit::line_fit_params>& candidate : candidates) {
+      candidate.initial_chi = probe->compute_guess_chi(candidate.params, _line_fit_setup_);
     }
-    lfm.set_hits(gg_hits_);
-    lfm.set_t0(0.0 * CLHEP::ns);
-    const double eps = 1.0e-2;
-    lfm.set_fit_eps(eps);
-    lfm.set_guess(iguess.second);
-    lfm.initialize(_line_fit_setup_);
-    lfm.fit();
+    rank_candidates(candidates);
+  }
 
-    if (lfm.get_solution().ok) {
-      TrackFit::line_fit_solution& the_solution = lfm.grab_solution();
+  double best_chi = -1.0;
+  for (size_t icandidate = 0; icandidate < candidates.size(); ++icandidate) {
+    const fit_candidate<TrackFit::line_fit_params>& candidate = candidates[icandidate];
+    if (reject_guess(candidate.initial_chi, best_chi, _line_guess_rejection_factor_)) {
+      // Remaining guesses start even further from the data
+      _number_of_rejected_guesses_ += candidates.size() - icandidate;
+      break;
+    }
+    // Only the guesses which are actually fitted get a fit manager:
+    std::unique_ptr<TrackFit::line_fit_mgr> lfm = _make_line_fit_mgr_(gg_hits_);
+    lfm->set_guess(candidate.params);
+    lfm->initialize(_line_fit_setup_);
+    lfm->fit();
+    _number_of_fits_++;
+
+    if (lfm->get_solution().ok) {
+      TrackFit::line_fit_solution& the_solution = lfm->grab_solution();
 
       // Store initial guess as properties:
-      the_solution.auxiliaries.store_string("guess", iguess.first);
-      solutions_.push_back(the_solution);
+      the_solution.auxiliaries.store_string("guess", candidate.guess);
+      if (add_solution(solutions_, the_solution, _line_merge_nsigma_)) {
+        _number_of_merged_solutions_++;
+      }
+      if (best_chi < 0.0 || the_solution.chi < best_chi) {
+        best_chi = the_solution.chi;
+      }
     }
-    lfm.reset();
+    lfm->reset();
   }
 }
 
@@ -625,6 +869,105 @@ DOCD_CLASS_IMPLEMENT_LOAD_BEGIN(snemo::reconstruction::trackfit_driver, ocd_) {
             "                                              \n");
   }
 
+  {
+    // Description of the 'line.guess_rejection_factor' configuration property :
+    datatools::configuration_property_description& cpd = ocd_.add_property_info();
+    cpd.set_name_pattern("line.guess_rejection_factor")
+        .set_terse_description("Maximum ratio between the chi2 of a line guess and the best chi2")
+        .set_traits(datatools::TYPE_REAL)
+        .set_mandatory(false)
+        .set_long_description(
+            "When strictly positive, line guesses are fitted by increasing     \n"
+            "chi2 at the guess. Guesses with a chi2 larger than this factor  \n"
+            "times the best fitted chi2 so far are not fitted.              \n")
+        .set_default_value_real(0.0)
+        .add_example(
+            "Do not fit guesses 100 times worse than the best solution:: \n"
+            "                                                            \n"
+            "  line.guess_rejection_factor : real = 100.0                \n"
+            "                                                            \n");
+  }
+
+  {
+    // Description of the 'line.merge_nsigma' configuration property :
+    datatools::configuration_property_description& cpd = ocd_.add_property_info();
+    cpd.set_name_pattern("line.merge_nsigma")
+        .set_terse_description("Agreement in standard deviations to merge line solutions")
+        .set_traits(datatools::TYPE_REAL)
+        .set_mandatory(false)
+        .set_long_description(
+            "When strictly positive, line solutions whose parameters all       \n"
+            "agree within this number of standard deviations are merged,    \n"
+            "keeping the one with the lowest chi2.                          \n")
+        .set_default_value_real(0.0)
+        .add_example(
+            "Merge solutions agreeing within 1 sigma::                   \n"
+            "                                                            \n"
+            "  line.merge_nsigma : real = 1.0                            \n"
+            "                                                            \n");
+  }
+
+  {
+    // Description of the 'helix.guess_rejection_factor' configuration property :
+    datatools::configuration_property_description& cpd = ocd_.add_property_info();
+    cpd.set_name_pattern("helix.guess_rejection_factor")
+        .set_terse_description("Maximum ratio between the chi2 of a helix guess and the best chi2")
+        .set_traits(datatools::TYPE_REAL)
+        .set_mandatory(false)
+        .set_long_description(
+            "When strictly positive, helix guesses are fitted by increasing     \n"
+            "chi2 at the guess. Guesses with a chi2 larger than this factor  \n"
+            "times the best fitted chi2 so far are not fitted.              \n")
+        .set_default_value_real(0.0)
+        .add_example(
+            "Do not fit guesses 100 times worse than the best solution:: \n"
+            "                                                            \n"
+            "  helix.guess_rejection_factor : real = 100.0               \n"
+            "                                                            \n");
+  }
+
+  {
+    // Description of the 'helix.merge_nsigma' configuration property :
+    datatools::configuration_property_description& cpd = ocd_.add_property_info();
+    cpd.set_name_pattern("helix.merge_nsigma")
+        .set_terse_description("Agreement in standard deviations to merge helix solutions")
+        .set_traits(datatools::TYPE_REAL)
+        .set_mandatory(false)
+        .set_long_description(
+            "When strictly positive, helix solutions whose parameters all       \n"
+            "agree within this number of standard deviations are merged,    \n"
+            "keeping the one with the lowest chi2.                          \n")
+        .set_default_value_real(0.0)
+        .add_example(
+            "Merge solutions agreeing within 1 sigma::                   \n"
+            "                                                            \n"
+            "  helix.merge_nsigma : real = 1.0                           \n"
+            "                                                            \n");
+  }
+
+  {
+    // Description of the 'helix.use_cluster_seed' configuration property :
+    datatools::configuration_property_description& cpd = ocd_.add_property_info();
+    cpd.set_name_pattern("helix.use_cluster_seed")
+        .set_terse_description("Start the helix fit from the helix seed of the clusters")
+        .set_traits(datatools::TYPE_BOOLEAN)
+        .set_mandatory(false)
+        .set_long_description(
+            "When set, the helix of a cluster seeded by its clusterizer     \n"
+            "(CAT, SULTAN) is fitted first. If this fit converges, its      \n"
+            "solution replaces the ones of the guesses, which are fitted    \n"
+            "only when it does not. With 'helix.guess_rejection_factor',    \n"
+            "the guesses that can still compete with the seeded solution    \n"
+            "are fitted too, and with 'helix.merge_nsigma', those           \n"
+            "converging to it are merged.                                   \n")
+        .set_default_value_boolean(false)
+        .add_example(
+            "Use the clusterizer helices::                               \n"
+            "                                                            \n"
+            "  helix.use_cluster_seed : boolean = true                   \n"
+            "                                                            \n");
+  }
+
   ocd_.set_validation_support(true);
   ocd_.lock();
   return;
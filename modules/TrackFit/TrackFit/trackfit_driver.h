@@ -34,6 +34,7 @@
 // Standard library:
 #include <list>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -42,6 +43,9 @@
 #include <boost/scoped_ptr.hpp>
 
 // Falaise:
+#include <falaise/snemo/datamodels/handle_pool.h>
+#include <falaise/snemo/datamodels/tracker_cluster.h>
+#include <falaise/snemo/datamodels/tracker_trajectory.h>
 #include <falaise/snemo/processing/base_tracker_fitter.h>
 
 // This project:
@@ -119,6 +123,12 @@ class trackfit_driver : public ::snemo::processing::base_tracker_fitter {
   /// Check the flag to use the helix fit
   bool use_helix_fit() const;
 
+  /// Set the flag to start the helix fit from the helix seed of the clusters
+  void set_use_cluster_seed(const bool use_cluster_seed_);
+
+  /// Check the flag to start the helix fit from the helix seed of the clusters
+  bool use_cluster_seed() const;
+
   /// Set a collection of guesses for the line fit
   void set_line_only_guesses(const std::vector<std::string>& only_guesses_);
 
@@ -126,9 +136,22 @@ class trackfit_driver : public ::snemo::processing::base_tracker_fitter {
   void set_helix_only_guesses(const std::vector<std::string>& only_guesses_);
 
   /// Perform the helix fit
+  /**
+   * Guesses must compete with the solutions already in the list.
+   */
   void do_helix_fit(const TrackFit::gg_hits_col& gg_hits_,
                     std::list<TrackFit::helix_fit_solution>& solutions_);
 
+  /// Perform the helix fit from the helix seed of a cluster
+  /**
+   * Return true if the fit converged, in which case its solution is added.
+   * The guesses are then only fitted with do_helix_fit if it did not, or to
+   * compete with its solution when the guess rejection is set.
+   */
+  bool do_seeded_helix_fit(const TrackFit::gg_hits_col& gg_hits_,
+                           const snemo::datamodel::tracker_cluster::helix_seed& seed_,
+                           std::list<TrackFit::helix_fit_solution>& solutions_);
+
   /// Perform the line fit
   void do_line_fit(const TrackFit::gg_hits_col& gg_hits_,
                    std::list<TrackFit::line_fit_solution>& solutions_);
@@ -177,6 +200,14 @@ class trackfit_driver : public ::snemo::processing::base_tracker_fitter {
   void _compute_line_guesses_(const TrackFit::gg_hits_col& gg_hits_, line_guess_dict_type& guesses_,
                               const size_t max_guess_);
 
+  /// Return a helix fit manager set up for the hits, waiting for its guess
+  std::unique_ptr<TrackFit::helix_fit_mgr> _make_helix_fit_mgr_(
+      const TrackFit::gg_hits_col& gg_hits_) const;
+
+  /// Return a line fit manager set up for the hits, waiting for its guess
+  std::unique_ptr<TrackFit::line_fit_mgr> _make_line_fit_mgr_(
+      const TrackFit::gg_hits_col& gg_hits_) const;
+
   /// Compute 'helix' fit parameters
   void _compute_helix_fit_solutions_(const TrackFit::gg_hits_col& gg_hits_,
                                      const helix_guess_dict_type& guesses_,
@@ -197,6 +228,8 @@ class trackfit_driver : public ::snemo::processing::base_tracker_fitter {
   TrackFit::line_fit_mgr::guess_utils _line_guess_driver_;  /// Guess driver for line fit
   std::map<std::string, int> _line_guess_dict_;             /// Guess dictionary for 'line' fit
   datatools::properties _line_fit_setup_;                   /// Setup for the 'line' fit algorithm
+  double _line_guess_rejection_factor_;  /// Max initial/best chi2 ratio of 'line' guesses (0: off)
+  double _line_merge_nsigma_;  /// Agreement (in sigma) to merge 'line' solutions (0: off)
   TrackFit::gg_hits_col _gg_hits_referential_;  /// Geiger hits in the best frame ('line' fit)
   geomtools::placement* _working_referential_;  /// Working referential ('line' fit)
 
@@ -205,6 +238,20 @@ class trackfit_driver : public ::snemo::processing::base_tracker_fitter {
   TrackFit::helix_fit_mgr::guess_utils _helix_guess_driver_;  /// Guess driver for helix fit
   std::map<std::string, int> _helix_guess_dict_;              /// Guess dictionary for 'helix' fit
   datatools::properties _helix_fit_setup_;  /// Setup for the 'helix' fit algorithm
+  double _helix_guess_rejection_factor_;  /// Max initial/best chi2 ratio of 'helix' guess (0: off)
+  double _helix_merge_nsigma_;  /// Agreement (in sigma) to merge 'helix' solutions (0: off)
+  bool _use_cluster_seed_;  /// Start the 'helix' fit from the helix seed of the clusters
+
+  // Statistics for the current trajectory solution:
+  size_t _number_of_fits_;              /// Number of performed fits
+  size_t _number_of_rejected_guesses_;  /// Number of guesses not fitted
+  size_t _number_of_merged_solutions_;  /// Number of solutions merged with another one
+  size_t _number_of_seeded_fits_;       /// Number of clusters fitted from their helix seed
+
+  snedm::handle_pool<snemo::datamodel::tracker_trajectory>
+      _trajectory_pool_;  /// Pool of reusable trajectories
+
+  TrackFit::gg_hits_col _gg_hits_;  /// Geiger hits of the current cluster
 };
 
 }  // end of namespace reconstruction
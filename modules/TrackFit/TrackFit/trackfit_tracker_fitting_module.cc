@@ -16,6 +16,7 @@
 
 // This project:
 #include <falaise/property_set.h>
+#include <falaise/snemo/datamodels/calibrated_data.h>
 #include <falaise/snemo/datamodels/data_model.h>
 #include <falaise/snemo/datamodels/tracker_clustering_data.h>
 #include <falaise/snemo/datamodels/tracker_trajectory_data.h>
@@ -65,6 +66,7 @@ void trackfit_tracker_fitting_module::set_geometry_manager(const geomtools::mana
 
 void trackfit_tracker_fitting_module::_set_defaults() {
   geoManager_ = nullptr;
+  CDTag_.clear();
   TCDTag_.clear();
   TTDTag_.clear();
   fitterAlgo_.reset(nullptr);
@@ -80,6 +82,7 @@ void trackfit_tracker_fitting_module::initialize(const datatools::properties& co
   dpp::base_module::_common_initialize(config);
 
   falaise::property_set ps{config};
+  CDTag_ = ps.get<std::string>("CD_label", snedm::labels::calibrated_data());
   TCDTag_ = ps.get<std::string>("TCD_label", snedm::labels::tracker_clustering_data());
   TTDTag_ = ps.get<std::string>("TTD_label", snedm::labels::tracker_trajectory_data());
 
@@ -122,6 +125,12 @@ dpp::base_module::process_status trackfit_tracker_fitting_module::process(
   }
   const auto& inputClusters = event.get<snedm::tracker_clustering_data>(TCDTag_);
 
+  // Calibrated data holding the clustered hits, if still in the event
+  const snedm::calibrated_data* calibratedData = nullptr;
+  if (event.has(CDTag_) && event.is_a<snedm::calibrated_data>(CDTag_)) {
+    calibratedData = &event.get<snedm::calibrated_data>(CDTag_);
+  }
+
   // Check tracker trajectory data
   auto& outputTrajectories = ::snedm::getOrAddToEvent<snedm::tracker_trajectory_data>(TTDTag_, event);
   if (outputTrajectories.has_solutions()) {
@@ -131,12 +140,13 @@ dpp::base_module::process_status trackfit_tracker_fitting_module::process(
   outputTrajectories.reset();
 
   // Main processing method :
-  _process(inputClusters, outputTrajectories);
+  _process(calibratedData, inputClusters, outputTrajectories);
 
   return dpp::base_module::PROCESS_SUCCESS;
 }
 
 void trackfit_tracker_fitting_module::_process(
+    const snemo::datamodel::calibrated_data* calib_data,
     const snemo::datamodel::tracker_clustering_data& clusters,
     snemo::datamodel::tracker_trajectory_data& trajectories) {
   // Process isolated tracks using external resource:
@@ -145,7 +155,11 @@ void trackfit_tracker_fitting_module::_process(
   }
 
   // process the fitter driver :
-  fitterAlgo_->process(clusters, trajectories);
+  if (calib_data != nullptr) {
+    fitterAlgo_->process(*calib_data, clusters, trajectories);
+  } else {
+    fitterAlgo_->process(clusters, trajectories);
+  }
 }
 
 }  // end of namespace reconstruction
@@ -166,6 +180,26 @@ DOCD_CLASS_IMPLEMENT_LOAD_BEGIN(snemo::reconstruction::trackfit_tracker_fitting_
 
   dpp::base_module::common_ocd(ocd_);
 
+  {
+    // Description of the 'CD_label' configuration property :
+    datatools::configuration_property_description& cpd = ocd_.add_property_info();
+    cpd.set_name_pattern("CD_label")
+        .set_terse_description("The label/name of the 'calibrated data' bank")
+        .set_traits(datatools::TYPE_STRING)
+        .set_mandatory(false)
+        .set_long_description(
+            "This is the name of the bank holding the calibrated  \n"
+            "tracker hits of the clusters. When present, the view \n"
+            "of these hits built by the clusterizer is reused.    \n")
+        .set_default_value_string(
+            snedm::labels::calibrated_data())
+        .add_example(
+            "Use an alternative name for the 'calibrated data' bank:: \n"
+            "                                  \n"
+            "  CD_label : string = \"CD2\"     \n"
+            "                                  \n");
+  }
+
   {
     // Description of the 'TCD_label' configuration property :
     datatools::configuration_property_description& cpd = ocd_.add_property_info();
@@ -209,6 +243,7 @@ DOCD_CLASS_IMPLEMENT_LOAD_BEGIN(snemo::reconstruction::trackfit_tracker_fitting_
       "Here is a full configuration example in the      \n"
       "``datatools::properties`` ASCII format::         \n"
       "                                         \n"
+      "  CD_label : string = \"CD\"             \n"
       "  TCD_label : string = \"TCD\"           \n"
       "  TTD_label : string = \"TTD\"           \n"
       "                                         \n"
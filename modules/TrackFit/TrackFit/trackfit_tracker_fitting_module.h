@@ -48,6 +48,7 @@ class manager;
 namespace snemo {
 
 namespace datamodel {
+class calibrated_data;
 class tracker_clustering_data;
 class tracker_trajectory_data;
 }  // namespace datamodel
@@ -86,7 +87,9 @@ class trackfit_tracker_fitting_module : public dpp::base_module {
 
  protected:
   /// Special method to process and generate trajectory data
-  void _process(const snemo::datamodel::tracker_clustering_data& clusters,
+  /// The calibrated data, if any, provides the view of the hits shared with the clusterizer
+  void _process(const snemo::datamodel::calibrated_data* calib_data,
+                const snemo::datamodel::tracker_clustering_data& clusters,
                 snemo::datamodel::tracker_trajectory_data& trajectories);
 
   /// Give default values to specific class members.
@@ -94,6 +97,7 @@ class trackfit_tracker_fitting_module : public dpp::base_module {
 
  private:
   const geomtools::manager* geoManager_;  //!< The geometry manager
+  std::string CDTag_;   //!< The label of the calibrated data bank
   std::string TCDTag_;  //!< The label of the input tracker clustering data bank
   std::string TTDTag_;  //!< The label of the output tracker trajectory data bank
   std::unique_ptr<snemo::processing::base_tracker_fitter>
@@ -35,12 +35,15 @@ FLReconstructCommandLine FLReconstructCommandLine::makeDefault() {
   FLReconstructCommandLine frArgs;
   frArgs.logLevel = datatools::logger::PRIO_FATAL;
   frArgs.moduloEvents = 0;
+  frArgs.ioQueueDepth = 0;
   frArgs.userProfile = "normal";
   frArgs.pipelineScript = "";
   frArgs.inputMetadataFile = "";
   frArgs.outputMetadataFile = "";  // "flreconstruct.mdata" ?
   frArgs.inputFile = "";
   frArgs.outputFile = "";
+  frArgs.serveSpoolDirectory = "";
+  frArgs.profileFile = "";
   return frArgs;
 }
 
@@ -170,6 +173,9 @@ FLDialogState do_cldialog(int argc, char* argv[], FLReconstructCommandLine& clAr
     ("modulo,P", bpo::value<uint32_t>(&clArgs.moduloEvents)->default_value(0)->value_name("period"),
       "progress modulo on number of events")
 
+    ("io-queue-depth", bpo::value<uint32_t>(&clArgs.ioQueueDepth)->default_value(0)->value_name("depth"),
+      "number of events read ahead/written behind on separate threads (0: synchronous I/O)")
+
     ("user-profile,u", bpo::value<std::string>(&clArgs.userProfile)->value_name("name")->default_value("normal"),
       R"(set the user profile ("expert", "normal", "production"))")
 
@@ -182,11 +188,17 @@ FLDialogState do_cldialog(int argc, char* argv[], FLReconstructCommandLine& clAr
     ("pipeline,p", bpo::value<std::string>(&clArgs.pipelineScript)->value_name("file"),
       "pipeline script")
 
-    ("input-file,i", bpo::value<std::string>(&clArgs.inputFile)->required()->value_name("file"),
+    ("input-file,i", bpo::value<std::string>(&clArgs.inputFile)->value_name("file"),
       "file from which to read input data (simulation, real)")
 
     ("output-file,o", bpo::value<std::string>(&clArgs.outputFile)->value_name("file"),
       "file in which to store reconstruction results")
+
+    ("serve", bpo::value<std::string>(&clArgs.serveSpoolDirectory)->value_name("dir"),
+      "keep the pipeline initialized and run jobs submitted to a spool directory")
+
+    ("profile-file", bpo::value<std::string>(&clArgs.profileFile)->value_name("file"),
+      "file in which to store throughput, peak memory and per-module timings")
     ;
   // clang-format on
 
@@ -234,6 +246,20 @@ FLDialogState do_cldialog(int argc, char* argv[], FLReconstructCommandLine& clAr
     return DIALOG_QUERY;
   }
 
+  // Input is given by each job when serving
+  if (clArgs.inputFile.empty() && clArgs.serveSpoolDirectory.empty()) {
+    do_error(std::cerr, "the option '--input-file' is required but missing");
+    return DIALOG_ERROR;
+  }
+  if (!clArgs.inputFile.empty() && !clArgs.serveSpoolDirectory.empty()) {
+    do_error(std::cerr, "the options '--input-file' and '--serve' are mutually exclusive");
+    return DIALOG_ERROR;
+  }
+  if (!clArgs.profileFile.empty() && !clArgs.serveSpoolDirectory.empty()) {
+    do_error(std::cerr, "the options '--profile-file' and '--serve' are mutually exclusive");
+    return DIALOG_ERROR;
+  }
+
   if (vMap.count("verbosity") != 0u) {
     clArgs.logLevel = datatools::logger::get_priority(verbosityLabel);
     if (clArgs.logLevel == datatools::logger::PRIO_UNDEFINED) {
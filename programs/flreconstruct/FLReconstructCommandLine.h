@@ -38,12 +38,15 @@ namespace FLReconstruct {
 struct FLReconstructCommandLine {
   datatools::logger::priority logLevel;  //!< Verbosity level
   uint32_t moduloEvents;                 //!< Event modulo
+  uint32_t ioQueueDepth;                 //!< Depth of asynchronous I/O queues
   std::string userProfile;               //!< User profile
   std::string pipelineScript;            //!< Path of the processing pipeline configuration script
   std::string inputMetadataFile;         //!< Path for loading metadata
   std::string inputFile;                 //!< Path for the input module
   std::string outputMetadataFile;        //!< Path for saving metadata
   std::string outputFile;                //!< Path for the output module
+  std::string serveSpoolDirectory;       //!< Path of the job spool directory in warm mode
+  std::string profileFile;               //!< Path of the throughput profile report
 
   //! Build a default arguments set:
   static FLReconstructCommandLine makeDefault();
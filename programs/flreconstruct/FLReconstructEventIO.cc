@@ -0,0 +1,242 @@
+// Ourselves
+#include "FLReconstructEventIO.h"
+
+// Standard Library
+#include <utility>
+#include <vector>
+
+// Third Party
+// - Bayeux
+#include "bayeux/datatools/exception.h"
+
+namespace FLReconstruct {
+
+WorkItemQueue::WorkItemQueue(std::size_t capacity) : capacity_(capacity), closed_(false) {
+  DT_THROW_IF(capacity_ == 0, std::logic_error, "Work item queue must have non-zero capacity");
+}
+
+bool WorkItemQueue::push(WorkItemPtr item, bool& stalled) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  stalled = false;
+  while (!closed_ && items_.size() >= capacity_) {
+    stalled = true;
+    notFull_.wait(lock);
+  }
+  if (closed_) {
+    return false;
+  }
+  items_.push_back(std::move(item));
+  notEmpty_.notify_one();
+  return true;
+}
+
+WorkItemPtr WorkItemQueue::pop(bool& stalled) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  stalled = false;
+  while (!closed_ && items_.empty()) {
+    stalled = true;
+    notEmpty_.wait(lock);
+  }
+  if (items_.empty()) {
+    return nullptr;
+  }
+  WorkItemPtr item = std::move(items_.front());
+  items_.pop_front();
+  notFull_.notify_one();
+  return item;
+}
+
+void WorkItemQueue::close() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  closed_ = true;
+  notFull_.notify_all();
+  notEmpty_.notify_all();
+}
+
+//----------------------------------------------------------------------
+EventIO::EventIO(dpp::input_module& input, dpp::base_module* output, std::size_t depth,
+                 bool asyncOutput)
+    : input_(input),
+      output_(output),
+      depth_(depth),
+      asyncOutput_(asyncOutput && output != nullptr && depth > 0),
+      readFailed_(false),
+      writeFailed_(false),
+      inputStalls_(0),
+      outputStalls_(0) {
+  if (depth_ == 0) {
+    syncItem_.reset(new datatools::things);
+    return;
+  }
+
+  // One record in the pipeline, up to depth in each queue
+  std::size_t poolSize = 2 * depth_ + 1;
+  freeItems_.reset(new WorkItemQueue(poolSize));
+  readItems_.reset(new WorkItemQueue(depth_));
+  if (asyncOutput_) {
+    writeItems_.reset(new WorkItemQueue(depth_));
+  }
+  bool dummy = false;
+  for (std::size_t i = 0; i < poolSize; ++i) {
+    freeItems_->push(WorkItemPtr(new datatools::things), dummy);
+  }
+}
+
+EventIO::~EventIO() { finish(); }
+
+void EventIO::setInputBanks(const std::set<std::string>& banks) {
+  DT_THROW_IF(reader_.joinable(), std::logic_error, "Cannot select input banks once started");
+  inputBanks_ = banks;
+}
+
+void EventIO::start() {
+  if (depth_ == 0 || reader_.joinable()) {
+    return;
+  }
+  reader_ = std::thread(&EventIO::readLoop, this);
+  if (asyncOutput_) {
+    writer_ = std::thread(&EventIO::writeLoop, this);
+  }
+}
+
+EventIO::ReadStatus EventIO::next(WorkItemPtr& item) {
+  if (depth_ == 0) {
+    syncItem_->clear();
+    if (input_.is_terminated()) {
+      return ReadStatus::END;
+    }
+    if (!read(*syncItem_)) {
+      return ReadStatus::ERROR;
+    }
+    item = std::move(syncItem_);
+    return ReadStatus::OK;
+  }
+
+  bool stalled = false;
+  item = readItems_->pop(stalled);
+  if (!item) {
+    std::lock_guard<std::mutex> lock(statusMutex_);
+    return readFailed_ ? ReadStatus::ERROR : ReadStatus::END;
+  }
+  if (stalled) {
+    inputStalls_++;
+  }
+  return ReadStatus::OK;
+}
+
+bool EventIO::write(WorkItemPtr item) {
+  if (output_ == nullptr) {
+    recycle(std::move(item));
+    return true;
+  }
+
+  if (!asyncOutput_) {
+    bool ok = (output_->process(*item) == dpp::base_module::PROCESS_OK);
+    recycle(std::move(item));
+    return ok;
+  }
+
+  bool stalled = false;
+  bool queued = writeItems_->push(std::move(item), stalled);
+  if (stalled) {
+    outputStalls_++;
+  }
+  std::lock_guard<std::mutex> lock(statusMutex_);
+  return queued && !writeFailed_;
+}
+
+void EventIO::discard(WorkItemPtr item) { recycle(std::move(item)); }
+
+bool EventIO::finish() {
+  // Drain the output first so that every processed record reaches the sink
+  if (writer_.joinable()) {
+    writeItems_->close();
+    writer_.join();
+  }
+  if (reader_.joinable()) {
+    freeItems_->close();
+    readItems_->close();
+    reader_.join();
+  }
+  std::lock_guard<std::mutex> lock(statusMutex_);
+  return !writeFailed_;
+}
+
+std::size_t EventIO::inputStalls() const { return inputStalls_; }
+
+std::size_t EventIO::outputStalls() const { return outputStalls_; }
+
+bool EventIO::isReadAhead() const { return depth_ > 0; }
+
+bool EventIO::isWriteBehind() const { return asyncOutput_; }
+
+void EventIO::readLoop() {
+  bool stalled = false;
+  while (true) {
+    WorkItemPtr item = freeItems_->pop(stalled);
+    if (!item) {
+      break;
+    }
+    item->clear();
+    if (input_.is_terminated()) {
+      break;
+    }
+    if (!read(*item)) {
+      std::lock_guard<std::mutex> lock(statusMutex_);
+      readFailed_ = true;
+      break;
+    }
+    if (!readItems_->push(std::move(item), stalled)) {
+      break;
+    }
+  }
+  readItems_->close();
+}
+
+void EventIO::writeLoop() {
+  bool stalled = false;
+  while (true) {
+    WorkItemPtr item = writeItems_->pop(stalled);
+    if (!item) {
+      break;
+    }
+    if (output_->process(*item) != dpp::base_module::PROCESS_OK) {
+      {
+        std::lock_guard<std::mutex> lock(statusMutex_);
+        writeFailed_ = true;
+      }
+      // Unblock the event loop, remaining records are dropped
+      writeItems_->close();
+      break;
+    }
+    recycle(std::move(item));
+  }
+}
+
+bool EventIO::read(datatools::things& item) {
+  if (input_.process(item) != dpp::base_module::PROCESS_OK) {
+    return false;
+  }
+  if (!inputBanks_.empty()) {
+    std::vector<std::string> banks;
+    item.get_names(banks);
+    for (const std::string& bank : banks) {
+      if (inputBanks_.count(bank) == 0u) {
+        item.remove(bank);
+      }
+    }
+  }
+  return true;
+}
+
+void EventIO::recycle(WorkItemPtr item) {
+  if (depth_ == 0) {
+    syncItem_ = std::move(item);
+    return;
+  }
+  // Pool capacity covers every record, so this never blocks
+  bool stalled = false;
+  freeItems_->push(std::move(item), stalled);
+}
+
+}  // namespace FLReconstruct
@@ -0,0 +1,160 @@
+// FLReconstructEventIO.h - Read-ahead/write-behind stages for the event loop
+//
+// Copyright (c) 2013 by Ben Morgan <bmorgan.warwick@gmail.com>
+// Copyright (c) 2013 by The University of Warwick
+
+// Distributed under the OSI-approved BSD 3-Clause License (the "License");
+// see accompanying file License.txt for details.
+//
+// This software is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the License for more information.
+
+#ifndef FLRECONSTRUCTEVENTIO_H
+#define FLRECONSTRUCTEVENTIO_H
+
+// Standard Library:
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+// Third Party
+// - Bayeux
+#include "bayeux/datatools/things.h"
+#include "bayeux/dpp/base_module.h"
+#include "bayeux/dpp/input_module.h"
+
+namespace FLReconstruct {
+
+//! Owning handle on an event record travelling through the loop
+using WorkItemPtr = std::unique_ptr<datatools::things>;
+
+//! \brief Bounded FIFO of event records shared between two threads
+//!
+//! Producers block while the queue is full, consumers block while it is
+//! empty. Once closed, pushes are refused and pops drain the remaining
+//! records before returning a null handle.
+class WorkItemQueue {
+ public:
+  explicit WorkItemQueue(std::size_t capacity);
+
+  //! Append a record, blocking while full. Return false if the queue is closed
+  bool push(WorkItemPtr item, bool& stalled);
+
+  //! Remove the oldest record, blocking while empty and open
+  WorkItemPtr pop(bool& stalled);
+
+  //! Wake up all waiting threads and refuse any further push
+  void close();
+
+ private:
+  std::size_t capacity_;
+  bool closed_;
+  std::deque<WorkItemPtr> items_;
+  std::mutex mutex_;
+  std::condition_variable notFull_;
+  std::condition_variable notEmpty_;
+};
+
+//! \brief Input and output stages of the flreconstruct event loop
+//!
+//! With a zero queue depth, records are read and written synchronously
+//! on the calling thread, exactly as the plain loop did. With a non-zero
+//! depth, a reader thread deserializes up to depth records ahead of the
+//! pipeline and a writer thread serializes processed records behind it,
+//! so that I/O overlaps with reconstruction. Records are recycled from a
+//! fixed pool, so at most 2*depth+1 are alive at any time.
+//!
+//! The number of times the event loop had to wait for the reader (input
+//! stall) or for the writer (output stall) is counted for reporting.
+class EventIO {
+ public:
+  //! Status returned when asking for the next record
+  enum class ReadStatus { OK, END, ERROR };
+
+  //! Construct stages for input and optional output (may be nullptr)
+  //! Write-behind is only done if asyncOutput is true
+  EventIO(dpp::input_module& input, dpp::base_module* output, std::size_t depth, bool asyncOutput);
+
+  //! Join any running thread
+  ~EventIO();
+
+  EventIO(const EventIO&) = delete;
+  EventIO& operator=(const EventIO&) = delete;
+
+  //! Only keep the given banks in records read from input (empty: keep all)
+  //! Other banks are dropped, and so are not written to the output.
+  //! Must be called before start()
+  void setInputBanks(const std::set<std::string>& banks);
+
+  //! Start the I/O threads, if any
+  void start();
+
+  //! Fetch the next input record
+  ReadStatus next(WorkItemPtr& item);
+
+  //! Hand over a processed record to the output stage, returning false on write error
+  bool write(WorkItemPtr item);
+
+  //! Give back a record that is not to be written
+  void discard(WorkItemPtr item);
+
+  //! Flush the output stage and join threads, returning false on write error
+  bool finish();
+
+  //! Return the number of times the loop waited on input
+  std::size_t inputStalls() const;
+
+  //! Return the number of times the loop waited on output
+  std::size_t outputStalls() const;
+
+  //! Return true if reads are done on a separate thread
+  bool isReadAhead() const;
+
+  //! Return true if writes are done on a separate thread
+  bool isWriteBehind() const;
+
+ private:
+  void readLoop();
+  void writeLoop();
+  void recycle(WorkItemPtr item);
+  bool read(datatools::things& item);
+
+ private:
+  dpp::input_module& input_;
+  dpp::base_module* output_;
+  std::size_t depth_;
+  bool asyncOutput_;
+  std::set<std::string> inputBanks_;  //!< Banks kept from input records
+
+  WorkItemPtr syncItem_;  //!< Single record used in synchronous mode
+
+  std::unique_ptr<WorkItemQueue> freeItems_;   //!< Records ready to be refilled
+  std::unique_ptr<WorkItemQueue> readItems_;   //!< Records read, waiting for the pipeline
+  std::unique_ptr<WorkItemQueue> writeItems_;  //!< Records processed, waiting for the output
+
+  std::thread reader_;
+  std::thread writer_;
+
+  std::mutex statusMutex_;
+  bool readFailed_;
+  bool writeFailed_;
+
+  std::size_t inputStalls_;
+  std::size_t outputStalls_;
+};
+
+}  // namespace FLReconstruct
+
+#endif  // FLRECONSTRUCTEVENTIO_H
+
+// Local Variables: --
+// mode: c++ --
+// c-file-style: "gnu" --
+// tab-width: 2 --
+// End: --
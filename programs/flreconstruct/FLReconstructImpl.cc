@@ -60,11 +60,14 @@ void do_configure(int argc, char* argv[], FLReconstructParams& flRecParameters)
   // Import parameters from the command line:
   flRecParameters.logLevel = clArgs.logLevel;
   flRecParameters.moduloEvents = clArgs.moduloEvents;
+  flRecParameters.ioQueueDepth = clArgs.ioQueueDepth;
   flRecParameters.userProfile = clArgs.userProfile;
   flRecParameters.inputMetadataFile = clArgs.inputMetadataFile;
   flRecParameters.inputFile = clArgs.inputFile;
   flRecParameters.outputMetadataFile = clArgs.outputMetadataFile;
   flRecParameters.outputFile = clArgs.outputFile;
+  flRecParameters.serveSpoolDirectory = clArgs.serveSpoolDirectory;
+  flRecParameters.profileFile = clArgs.profileFile;
 
   if (flRecParameters.userProfile.empty()) {
     // Force a default user profile:
@@ -96,6 +99,14 @@ void do_configure(int argc, char* argv[], FLReconstructParams& flRecParameters)
     flRecParameters.moduloEvents =
         basicSystem.get<int>("moduloEvents", flRecParameters.moduloEvents);
 
+    // Depth of the asynchronous I/O queues:
+    flRecParameters.ioQueueDepth =
+        basicSystem.get<int>("ioQueueDepth", flRecParameters.ioQueueDepth);
+
+    // Banks to keep from input records:
+    flRecParameters.inputBanks =
+        basicSystem.get<std::vector<std::string>>("inputBanks", flRecParameters.inputBanks);
+
     // Printing rate for events:
     flRecParameters.userProfile =
         basicSystem.get<std::string>("userprofile", flRecParameters.userProfile);
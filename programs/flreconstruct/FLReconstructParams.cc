@@ -12,6 +12,7 @@ FLReconstructParams FLReconstructParams::makeDefault() {
   params.userProfile = "normal";
   params.numberOfEvents = 0;  // 0 == no limit on event loop
   params.moduloEvents = 0;    // 0 == no print
+  params.ioQueueDepth = 0;    // 0 == synchronous I/O
 
   // Experimental setup:
   params.experimentalSetupUrn = "";  // "urn:snemo:demonstrator:setup:1.0";
@@ -36,6 +37,9 @@ FLReconstructParams FLReconstructParams::makeDefault() {
   params.inputFile = "";
   params.outputMetadataFile = "";
   params.outputFile = "";
+  params.inputBanks.clear();
+  params.serveSpoolDirectory = "";
+  params.profileFile = "";
   params.inputMetadata.reset();
   params.inputMetadata.set_key_label("name");
   params.inputMetadata.set_meta_label("type");
@@ -65,6 +69,7 @@ void FLReconstructParams::print(std::ostream& out_) const {
   out_ << tag << "userProfile                = " << userProfile << std::endl;
   out_ << tag << "numberOfEvents               = " << numberOfEvents << std::endl;
   out_ << tag << "moduloEvents                 = " << moduloEvents << std::endl;
+  out_ << tag << "ioQueueDepth                 = " << ioQueueDepth << std::endl;
   out_ << tag << "experimentalSetupUrn         = " << experimentalSetupUrn << std::endl;
   out_ << tag << "reconstructionPipelineUrn    = " << reconstructionPipelineUrn << std::endl;
   out_ << tag << "reconstructionPipelineConfig = " << reconstructionPipelineConfig << std::endl;
@@ -77,7 +82,10 @@ void FLReconstructParams::print(std::ostream& out_) const {
   out_ << tag << "servicesSubsystemConfig      = " << servicesSubsystemConfig << std::endl;
   out_ << tag << "inputMetadataFile            = " << inputMetadataFile << std::endl;
   out_ << tag << "inputFile                    = " << inputFile << std::endl;
+  out_ << tag << "inputBanks                   = " << inputBanks.size() << std::endl;
   out_ << tag << "outputMetadataFile           = " << outputMetadataFile << std::endl;
+  out_ << tag << "serveSpoolDirectory          = " << serveSpoolDirectory << std::endl;
+  out_ << tag << "profileFile                  = " << profileFile << std::endl;
   out_ << last_tag << "outputFile                   = " << outputFile << std::endl;
 }
 
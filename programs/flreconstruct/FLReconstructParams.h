@@ -17,6 +17,7 @@
 
 // Standard Library:
 #include <string>
+#include <vector>
 
 // Third Party
 // - Bayeux
@@ -33,6 +34,7 @@ struct FLReconstructParams {
   std::string userProfile;               //!< User profile
   unsigned int numberOfEvents;           //!< Number of events to be processed in the pipeline
   unsigned int moduloEvents;             //!< Number of events progress modulo
+  unsigned int ioQueueDepth;             //!< Depth of read-ahead/write-behind queues (0: no async I/O)
 
   // Required experimental setup and versioning:
   std::string experimentalSetupUrn;  //!< The URN of the experimental setup
@@ -52,6 +54,9 @@ struct FLReconstructParams {
   std::string inputFile;           //!< Input data file for the input module
   std::string outputMetadataFile;  //!< Output metadata file
   std::string outputFile;          //!< Output data file for the output module
+  std::vector<std::string> inputBanks;  //!< Banks kept from input records (empty: all)
+  std::string serveSpoolDirectory;      //!< Spool directory of jobs to serve (empty: single run)
+  std::string profileFile;              //!< Throughput profile report file (empty: no profiling)
 
   // Plugin dedicated service:
   datatools::multi_properties userLibConfig;  //!< Main configuration file for plugins loader
@@ -2,8 +2,12 @@
 #include "FLReconstructPipeline.h"
 
 // Standard Library
+#include <chrono>
 #include <exception>
 #include <memory>
+#include <set>
+#include <string>
+#include <utility>
 
 // Third Party
 // - Boost
@@ -23,7 +27,10 @@
 #include "bayeux/geomtools/manager.h"
 
 // This Project:
+#include "FLReconstructEventIO.h"
 #include "FLReconstructImpl.h"
+#include "FLReconstructProfile.h"
+#include "FLReconstructServe.h"
 #include "falaise/resource.h"
 #include "falaise/snemo/services/services.h"
 
@@ -87,20 +94,14 @@ falaise::exit_code do_pipeline(const FLReconstructParams& flRecParameters) {
     moduleManager->set_service_manager(recServices);
 
     // Configure the modules themselves
-    if (!flRecParameters.modulesConfig.empty()) {
-      moduleManager->load_modules(flRecParameters.modulesConfig);
-    } else {
-      // Hand configure a dumb dump module
-      datatools::properties dumbConfig;
-      dumbConfig.store("title", "flreconstruct::default");
-      dumbConfig.store("output", "cout");
-      moduleManager->load_module(flRecParameters.reconstructionPipelineModule, "dpp::dump_module",
-                                 dumbConfig);
-    }
+    load_pipeline_modules(flRecParameters, *moduleManager);
 
     datatools::library_loader altLibLoader;
-    // Load a Things2Root module in the manager before initialization
-    if (!flRecParameters.outputFile.empty()) {
+    if (!flRecParameters.serveSpoolDirectory.empty()) {
+      // Jobs may ask for ROOT output, so make the Things2Root module available
+      altLibLoader.load("Things2Root", falaise::get_plugin_dir());
+    } else if (!flRecParameters.outputFile.empty()) {
+      // Load a Things2Root module in the manager before initialization
       if (boost::algorithm::ends_with(flRecParameters.outputFile, ".root")) {
         std::string pluginPath = falaise::get_plugin_dir();
         altLibLoader.load("Things2Root", pluginPath);
@@ -113,11 +114,14 @@ falaise::exit_code do_pipeline(const FLReconstructParams& flRecParameters) {
     // Plain initialization:
     moduleManager->initialize_simple();
 
-    // Input module...
-    std::unique_ptr<dpp::input_module> recInput(new dpp::input_module);
-    recInput->set_logging_priority(flRecParameters.logLevel);
-    recInput->set_single_input_file(flRecParameters.inputFile);
-    recInput->initialize_simple();
+    // Input module... jobs open their own input in warm mode
+    std::unique_ptr<dpp::input_module> recInput;
+    if (flRecParameters.serveSpoolDirectory.empty()) {
+      recInput.reset(new dpp::input_module);
+      recInput->set_logging_priority(flRecParameters.logLevel);
+      recInput->set_single_input_file(flRecParameters.inputFile);
+      recInput->initialize_simple();
+    }
 
     // Output metadata management:
     datatools::multi_properties flRecMetadata("name", "type",
@@ -142,7 +146,8 @@ falaise::exit_code do_pipeline(const FLReconstructParams& flRecParameters) {
     if (moduleManager->has("t2rRecOutput")) {
       // We instantiate and fetch the t2r module from the manager
       recOutputHandle = &moduleManager->grab("t2rRecOutput");
-    } else if (!flRecParameters.outputFile.empty()) {
+    } else if (!flRecParameters.outputFile.empty() &&
+               flRecParameters.serveSpoolDirectory.empty()) {
       // We try to setup an output module
       flRecOutput.reset(new dpp::output_module);
       flRecOutput->set_name("FLReconstructOutput");
@@ -159,72 +164,29 @@ falaise::exit_code do_pipeline(const FLReconstructParams& flRecParameters) {
       flRecMetadata.write(fMetadata);
     }
 
-    // - Now the actual event loop
-    DT_LOG_DEBUG(flRecParameters.logLevel, "begin event loop");
-    datatools::things workItem;
-    std::size_t eventCounter = 0;
-    while (true) {
-      // Prepare and read work
-      workItem.clear();
-      if (recInput->is_terminated()) {
-        break;
-      }
-      if (recInput->process(workItem) != dpp::base_module::PROCESS_OK) {
-        DT_LOG_FATAL(flRecParameters.logLevel, "Failed to read data record from input source");
-        code = falaise::EXIT_UNAVAILABLE;
-        break;
-      }
-
-      // Feed through pipeline
-      dpp::base_module::process_status pStatus = pipeline->process(workItem);
-      DT_THROW_IF(
-          pStatus == dpp::base_module::PROCESS_INVALID, std::logic_error,
-          "Module '" << pipeline->get_name() << "' did not return a valid processing status!");
-
-      // FATAL, ERROR and ERROR_STOP status triggers the abortion of the processing loop.
-      // This is a very conservative approach, but it is compatible with the default behaviour of
-      // the bxdpp_processing executable.
-      if (pStatus == dpp::base_module::PROCESS_FATAL) {
-        code = falaise::EXIT_UNAVAILABLE;
-        break;
-      }
-      if (pStatus == dpp::base_module::PROCESS_ERROR) {
-        code = falaise::EXIT_UNAVAILABLE;
-        break;
-      }
-      if (pStatus == dpp::base_module::PROCESS_ERROR_STOP) {
-        code = falaise::EXIT_UNAVAILABLE;
-        break;
-      }
-
-      // STOP means the current event should not be processed anymore nor saved
-      // but the loop can continue with other items
-      if (pStatus == dpp::base_module::PROCESS_STOP) {
-        continue;
-      }
-
-      // Check post-conditions on event model (expectedOutputBanks) ?
-
-      // Write item
-      if (recOutputHandle != nullptr) {
-        pStatus = recOutputHandle->process(workItem);
-        if (pStatus != dpp::base_module::PROCESS_OK) {
-          DT_LOG_FATAL(flRecParameters.logLevel, "Failed to write data record to output sink");
-          code = falaise::EXIT_UNAVAILABLE;
-          break;
-        }
-      }
-      if (flRecParameters.moduloEvents > 0) {
-        if (eventCounter % flRecParameters.moduloEvents == 0) {
-          DT_LOG_NOTICE(datatools::logger::PRIO_NOTICE, "Event #" << eventCounter);
-        }
+    if (!flRecParameters.serveSpoolDirectory.empty()) {
+      // - Warm mode: keep services alive, run jobs from the spool
+      code = do_serve(flRecParameters, recServices, moduleManager, flRecMetadata);
+    } else {
+      // - ROOT output is kept on the main thread as ROOT is not thread-safe by default
+      bool asyncOutput = (flRecOutput != nullptr);
+      std::size_t eventCounter = 0;
+      std::unique_ptr<ProfiledPipeline> profiledPipeline;
+      if (!flRecParameters.profileFile.empty()) {
+        profiledPipeline.reset(
+            new ProfiledPipeline(*pipeline, *moduleManager, flRecParameters.modulesConfig));
+        pipeline = profiledPipeline.get();
       }
-      eventCounter++;
-      if (flRecParameters.numberOfEvents > 0 && eventCounter > flRecParameters.numberOfEvents) {
-        break;
+      auto start = std::chrono::steady_clock::now();
+      code = do_event_loop(flRecParameters, *pipeline, *recInput, recOutputHandle, asyncOutput, 0,
+                           flRecParameters.numberOfEvents, eventCounter);
+      std::chrono::duration<double> wallTime = std::chrono::steady_clock::now() - start;
+      if (profiledPipeline != nullptr && code == falaise::EXIT_OK) {
+        std::string profileFile = flRecParameters.profileFile;
+        datatools::fetch_path_with_env(profileFile);
+        profiledPipeline->writeReport(profileFile, eventCounter, wallTime.count());
       }
     }
-    DT_LOG_DEBUG(flRecParameters.logLevel, "event loop completed");
 
     // - MUST delete the module manager BEFORE the library loader clears
     // in case the manager is holding resources created from a shared lib
@@ -250,6 +212,126 @@ falaise::exit_code do_pipeline(const FLReconstructParams& flRecParameters) {
   return code;  // falaise::EXIT_OK;
 }
 
+void load_pipeline_modules(const FLReconstructParams& flRecParameters,
+                           dpp::module_manager& moduleManager) {
+  if (!flRecParameters.modulesConfig.empty()) {
+    moduleManager.load_modules(flRecParameters.modulesConfig);
+  } else {
+    // Hand configure a dumb dump module
+    datatools::properties dumbConfig;
+    dumbConfig.store("title", "flreconstruct::default");
+    dumbConfig.store("output", "cout");
+    moduleManager.load_module(flRecParameters.reconstructionPipelineModule, "dpp::dump_module",
+                              dumbConfig);
+  }
+}
+
+falaise::exit_code do_event_loop(const FLReconstructParams& flRecParameters,
+                                 dpp::base_module& pipeline, dpp::input_module& recInput,
+                                 dpp::base_module* recOutput, bool asyncOutput,
+                                 std::size_t firstEvent, std::size_t numberOfEvents,
+                                 std::size_t& eventCounter) {
+  falaise::exit_code code = falaise::EXIT_OK;
+  // - I/O stages: read-ahead and write-behind threads if a queue depth is set
+  EventIO eventIO(recInput, recOutput, flRecParameters.ioQueueDepth, asyncOutput);
+  eventIO.setInputBanks(std::set<std::string>{flRecParameters.inputBanks.begin(),
+                                              flRecParameters.inputBanks.end()});
+  eventIO.start();
+
+  // - Now the actual event loop
+  DT_LOG_DEBUG(flRecParameters.logLevel, "begin event loop");
+  WorkItemPtr workItem;
+  eventCounter = 0;
+  bool endOfInput = false;
+  for (std::size_t i = 0; i < firstEvent; ++i) {
+    // Skip records before the requested range
+    EventIO::ReadStatus rStatus = eventIO.next(workItem);
+    if (rStatus == EventIO::ReadStatus::END) {
+      endOfInput = true;
+      break;
+    }
+    if (rStatus != EventIO::ReadStatus::OK) {
+      DT_LOG_FATAL(flRecParameters.logLevel, "Failed to read data record from input source");
+      code = falaise::EXIT_UNAVAILABLE;
+      break;
+    }
+    eventIO.discard(std::move(workItem));
+  }
+  while (code == falaise::EXIT_OK && !endOfInput) {
+    // Prepare and read work
+    EventIO::ReadStatus rStatus = eventIO.next(workItem);
+    if (rStatus == EventIO::ReadStatus::END) {
+      break;
+    }
+    if (rStatus != EventIO::ReadStatus::OK) {
+      DT_LOG_FATAL(flRecParameters.logLevel, "Failed to read data record from input source");
+      code = falaise::EXIT_UNAVAILABLE;
+      break;
+    }
+
+    // Feed through pipeline
+    dpp::base_module::process_status pStatus = pipeline.process(*workItem);
+    DT_THROW_IF(
+        pStatus == dpp::base_module::PROCESS_INVALID, std::logic_error,
+        "Module '" << pipeline.get_name() << "' did not return a valid processing status!");
+
+    // FATAL, ERROR and ERROR_STOP status triggers the abortion of the processing loop.
+    // This is a very conservative approach, but it is compatible with the default behaviour of
+    // the bxdpp_processing executable.
+    if (pStatus == dpp::base_module::PROCESS_FATAL) {
+      code = falaise::EXIT_UNAVAILABLE;
+      break;
+    }
+    if (pStatus == dpp::base_module::PROCESS_ERROR) {
+      code = falaise::EXIT_UNAVAILABLE;
+      break;
+    }
+    if (pStatus == dpp::base_module::PROCESS_ERROR_STOP) {
+      code = falaise::EXIT_UNAVAILABLE;
+      break;
+    }
+
+    // STOP means the current event should not be processed anymore nor saved
+    // but the loop can continue with other items
+    if (pStatus == dpp::base_module::PROCESS_STOP) {
+      eventIO.discard(std::move(workItem));
+      continue;
+    }
+
+    // Check post-conditions on event model (expectedOutputBanks) ?
+
+    // Write item
+    if (!eventIO.write(std::move(workItem))) {
+      DT_LOG_FATAL(flRecParameters.logLevel, "Failed to write data record to output sink");
+      code = falaise::EXIT_UNAVAILABLE;
+      break;
+    }
+    if (flRecParameters.moduloEvents > 0) {
+      if (eventCounter % flRecParameters.moduloEvents == 0) {
+        DT_LOG_NOTICE(datatools::logger::PRIO_NOTICE, "Event #" << eventCounter);
+      }
+    }
+    eventCounter++;
+    if (numberOfEvents > 0 && eventCounter > numberOfEvents) {
+      break;
+    }
+  }
+  if (!eventIO.finish() && code == falaise::EXIT_OK) {
+    DT_LOG_FATAL(flRecParameters.logLevel, "Failed to write data record to output sink");
+    code = falaise::EXIT_UNAVAILABLE;
+  }
+  if (eventIO.isReadAhead()) {
+    DT_LOG_NOTICE(datatools::logger::PRIO_NOTICE,
+                  "I/O queue depth " << flRecParameters.ioQueueDepth << ": stalled on input "
+                                     << eventIO.inputStalls() << " times, on output "
+                                     << eventIO.outputStalls() << " times (write-behind "
+                                     << (eventIO.isWriteBehind() ? "on" : "off") << ") over "
+                                     << eventCounter << " events");
+  }
+  DT_LOG_DEBUG(flRecParameters.logLevel, "event loop completed");
+  return code;
+}
+
 falaise::exit_code ensure_core_services(const FLReconstructParams& recParams,
                                         datatools::service_manager& recServices) {
   datatools::kernel& dtk = datatools::kernel::instance();
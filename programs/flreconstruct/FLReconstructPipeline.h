@@ -15,9 +15,15 @@
 #ifndef FLRECONSTRUCTPIPELINE_H
 #define FLRECONSTRUCTPIPELINE_H
 
+// Standard Library:
+#include <cstddef>
+
 // Third party
 //  - Bayeux:
 #include "bayeux/datatools/service_manager.h"
+#include "bayeux/dpp/base_module.h"
+#include "bayeux/dpp/input_module.h"
+#include "bayeux/dpp/module_manager.h"
 
 // This Project
 #include "FLReconstructParams.h"
@@ -28,6 +34,19 @@ namespace FLReconstruct {
 //! Run the pipeline after configuration step
 falaise::exit_code do_pipeline(const FLReconstructParams& flRecParameters);
 
+//! Load the pipeline modules in the manager, before its initialization
+void load_pipeline_modules(const FLReconstructParams& flRecParameters,
+                           dpp::module_manager& moduleManager);
+
+//! Run records from input through the pipeline to an optional output
+//! Records before firstEvent are skipped, and numberOfEvents limits the loop (0: no limit).
+//! The number of processed events is returned in eventCounter.
+falaise::exit_code do_event_loop(const FLReconstructParams& flRecParameters,
+                                 dpp::base_module& pipeline, dpp::input_module& recInput,
+                                 dpp::base_module* recOutput, bool asyncOutput,
+                                 std::size_t firstEvent, std::size_t numberOfEvents,
+                                 std::size_t& eventCounter);
+
 //! Ensure some critical services are setup
 falaise::exit_code ensure_core_services(const FLReconstructParams& recParams,
                                         datatools::service_manager& recServices);
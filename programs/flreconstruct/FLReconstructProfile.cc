@@ -0,0 +1,103 @@
+// Ourselves
+#include "FLReconstructProfile.h"
+
+// Standard Library
+#include <sys/resource.h>
+
+// Third Party
+// - Bayeux
+#include "bayeux/datatools/exception.h"
+#include "bayeux/datatools/properties.h"
+
+namespace FLReconstruct {
+
+ProfiledPipeline::ProfiledPipeline(dpp::base_module& pipeline,
+                                   dpp::module_manager& moduleManager,
+                                   const datatools::multi_properties& modulesConfig) {
+  set_name("flreconstruct.profile");
+  const std::string& pipelineName = pipeline.get_name();
+  std::vector<std::string> moduleNames;
+  if (modulesConfig.has_key_with_meta(pipelineName, "dpp::chain_module")) {
+    const datatools::properties& chainConfig = modulesConfig.get_section(pipelineName);
+    if (chainConfig.has_key("modules")) {
+      chainConfig.fetch("modules", moduleNames);
+    }
+  }
+
+  if (moduleNames.empty()) {
+    stages_.push_back({pipelineName, &pipeline, {}, 0});
+  } else {
+    for (const std::string& name : moduleNames) {
+      DT_THROW_IF(!moduleManager.has(name), std::logic_error,
+                  "No module '" << name << "' in pipeline '" << pipelineName << "'");
+      stages_.push_back({name, &moduleManager.grab(name), {}, 0});
+    }
+  }
+  _set_initialized(true);
+}
+
+ProfiledPipeline::~ProfiledPipeline() {
+  if (is_initialized()) {
+    this->reset();
+  }
+}
+
+void ProfiledPipeline::initialize(const datatools::properties& /*config*/,
+                                  datatools::service_manager& /*services*/,
+                                  dpp::module_handle_dict_type& /*modules*/) {
+  _set_initialized(true);
+}
+
+void ProfiledPipeline::reset() { _set_initialized(false); }
+
+dpp::base_module::process_status ProfiledPipeline::process(datatools::things& record) {
+  for (Stage& stage : stages_) {
+    auto start = std::chrono::steady_clock::now();
+    process_status status = stage.module->process(record);
+    stage.time += std::chrono::steady_clock::now() - start;
+    stage.calls++;
+    if (status != PROCESS_OK) {
+      return status;
+    }
+  }
+  return PROCESS_OK;
+}
+
+void ProfiledPipeline::writeReport(const std::string& reportFile, std::size_t numberOfEvents,
+                                   double wallTime) const {
+  datatools::properties report;
+  report.store_integer("numberOfEvents", static_cast<int>(numberOfEvents));
+  report.store_real("wallTime", wallTime);
+  report.store_real("eventsPerSecond", wallTime > 0.0 ? numberOfEvents / wallTime : 0.0);
+  report.store_real("peakResidentMemory", peak_resident_memory());
+
+  std::vector<std::string> names;
+  for (const Stage& stage : stages_) {
+    names.push_back(stage.name);
+    std::chrono::duration<double> time = stage.time;
+    const std::string prefix = "module." + stage.name + ".";
+    report.store_real(prefix + "time", time.count());
+    report.store_integer(prefix + "calls", static_cast<int>(stage.calls));
+    // Per processed event in milliseconds, so that stopped events do not bias later modules
+    report.store_real(prefix + "timePerEvent",
+                      stage.calls > 0 ? 1000.0 * time.count() / stage.calls : 0.0);
+  }
+  report.store("modules", names);
+  report.write_configuration(reportFile);
+}
+
+double peak_resident_memory() {
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0.0;
+  }
+#if defined(__APPLE__)
+  // Bytes on macOS
+  return usage.ru_maxrss / (1024.0 * 1024.0);
+#else
+  // Kilobytes on Linux
+  return usage.ru_maxrss / 1024.0;
+#endif
+}
+
+}  // namespace FLReconstruct
@@ -0,0 +1,86 @@
+// FLReconstructProfile.h - Throughput profiling of the reconstruction pipeline
+//
+// Copyright (c) 2013 by Ben Morgan <bmorgan.warwick@gmail.com>
+// Copyright (c) 2013 by The University of Warwick
+
+// Distributed under the OSI-approved BSD 3-Clause License (the "License");
+// see accompanying file License.txt for details.
+//
+// This software is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the License for more information.
+
+#ifndef FLRECONSTRUCTPROFILE_H
+#define FLRECONSTRUCTPROFILE_H
+
+// Standard Library:
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Third Party
+// - Bayeux
+#include "bayeux/datatools/multi_properties.h"
+#include "bayeux/dpp/base_module.h"
+#include "bayeux/dpp/module_manager.h"
+
+namespace FLReconstruct {
+
+//! \brief Pipeline wrapper timing each of its top level modules
+//!
+//! If the pipeline is a `dpp::chain_module`, its modules are run in turn by
+//! the wrapper, with the same semantics as the chain: processing stops at the
+//! first module not returning `PROCESS_OK`. Any other pipeline is timed as a
+//! single module. Nested chains are timed as a whole.
+class ProfiledPipeline : public dpp::base_module {
+ public:
+  //! Construct from the pipeline, looking up its modules in the manager
+  ProfiledPipeline(dpp::base_module& pipeline, dpp::module_manager& moduleManager,
+                   const datatools::multi_properties& modulesConfig);
+
+  //! Destructor
+  ~ProfiledPipeline() override;
+
+  //! Nothing to configure, all modules are initialized by their manager
+  void initialize(const datatools::properties& config, datatools::service_manager& services,
+                  dpp::module_handle_dict_type& modules) override;
+
+  //! Reset the wrapper, keeping the modules untouched
+  void reset() override;
+
+  //! Run the record through the timed modules
+  process_status process(datatools::things& record) override;
+
+  //! Write a report of the timings, together with run totals, as a `datatools::properties` file
+  //!
+  //! The report holds the number of events, the wall time of the event loop
+  //! and the peak resident memory of the process, plus the total time, number
+  //! of calls and mean time per processed event of each module.
+  void writeReport(const std::string& reportFile, std::size_t numberOfEvents,
+                   double wallTime) const;
+
+ private:
+  //! Accumulated timing of one module
+  struct Stage {
+    std::string name;
+    dpp::base_module* module;
+    std::chrono::steady_clock::duration time;
+    std::size_t calls;
+  };
+
+  std::vector<Stage> stages_;
+};
+
+//! Return the peak resident set size of the process in MiB
+double peak_resident_memory();
+
+}  // namespace FLReconstruct
+
+#endif  // FLRECONSTRUCTPROFILE_H
+
+// Local Variables: --
+// mode: c++ --
+// c-file-style: "gnu" --
+// tab-width: 2 --
+// End: --
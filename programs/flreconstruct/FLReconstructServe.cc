@@ -0,0 +1,230 @@
+// Ourselves
+#include "FLReconstructServe.h"
+
+// Standard Library
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Third Party
+// - Boost
+#include <boost/algorithm/string.hpp>
+#include <boost/filesystem.hpp>
+// - Bayeux
+#include "bayeux/datatools/exception.h"
+#include "bayeux/datatools/factory_macros.h"
+#include "bayeux/datatools/logger.h"
+#include "bayeux/datatools/properties.h"
+#include "bayeux/datatools/utils.h"
+#include "bayeux/dpp/input_module.h"
+#include "bayeux/dpp/output_module.h"
+
+// This Project
+#include "FLReconstructPipeline.h"
+#include "falaise/property_set.h"
+
+namespace FLReconstruct {
+
+namespace {
+namespace bfs = boost::filesystem;
+
+//! Interval between two scans of an idle spool directory
+const std::chrono::milliseconds kSpoolPollInterval{500};
+
+//! Return the pending job files in the spool directory, in name order
+std::vector<bfs::path> pending_jobs(const bfs::path& spool) {
+  std::vector<bfs::path> jobs;
+  for (bfs::directory_iterator it(spool); it != bfs::directory_iterator(); ++it) {
+    if (bfs::is_regular_file(it->path()) && it->path().extension() == ".job") {
+      jobs.push_back(it->path());
+    }
+  }
+  std::sort(jobs.begin(), jobs.end());
+  return jobs;
+}
+
+//! Return the output metadata of a job: the server one, with the job input and event range
+datatools::multi_properties make_job_metadata(const FLReconstructJob& job,
+                                              const datatools::multi_properties& flRecMetadata) {
+  datatools::multi_properties jobMetadata = flRecMetadata;
+  datatools::properties& system_props = jobMetadata.grab_section("flreconstruct");
+  system_props.store_string("job", job.name, "Reconstruction job");
+  system_props.store_path("inputFile", job.inputFile, "Input data file");
+  if (job.firstEvent > 0) {
+    system_props.store_integer("firstEvent", static_cast<int>(job.firstEvent),
+                               "Number of skipped input events");
+  }
+  // The server has no event limit of its own, only the job one applies
+  if (system_props.has_key("numberOfEvents")) {
+    system_props.erase("numberOfEvents");
+  }
+  if (job.numberOfEvents > 0) {
+    system_props.store_integer("numberOfEvents", static_cast<int>(job.numberOfEvents),
+                               "Number of reconstructed events");
+  }
+  return jobMetadata;
+}
+
+//! Replace the module manager by a new one, with freshly initialized pipeline modules
+void reload_modules(const FLReconstructParams& flRecParameters,
+                    datatools::service_manager& recServices,
+                    std::unique_ptr<dpp::module_manager>& moduleManager) {
+  if (moduleManager != nullptr && moduleManager->is_initialized()) {
+    moduleManager->reset();
+  }
+  moduleManager.reset(new dpp::module_manager);
+  moduleManager->set_service_manager(recServices);
+  load_pipeline_modules(flRecParameters, *moduleManager);
+  moduleManager->initialize_simple();
+}
+
+//! Create the output module for a job, if it has an output file
+std::unique_ptr<dpp::base_module> make_job_output(
+    const FLReconstructJob& job, const datatools::multi_properties& jobMetadata) {
+  std::unique_ptr<dpp::base_module> output;
+  if (job.outputFile.empty()) {
+    return output;
+  }
+
+  if (boost::algorithm::ends_with(job.outputFile, ".root")) {
+    const auto& moduleRegister = DATATOOLS_FACTORY_GET_SYSTEM_REGISTER(dpp::base_module);
+    DT_THROW_IF(!moduleRegister.has("Things2Root"), std::logic_error,
+                "Things2Root module is not available for ROOT output");
+    output.reset(moduleRegister.get("Things2Root")());
+    datatools::properties t2rConfig;
+    t2rConfig.store("output_file", job.outputFile);
+    output->initialize_standalone(t2rConfig);
+    return output;
+  }
+
+  std::unique_ptr<dpp::output_module> brioOutput(new dpp::output_module);
+  brioOutput->set_name("FLReconstructOutput");
+  brioOutput->set_single_output_file(job.outputFile);
+  brioOutput->grab_metadata_store() = jobMetadata;
+  brioOutput->initialize_simple();
+  output = std::move(brioOutput);
+  return output;
+}
+}  // namespace
+
+// static
+FLReconstructJob FLReconstructJob::load(const std::string& jobFile) {
+  datatools::properties jobConfig;
+  jobConfig.read_configuration(jobFile);
+  falaise::property_set ps{jobConfig};
+
+  FLReconstructJob job;
+  job.name = bfs::path(jobFile).stem().string();
+  job.inputFile = ps.get<falaise::path>("inputFile");
+  job.outputFile = ps.get<falaise::path>("outputFile", {});
+  int first = ps.get<int>("firstEvent", 0);
+  int count = ps.get<int>("numberOfEvents", 0);
+  DT_THROW_IF(first < 0 || count < 0, std::domain_error,
+              "Job '" << job.name << "' has a negative event range");
+  job.firstEvent = static_cast<std::size_t>(first);
+  job.numberOfEvents = static_cast<std::size_t>(count);
+  return job;
+}
+
+falaise::exit_code do_serve(const FLReconstructParams& flRecParameters,
+                            datatools::service_manager& recServices,
+                            std::unique_ptr<dpp::module_manager>& moduleManager,
+                            const datatools::multi_properties& flRecMetadata) {
+  bfs::path spool{flRecParameters.serveSpoolDirectory};
+  DT_THROW_IF(!bfs::is_directory(spool), std::logic_error,
+              "Spool directory '" << spool.string() << "' does not exist");
+  DT_LOG_NOTICE(datatools::logger::PRIO_NOTICE,
+                "Serving reconstruction jobs from '" << spool.string() << "'");
+
+  std::size_t nJobs = 0;
+  std::size_t nFailed = 0;
+  while (true) {
+    std::vector<bfs::path> jobs = pending_jobs(spool);
+    if (jobs.empty()) {
+      if (bfs::exists(spool / "stop")) {
+        break;
+      }
+      std::this_thread::sleep_for(kSpoolPollInterval);
+      continue;
+    }
+
+    for (const bfs::path& jobPath : jobs) {
+      // Claim the job, another server may share the spool
+      bfs::path runPath = jobPath;
+      runPath.replace_extension(".running");
+      boost::system::error_code ec;
+      bfs::rename(jobPath, runPath, ec);
+      if (ec) {
+        continue;
+      }
+
+      datatools::properties report;
+      std::size_t eventCounter = 0;
+      falaise::exit_code code = falaise::EXIT_OK;
+      auto start = std::chrono::steady_clock::now();
+      try {
+        FLReconstructJob job = FLReconstructJob::load(runPath.string());
+        report.store_string("inputFile", job.inputFile);
+        report.store_string("outputFile", job.outputFile);
+
+        // The first job runs on the modules initialized at startup
+        if (nJobs > 0) {
+          reload_modules(flRecParameters, recServices, moduleManager);
+        }
+        dpp::base_module& pipeline =
+            moduleManager->grab(flRecParameters.reconstructionPipelineModule);
+
+        dpp::input_module recInput;
+        recInput.set_logging_priority(flRecParameters.logLevel);
+        recInput.set_single_input_file(job.inputFile);
+        recInput.initialize_simple();
+        std::unique_ptr<dpp::base_module> recOutput =
+            make_job_output(job, make_job_metadata(job, flRecMetadata));
+        bool asyncOutput = (dynamic_cast<dpp::output_module*>(recOutput.get()) != nullptr);
+
+        code = do_event_loop(flRecParameters, pipeline, recInput, recOutput.get(), asyncOutput,
+                             job.firstEvent, job.numberOfEvents, eventCounter);
+
+        // Close files now, so they are complete when the report appears
+        if (recOutput) {
+          recOutput->reset();
+        }
+        recInput.reset();
+      } catch (std::exception& e) {
+        report.store_string("error", e.what());
+        code = falaise::EXIT_UNAVAILABLE;
+      }
+      std::chrono::duration<double> wallTime = std::chrono::steady_clock::now() - start;
+
+      nJobs++;
+      bool ok = (code == falaise::EXIT_OK);
+      if (!ok) {
+        nFailed++;
+      }
+      report.store_integer("numberOfEvents", static_cast<int>(eventCounter));
+      report.store_real("wallTime", wallTime.count());
+      report.store_real("eventsPerSecond",
+                        wallTime.count() > 0.0 ? eventCounter / wallTime.count() : 0.0);
+      bfs::path reportPath = runPath;
+      reportPath.replace_extension(ok ? ".done" : ".failed");
+      report.write_configuration(reportPath.string());
+      bfs::remove(runPath, ec);
+
+      DT_LOG_NOTICE(datatools::logger::PRIO_NOTICE,
+                    "Job '" << jobPath.stem().string() << "' " << (ok ? "done" : "failed")
+                            << ": " << eventCounter << " events in " << wallTime.count()
+                            << " s");
+    }
+  }
+
+  boost::system::error_code ec;
+  bfs::remove(spool / "stop", ec);
+  DT_LOG_NOTICE(datatools::logger::PRIO_NOTICE,
+                "Stopped serving after " << nJobs << " jobs (" << nFailed << " failed)");
+  return nFailed == 0 ? falaise::EXIT_OK : falaise::EXIT_UNAVAILABLE;
+}
+
+}  // namespace FLReconstruct
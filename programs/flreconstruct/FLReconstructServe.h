@@ -0,0 +1,78 @@
+// FLReconstructServe.h - Warm reconstruction server running jobs from a spool directory
+//
+// Copyright (c) 2013 by Ben Morgan <bmorgan.warwick@gmail.com>
+// Copyright (c) 2013 by The University of Warwick
+
+// Distributed under the OSI-approved BSD 3-Clause License (the "License");
+// see accompanying file License.txt for details.
+//
+// This software is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the License for more information.
+
+#ifndef FLRECONSTRUCTSERVE_H
+#define FLRECONSTRUCTSERVE_H
+
+// Standard Library:
+#include <cstddef>
+#include <memory>
+#include <string>
+
+// Third Party
+// - Bayeux
+#include "bayeux/datatools/multi_properties.h"
+#include "bayeux/datatools/service_manager.h"
+#include "bayeux/dpp/module_manager.h"
+
+// This Project
+#include "FLReconstructParams.h"
+#include "falaise/exitcodes.h"
+
+namespace FLReconstruct {
+
+//! \brief A single reconstruction job read from the spool directory
+//!
+//! Jobs are `datatools::properties` files with the `.job` extension:
+//!
+//! ```
+//! inputFile : string as path = "run_1.brio"
+//! outputFile : string as path = "run_1-rec.brio"
+//! firstEvent : integer = 0
+//! numberOfEvents : integer = 0
+//! ```
+struct FLReconstructJob {
+  std::string name;            //!< Job name (file name without extension)
+  std::string inputFile;       //!< Input data file
+  std::string outputFile;      //!< Output data file (optional)
+  std::size_t firstEvent;      //!< Number of input records to skip
+  std::size_t numberOfEvents;  //!< Number of events to process (0: all)
+
+  //! Load a job from its spool file
+  static FLReconstructJob load(const std::string& jobFile);
+};
+
+//! Run jobs found in the spool directory through an initialized pipeline
+//!
+//! Services stay initialized for the lifetime of the server. Pipeline
+//! modules are re-initialized between jobs, so that no module state carries
+//! over from one job to the next, and the module manager is replaced by a
+//! new one for each job after the first. Each job gets its own input and
+//! output modules, and its output metadata records its own input file and
+//! event range. Jobs are picked in name order, renamed to `.running` while
+//! processed, and replaced by a `.done` or `.failed` report holding the event
+//! count and timings. The server returns once a file named `stop` is present
+//! and no job is pending.
+falaise::exit_code do_serve(const FLReconstructParams& flRecParameters,
+                            datatools::service_manager& recServices,
+                            std::unique_ptr<dpp::module_manager>& moduleManager,
+                            const datatools::multi_properties& flRecMetadata);
+
+}  // namespace FLReconstruct
+
+#endif  // FLRECONSTRUCTSERVE_H
+
+// Local Variables: --
+// mode: c++ --
+// c-file-style: "gnu" --
+// tab-width: 2 --
+// End: --
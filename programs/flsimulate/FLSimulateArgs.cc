@@ -70,6 +70,13 @@ FLSimulateArgs FLSimulateArgs::makeDefault() {
   params.saveRngSeeding = true;
   params.rngSeeding = "";
 
+  // Selection of simulated events:
+  params.selection.config = "";
+  params.selection.cut = "";
+
+  // Reconstruction of simulated events:
+  params.reconstruction = FLSimulateReconstructionConfig::makeDefault();
+
   // Variants support:
   params.variantConfigUrn = "";
   params.variantProfileUrn = "";
@@ -84,6 +91,7 @@ FLSimulateArgs FLSimulateArgs::makeDefault() {
   params.outputMetadataFile = "";
   params.embeddedMetadata = true;
   params.outputFile = "";
+  params.numberOfJobs = 1;
 
   return params;
 }
@@ -108,6 +116,7 @@ void do_configure(int argc, char* argv[], FLSimulateArgs& flSimParameters) {
   flSimParameters.outputMetadataFile = args.outputMetadataFile;
   flSimParameters.embeddedMetadata = args.embeddedMetadata;
   flSimParameters.outputFile = args.outputFile;
+  flSimParameters.numberOfJobs = args.numberOfJobs;
   flSimParameters.mountPoints = args.mountPoints;
 
   if (static_cast<unsigned int>(!flSimParameters.mountPoints.empty()) != 0u) {
@@ -287,6 +296,32 @@ void do_configure(int argc, char* argv[], FLSimulateArgs& flSimParameters) {
     // Bind properties in this section to the relevant ones in params:
     //}
 
+    // Cuts subsystem:
+    if (flSimConfig.has_key_with_meta("flsimulate.cuts", "flsimulate::section")) {
+      falaise::property_set cutsSubsystem{flSimConfig.get_section("flsimulate.cuts")};
+
+      // Cut manager configuration file:
+      flSimParameters.selection.config =
+          cutsSubsystem.get<falaise::path>("config", flSimParameters.selection.config);
+
+      // Cut selecting the events to keep:
+      flSimParameters.selection.cut =
+          cutsSubsystem.get<std::string>("cut", flSimParameters.selection.cut);
+    }
+
+    // Reconstruction subsystem:
+    if (flSimConfig.has_key_with_meta("flsimulate.reconstruction", "flsimulate::section")) {
+      falaise::property_set recSubsystem{flSimConfig.get_section("flsimulate.reconstruction")};
+
+      // Pipeline script, in the flreconstruct format:
+      flSimParameters.reconstruction.pipelineScript = recSubsystem.get<falaise::path>(
+          "pipelineScript", flSimParameters.reconstruction.pipelineScript);
+
+      // Keep the MC step hits in the output:
+      flSimParameters.reconstruction.keepStepHits =
+          recSubsystem.get<bool>("keepStepHits", flSimParameters.reconstruction.keepStepHits);
+    }
+
     // Variants subsystem:
     if (flSimConfig.has_key_with_meta("flsimulate.variantService", "flsimulate::section")) {
       falaise::property_set variantSubsystem{flSimConfig.get_section("flsimulate.variantService")};
@@ -365,6 +400,18 @@ void do_postprocess(FLSimulateArgs& flSimParameters) {
     }
   }
 
+  // Workers start from seeds, PRNG states can only be saved/restored by a single process
+  if (flSimParameters.numberOfJobs > 1 &&
+      (!flSimParameters.simulationManagerParams.input_prng_states_file.empty() ||
+       !flSimParameters.simulationManagerParams.output_prng_states_file.empty())) {
+    DT_THROW(FLConfigUserError, "PRNG state files cannot be used with more than one job");
+  }
+
+  if (flSimParameters.reconstruction.is_active()) {
+    load_reconstruction_script(flSimParameters.reconstruction, flSimParameters.userProfile,
+                               flSimParameters.logLevel);
+  }
+
   // Propagate verbosity to variant service:
   flSimParameters.variantSubsystemParams.logging =
       datatools::logger::get_priority_label(flSimParameters.logLevel);
@@ -576,6 +623,13 @@ void FLSimulateArgs::print(std::ostream& out_) const {
        << std::endl;
   out_ << tag << "saveRngSeeding             = " << std::boolalpha << saveRngSeeding << std::endl;
   out_ << tag << "rngSeeding                 = " << rngSeeding << std::endl;
+  out_ << tag << "selectionCut               = "
+       << (selection.is_active() ? selection.cut : "<not used>") << std::endl;
+  out_ << tag << "reconstructionScript       = "
+       << (reconstruction.is_active() ? reconstruction.pipelineScript : "<not used>")
+       << std::endl;
+  out_ << tag << "keepStepHits               = " << std::boolalpha << reconstruction.keepStepHits
+       << std::endl;
   out_ << tag << "digitizationSetupUrn       = "
        << (digitizationSetupUrn.empty() ? "<not used>" : digitizationSetupUrn) << std::endl;
   out_ << tag << "variantConfigUrn           = " << variantConfigUrn << std::endl;
@@ -588,7 +642,8 @@ void FLSimulateArgs::print(std::ostream& out_) const {
   out_ << tag << "servicesSubsystemConfig    = " << servicesSubsystemConfig << std::endl;
   out_ << tag << "outputMetadataFile         = " << outputMetadataFile << std::endl;
   out_ << tag << "embeddedMetadata           = " << std::boolalpha << embeddedMetadata << std::endl;
-  out_ << last_tag << "outputFile                 = " << outputFile << std::endl;
+  out_ << tag << "outputFile                 = " << outputFile << std::endl;
+  out_ << last_tag << "numberOfJobs               = " << numberOfJobs << std::endl;
 }
 
 }  // namespace FLSimulate
@@ -24,6 +24,10 @@
 #include "bayeux/datatools/multi_properties.h"
 #include "bayeux/mctools/g4/manager_parameters.h"
 
+// This Project
+#include "FLSimulateReconstruction.h"
+#include "FLSimulateSelection.h"
+
 namespace FLSimulate {
 
 //! Collect all needed configuration parameters in one data structure
@@ -47,6 +51,12 @@ struct FLSimulateArgs {
   // Digitization module setup:
   std::string digitizationSetupUrn;  //!< The URN of the digitization module setup
 
+  // Selection of simulated events:
+  FLSimulateSelectionConfig selection;  //!< Cut applied at the end of each event
+
+  // Reconstruction of simulated events:
+  FLSimulateReconstructionConfig reconstruction;  //!< Reconstruction pipeline setup
+
   // Variants support:
   std::string variantConfigUrn;   //!< Variants configuration URN
   std::string variantProfileUrn;  //!< Variants profile URN
@@ -64,6 +74,7 @@ struct FLSimulateArgs {
   bool saveRngSeeding;             //!< Flag to save PRNG seeds in metadata
   std::string rngSeeding;          //!< PRNG seed initialization
   std::string outputFile;          //!< Output data file for the output module
+  unsigned int numberOfJobs;       //!< Number of worker processes
 
   //! Construct and return the default configuration object
   // Equally, could be supplied in a .application file, though note
@@ -28,6 +28,7 @@ FLSimulateCommandLine FLSimulateCommandLine::makeDefault() {
   flClarg.embeddedMetadata = true;
   flClarg.outputFile = "";
   flClarg.userProfile = "normal";
+  flClarg.numberOfJobs = 1;
   return flClarg;
 }
 
@@ -82,6 +83,15 @@ void do_help_scripting(std::ostream& os) {
      << "rngSeedFile : string as path = \"seeds.conf\"      # Path to file containing random "
         "number seeds\n"
      << std::endl
+     << "[name=\"flsimulate.cuts\" type=\"flsimulate::section\"]\n"
+     << "config : string as path = \"cuts.conf\"            # Cut manager configuration file\n"
+     << "cut : string = \"selection\"                       # Cut selecting the saved events\n"
+     << std::endl
+     << "[name=\"flsimulate.reconstruction\" type=\"flsimulate::section\"]\n"
+     << "pipelineScript : string as path = \"rec.conf\"     # flreconstruct pipeline script run "
+        "on each event\n"
+     << "keepStepHits : boolean = false                   # Drop MC step hits from the output\n"
+     << std::endl
      << "[name=\"flsimulate.variantService\" type=\"flsimulate::section\"]\n"
      << "profile : string as path = \"vprofile.conf\"       # Input variant profile configuration "
         "file.\n"
@@ -160,6 +170,11 @@ void do_cldialog(int argc, char* argv[], FLSimulateCommandLine& clArgs) {
       "Examples:\n"
       "  -o \"example.brio\" \n"
       "  -o \"${WORKER_DIR}/data/run_1.xml\"")
+
+    ("jobs,j", bpo::value<unsigned int>(&clArgs.numberOfJobs)->value_name("n")->default_value(1),
+      "number of worker processes among which the events are split\n"
+      "Example:\n"
+      "  -j 4")
     ;
   // clang-format on
 
@@ -211,6 +226,10 @@ void do_cldialog(int argc, char* argv[], FLSimulateCommandLine& clArgs) {
   if (falaise::validUserLevels().count(clArgs.userProfile) == 0u) {
     DT_THROW(FLDialogOptionsError, "Invalid user profile '" << clArgs.userProfile << "'");
   }
+
+  if (clArgs.numberOfJobs == 0) {
+    DT_THROW(FLDialogOptionsError, "Number of jobs must be at least 1");
+  }
 }
 
 }  // namespace FLSimulate
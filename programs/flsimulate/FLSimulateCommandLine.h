@@ -37,6 +37,7 @@ struct FLSimulateCommandLine {
   std::string outputMetadataFile;        //!< Path for saving metadata
   bool embeddedMetadata;                 //!< Flag to embed metadata in the output data file
   std::string outputFile;                //!< Path for the output module
+  unsigned int numberOfJobs;             //!< Number of worker processes
   static FLSimulateCommandLine makeDefault();
 };
 
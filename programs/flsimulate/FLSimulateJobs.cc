@@ -0,0 +1,191 @@
+// Ourselves
+#include "FLSimulateJobs.h"
+
+// Standard Library
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <set>
+#include <sstream>
+
+// Third Party
+// - Boost
+#include "boost/filesystem.hpp"
+// - Bayeux
+#include "bayeux/datatools/exception.h"
+#include "bayeux/datatools/things.h"
+#include "bayeux/datatools/utils.h"
+#include "bayeux/dpp/input_module.h"
+#include "bayeux/dpp/output_module.h"
+#include "bayeux/mygsl/seed_manager.h"
+
+namespace FLSimulate {
+
+namespace {
+//! Labels of the seeds of the simulation manager, with their explicit values
+std::vector<std::pair<std::string, int32_t>> explicit_seeds(
+    const mctools::g4::manager_parameters& params) {
+  return {{"EG", params.eg_seed},
+          {"MGR", params.mgr_seed},
+          {"SHPF", params.shpf_seed},
+          {"VG", params.vg_seed}};
+}
+
+//! Largest valid seed
+const uint64_t kMaxSeed = 0x7FFFFFFF;
+}  // namespace
+
+FLSimulateSeeds make_run_seeds(const mctools::g4::manager_parameters& params) {
+  FLSimulateSeeds seeds;
+  if (!params.input_prng_seeds_file.empty()) {
+    std::string seedsFile = params.input_prng_seeds_file;
+    datatools::fetch_path_with_env(seedsFile);
+    std::ifstream input(seedsFile);
+    DT_THROW_IF(!input, std::runtime_error, "Cannot open seeds file '" << seedsFile << "'");
+    mygsl::seed_manager fileSeeds;
+    input >> fileSeeds;
+    DT_THROW_IF(!input, std::runtime_error, "Cannot read seeds file '" << seedsFile << "'");
+    for (const auto& s : explicit_seeds(params)) {
+      DT_THROW_IF(!fileSeeds.has_seed(s.first), std::runtime_error,
+                  "Seeds file '" << seedsFile << "' has no '" << s.first << "' seed");
+      seeds[s.first] = fileSeeds.get_seed(s.first);
+    }
+    return seeds;
+  }
+
+  // Seeds not set explicitly are drawn once here, then derived for all workers
+  std::random_device entropy;
+  std::set<int32_t> used;
+  for (const auto& s : explicit_seeds(params)) {
+    if (s.second > 0) {
+      used.insert(s.second);
+    }
+  }
+  for (const auto& s : explicit_seeds(params)) {
+    int32_t seed = s.second;
+    while (seed <= 0 || (s.second <= 0 && used.count(seed) != 0)) {
+      seed = static_cast<int32_t>(1 + entropy() % kMaxSeed);
+    }
+    used.insert(seed);
+    seeds[s.first] = seed;
+  }
+  return seeds;
+}
+
+int32_t derive_seed(int32_t runSeed, unsigned int job) {
+  if (job == 0) {
+    return runSeed;
+  }
+  // SplitMix64 finalizer of the (seed, job) pair
+  uint64_t z = (static_cast<uint64_t>(static_cast<uint32_t>(runSeed)) << 32) | job;
+  z += 0x9E3779B97F4A7C15ULL;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  z = z ^ (z >> 31);
+  return static_cast<int32_t>(1 + z % kMaxSeed);
+}
+
+std::vector<FLSimulateJob> make_jobs(unsigned int numberOfEvents, unsigned int numberOfJobs,
+                                     const FLSimulateSeeds& runSeeds,
+                                     const std::string& outputFile) {
+  // At least one event per worker
+  unsigned int nJobs = std::max(1u, std::min(numberOfJobs, numberOfEvents));
+  boost::filesystem::path output(outputFile);
+
+  std::vector<FLSimulateJob> jobs;
+  unsigned int firstEvent = 0;
+  for (unsigned int k = 0; k < nJobs; ++k) {
+    FLSimulateJob job;
+    job.index = k;
+    job.firstEvent = firstEvent;
+    job.numberOfEvents = numberOfEvents / nJobs + (k < numberOfEvents % nJobs ? 1 : 0);
+    firstEvent += job.numberOfEvents;
+
+    // Seeds of a worker must differ from each other, as the run's do
+    std::set<int32_t> used;
+    for (const auto& s : runSeeds) {
+      int32_t seed = derive_seed(s.second, k);
+      for (unsigned int salt = 1; used.count(seed) != 0; ++salt) {
+        seed = derive_seed(seed, salt);
+      }
+      used.insert(seed);
+      job.seeds[s.first] = seed;
+    }
+
+    // Prefix rather than suffix, so that the file keeps its format extension(s)
+    job.outputFile =
+        (output.parent_path() /
+         ("__flsimulate-job" + std::to_string(k) + "-" + output.filename().string()))
+            .string();
+    jobs.push_back(job);
+  }
+  return jobs;
+}
+
+std::string format_seeds(const FLSimulateSeeds& seeds) {
+  mygsl::seed_manager sm;
+  for (const auto& s : seeds) {
+    sm.add_seed(s.first, s.second);
+  }
+  std::ostringstream out;
+  out << sm;
+  return out.str();
+}
+
+void store_jobs_metadata(const std::vector<FLSimulateJob>& jobs, datatools::properties& section) {
+  section.store_integer("numberOfJobs", static_cast<int>(jobs.size()),
+                        "Number of worker processes");
+  for (const FLSimulateJob& job : jobs) {
+    const std::string prefix = "jobs." + std::to_string(job.index) + ".";
+    section.store_integer(prefix + "firstEvent", static_cast<int>(job.firstEvent),
+                          "Event number of the first event of the worker");
+    section.store_integer(prefix + "numberOfEvents", static_cast<int>(job.numberOfEvents),
+                          "Number of events simulated by the worker");
+    section.store_string(prefix + "rngSeeding", format_seeds(job.seeds),
+                         "PRNG initial seeds of the worker");
+  }
+}
+
+falaise::exit_code merge_job_outputs(const std::vector<FLSimulateJob>& jobs,
+                                     const std::string& outputFile,
+                                     const datatools::multi_properties* metadata) {
+  dpp::output_module simOutput;
+  simOutput.set_name("FLSimulateOutput");
+  simOutput.set_single_output_file(outputFile);
+  if (metadata != nullptr) {
+    simOutput.grab_metadata_store() = *metadata;
+  }
+  simOutput.initialize_simple();
+
+  datatools::things workItem;
+  for (const FLSimulateJob& job : jobs) {
+    dpp::input_module jobInput;
+    jobInput.set_name("FLSimulateJobInput");
+    jobInput.set_single_input_file(job.outputFile);
+    jobInput.initialize_simple();
+
+    unsigned int nEvents = 0;
+    while (!jobInput.is_terminated()) {
+      workItem.clear();
+      if (jobInput.process(workItem) != dpp::base_module::PROCESS_OK) {
+        std::cerr << "flsimulate : Cannot read output of job " << job.index << std::endl;
+        return falaise::EXIT_UNAVAILABLE;
+      }
+      if (simOutput.process(workItem) != dpp::base_module::PROCESS_OK) {
+        std::cerr << "flsimulate : Output module failed" << std::endl;
+        return falaise::EXIT_UNAVAILABLE;
+      }
+      nEvents++;
+    }
+    // Events rejected by the reconstruction pipeline are not saved
+    if (nEvents > job.numberOfEvents) {
+      std::cerr << "flsimulate : Job " << job.index << " produced " << nEvents
+                << " events for " << job.numberOfEvents << " simulated" << std::endl;
+      return falaise::EXIT_UNAVAILABLE;
+    }
+  }
+  return falaise::EXIT_OK;
+}
+
+}  // namespace FLSimulate
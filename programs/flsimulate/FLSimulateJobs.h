@@ -0,0 +1,82 @@
+// FLSimulateJobs.h - Splitting of a flsimulate run over worker processes
+//
+// Copyright (c) 2013 by Ben Morgan <bmorgan.warwick@gmail.com>
+// Copyright (c) 2013 by The University of Warwick
+// Distributed under the OSI-approved BSD 3-Clause License (the "License");
+// see accompanying file License.txt for details.
+//
+// This software is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the License for more information.
+
+#ifndef FLSIMULATEJOBS_H
+#define FLSIMULATEJOBS_H
+
+// Standard Library:
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+// Third Party
+// - Bayeux
+#include "bayeux/datatools/multi_properties.h"
+#include "bayeux/datatools/properties.h"
+#include "bayeux/mctools/g4/manager_parameters.h"
+
+// This Project
+#include "falaise/exitcodes.h"
+
+namespace FLSimulate {
+
+//! PRNG seeds, by label of the simulation manager seed manager ("EG", "MGR", "SHPF", "VG")
+using FLSimulateSeeds = std::map<std::string, int32_t>;
+
+//! \brief A worker of a run split with --jobs
+//!
+//! Each worker simulates a contiguous range of events of the run, with
+//! seeds derived from the run's seeds, into its own temporary output file.
+struct FLSimulateJob {
+  unsigned int index;           //!< Worker index
+  unsigned int firstEvent;      //!< Event number of its first event in the run
+  unsigned int numberOfEvents;  //!< Number of events it simulates
+  FLSimulateSeeds seeds;        //!< Its PRNG seeds
+  std::string outputFile;       //!< Its temporary output file
+};
+
+//! Return the run's seeds, read from the seeds file or set from the explicit seeds
+//!
+//! Seeds left to the automatic policy are drawn from the system entropy source.
+FLSimulateSeeds make_run_seeds(const mctools::g4::manager_parameters& params);
+
+//! Derive the seed of a worker from a run seed
+//!
+//! Worker 0 keeps the run seed, so that a run with one job is identical to a
+//! run without --jobs. Other workers get a hash of the run seed and their index.
+int32_t derive_seed(int32_t runSeed, unsigned int job);
+
+//! Split a run of numberOfEvents events over at most numberOfJobs workers
+std::vector<FLSimulateJob> make_jobs(unsigned int numberOfEvents, unsigned int numberOfJobs,
+                                     const FLSimulateSeeds& runSeeds,
+                                     const std::string& outputFile);
+
+//! Format seeds as a seed manager, i.e. in the format of seeds files
+std::string format_seeds(const FLSimulateSeeds& seeds);
+
+//! Record the event ranges and seeds of the workers in a metadata section
+void store_jobs_metadata(const std::vector<FLSimulateJob>& jobs, datatools::properties& section);
+
+//! Concatenate the worker output files, in worker order, into the output file
+falaise::exit_code merge_job_outputs(const std::vector<FLSimulateJob>& jobs,
+                                     const std::string& outputFile,
+                                     const datatools::multi_properties* metadata);
+
+}  // namespace FLSimulate
+
+#endif  // FLSIMULATEJOBS_H
+
+// Local Variables: --
+// mode: c++ --
+// c-file-style: "gnu" --
+// tab-width: 2 --
+// End: --
@@ -0,0 +1,165 @@
+// Ourselves
+#include "FLSimulateReconstruction.h"
+
+// Standard Library
+#include <vector>
+
+// Third Party
+// - Bayeux
+#include "bayeux/datatools/exception.h"
+#include "bayeux/datatools/kernel.h"
+#include "bayeux/datatools/urn_query_service.h"
+#include "bayeux/datatools/utils.h"
+#include "bayeux/mctools/simulated_data.h"
+
+// This Project
+#include "FLSimulateErrors.h"
+#include "falaise/property_set.h"
+#include "falaise/snemo/datamodels/data_model.h"
+#include "falaise/tags.h"
+
+namespace FLSimulate {
+
+// static
+FLSimulateReconstructionConfig FLSimulateReconstructionConfig::makeDefault() {
+  FLSimulateReconstructionConfig config;
+  config.pipelineScript = "";
+  config.pipelineUrn = "";
+  config.pipelineConfig = "";
+  config.pipelineModule = "pipeline";
+  config.keepStepHits = true;
+  return config;
+}
+
+void load_reconstruction_script(FLSimulateReconstructionConfig& config,
+                                const std::string& userProfile,
+                                datatools::logger::priority logLevel) {
+  datatools::multi_properties flRecConfig("name", "type");
+  std::string pipelineScript = config.pipelineScript;
+  datatools::fetch_path_with_env(pipelineScript);
+  flRecConfig.read(pipelineScript);
+
+  // Plugins, as in flreconstruct:
+  if (flRecConfig.has_key_with_meta("flreconstruct.plugins", "flreconstruct::section")) {
+    falaise::property_set userFLPlugins{flRecConfig.get_section("flreconstruct.plugins")};
+    flRecConfig.remove("flreconstruct.plugins");
+
+    auto pList = userFLPlugins.get<std::vector<std::string>>("plugins", {});
+    for (const std::string& plugin_name : pList) {
+      auto pSection = userFLPlugins.get<falaise::property_set>(plugin_name, {});
+      pSection.put("autoload", true);
+      if (!pSection.has_key("directory")) {
+        pSection.put("directory", std::string{"@falaise.plugins:"});
+      }
+      config.userLibConfig.add(plugin_name, "", pSection);
+    }
+  }
+
+  // Pipeline:
+  if (flRecConfig.has_key_with_meta("flreconstruct.pipeline", "flreconstruct::section")) {
+    falaise::property_set pipelineSubsystem{flRecConfig.get_section("flreconstruct.pipeline")};
+    flRecConfig.remove("flreconstruct.pipeline");
+    config.pipelineUrn = pipelineSubsystem.get<std::string>("configUrn", config.pipelineUrn);
+    config.pipelineConfig = pipelineSubsystem.get<std::string>("config", config.pipelineConfig);
+    config.pipelineModule = pipelineSubsystem.get<std::string>("module", config.pipelineModule);
+  }
+
+  // Services and variants are those of the simulation
+  for (const auto& section_key : flRecConfig.keys()) {
+    if (flRecConfig.has_key_with_meta(section_key, "flreconstruct::section")) {
+      DT_LOG_WARNING(logLevel, "Section '" << section_key << "' of reconstruction script '"
+                                           << config.pipelineScript << "' is ignored");
+      flRecConfig.remove(section_key);
+    }
+  }
+
+  if (userProfile == "production" && !flRecConfig.empty()) {
+    DT_THROW(FLConfigUserError, "User profile '"
+                                    << userProfile << "' "
+                                    << "does not allow the definitions of inline modules!");
+  }
+  config.modulesConfig = flRecConfig;
+
+  if (!config.pipelineUrn.empty()) {
+    const datatools::urn_query_service& dtkUrnQuery =
+        datatools::kernel::instance().get_urn_query();
+    DT_THROW_IF(!dtkUrnQuery.check_urn_info(config.pipelineUrn,
+                                            falaise::tags::reconstruction_setup_category()),
+                FLConfigUserError,
+                "Cannot query reconstruction setup URN='" << config.pipelineUrn << "'!");
+    std::string conf_rec_category = "configuration";
+    std::string conf_rec_mime;
+    std::string conf_rec_path;
+    DT_THROW_IF(!dtkUrnQuery.resolve_urn_to_path(config.pipelineUrn, conf_rec_category,
+                                                 conf_rec_mime, conf_rec_path),
+                FLConfigUserError, "Cannot resolve URN='" << config.pipelineUrn << "'!");
+    config.pipelineConfig = conf_rec_path;
+  }
+
+  if (!config.pipelineConfig.empty()) {
+    DT_THROW_IF(!config.modulesConfig.empty(), FLConfigUserError,
+                "Pipeline module configuration file '"
+                    << config.pipelineConfig << "' "
+                    << "conflicts with pipeline inline configuration provided by the script!");
+    std::string pipeline_config_filename = config.pipelineConfig;
+    datatools::fetch_path_with_env(pipeline_config_filename);
+    config.modulesConfig.read(pipeline_config_filename);
+  }
+
+  DT_THROW_IF(config.modulesConfig.empty(), FLConfigUserError,
+              "Reconstruction script '" << config.pipelineScript << "' defines no module");
+}
+
+void store_reconstruction_metadata(const FLSimulateReconstructionConfig& config,
+                                   datatools::properties& section) {
+  section.store_path("pipelineScript", config.pipelineScript, "Reconstruction pipeline script");
+  if (!config.pipelineUrn.empty()) {
+    section.store_string("configUrn", config.pipelineUrn, "Reconstruction setup URN");
+  } else if (!config.pipelineConfig.empty()) {
+    section.store_path("config", config.pipelineConfig,
+                       "Reconstruction setup main configuration file");
+  }
+  section.store_string("module", config.pipelineModule, "Reconstruction pipeline top module");
+  section.store_boolean("keepStepHits", config.keepStepHits, "Flag to keep MC step hits");
+}
+
+FLSimulateReconstruction::FLSimulateReconstruction(const FLSimulateReconstructionConfig& config,
+                                                   datatools::service_manager& services)
+    : libLoader_(config.userLibConfig),
+      moduleManager_(new dpp::module_manager),
+      keepStepHits_(config.keepStepHits) {
+  moduleManager_->set_service_manager(services);
+  moduleManager_->load_modules(config.modulesConfig);
+  moduleManager_->initialize_simple();
+  pipeline_ = &(moduleManager_->grab(config.pipelineModule));
+}
+
+FLSimulateReconstruction::~FLSimulateReconstruction() {
+  // - MUST delete the module manager BEFORE the library loader clears
+  // in case the manager is holding resources created from a shared lib
+  if (moduleManager_->is_initialized()) {
+    moduleManager_->reset();
+  }
+  moduleManager_.reset();
+}
+
+dpp::base_module::process_status FLSimulateReconstruction::process(datatools::things& workItem) {
+  dpp::base_module::process_status status = pipeline_->process(workItem);
+  if (status != dpp::base_module::PROCESS_OK || keepStepHits_) {
+    return status;
+  }
+
+  // Keep the primary event and vertex, drop the step hits
+  const std::string& sdLabel = snedm::labels::simulated_data();
+  if (workItem.has(sdLabel) && workItem.is_a<mctools::simulated_data>(sdLabel)) {
+    auto& sd = workItem.grab<mctools::simulated_data>(sdLabel);
+    std::vector<std::string> categories;
+    sd.get_step_hits_categories(categories, mctools::simulated_data::HIT_CATEGORY_TYPE_ALL);
+    for (const std::string& category : categories) {
+      sd.grab_step_hits(category).clear();
+    }
+  }
+  return status;
+}
+
+}  // namespace FLSimulate
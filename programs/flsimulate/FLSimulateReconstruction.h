@@ -0,0 +1,93 @@
+// FLSimulateReconstruction.h - Reconstruction pipeline run in flsimulate
+//
+// Copyright (c) 2013 by Ben Morgan <bmorgan.warwick@gmail.com>
+// Copyright (c) 2013 by The University of Warwick
+// Distributed under the OSI-approved BSD 3-Clause License (the "License");
+// see accompanying file License.txt for details.
+//
+// This software is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the License for more information.
+
+#ifndef FLSIMULATERECONSTRUCTION_H
+#define FLSIMULATERECONSTRUCTION_H
+
+// Standard Library:
+#include <memory>
+#include <string>
+
+// Third Party
+// - Bayeux
+#include "bayeux/datatools/library_loader.h"
+#include "bayeux/datatools/logger.h"
+#include "bayeux/datatools/multi_properties.h"
+#include "bayeux/datatools/service_manager.h"
+#include "bayeux/datatools/things.h"
+#include "bayeux/dpp/base_module.h"
+#include "bayeux/dpp/module_manager.h"
+
+namespace FLSimulate {
+
+//! \brief Configuration of the reconstruction pipeline run on simulated events
+//!
+//! It is read from a pipeline script in the flreconstruct format: the
+//! "flreconstruct.plugins" and "flreconstruct.pipeline" sections are used,
+//! together with inline module definitions. Other "flreconstruct::section"
+//! sections (services, variants, ...) are ignored, flsimulate's own being used.
+struct FLSimulateReconstructionConfig {
+  std::string pipelineScript;                 //!< Path to the flreconstruct pipeline script
+  std::string pipelineUrn;                    //!< URN of the reconstruction pipeline
+  std::string pipelineConfig;                 //!< Main definition file of the pipeline modules
+  std::string pipelineModule;                 //!< Top module of the pipeline
+  bool keepStepHits;                          //!< Flag to keep MC step hits in the output
+  datatools::multi_properties userLibConfig;  //!< Plugins to load
+  datatools::multi_properties modulesConfig;  //!< Pipeline modules definitions
+
+  //! Construct and return the default configuration object
+  static FLSimulateReconstructionConfig makeDefault();
+
+  //! Check if a pipeline script is set
+  bool is_active() const { return !pipelineScript.empty(); }
+};
+
+//! Read the pipeline script of the configuration, resolve its modules configuration
+void load_reconstruction_script(FLSimulateReconstructionConfig& config,
+                                const std::string& userProfile,
+                                datatools::logger::priority logLevel);
+
+//! Record the reconstruction configuration in a metadata section
+void store_reconstruction_metadata(const FLSimulateReconstructionConfig& config,
+                                   datatools::properties& section);
+
+//! \brief Reconstruction pipeline applied to each event after its simulation
+class FLSimulateReconstruction {
+ public:
+  //! Load the plugins and initialize the pipeline modules with the simulation services
+  FLSimulateReconstruction(const FLSimulateReconstructionConfig& config,
+                           datatools::service_manager& services);
+
+  //! Reset the modules before the plugins are unloaded
+  ~FLSimulateReconstruction();
+
+  FLSimulateReconstruction(const FLSimulateReconstruction&) = delete;
+  FLSimulateReconstruction& operator=(const FLSimulateReconstruction&) = delete;
+
+  //! Run the pipeline on an event, then drop its step hits if not kept
+  dpp::base_module::process_status process(datatools::things& workItem);
+
+ private:
+  datatools::library_loader libLoader_;                 //!< Plugins loader
+  std::unique_ptr<dpp::module_manager> moduleManager_;  //!< Pipeline modules
+  dpp::base_module* pipeline_ = nullptr;                //!< Top module
+  bool keepStepHits_ = true;                            //!< Flag to keep MC step hits
+};
+
+}  // namespace FLSimulate
+
+#endif  // FLSIMULATERECONSTRUCTION_H
+
+// Local Variables: --
+// mode: c++ --
+// c-file-style: "gnu" --
+// tab-width: 2 --
+// End: --
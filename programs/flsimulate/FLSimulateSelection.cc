@@ -0,0 +1,61 @@
+// Ourselves
+#include "FLSimulateSelection.h"
+
+// Third Party
+// - Bayeux
+#include "bayeux/cuts/i_cut.h"
+#include "bayeux/datatools/exception.h"
+#include "bayeux/datatools/utils.h"
+
+namespace FLSimulate {
+
+void store_selection_metadata(const FLSimulateSelectionConfig& config,
+                              datatools::properties& section) {
+  if (!config.config.empty()) {
+    section.store_path("config", config.config, "Cut manager configuration file");
+  }
+  section.store_string("cut", config.cut, "Cut selecting the saved events");
+}
+
+void store_selection_counters(const FLSimulateCounters& counters, datatools::properties& section) {
+  section.store_integer("numberOfAcceptedEvents", static_cast<int>(counters.accepted),
+                        "Number of simulated events accepted by the cut");
+  section.store_integer("numberOfRejectedEvents", static_cast<int>(counters.rejected),
+                        "Number of simulated events rejected by the cut");
+}
+
+FLSimulateSelection::FLSimulateSelection(const FLSimulateSelectionConfig& config,
+                                         datatools::service_manager& services)
+    : cutManager_(new cuts::cut_manager) {
+  cutManager_->set_service_manager(services);
+  datatools::properties cutManagerConfig;
+  if (!config.config.empty()) {
+    std::string filename = config.config;
+    datatools::fetch_path_with_env(filename);
+    datatools::properties::read_config(filename, cutManagerConfig);
+  }
+  cutManager_->initialize(cutManagerConfig);
+  DT_THROW_IF(!cutManager_->has(config.cut), std::logic_error,
+              "No cut named '" << config.cut << "' is defined");
+  cut_ = &(cutManager_->grab(config.cut));
+}
+
+FLSimulateSelection::~FLSimulateSelection() {
+  if (cutManager_->is_initialized()) {
+    cutManager_->reset();
+  }
+}
+
+bool FLSimulateSelection::accept(const datatools::things& workItem) {
+  cut_->set_user_data(workItem);
+  int status = cut_->process();
+  cut_->reset_user_data();
+  if (status != cuts::SELECTION_ACCEPTED) {
+    counters_.rejected++;
+    return false;
+  }
+  counters_.accepted++;
+  return true;
+}
+
+}  // namespace FLSimulate
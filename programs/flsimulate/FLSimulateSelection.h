@@ -0,0 +1,96 @@
+// FLSimulateSelection.h - Selection of simulated events in flsimulate
+//
+// Copyright (c) 2013 by Ben Morgan <bmorgan.warwick@gmail.com>
+// Copyright (c) 2013 by The University of Warwick
+// Distributed under the OSI-approved BSD 3-Clause License (the "License");
+// see accompanying file License.txt for details.
+//
+// This software is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the License for more information.
+
+#ifndef FLSIMULATESELECTION_H
+#define FLSIMULATESELECTION_H
+
+// Standard Library:
+#include <memory>
+#include <string>
+
+// Third Party
+// - Bayeux
+#include "bayeux/cuts/cut_manager.h"
+#include "bayeux/datatools/properties.h"
+#include "bayeux/datatools/service_manager.h"
+#include "bayeux/datatools/things.h"
+
+namespace FLSimulate {
+
+//! \brief Configuration of the cut applied to simulated events
+struct FLSimulateSelectionConfig {
+  std::string config;  //!< Path to the cut manager configuration file
+  std::string cut;     //!< Name of the cut selecting the events to keep
+
+  //! Check if a cut is set
+  bool is_active() const { return !cut.empty(); }
+};
+
+//! \brief Numbers of simulated events accepted and rejected by the cut
+struct FLSimulateCounters {
+  unsigned int accepted = 0;  //!< Events accepted by the cut
+  unsigned int rejected = 0;  //!< Events rejected by the cut
+
+  //! Add the counters of another run
+  FLSimulateCounters& operator+=(const FLSimulateCounters& other) {
+    accepted += other.accepted;
+    rejected += other.rejected;
+    return *this;
+  }
+};
+
+//! Record the selection configuration in a metadata section
+void store_selection_metadata(const FLSimulateSelectionConfig& config,
+                              datatools::properties& section);
+
+//! Record the selection counters of a run in a metadata section
+void store_selection_counters(const FLSimulateCounters& counters, datatools::properties& section);
+
+//! \brief Cut applied to each event at the end of its simulation
+//!
+//! Rejected events are neither reconstructed nor saved. Any cut registered
+//! in the cut manager may be used, typically a snemo::cut::simulated_data_cut
+//! on the step hits of the "SD" bank, or a combination of such cuts.
+//! The cut sees the event once the simulation module is done with it, so
+//! Geant4 tracking and step hit processing are not saved for rejected events.
+class FLSimulateSelection {
+ public:
+  //! Initialize the cut manager with the simulation services
+  FLSimulateSelection(const FLSimulateSelectionConfig& config,
+                      datatools::service_manager& services);
+
+  //! Reset the cut manager
+  ~FLSimulateSelection();
+
+  FLSimulateSelection(const FLSimulateSelection&) = delete;
+  FLSimulateSelection& operator=(const FLSimulateSelection&) = delete;
+
+  //! Check if an event passes the cut, and count it
+  bool accept(const datatools::things& workItem);
+
+  //! Return the counters of the events seen so far
+  const FLSimulateCounters& counters() const { return counters_; }
+
+ private:
+  std::unique_ptr<cuts::cut_manager> cutManager_;  //!< Cuts
+  cuts::i_cut* cut_ = nullptr;                     //!< Selecting cut
+  FLSimulateCounters counters_;                    //!< Event counters
+};
+
+}  // namespace FLSimulate
+
+#endif  // FLSIMULATESELECTION_H
+
+// Local Variables: --
+// mode: c++ --
+// c-file-style: "gnu" --
+// tab-width: 2 --
+// End: --
@@ -37,7 +37,13 @@
 // along with Falaise.  If not, see <http://www.gnu.org/licenses/>.
 
 // Standard Library
+#include <memory>
 #include <string>
+#include <vector>
+
+// - POSIX
+#include <sys/wait.h>
+#include <unistd.h>
 
 // Third Party
 // - Boost
@@ -75,12 +81,27 @@
 #include "FLSimulateArgs.h"
 // #include "FLSimulateCommandLine.h"
 #include "FLSimulateErrors.h"
+#include "FLSimulateJobs.h"
+#include "FLSimulateReconstruction.h"
+#include "FLSimulateSelection.h"
 
 namespace FLSimulate {
 
 //! Perform simulation using command line args as given
 falaise::exit_code do_flsimulate(int argc, char *argv[]);
 
+//! Set up the services and modules, then simulate numberOfEvents events from firstEvent
+falaise::exit_code do_run(FLSimulateArgs & /*flSimParameters*/, unsigned int /*firstEvent*/,
+                          FLSimulateCounters & /*counters*/);
+
+//! Split the simulation over worker processes, then merge their outputs
+falaise::exit_code do_jobs(FLSimulateArgs & /*flSimParameters*/);
+
+//! Write the final metadata of a run, then merge the outputs of its jobs into the output file
+falaise::exit_code do_merge(const FLSimulateArgs & /*flSimParameters*/,
+                            const std::vector<FLSimulateJob> & /*jobs*/,
+                            bool /*storeJobs*/, const FLSimulateCounters & /*counters*/);
+
 //! Populate the metadata container with various informations classified in several categories
 falaise::exit_code do_metadata(const FLSimulateArgs & /*flSimParameters*/,
                                datatools::multi_properties & /*flSimMetadata*/);
@@ -172,6 +193,14 @@ falaise::exit_code do_metadata(const FLSimulateArgs &flSimParameters,
     }
   }
 
+  if (flSimParameters.selection.is_active()) {
+    // Cuts section:
+    datatools::properties &cuts_props =
+        flSimMetadata.add_section("flsimulate.cuts", "flsimulate::section");
+    cuts_props.set_description("Selection of simulated events");
+    store_selection_metadata(flSimParameters.selection, cuts_props);
+  }
+
   if (flSimParameters.doDigitization) {
     // Digitization section:
     datatools::properties &digitization_props =
@@ -191,6 +220,14 @@ falaise::exit_code do_metadata(const FLSimulateArgs &flSimParameters,
     // }
   }
 
+  if (flSimParameters.reconstruction.is_active()) {
+    // Reconstruction section:
+    datatools::properties &reconstruction_props =
+        flSimMetadata.add_section("flsimulate.reconstruction", "flsimulate::section");
+    reconstruction_props.set_description("Reconstruction setup parameters");
+    store_reconstruction_metadata(flSimParameters.reconstruction, reconstruction_props);
+  }
+
   // Variants section:
   datatools::properties &variants_props =
       flSimMetadata.add_section("flsimulate.variantService", "flsimulate::section");
@@ -285,6 +322,25 @@ falaise::exit_code do_flsimulate(int argc, char *argv[]) {
 
   // - Run:
   falaise::exit_code code = falaise::EXIT_OK;
+  if (flSimParameters.numberOfJobs > 1) {
+    code = do_jobs(flSimParameters);
+  } else {
+    FLSimulateCounters counters;
+    code = do_run(flSimParameters, 0, counters);
+  }
+
+  // Terminate the variant service:
+  if (variantService.is_started()) {
+    variantService.stop();
+  }
+
+  return code;
+}
+
+//----------------------------------------------------------------------
+falaise::exit_code do_run(FLSimulateArgs &flSimParameters, unsigned int firstEvent,
+                          FLSimulateCounters &counters) {
+  falaise::exit_code code = falaise::EXIT_OK;
   try {
     // Setup services:
     datatools::service_manager services("flSimulationServices", "SuperNEMO Simulation Services");
@@ -318,6 +374,18 @@ falaise::exit_code do_flsimulate(int argc, char *argv[]) {
       DT_THROW(std::logic_error, "Digitization is not supported yet!");
     }
 
+    // Cut applied to each event once simulated, i.e. after its step hit processing:
+    std::unique_ptr<FLSimulateSelection> flSelection;
+    if (flSimParameters.selection.is_active()) {
+      flSelection.reset(new FLSimulateSelection(flSimParameters.selection, services));
+    }
+
+    // Reconstruction pipeline, run in-process on each simulated event:
+    std::unique_ptr<FLSimulateReconstruction> flRecPipeline;
+    if (flSimParameters.reconstruction.is_active()) {
+      flRecPipeline.reset(new FLSimulateReconstruction(flSimParameters.reconstruction, services));
+    }
+
     // Output metadata management:
     datatools::multi_properties flSimMetadata("name", "type",
                                               "Metadata associated to a flsimulate run");
@@ -349,13 +417,19 @@ falaise::exit_code do_flsimulate(int argc, char *argv[]) {
     dpp::base_module::process_status status;
 
     for (unsigned int i(0); i < flSimParameters.numberOfEvents; ++i) {
-      workItem.clear();
+      // Banks of the previous event are emptied in place and filled again
+      snedm::resetEvent(workItem);
 
       // Add the event header bank
-      auto &eventHeader = workItem.add<snemo::datamodel::event_header>(
-          snedm::labels::event_header(), "Event Header Bank");
+      const std::string eventHeaderLabel = snedm::labels::event_header();
+      auto &eventHeader =
+          workItem.has(eventHeaderLabel)
+              ? workItem.grab<snemo::datamodel::event_header>(eventHeaderLabel)
+              : workItem.add<snemo::datamodel::event_header>(eventHeaderLabel,
+                                                             "Event Header Bank");
       eventHeader.set_generation(snemo::datamodel::event_header::GENERATION_SIMULATED);
-      datatools::event_id eventID{datatools::event_id::ANY_RUN_NUMBER, static_cast<int>(i)};
+      datatools::event_id eventID{datatools::event_id::ANY_RUN_NUMBER,
+                                  static_cast<int>(firstEvent + i)};
       eventHeader.set_id(eventID);
 
       status = flSimModule.process(workItem);
@@ -364,10 +438,29 @@ falaise::exit_code do_flsimulate(int argc, char *argv[]) {
         code = falaise::EXIT_UNAVAILABLE;
       }
 
-      status = simOutput.process(workItem);
-      if (status != dpp::base_module::PROCESS_OK) {
-        std::cerr << "flsimulate : Output module failed" << std::endl;
-        code = falaise::EXIT_UNAVAILABLE;
+      if (code == falaise::EXIT_OK && flSelection && !flSelection->accept(workItem)) {
+        // Event rejected by the cut, neither reconstructed nor saved
+        continue;
+      }
+
+      if (code == falaise::EXIT_OK && flRecPipeline) {
+        status = flRecPipeline->process(workItem);
+        if (status == dpp::base_module::PROCESS_STOP) {
+          // Event rejected by the pipeline, not saved
+          continue;
+        }
+        if (status != dpp::base_module::PROCESS_OK) {
+          std::cerr << "flsimulate : Reconstruction pipeline failed" << std::endl;
+          code = falaise::EXIT_UNAVAILABLE;
+        }
+      }
+
+      if (code == falaise::EXIT_OK) {
+        status = simOutput.process(workItem);
+        if (status != dpp::base_module::PROCESS_OK) {
+          std::cerr << "flsimulate : Output module failed" << std::endl;
+          code = falaise::EXIT_UNAVAILABLE;
+        }
       }
 
       // Here we will process optional ASB+Digitization+terminal output modules
@@ -376,17 +469,164 @@ falaise::exit_code do_flsimulate(int argc, char *argv[]) {
         break;
       }
     }
+    if (flSelection) {
+      counters = flSelection->counters();
+      DT_LOG_NOTICE(flSimParameters.logLevel,
+                    "Events accepted by the cut = " << counters.accepted
+                                                    << ", rejected = " << counters.rejected);
+      // The embedded metadata went out with the output file header, before
+      // the counters were known, but the metadata file can be completed:
+      if (!flSimParameters.outputMetadataFile.empty()) {
+        store_selection_counters(counters, flSimMetadata.grab_section("flsimulate.cuts"));
+        std::string fMetadata = flSimParameters.outputMetadataFile;
+        datatools::fetch_path_with_env(fMetadata);
+        flSimMetadata.write(fMetadata);
+      }
+    }
   } catch (std::exception &e) {
     std::cerr << "flsimulate : Setup/run of simulation threw exception" << std::endl;
     std::cerr << e.what() << std::endl;
     code = falaise::EXIT_UNAVAILABLE;
   }
 
-  // Terminate the variant service:
-  if (variantService.is_started()) {
-    variantService.stop();
+  return code;
+}
+
+//----------------------------------------------------------------------
+falaise::exit_code do_jobs(FLSimulateArgs &flSimParameters) {
+  std::vector<FLSimulateJob> jobs;
+  try {
+    FLSimulateSeeds runSeeds = make_run_seeds(flSimParameters.simulationManagerParams);
+    jobs = make_jobs(flSimParameters.numberOfEvents, flSimParameters.numberOfJobs, runSeeds,
+                     flSimParameters.outputFile);
+    flSimParameters.rngSeeding = format_seeds(runSeeds);
+    DT_LOG_DEBUG(flSimParameters.logLevel, "PRNG seeding = " << flSimParameters.rngSeeding);
+  } catch (std::exception &e) {
+    std::cerr << "flsimulate : Seeding of jobs threw exception" << std::endl;
+    std::cerr << e.what() << std::endl;
+    return falaise::EXIT_UNAVAILABLE;
   }
 
+  // Do not let buffered output be written by each worker
+  std::cout.flush();
+  std::clog.flush();
+  std::cerr.flush();
+
+  // Each worker sends its counters back through a pipe
+  std::vector<pid_t> workers;
+  std::vector<int> countersPipes;
+  for (const FLSimulateJob &job : jobs) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+      std::cerr << "flsimulate : Cannot start job " << job.index << std::endl;
+      break;
+    }
+    pid_t pid = fork();
+    if (pid < 0) {
+      std::cerr << "flsimulate : Cannot start job " << job.index << std::endl;
+      close(fds[0]);
+      close(fds[1]);
+      break;
+    }
+    if (pid == 0) {
+      close(fds[0]);
+      // Worker: simulate its range of events with its explicit seeds
+      FLSimulateArgs jobParameters = flSimParameters;
+      jobParameters.numberOfEvents = job.numberOfEvents;
+      jobParameters.outputFile = job.outputFile;
+      jobParameters.outputMetadataFile = "";
+      jobParameters.embeddedMetadata = false;
+      mctools::g4::manager_parameters &g4Parameters = jobParameters.simulationManagerParams;
+      g4Parameters.input_prng_seeds_file = "";
+      g4Parameters.eg_seed = job.seeds.at("EG");
+      g4Parameters.mgr_seed = job.seeds.at("MGR");
+      g4Parameters.shpf_seed = job.seeds.at("SHPF");
+      g4Parameters.vg_seed = job.seeds.at("VG");
+      if (!g4Parameters.output_prng_seeds_file.empty() && jobs.size() > 1) {
+        g4Parameters.output_prng_seeds_file += ".job" + std::to_string(job.index);
+      }
+      FLSimulateCounters jobCounters;
+      falaise::exit_code jobCode = do_run(jobParameters, job.firstEvent, jobCounters);
+      if (write(fds[1], &jobCounters, sizeof(jobCounters)) != sizeof(jobCounters)) {
+        jobCode = falaise::EXIT_UNAVAILABLE;
+      }
+      close(fds[1]);
+      std::cout.flush();
+      std::clog.flush();
+      std::cerr.flush();
+      // Leave without running the parent's exit handlers
+      _exit(jobCode);
+    }
+    close(fds[1]);
+    workers.push_back(pid);
+    countersPipes.push_back(fds[0]);
+  }
+
+  falaise::exit_code code = falaise::EXIT_OK;
+  if (workers.size() != jobs.size()) {
+    code = falaise::EXIT_UNAVAILABLE;
+  }
+  FLSimulateCounters counters;
+  for (std::size_t k = 0; k < workers.size(); ++k) {
+    FLSimulateCounters jobCounters;
+    bool hasCounters =
+        read(countersPipes[k], &jobCounters, sizeof(jobCounters)) == sizeof(jobCounters);
+    close(countersPipes[k]);
+    int status = 0;
+    if (waitpid(workers[k], &status, 0) < 0 || !WIFEXITED(status) ||
+        WEXITSTATUS(status) != falaise::EXIT_OK || !hasCounters) {
+      std::cerr << "flsimulate : Job " << k << " failed" << std::endl;
+      code = falaise::EXIT_UNAVAILABLE;
+    }
+    counters += jobCounters;
+  }
+
+  if (code == falaise::EXIT_OK) {
+    // Output metadata, with the seeds of each worker:
+    code = do_merge(flSimParameters, jobs, true, counters);
+  }
+
+  // Worker outputs are temporary, whatever the outcome
+  for (const FLSimulateJob &job : jobs) {
+    boost::system::error_code ec;
+    boost::filesystem::remove(job.outputFile, ec);
+  }
+  return code;
+}
+
+//----------------------------------------------------------------------
+falaise::exit_code do_merge(const FLSimulateArgs &flSimParameters,
+                            const std::vector<FLSimulateJob> &jobs, bool storeJobs,
+                            const FLSimulateCounters &counters) {
+  falaise::exit_code code = falaise::EXIT_OK;
+  try {
+    // Output metadata management:
+    datatools::multi_properties flSimMetadata("name", "type",
+                                              "Metadata associated to a flsimulate run");
+    do_metadata(flSimParameters, flSimMetadata);
+    if (storeJobs && flSimParameters.doSimulation) {
+      store_jobs_metadata(jobs, flSimMetadata.grab_section("flsimulate.simulation"));
+    }
+    if (flSimParameters.selection.is_active()) {
+      store_selection_counters(counters, flSimMetadata.grab_section("flsimulate.cuts"));
+    }
+    if (datatools::logger::is_debug(flSimParameters.logLevel)) {
+      flSimMetadata.tree_dump(std::cerr, "Simulation metadata: ", "[debug]: ");
+    }
+
+    if (!flSimParameters.outputMetadataFile.empty()) {
+      std::string fMetadata = flSimParameters.outputMetadataFile;
+      datatools::fetch_path_with_env(fMetadata);
+      flSimMetadata.write(fMetadata);
+    }
+
+    code = merge_job_outputs(jobs, flSimParameters.outputFile,
+                             flSimParameters.embeddedMetadata ? &flSimMetadata : nullptr);
+  } catch (std::exception &e) {
+    std::cerr << "flsimulate : Merge of job outputs threw exception" << std::endl;
+    std::cerr << e.what() << std::endl;
+    code = falaise::EXIT_UNAVAILABLE;
+  }
   return code;
 }
 
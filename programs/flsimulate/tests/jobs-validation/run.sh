@@ -0,0 +1,137 @@
+#!/bin/bash
+#
+# Test of the multi-process mode of flsimulate
+# ============================================
+#
+# Simulate events over two worker processes and check that:
+#
+#  * the merged output file holds the events of the run in order, with
+#    contiguous event numbers starting at 0,
+#  * the metadata file records the first event, number of events and PRNG
+#    seeds of each worker.
+#
+# flsimulate must be in the PATH:
+#
+#  $ ./run.sh --cfg-dir /path/to/flsimulate/tests [--work-dir /tmp/${USER}/fltest-jobs]
+#
+
+label="run-jobs-validation"
+work_dir=""
+cfg_dir=""
+n_jobs=2
+
+function parse_cl_opts()
+{
+    while [ -n "$1" ]; do
+	local opt="$1"
+	if [ "${opt}" == "--work-dir" ]; then
+	    shift 1
+	    work_dir="$1"
+	elif [ "${opt}" == "--cfg-dir" ]; then
+	    shift 1
+	    cfg_dir="$1"
+	else
+	    echo >&2 "[error] Invalid command line option '${opt}'! Abort!"
+	    return 1
+	fi
+	shift 1
+    done
+    return 0
+}
+
+parse_cl_opts $@
+if [ $? -ne 0 ]; then
+    exit 1
+fi
+
+if [ -z "${work_dir}" ]; then
+    work_dir="_work.d"
+fi
+if [ -z "${cfg_dir}" ]; then
+    cfg_dir="."
+fi
+
+#########################################
+export FLWORKDIR="${work_dir}/${label}"
+
+function my_exit()
+{
+    local error_code="$1"
+    shift 1
+    local error_msg="$@"
+    if [ -n "${error_msg}" ]; then
+	echo >&2 "[error] $@"
+    fi
+    if [ -d ${FLWORKDIR} ]; then
+	rm -fr ${FLWORKDIR}
+    fi
+    exit ${error_code}
+}
+
+which flsimulate > /dev/null 2>&1
+if [ $? -ne 0 ]; then
+    my_exit 1 "flsimulate is not available! Abort!"
+fi
+
+if [ ! -d ${FLWORKDIR} ]; then
+    mkdir -p ${FLWORKDIR}
+fi
+
+conf="${cfg_dir}/flsimulate-script-inlineseeds.conf"
+n_events=$(grep "^numberOfEvents" ${conf} | sed -e "s@.*=[[:space:]]*@@")
+
+echo >&2 "[info] Running flsimulate over ${n_jobs} workers..."
+flsimulate -j ${n_jobs} -c ${conf} \
+	   -m ${FLWORKDIR}/jobs.meta \
+	   -o ${FLWORKDIR}/jobs.xml > ${FLWORKDIR}/flsim.log 2>&1
+if [ $? -ne 0 ]; then
+    cat >&2 ${FLWORKDIR}/flsim.log
+    my_exit 1 "flsimulate failed! Abort!"
+fi
+
+# Event numbers of the merged file must run from 0 to n_events-1, in order:
+grep -o "<event_number>[0-9-]*</event_number>" ${FLWORKDIR}/jobs.xml | \
+    sed -e "s@<[/a-z_]*>@@g" > ${FLWORKDIR}/event_numbers.data
+seq 0 $((n_events - 1)) > ${FLWORKDIR}/expected_event_numbers.data
+diff ${FLWORKDIR}/expected_event_numbers.data ${FLWORKDIR}/event_numbers.data >&2
+if [ $? -ne 0 ]; then
+    my_exit 1 "merged event numbers are not contiguous from 0 to $((n_events - 1))!"
+fi
+
+# Each worker must have its own entries in the metadata:
+grep -q "^numberOfJobs[[:space:]]*:[[:space:]]*integer[[:space:]]*=[[:space:]]*${n_jobs}$" \
+     ${FLWORKDIR}/jobs.meta
+if [ $? -ne 0 ]; then
+    my_exit 1 "metadata does not record ${n_jobs} jobs!"
+fi
+first_event=0
+for k in $(seq 0 $((n_jobs - 1))); do
+    for key in firstEvent numberOfEvents rngSeeding; do
+	grep -q "^jobs\.${k}\.${key}[[:space:]]*:" ${FLWORKDIR}/jobs.meta
+	if [ $? -ne 0 ]; then
+	    my_exit 1 "metadata misses 'jobs.${k}.${key}'!"
+	fi
+    done
+    grep -q "^jobs\.${k}\.firstEvent[[:space:]]*:.*=[[:space:]]*${first_event}$" \
+	 ${FLWORKDIR}/jobs.meta
+    if [ $? -ne 0 ]; then
+	my_exit 1 "job ${k} does not start at event ${first_event}!"
+    fi
+    n_job_events=$(grep "^jobs\.${k}\.numberOfEvents" ${FLWORKDIR}/jobs.meta | \
+			  sed -e "s@.*=[[:space:]]*@@")
+    first_event=$((first_event + n_job_events))
+done
+if [ ${first_event} -ne ${n_events} ]; then
+    my_exit 1 "jobs simulate ${first_event} events for ${n_events}!"
+fi
+
+# Workers must not share their seeds:
+n_seedings=$(grep "^jobs\.[0-9]*\.rngSeeding" ${FLWORKDIR}/jobs.meta | \
+		 sed -e "s@^jobs\.[0-9]*\.@@" | sort -u | wc -l)
+if [ ${n_seedings} -ne ${n_jobs} ]; then
+    my_exit 1 "workers share their PRNG seeds!"
+fi
+
+my_exit 0
+
+# end
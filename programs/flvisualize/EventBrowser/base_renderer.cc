@@ -36,6 +36,8 @@
 #include <geomtools/id_mgr.h>
 #include <geomtools/line_3d.h>
 
+#include <TLatex.h>
+#include <TMarker3DBox.h>
 #include <TObjArray.h>
 #include <TPolyLine3D.h>
 #include <TPolyMarker3D.h>
@@ -46,6 +48,33 @@ namespace visualization {
 
 namespace view {
 
+namespace {
+
+/// Set the points of a polyline, all of them
+void set_polyline_points(TPolyLine3D& polyline_, const geomtools::polyline_type& points_,
+                         const bool convert_) {
+  size_t idx = 0;
+  for (const auto& a_point : points_) {
+    geomtools::vector_3d new_point = a_point;
+    if (convert_) {
+      detector::detector_manager::get_instance().compute_world_coordinates(a_point, new_point);
+    }
+    polyline_.SetPoint(idx++, new_point.x(), new_point.y(), new_point.z());
+  }
+}
+
+/// Set the point of a single point marker
+void set_polymarker_point(TPolyMarker3D& polymarker_, const geomtools::vector_3d& point_,
+                          const bool convert_) {
+  geomtools::vector_3d new_point = point_;
+  if (convert_) {
+    detector::detector_manager::get_instance().compute_world_coordinates(point_, new_point);
+  }
+  polymarker_.SetPoint(0, new_point.x(), new_point.y(), new_point.z());
+}
+
+}  // namespace
+
 bool base_renderer::is_initialized() const { return _initialized; }
 
 bool base_renderer::has_server() const { return _server != nullptr; }
@@ -66,6 +95,7 @@ base_renderer::base_renderer() {
   _server = nullptr;
   _objects = nullptr;
   _text_objects = nullptr;
+  _current_layer_ = MC_TRUTH_LAYER;
 }
 
 // dtor:
@@ -87,16 +117,91 @@ void base_renderer::clear() {
     volume_hit->clear();
   }
   _highlighted_geom_id.clear();
+  for (auto& a_layer : _layers_) {
+    a_layer.pool.undraw();
+  }
 }
 
 void base_renderer::reset() {
   DT_THROW_IF(!is_initialized(), std::logic_error, "Not initialized !");
   this->clear();
+  for (auto& a_layer : _layers_) {
+    a_layer.pool.clear();
+    a_layer.highlights.clear();
+  }
+  _current_layer_ = MC_TRUTH_LAYER;
   _initialized = false;
 }
 
+void base_renderer::begin_layer(const layer_type layer_, const bool keep_) {
+  _current_layer_ = layer_;
+  if (!keep_) {
+    layer_record& a_layer = _layers_[layer_];
+    a_layer.pool.release();
+    a_layer.highlights.clear();
+  }
+}
+
+void base_renderer::restore_layer(const layer_type layer_) {
+  _current_layer_ = layer_;
+  const layer_record& a_layer = _layers_[layer_];
+  for (TObject* a_primitive : a_layer.pool.get_primitives()) {
+    _objects->Add(a_primitive);
+  }
+  for (const highlight_record& a_highlight : a_layer.highlights) {
+    this->_highlight_geom_id_(a_highlight.gid, a_highlight.color, a_highlight.text);
+  }
+}
+
+TPolyLine3D* base_renderer::add_polyline(const size_t npoints_) {
+  TPolyLine3D* polyline = _layers_[_current_layer_].pool.make_polyline(npoints_);
+  _objects->Add(polyline);
+  return polyline;
+}
+
+TPolyLine3D* base_renderer::add_polyline(const geomtools::polyline_type& polyline_,
+                                         const bool convert_) {
+  TPolyLine3D* polyline = this->add_polyline(polyline_.size());
+  set_polyline_points(*polyline, polyline_, convert_);
+  return polyline;
+}
+
+TPolyLine3D* base_renderer::add_track(const geomtools::i_wires_3d_rendering& iw3dr_,
+                                      const bool convert_) {
+  geomtools::wires_type wires;
+  iw3dr_.generate_wires_self(wires);
+  DT_THROW_IF(wires.size() > 1, std::logic_error, "Track must be defined by only one polyline !");
+  return this->add_polyline(wires.back(), convert_);
+}
+
+TPolyMarker3D* base_renderer::add_polymarker(const geomtools::vector_3d& point_,
+                                             const bool convert_) {
+  TPolyMarker3D* marker = _layers_[_current_layer_].pool.make_polymarker(1);
+  _objects->Add(marker);
+  set_polymarker_point(*marker, point_, convert_);
+  return marker;
+}
+
+TMarker3DBox* base_renderer::add_box() {
+  TMarker3DBox* box = _layers_[_current_layer_].pool.make_box();
+  _objects->Add(box);
+  return box;
+}
+
+TLatex* base_renderer::add_latex() {
+  TLatex* latex = _layers_[_current_layer_].pool.make_latex();
+  _objects->Add(latex);
+  return latex;
+}
+
 void base_renderer::highlight_geom_id(const geomtools::geom_id& gid_, const size_t color_,
                                       const std::string& text_) {
+  _layers_[_current_layer_].highlights.push_back(highlight_record{gid_, color_, text_});
+  this->_highlight_geom_id_(gid_, color_, text_);
+}
+
+void base_renderer::_highlight_geom_id_(const geomtools::geom_id& gid_, const size_t color_,
+                                        const std::string& text_) {
   DT_LOG_DEBUG(options_manager::get_instance().get_logging_priority(),
                "Geom id '" << gid_ << "' is hit");
 
@@ -139,25 +244,14 @@ void base_renderer::highlight_geom_id(const geomtools::geom_id& gid_, const size
 TPolyMarker3D* base_renderer::make_polymarker(const geomtools::vector_3d& point_,
                                               const bool convert_) {
   auto* marker = new TPolyMarker3D;
-  geomtools::vector_3d new_point = point_;
-  if (convert_) {
-    detector::detector_manager::get_instance().compute_world_coordinates(point_, new_point);
-  }
-  marker->SetPoint(0, new_point.x(), new_point.y(), new_point.z());
+  set_polymarker_point(*marker, point_, convert_);
   return marker;
 }
 
 TPolyLine3D* base_renderer::make_polyline(const geomtools::polyline_type& polyline_,
                                           const bool convert_) {
   auto* polyline = new TPolyLine3D;
-  size_t idx = 0;
-  for (const auto& a_point : polyline_) {
-    geomtools::vector_3d new_point = a_point;
-    if (convert_) {
-      detector::detector_manager::get_instance().compute_world_coordinates(a_point, new_point);
-    }
-    polyline->SetPoint(idx++, new_point.x(), new_point.y(), new_point.z());
-  }
+  set_polyline_points(*polyline, polyline_, convert_);
   return polyline;
 }
 
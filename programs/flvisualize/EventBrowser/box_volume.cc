@@ -47,10 +47,7 @@ box_volume::box_volume(const std::string &name_, const std::string &category_)
 box_volume::~box_volume() = default;
 
 void box_volume::_construct(const geomtools::i_shape_3d &shape_3d_) {
-  const auto &mbox = dynamic_cast<const geomtools::box &>(shape_3d_);
-  _length_ = mbox.get_x();
-  _width_ = mbox.get_y();
-  _height_ = mbox.get_z();
+  this->_set_dimensions(shape_3d_);
 
   auto *material = new TGeoMaterial("Dummy");
   auto *medium = new TGeoMedium("Dummy", 1, material);
@@ -59,6 +56,13 @@ void box_volume::_construct(const geomtools::i_shape_3d &shape_3d_) {
       gGeoManager->MakeBox(_name.c_str(), medium, _length_ / 2., _width_ / 2., _height_ / 2.);
 }
 
+void box_volume::_set_dimensions(const geomtools::i_shape_3d &shape_3d_) {
+  const auto &mbox = dynamic_cast<const geomtools::box &>(shape_3d_);
+  _length_ = mbox.get_x();
+  _width_ = mbox.get_y();
+  _height_ = mbox.get_z();
+}
+
 void box_volume::tree_dump(std::ostream &out_, const std::string &title_,
                            const std::string &indent_, bool inherit_) const {
   std::string indent;
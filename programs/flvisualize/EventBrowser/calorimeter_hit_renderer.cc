@@ -80,8 +80,7 @@ void calorimeter_hit_renderer::push_simulated_hits(const std::string& hit_catego
 
     const geomtools::vector_3d pos = 0.5 * (pstart + pstop);
 
-    auto* step_3d = new TMarker3DBox;
-    _objects->Add(step_3d);
+    TMarker3DBox* step_3d = this->add_box();
     step_3d->SetPosition(pos.x(), pos.y(), pos.z());
     step_3d->SetSize(dx, dy, dz);
     step_3d->SetLineColor(kRed);
@@ -97,16 +96,12 @@ void calorimeter_hit_renderer::push_simulated_hits(const std::string& hit_catego
     size_t line_width = style_manager::get_instance().get_mc_line_width();
     if (a_hit.get_auxiliaries().has_flag(browser_tracks::HIGHLIGHT_FLAG)) {
       line_width = 3;
-      auto* mark1 = new TPolyMarker3D;
-      _objects->Add(mark1);
+      TPolyMarker3D* mark1 = this->add_polymarker(pstart);
       mark1->SetMarkerColor(kRed);
       mark1->SetMarkerStyle(kCircle);
-      mark1->SetPoint(0, pstart.x(), pstart.y(), pstart.z());
-      auto* mark2 = new TPolyMarker3D;
-      _objects->Add(mark2);
+      TPolyMarker3D* mark2 = this->add_polymarker(pstop);
       mark2->SetMarkerColor(kRed);
       mark2->SetMarkerStyle(kCircle);
-      mark2->SetPoint(0, pstop.x(), pstop.y(), pstop.z());
     }
     // hit_properties.update(browser_tracks::HIGHLIGHT_FLAG, false);
     step_3d->SetLineWidth(line_width);
@@ -47,11 +47,7 @@ cylinder_volume::cylinder_volume(const std::string &name_, const std::string &ca
 cylinder_volume::~cylinder_volume() = default;
 
 void cylinder_volume::_construct(const geomtools::i_shape_3d &shape_3d_) {
-  const auto &mcylinder = dynamic_cast<const geomtools::cylinder &>(shape_3d_);
-
-  _inner_radius_ = 0.0;
-  _outer_radius_ = mcylinder.get_radius();
-  _height_ = mcylinder.get_z();
+  this->_set_dimensions(shape_3d_);
 
   auto *material = new TGeoMaterial("Dummy");
   auto *medium = new TGeoMedium("Dummy", 1, material);
@@ -60,6 +56,14 @@ void cylinder_volume::_construct(const geomtools::i_shape_3d &shape_3d_) {
       gGeoManager->MakeTube(_name.c_str(), medium, _inner_radius_, _outer_radius_, _height_ / 2.);
 }
 
+void cylinder_volume::_set_dimensions(const geomtools::i_shape_3d &shape_3d_) {
+  const auto &mcylinder = dynamic_cast<const geomtools::cylinder &>(shape_3d_);
+
+  _inner_radius_ = 0.0;
+  _outer_radius_ = mcylinder.get_radius();
+  _height_ = mcylinder.get_z();
+}
+
 void cylinder_volume::tree_dump(std::ostream &out_, const std::string &title_,
                                 const std::string &indent_, bool inherit_) const {
   std::string indent;
@@ -42,8 +42,9 @@ default_draw_manager::default_draw_manager(const io::event_server* server_) {
 
   _objects_ = new TObjArray(1000);
   _text_objects_ = new TObjArray(10);
-  _objects_->SetOwner(true);
+  _objects_->SetOwner(false);
   _text_objects_->SetOwner(true);
+  _displayed_ = false;
 
   // Initialize renderers
   _calorimeter_hit_renderer_.initialize(_server_, _objects_, _text_objects_);
@@ -64,6 +65,13 @@ void default_draw_manager::update() {
     return;
   }
 
+  // Without a clear since the last update, objects are added to the
+  // displayed ones
+  const bool accumulate = _displayed_;
+  _displayed_ = true;
+  _calorimeter_hit_renderer_.begin_layer(base_renderer::MC_TRUTH_LAYER, accumulate);
+  _visual_track_renderer_.begin_layer(base_renderer::MC_TRUTH_LAYER, accumulate);
+
   // Add 'simulated_data' objects:
   if (_server_->get_event().has(io::SD_LABEL)) {
     this->_add_simulated_data();
@@ -94,8 +102,9 @@ void default_draw_manager::clear() {
   _calorimeter_hit_renderer_.clear();
   _visual_track_renderer_.clear();
 
-  _objects_->Delete();
+  _objects_->Clear();
   _text_objects_->Delete();
+  _displayed_ = false;
 }
 
 /***************************************************
@@ -131,14 +140,12 @@ void default_draw_manager::_add_simulated_vertex_() {
 
   const geomtools::vector_3d& sim_vertex = sim_data.get_vertex();
   {
-    TPolyMarker3D* vertex_3d = base_renderer::make_polymarker(sim_vertex);
-    _objects_->Add(vertex_3d);
+    TPolyMarker3D* vertex_3d = _visual_track_renderer_.add_polymarker(sim_vertex);
     vertex_3d->SetMarkerColor(kViolet);
     vertex_3d->SetMarkerStyle(kPlus);
   }
   if (sim_data.get_primary_event().get_auxiliaries().has_flag(browser_tracks::HIGHLIGHT_FLAG)) {
-    TPolyMarker3D* vertex_3d = base_renderer::make_polymarker(sim_vertex);
-    _objects_->Add(vertex_3d);
+    TPolyMarker3D* vertex_3d = _visual_track_renderer_.add_polymarker(sim_vertex);
     vertex_3d->SetMarkerColor(kViolet);
     vertex_3d->SetMarkerStyle(kCircle);
   }
@@ -59,6 +59,9 @@ class box_volume : public i_root_volume {
   /// Construct the box volume
   virtual void _construct(const geomtools::i_shape_3d& shape_3d_);
 
+  /// Set the box dimensions
+  virtual void _set_dimensions(const geomtools::i_shape_3d& shape_3d_);
+
  private:
   double _length_;  //<! Box length
   double _width_;   //<! Box width
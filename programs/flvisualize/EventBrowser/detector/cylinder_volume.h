@@ -60,6 +60,9 @@ class cylinder_volume : public i_root_volume {
   /// Construct the cylinder volume
   virtual void _construct(const geomtools::i_shape_3d& shape_3d_);
 
+  /// Set the cylinder dimensions
+  virtual void _set_dimensions(const geomtools::i_shape_3d& shape_3d_);
+
  private:
   double _inner_radius_;  //<! Cylinder inner radius
   double _outer_radius_;  //<! Cylinder outer radius
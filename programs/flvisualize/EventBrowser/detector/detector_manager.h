@@ -45,6 +45,10 @@
 // This project:
 #include <EventBrowser/utils/singleton.h>
 
+namespace datatools {
+class properties;
+}
+
 namespace geomtools {
 class manager;
 class i_shape_3d;
@@ -182,6 +186,19 @@ class detector_manager : public utils::singleton<detector_manager>,
   /// Read geometry detector configuration
   void _read_detector_config_();
 
+  /// Compute the key identifying the ROOT geometry built from a configuration
+  ///
+  /// It covers the geometry files (with the category lists and the model files
+  /// of the geometry list) and the active variant profile.
+  std::string _compute_cache_key_(const datatools::properties& gmanager_config_,
+                                  const std::vector<std::string>& only_categories_) const;
+
+  /// Load the ROOT geometry from the cache file if it matches the cache key
+  bool _load_cache_();
+
+  /// Store the ROOT geometry with its key in the cache file
+  void _store_cache_() const;
+
   /// Set volume categories with their visibility attributes
   void _set_categories_(std::vector<std::string>& only_categories_) const;
 
@@ -212,6 +229,10 @@ class detector_manager : public utils::singleton<detector_manager>,
 
   const geomtools::placement* _module_placement_;  //!< Module placement
 
+  std::string _cache_file_;  //!< ROOT geometry cache file
+  std::string _cache_key_;   //!< Key of the ROOT geometry, empty if not cached
+  bool _from_cache_;         //!< ROOT geometry loaded from the cache file
+
   TGeoVolume* _world_volume_;  //!< ROOT world volume
   double _world_length_;       //!< World length
   double _world_width_;        //!< World width
@@ -61,6 +61,9 @@ class i_root_volume : public i_volume {
   /// Virtual method to initialize the volume
   virtual void initialize(const geomtools::geom_info& ginfo_);
 
+  /// Initialize the volume with an already constructed ROOT volume
+  void attach(const geomtools::geom_info& ginfo_, TGeoVolume* geo_volume_);
+
   /// Update method to refresh volume properties
   virtual void update();
 
@@ -93,6 +96,9 @@ class i_root_volume : public i_volume {
   /// Implement dedicated construct method
   virtual void _construct(const geomtools::i_shape_3d& shape_3d_) = 0;
 
+  /// Set the dimensions of the volume from its shape
+  virtual void _set_dimensions(const geomtools::i_shape_3d& shape_3d_);
+
  protected:
   bool _initialized;        //<! Initialization flag
   TGeoVolume* _geo_volume;  //<! ROOT geometry volume
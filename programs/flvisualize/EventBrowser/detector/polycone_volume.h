@@ -59,6 +59,9 @@ class polycone_volume : public i_root_volume {
   /// Construct the polycone volume
   virtual void _construct(const geomtools::i_shape_3d& shape_3d_);
 
+  /// Set the polycone dimensions
+  virtual void _set_dimensions(const geomtools::i_shape_3d& shape_3d_);
+
  private:
   size_t _nbr_z_section_;  //<! Number of z-section to describe the polycone
 };
@@ -60,6 +60,9 @@ class sphere_volume : public i_root_volume {
   /// Construct the sphere volume
   virtual void _construct(const geomtools::i_shape_3d& shape_3d_);
 
+  /// Set the sphere dimensions
+  virtual void _set_dimensions(const geomtools::i_shape_3d& shape_3d_);
+
  private:
   double _inner_radius_;  //<! Sphere inner radius
   double _outer_radius_;  //<! Sphere outer radius
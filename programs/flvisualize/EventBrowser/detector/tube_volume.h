@@ -60,6 +60,9 @@ class tube_volume : public i_root_volume {
   /// Construct the tube volume
   virtual void _construct(const geomtools::i_shape_3d& shape_3d_);
 
+  /// Set the tube dimensions
+  virtual void _set_dimensions(const geomtools::i_shape_3d& shape_3d_);
+
  private:
   double _inner_radius_;  //<! Inner radius
   double _outer_radius_;  //<! Outer radius
@@ -36,6 +36,11 @@
 
 #include <EventBrowser/utils/root_utilities.h>
 
+// - Bayeux/datatools:
+#include <bayeux/datatools/configuration/variant_repository.h>
+#include <bayeux/datatools/kernel.h>
+#include <bayeux/datatools/properties.h>
+#include <bayeux/datatools/utils.h>
 // - Bayeux/geomtools:
 #include <bayeux/geomtools/box.h>
 #include <bayeux/geomtools/manager.h>
@@ -43,15 +48,26 @@
 
 // - Falaise:
 #include <falaise/resource.h>
+#include <falaise/version.h>
 
 // Standard libraries:
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <set>
 #include <sstream>
 #include <string>
+#include <vector>
 
 // ROOT
 #include <TError.h>
+#include <TFile.h>
 #include <TGeoManager.h>
 #include <TGeoMatrix.h>
+#include <TNamed.h>
+#include <TROOT.h>
+#include <TSystem.h>
 
 namespace snemo {
 
@@ -59,6 +75,23 @@ namespace visualization {
 
 namespace detector {
 
+namespace {
+
+/// Name of the geometry cache file entry holding the cache key
+const char *const cache_key_name = "flvisualize_geometry_cache_key";
+
+/// Return the 64-bit FNV-1a hash of a text, which is the same from one run to the other
+uint64_t stable_hash(const std::string &text_) {
+  uint64_t hash = 14695981039346656037ULL;
+  for (const char a_char : text_) {
+    hash ^= static_cast<unsigned char>(a_char);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+}  // namespace
+
 bool detector_manager::is_initialized() const { return _initialized_; }
 
 bool detector_manager::is_constructed() const { return _constructed_; }
@@ -146,6 +179,8 @@ detector_manager::detector_manager() {
   _has_external_geometry_manager_ = false;
   _geo_manager_config_file_ = "";
   _geo_manager_ = nullptr;
+  _module_placement_ = nullptr;
+  _from_cache_ = false;
   _world_volume_ = nullptr;
   _world_length_ = 0.0;
   _world_width_ = 0.0;
@@ -216,6 +251,10 @@ void detector_manager::reset() {
   _volumes_.clear();
   _special_volume_name_.clear();
 
+  _cache_file_.clear();
+  _cache_key_.clear();
+  _from_cache_ = false;
+
   _constructed_ = false;
   _initialized_ = false;
 }
@@ -313,6 +352,12 @@ void detector_manager::_at_init_(const std::string &geo_manager_config_file_) {
   // Instantiate TGeoManager here and then use static pointer gGeoManager
   new TGeoManager("ROOT TGeo Manager", "ROOT TGeo Manager");
 
+  // Setting the ROOT geometry cache file, if any
+  _cache_file_ = view::options_manager::get_instance().get_geometry_cache_file();
+  if (!_cache_file_.empty()) {
+    datatools::fetch_path_with_env(_cache_file_);
+  }
+
   // Setting geometry manager file
   if (has_external_geometry_manager()) {
     _setup_label_name_ = _geo_manager_->get_setup_label();
@@ -352,19 +397,27 @@ void detector_manager::_at_construct_() {
   // set maximum dimension to world volume
   this->_set_world_dimensions_();
 
-  // building world volume by ROOT
-  _world_volume_ = gGeoManager->MakeBox("World Volume", nullptr, _world_length_ / 2.,
-                                        _world_width_ / 2., _world_height_ / 2.);
-  _world_volume_->SetVisibility(false);
+  if (_from_cache_) {
+    // the cached geometry is already placed and closed
+    _world_volume_ = gGeoManager->GetTopVolume();
+  } else {
+    // building world volume by ROOT
+    _world_volume_ = gGeoManager->MakeBox("World Volume", nullptr, _world_length_ / 2.,
+                                          _world_width_ / 2., _world_height_ / 2.);
+    _world_volume_->SetVisibility(false);
+
+    // setting world volume for ROOT Geo Manager
+    gGeoManager->SetTopVolume(_world_volume_);
 
-  // setting world volume for ROOT Geo Manager
-  gGeoManager->SetTopVolume(_world_volume_);
+    // adding each volume to the world one
+    this->_add_volumes_();
 
-  // adding each volume to the world one
-  this->_add_volumes_();
+    // closing geometry to not to modify it later
+    gGeoManager->CloseGeometry();
 
-  // closing geometry to not to modify it later
-  gGeoManager->CloseGeometry();
+    // saving it for the next runs
+    this->_store_cache_();
+  }
 
   if (view::options_manager::get_instance().get_logging_priority() >=
       datatools::logger::PRIO_DEBUG) {
@@ -462,6 +515,14 @@ void detector_manager::_read_detector_config_() {
     }
   }
 
+  // Reuse the ROOT geometry built by a previous run with the same configuration
+  _cache_key_.clear();
+  _from_cache_ = false;
+  if (!has_external_geometry_manager() && !_cache_file_.empty()) {
+    _cache_key_ = this->_compute_cache_key_(gmanager_config, only_categories);
+    _from_cache_ = this->_load_cache_();
+  }
+
   for (std::vector<std::string>::const_iterator it_category = only_categories.begin();
        it_category != only_categories.end(); ++it_category) {
     const std::string &volume_category_name = *it_category;
@@ -506,6 +567,150 @@ void detector_manager::_read_detector_config_() {
   }    // end of enabled categories
 }
 
+std::string detector_manager::_compute_cache_key_(
+    const datatools::properties &gmanager_config_,
+    const std::vector<std::string> &only_categories_) const {
+  std::ostringstream key;
+  key << "falaise " << falaise::version::get_version() << std::endl;
+  key << "root " << gROOT->GetVersion() << std::endl;
+  key << "geometry " << _geo_manager_config_file_ << std::endl;
+  gmanager_config_.tree_dump(key);
+  for (const auto &a_category : only_categories_) {
+    key << "category " << a_category << std::endl;
+  }
+  for (const auto &a_name : _special_volume_name_) {
+    key << "special " << a_name << std::endl;
+  }
+
+  // Content of the geometry files (models, categories...) given by the configuration
+  std::set<std::string> hashed_files;
+  const auto add_file = [&key, &hashed_files](std::string path_) -> std::string {
+    datatools::fetch_path_with_env(path_);
+    std::ifstream file(path_.c_str());
+    const std::string content((std::istreambuf_iterator<char>(file)),
+                              std::istreambuf_iterator<char>());
+    if (hashed_files.insert(path_).second) {
+      key << "file " << path_ << std::endl << content << std::endl;
+    }
+    return content;
+  };
+  const auto get_paths = [&gmanager_config_](const std::string &key_) {
+    std::vector<std::string> paths;
+    if (gmanager_config_.is_vector(key_)) {
+      gmanager_config_.fetch(key_, paths);
+    } else {
+      paths.push_back(gmanager_config_.fetch_string(key_));
+    }
+    return paths;
+  };
+  for (const auto &a_key : gmanager_config_.keys()) {
+    if (!gmanager_config_.is_explicit_path(a_key)) {
+      continue;
+    }
+    for (const auto &a_path : get_paths(a_key)) {
+      add_file(a_path);
+    }
+  }
+  // - the category lists and model files, even if not flagged as paths
+  for (const std::string a_key : {"id_mgr.categories_list", "id_mgr.categories_lists",
+                                  "factory.geom_files", "factory.geom_list"}) {
+    if (!gmanager_config_.has_key(a_key) || !gmanager_config_.is_string(a_key)) {
+      continue;
+    }
+    for (const auto &a_path : get_paths(a_key)) {
+      const std::string content = add_file(a_path);
+      if (a_key != "factory.geom_list") {
+        continue;
+      }
+      // - the model files listed in the geometry list
+      std::istringstream lines(content);
+      std::string a_line;
+      while (std::getline(lines, a_line)) {
+        std::istringstream words(a_line);
+        std::string a_model_file;
+        words >> a_model_file;
+        if (!a_model_file.empty() && a_model_file[0] != '#') {
+          add_file(a_model_file);
+        }
+      }
+    }
+  }
+
+  // Active variant profile, on which the geometry files may depend
+  if (datatools::kernel::is_instantiated()) {
+    datatools::properties variant_props;
+    datatools::configuration::variant_repository::exporter variant_exporter(
+        variant_props, datatools::configuration::variant_repository::exporter::EXPORT_NOCLEAR);
+    variant_exporter.process(datatools::kernel::instance().get_effective_variant_repository());
+    for (const auto &a_setting : variant_exporter.get_settings()) {
+      key << "variant " << a_setting << std::endl;
+    }
+  }
+
+  std::ostringstream hash;
+  hash << std::hex << stable_hash(key.str());
+  return hash.str();
+}
+
+bool detector_manager::_load_cache_() {
+  if (gSystem->AccessPathName(_cache_file_.c_str())) {
+    DT_LOG_NOTICE(view::options_manager::get_instance().get_logging_priority(),
+                  "No geometry cache file '" << _cache_file_ << "' yet");
+    return false;
+  }
+
+  {
+    std::unique_ptr<TFile> cache_file(TFile::Open(_cache_file_.c_str(), "READ"));
+    if (!cache_file || cache_file->IsZombie()) {
+      DT_LOG_WARNING(view::options_manager::get_instance().get_logging_priority(),
+                     "Geometry cache file '" << _cache_file_ << "' cannot be read !");
+      return false;
+    }
+    std::unique_ptr<TNamed> cache_key(dynamic_cast<TNamed *>(cache_file->Get(cache_key_name)));
+    if (!cache_key || _cache_key_ != cache_key->GetTitle()) {
+      DT_LOG_NOTICE(view::options_manager::get_instance().get_logging_priority(),
+                    "Geometry cache file '" << _cache_file_ << "' is out of date");
+      return false;
+    }
+  }
+
+  // Replace the empty ROOT geometry by the cached one
+  delete gGeoManager;
+  if (TGeoManager::Import(_cache_file_.c_str()) == nullptr) {
+    DT_LOG_WARNING(view::options_manager::get_instance().get_logging_priority(),
+                   "No ROOT geometry in cache file '" << _cache_file_ << "' !");
+    new TGeoManager("ROOT TGeo Manager", "ROOT TGeo Manager");
+    return false;
+  }
+  DT_LOG_NOTICE(view::options_manager::get_instance().get_logging_priority(),
+                "ROOT geometry loaded from cache file '" << _cache_file_ << "'");
+  return true;
+}
+
+void detector_manager::_store_cache_() const {
+  if (_cache_key_.empty()) {
+    return;
+  }
+
+  if (gGeoManager->Export(_cache_file_.c_str()) == 0) {
+    DT_LOG_WARNING(view::options_manager::get_instance().get_logging_priority(),
+                   "Geometry cache file '" << _cache_file_ << "' cannot be written !");
+    return;
+  }
+
+  // The key is written last so that a partial export is never taken as valid
+  TFile cache_file(_cache_file_.c_str(), "UPDATE");
+  if (cache_file.IsZombie()) {
+    DT_LOG_WARNING(view::options_manager::get_instance().get_logging_priority(),
+                   "Geometry cache file '" << _cache_file_ << "' cannot be updated !");
+    return;
+  }
+  TNamed cache_key(cache_key_name, _cache_key_.c_str());
+  cache_key.Write();
+  DT_LOG_NOTICE(view::options_manager::get_instance().get_logging_priority(),
+                "ROOT geometry stored in cache file '" << _cache_file_ << "'");
+}
+
 void detector_manager::_set_categories_(std::vector<std::string> &only_categories_) const {
   view::style_manager &style_mgr = view::style_manager::get_instance();
 
@@ -626,7 +831,15 @@ void detector_manager::_set_volume_(const geomtools::geom_info &ginfo_) {
     return;
   }
 
-  _volumes_[volume_id]->initialize(ginfo_);
+  if (_from_cache_ && _volumes_[volume_id]->get_type() != "special") {
+    // The ROOT volume comes with the cached geometry
+    TGeoVolume *cached_volume = gGeoManager->GetVolume(volume_name.c_str());
+    DT_THROW_IF(cached_volume == nullptr, std::logic_error,
+                "Volume '" << volume_name << "' is missing from the geometry cache file !");
+    dynamic_cast<i_root_volume &>(*_volumes_[volume_id]).attach(ginfo_, cached_volume);
+  } else {
+    _volumes_[volume_id]->initialize(ginfo_);
+  }
   _volumes_[volume_id]->update();
 
   DT_LOG_DEBUG(
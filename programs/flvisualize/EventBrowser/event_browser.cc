@@ -253,7 +253,11 @@ void event_browser::initialize_event_server() {
   this->change_event(server.has_sequential_data() ? NEXT_EVENT : FIRST_EVENT);
 }
 
-void event_browser::track_select() { _display_->update(false, false); }
+void event_browser::track_select() {
+  // Highlight flags are not part of the display options
+  _display_->invalidate();
+  _display_->update(false, false);
+}
 
 void event_browser::add_full_2d_view() {
   if (_full_2d_display_ != nullptr) {
@@ -277,7 +281,13 @@ void event_browser::add_full_2d_view() {
   _tabs_->SetTab(FULL_2D_DISPLAY);
 }
 
-void event_browser::update_browser(const bool reset_view_) {
+void event_browser::update_browser(const bool reset_view_, const bool reset_scene_) {
+  if (reset_scene_) {
+    _display_->invalidate();
+    if (_full_2d_display_ != nullptr) {
+      _full_2d_display_->invalidate();
+    }
+  }
   _tab_is_uptodate_[EVENT_DISPLAY] = false;
   _tab_is_uptodate_[FULL_2D_DISPLAY] = false;
   this->update_tab((tab_id_index_type)_tabs_->GetCurrent(), reset_view_);
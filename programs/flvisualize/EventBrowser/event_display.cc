@@ -202,6 +202,12 @@ void event_display::clear() {
   }
 }
 
+void event_display::invalidate() {
+  if (_draw_manager_ != nullptr) {
+    _draw_manager_->invalidate();
+  }
+}
+
 void event_display::reset() {
   DT_THROW_IF(!is_initialized(), std::logic_error, "Not initialized !");
 
@@ -33,6 +33,8 @@ i_draw_manager::i_draw_manager() = default;
 // dtor:
 i_draw_manager::~i_draw_manager() = default;
 
+void i_draw_manager::invalidate() {}
+
 }  // end of namespace view
 
 }  // end of namespace visualization
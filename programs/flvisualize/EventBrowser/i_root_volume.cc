@@ -65,6 +65,15 @@ void i_root_volume::initialize(const geomtools::geom_info& ginfo_) {
   _initialized = true;
 }
 
+void i_root_volume::attach(const geomtools::geom_info& ginfo_, TGeoVolume* geo_volume_) {
+  DT_THROW_IF(geo_volume_ == nullptr, std::logic_error,
+              "Missing ROOT volume for '" << _name << "' !");
+  _placement = ginfo_.get_world_placement();
+  _set_dimensions(ginfo_.get_logical().get_shape());
+  _geo_volume = geo_volume_;
+  _initialized = true;
+}
+
 void i_root_volume::update() {
   const view::style_manager& style_mgr = view::style_manager::get_instance();
 
@@ -113,6 +122,8 @@ void i_root_volume::_highlight() {
   _geo_volume->SetVisibility(true);
 }
 
+void i_root_volume::_set_dimensions(const geomtools::i_shape_3d& /*shape_3d_*/) {}
+
 void i_root_volume::tree_dump(std::ostream& out_, const std::string& title_,
                               const std::string& indent_, bool inherit_) const {
   std::string indent;
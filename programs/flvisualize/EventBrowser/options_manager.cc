@@ -65,6 +65,7 @@ void options_manager::set_defaults() {
   _detector_config_file_ = "";
   _style_config_file_ = "";
   _cut_config_file_ = "";
+  _geometry_cache_file_ = "";
 
   _2d_display_on_left_ = true;
 
@@ -142,6 +143,10 @@ void options_manager::define_browser_options(
   easy_init("cut-config-file", po::value<std::string>(&_cut_config_file_)->value_name("file"),
             "set the path to the cut configuration file");
 
+  easy_init("geometry-cache-file",
+            po::value<std::string>(&_geometry_cache_file_)->value_name("file"),
+            "set the path to the ROOT file caching the detector geometry");
+
   easy_init("preload", po::value<bool>(&_preload_)->zero_tokens()->default_value(false),
             "enable the load in memory of Boost archive files (working only with pure "
             "'bxg4_production' output)");
@@ -260,6 +265,12 @@ bool options_manager::parse_command_line(int argc_, char** argv_) {
                                            ->value_name("name"),
                                        "set a DLL to be loaded.")
 
+                                          ("geometry-cache-file",
+                                           po::value<std::string>(&_geometry_cache_file_)
+                                               ->value_name("file"),
+                                           "set the path to the ROOT file caching the "
+                                           "detector geometry")
+
       ;  // end of 'options' description
 
   // Describe command line switches (-X, --XXX...) :
@@ -501,6 +512,14 @@ void options_manager::set_cut_config_file(const std::string& config_file_) {
   _cut_config_file_ = config_file_;
 }
 
+const std::string& options_manager::get_geometry_cache_file() const {
+  return _geometry_cache_file_;
+}
+
+void options_manager::set_geometry_cache_file(const std::string& cache_file_) {
+  _geometry_cache_file_ = cache_file_;
+}
+
 const std::string& options_manager::get_detector_config_file() const {
   return _detector_config_file_;
 }
@@ -48,10 +48,9 @@ polycone_volume::polycone_volume(const std::string& name_, const std::string& ca
 polycone_volume::~polycone_volume() = default;
 
 void polycone_volume::_construct(const geomtools::i_shape_3d& shape_3d_) {
+  this->_set_dimensions(shape_3d_);
   const auto& mpolycone = dynamic_cast<const geomtools::polycone&>(shape_3d_);
 
-  _nbr_z_section_ = mpolycone.points().size();
-
   TGeoShape* geo_shape = utils::root_utilities::get_geo_shape(mpolycone);
   geo_shape->SetName(_name.c_str());
 
@@ -61,6 +60,12 @@ void polycone_volume::_construct(const geomtools::i_shape_3d& shape_3d_) {
   _geo_volume = new TGeoVolume(_name.c_str(), geo_shape, medium);
 }
 
+void polycone_volume::_set_dimensions(const geomtools::i_shape_3d& shape_3d_) {
+  const auto& mpolycone = dynamic_cast<const geomtools::polycone&>(shape_3d_);
+
+  _nbr_z_section_ = mpolycone.points().size();
+}
+
 void polycone_volume::tree_dump(std::ostream& out_, const std::string& title_,
                                 const std::string& indent_, bool inherit_) const {
   std::string indent;
@@ -0,0 +1,210 @@
+/* primitive_pool.cc
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include <EventBrowser/view/primitive_pool.h>
+
+#include <TAttFill.h>
+#include <TAttLine.h>
+#include <TAttMarker.h>
+#include <TAttText.h>
+#include <TLatex.h>
+#include <TList.h>
+#include <TMarker3DBox.h>
+#include <TPolyLine3D.h>
+#include <TPolyMarker3D.h>
+#include <TROOT.h>
+
+namespace snemo {
+
+namespace visualization {
+
+namespace view {
+
+namespace {
+
+/// Take an available primitive, preferably with the given number of points
+template <class T>
+T* take_primitive(std::map<size_t, std::vector<T*> >& free_, const size_t npoints_,
+                  bool& resize_) {
+  auto found = free_.find(npoints_);
+  resize_ = found == free_.end();
+  if (resize_) {
+    found = free_.begin();
+  }
+  if (found == free_.end()) {
+    return nullptr;
+  }
+  T* primitive = found->second.back();
+  found->second.pop_back();
+  if (found->second.empty()) {
+    free_.erase(found);
+  }
+  return primitive;
+}
+
+/// Take an available primitive
+template <class T>
+T* take_primitive(std::vector<T*>& free_) {
+  if (free_.empty()) {
+    return nullptr;
+  }
+  T* primitive = free_.back();
+  free_.pop_back();
+  return primitive;
+}
+
+}  // namespace
+
+// ctor:
+primitive_pool::primitive_pool() = default;
+
+// dtor:
+primitive_pool::~primitive_pool() { this->clear(); }
+
+TPolyLine3D* primitive_pool::make_polyline(const size_t npoints_) {
+  bool resize = true;
+  TPolyLine3D* polyline = take_primitive(_free_polylines_, npoints_, resize);
+  if (polyline == nullptr) {
+    polyline = new TPolyLine3D;
+  } else {
+    TAttLine().Copy(*polyline);
+  }
+  if (resize) {
+    polyline->SetPolyLine(npoints_);
+  }
+  // The pool, not the pad, owns the primitive
+  polyline->ResetBit(kCanDelete);
+  _primitives_.push_back(polyline);
+  return polyline;
+}
+
+TPolyMarker3D* primitive_pool::make_polymarker(const size_t npoints_) {
+  bool resize = true;
+  TPolyMarker3D* polymarker = take_primitive(_free_polymarkers_, npoints_, resize);
+  if (polymarker == nullptr) {
+    polymarker = new TPolyMarker3D;
+  }
+  if (resize) {
+    polymarker->SetPolyMarker(npoints_, static_cast<Float_t*>(nullptr), 1);
+  }
+  TAttMarker().Copy(*polymarker);
+  polymarker->ResetBit(kCanDelete);
+  _primitives_.push_back(polymarker);
+  return polymarker;
+}
+
+TMarker3DBox* primitive_pool::make_box() {
+  TMarker3DBox* box = take_primitive(_free_boxes_);
+  if (box == nullptr) {
+    box = new TMarker3DBox;
+  } else {
+    TAttLine().Copy(*box);
+    TAttFill().Copy(*box);
+    box->SetPosition(0.0, 0.0, 0.0);
+    box->SetSize(0.0, 0.0, 0.0);
+    box->SetDirection(0.0, 0.0);
+  }
+  box->ResetBit(kCanDelete);
+  _primitives_.push_back(box);
+  return box;
+}
+
+TLatex* primitive_pool::make_latex() {
+  TLatex* latex = take_primitive(_free_latex_);
+  if (latex == nullptr) {
+    latex = new TLatex;
+  } else {
+    TAttText().Copy(*latex);
+    TAttLine().Copy(*latex);
+    latex->SetNDC(false);
+  }
+  latex->ResetBit(kCanDelete);
+  _primitives_.push_back(latex);
+  return latex;
+}
+
+const std::vector<TObject*>& primitive_pool::get_primitives() const { return _primitives_; }
+
+void primitive_pool::undraw() {
+  // Same cleanup as the one done by the TObject destructor
+  if (gROOT == nullptr || !gROOT->MustClean()) {
+    return;
+  }
+  for (TObject* a_primitive : _primitives_) {
+    if (a_primitive->TestBit(kMustCleanup)) {
+      gROOT->GetListOfCleanups()->RecursiveRemove(a_primitive);
+    }
+  }
+}
+
+void primitive_pool::release() {
+  for (TObject* a_primitive : _primitives_) {
+    if (a_primitive->IsA() == TPolyLine3D::Class()) {
+      auto* polyline = static_cast<TPolyLine3D*>(a_primitive);
+      _free_polylines_[polyline->Size()].push_back(polyline);
+    } else if (a_primitive->IsA() == TPolyMarker3D::Class()) {
+      auto* polymarker = static_cast<TPolyMarker3D*>(a_primitive);
+      _free_polymarkers_[polymarker->Size()].push_back(polymarker);
+    } else if (a_primitive->IsA() == TMarker3DBox::Class()) {
+      _free_boxes_.push_back(static_cast<TMarker3DBox*>(a_primitive));
+    } else {
+      _free_latex_.push_back(static_cast<TLatex*>(a_primitive));
+    }
+  }
+  _primitives_.clear();
+}
+
+void primitive_pool::clear() {
+  this->release();
+  for (auto& a_size : _free_polylines_) {
+    for (TPolyLine3D* a_polyline : a_size.second) {
+      delete a_polyline;
+    }
+  }
+  _free_polylines_.clear();
+  for (auto& a_size : _free_polymarkers_) {
+    for (TPolyMarker3D* a_polymarker : a_size.second) {
+      delete a_polymarker;
+    }
+  }
+  _free_polymarkers_.clear();
+  for (TMarker3DBox* a_box : _free_boxes_) {
+    delete a_box;
+  }
+  _free_boxes_.clear();
+  for (TLatex* a_latex : _free_latex_) {
+    delete a_latex;
+  }
+  _free_latex_.clear();
+}
+
+}  // end of namespace view
+
+}  // end of namespace visualization
+
+}  // end of namespace snemo
+
+// end of primitive_pool.cc
+/*
+** Local Variables: --
+** mode: c++ --
+** c-file-style: "gnu" --
+** tab-width: 2 --
+** End: --
+*/
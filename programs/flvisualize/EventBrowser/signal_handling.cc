@@ -362,7 +362,8 @@ void signal_handling::_process_menu_options_(const button_signals_type signal_)
     reset_view = true;
   }
 
-  _browser_->update_browser(reset_view);
+  // Only the event objects depending on the changed option are rebuilt
+  _browser_->update_browser(reset_view, false);
 }
 
 }  // end of namespace view
@@ -36,14 +36,33 @@ namespace visualization {
 
 namespace view {
 
+namespace {
+
+/// Return the display options a layer depends on
+const std::vector<button_signals_type>& layer_options(const base_renderer::layer_type layer_) {
+  static const std::vector<button_signals_type> options[base_renderer::NUMBER_OF_LAYERS] = {
+      {SHOW_MC_VERTEX, SHOW_MC_HITS, SHOW_MC_TRACKS, SHOW_MC_CALORIMETER_HITS,
+       SHOW_MC_TRACKER_HITS, SHOW_GG_CIRCLE, SHOW_GG_TIME_GRADIENT},
+      {SHOW_CALIBRATED_HITS, SHOW_CALIBRATED_INFO},
+      {SHOW_CALIBRATED_HITS, SHOW_TRACKER_CLUSTERED_HITS, SHOW_TRACKER_CLUSTERED_BOX,
+       SHOW_TRACKER_CLUSTERED_CIRCLE},
+      {SHOW_TRACKER_TRAJECTORIES, SHOW_RECALIBRATED_TRACKER_HITS, SHOW_PARTICLE_TRACKS,
+       SHOW_CALIBRATED_INFO, SHOW_TRACKER_CLUSTERED_HITS, SHOW_TRACKER_CLUSTERED_CIRCLE}};
+  return options[layer_];
+}
+
+}  // namespace
+
 // ctor:
 snemo_draw_manager::snemo_draw_manager(const io::event_server* server_) {
   _server_ = server_;
 
+  // Geometrical objects are owned by the renderers, which reuse them
   _objects_ = new TObjArray(1000);
   _text_objects_ = new TObjArray(10);
-  _objects_->SetOwner(true);
+  _objects_->SetOwner(false);
   _text_objects_->SetOwner(true);
+  _displayed_ = false;
 
   // Initialize renderers
   _calorimeter_hit_renderer_.initialize(_server_, _objects_, _text_objects_);
@@ -65,44 +84,71 @@ void snemo_draw_manager::update() {
     return;
   }
 
-  // Add 'simulated_data' objects:
-  if (_server_->get_event().has(io::SD_LABEL)) {
-    this->_add_simulated_data();
-  } else {
-    DT_LOG_DEBUG(options_manager::get_instance().get_logging_priority(),
-                 "Event has no simulated data");
+  // Without a clear since the last update, objects are added to the
+  // displayed ones (see event_display::show_all)
+  const bool accumulate = _displayed_;
+  _displayed_ = true;
+
+  // MC truth layer:
+  if (this->_begin_layer_(base_renderer::MC_TRUTH_LAYER, accumulate)) {
+    // Add 'simulated_data' objects:
+    if (_server_->get_event().has(io::SD_LABEL)) {
+      this->_add_simulated_data();
+    } else {
+      DT_LOG_DEBUG(options_manager::get_instance().get_logging_priority(),
+                   "Event has no simulated data");
+    }
   }
 
-  // Add 'calibrated_data' objects:
-  if (_server_->get_event().has(io::CD_LABEL)) {
-    this->_add_calibrated_data();
-  } else {
+  const bool has_calibrated_data = _server_->get_event().has(io::CD_LABEL);
+  if (!has_calibrated_data) {
     DT_LOG_DEBUG(options_manager::get_instance().get_logging_priority(),
                  "Event has no calibrated data");
   }
 
-  // Add 'tracker_clustering_data' objects:
-  if (_server_->get_event().has(io::TCD_LABEL)) {
-    this->_add_tracker_clustering_data();
-  } else {
-    DT_LOG_DEBUG(options_manager::get_instance().get_logging_priority(),
-                 "Event has no tracker clustering data");
+  // Calorimeter layer:
+  if (this->_begin_layer_(base_renderer::CALORIMETER_LAYER, accumulate)) {
+    // Add 'calibrated_data' calorimeter objects:
+    if (has_calibrated_data) {
+      this->_add_calibrated_calorimeter_data();
+    }
   }
 
-  // Add 'tracker_trajectory_data' objects:
-  if (_server_->get_event().has(io::TTD_LABEL)) {
-    this->_add_tracker_trajectory_data();
-  } else {
-    DT_LOG_DEBUG(options_manager::get_instance().get_logging_priority(),
-                 "Event has no tracker trajectory data");
+  // Tracker layer:
+  const bool tracker_rebuilt = this->_begin_layer_(base_renderer::TRACKER_LAYER, accumulate);
+  if (tracker_rebuilt) {
+    // Add 'calibrated_data' tracker objects:
+    if (has_calibrated_data) {
+      this->_add_calibrated_tracker_data();
+    }
+
+    // Add 'tracker_clustering_data' objects:
+    if (_server_->get_event().has(io::TCD_LABEL)) {
+      this->_add_tracker_clustering_data();
+    } else {
+      DT_LOG_DEBUG(options_manager::get_instance().get_logging_priority(),
+                   "Event has no tracker clustering data");
+    }
   }
 
-  // Add 'tracker_trajectory_data' objects:
-  if (_server_->get_event().has(io::PTD_LABEL)) {
-    this->_add_particle_track_data();
-  } else {
-    DT_LOG_DEBUG(options_manager::get_instance().get_logging_priority(),
-                 "Event has no particle track data");
+  // Trajectory layer: trajectories take the colors the tracker layer gives
+  // to their clusters
+  if (this->_begin_layer_(base_renderer::TRAJECTORY_LAYER, accumulate, tracker_rebuilt)) {
+    // Add 'tracker_trajectory_data' objects:
+    if (_server_->get_event().has(io::TTD_LABEL)) {
+      this->_add_tracker_trajectory_data();
+    } else {
+      DT_LOG_DEBUG(options_manager::get_instance().get_logging_priority(),
+                   "Event has no tracker trajectory data");
+    }
+
+    // Add 'particle_track_data' objects:
+    if (_server_->get_event().has(io::PTD_LABEL)) {
+      this->_add_particle_track_data();
+    } else {
+      DT_LOG_DEBUG(options_manager::get_instance().get_logging_priority(),
+                   "Event has no particle track data");
+    }
   }
 }
 
@@ -122,6 +168,8 @@ void snemo_draw_manager::reset() {
   _calorimeter_hit_renderer_.reset();
   _tracker_hit_renderer_.reset();
   _visual_track_renderer_.reset();
+
+  this->snemo_draw_manager::invalidate();
 }
 
 void snemo_draw_manager::clear() {
@@ -129,8 +177,46 @@ void snemo_draw_manager::clear() {
   _tracker_hit_renderer_.clear();
   _visual_track_renderer_.clear();
 
-  _objects_->Delete();
+  _objects_->Clear();
   _text_objects_->Delete();
+  _displayed_ = false;
+}
+
+void snemo_draw_manager::invalidate() {
+  for (auto& a_state : _layer_states_) {
+    a_state.valid = false;
+  }
+}
+
+bool snemo_draw_manager::_begin_layer_(const base_renderer::layer_type layer_,
+                                       const bool accumulate_, const bool force_) {
+  const options_manager& options_mgr = options_manager::get_instance();
+  std::vector<bool> options;
+  for (const button_signals_type an_option : layer_options(layer_)) {
+    options.push_back(options_mgr.get_option_flag(an_option));
+  }
+  const io::event_record* event = &_server_->get_event();
+  const int event_number = _server_->get_current_event_number();
+
+  layer_state& state = _layer_states_[layer_];
+  if (!accumulate_ && !force_ && state.valid && state.event == event &&
+      state.event_number == event_number && state.options == options) {
+    _calorimeter_hit_renderer_.restore_layer(layer_);
+    _tracker_hit_renderer_.restore_layer(layer_);
+    _visual_track_renderer_.restore_layer(layer_);
+    return false;
+  }
+
+  _calorimeter_hit_renderer_.begin_layer(layer_, accumulate_);
+  _tracker_hit_renderer_.begin_layer(layer_, accumulate_);
+  _visual_track_renderer_.begin_layer(layer_, accumulate_);
+
+  // A layer holding the objects of several events is not restored
+  state.valid = !accumulate_;
+  state.event = event;
+  state.event_number = event_number;
+  state.options.swap(options);
+  return true;
 }
 
 /***************************************************
@@ -166,8 +252,7 @@ void snemo_draw_manager::_add_simulated_vertex_() {
 
   const geomtools::vector_3d& sim_vertex = sim_data.get_vertex();
   {
-    TPolyMarker3D* vertex_3d = base_renderer::make_polymarker(sim_vertex);
-    _objects_->Add(vertex_3d);
+    TPolyMarker3D* vertex_3d = _visual_track_renderer_.add_polymarker(sim_vertex);
     vertex_3d->SetMarkerColor(kViolet);
     vertex_3d->SetMarkerStyle(kPlus);
   }
@@ -177,8 +262,7 @@ void snemo_draw_manager::_add_simulated_vertex_() {
 
   for (const auto& a_primary : particles) {
     if (a_primary.get_auxiliaries().has_flag(browser_tracks::HIGHLIGHT_FLAG)) {
-      TPolyMarker3D* vertex_3d = base_renderer::make_polymarker(sim_vertex);
-      _objects_->Add(vertex_3d);
+      TPolyMarker3D* vertex_3d = _visual_track_renderer_.add_polymarker(sim_vertex);
       vertex_3d->SetMarkerColor(kViolet);
       vertex_3d->SetMarkerStyle(kCircle);
       break;
@@ -209,10 +293,16 @@ void snemo_draw_manager::_add_simulated_hits_() {
  *  Filling objects from the 'calibrated_data' bank *
  ****************************************************/
 
-void snemo_draw_manager::_add_calibrated_data() {
+void snemo_draw_manager::_add_calibrated_calorimeter_data() {
   const options_manager& options_mgr = options_manager::get_instance();
   if (options_mgr.get_option_flag(SHOW_CALIBRATED_HITS)) {
     _calorimeter_hit_renderer_.push_calibrated_hits();
+  }
+}
+
+void snemo_draw_manager::_add_calibrated_tracker_data() {
+  const options_manager& options_mgr = options_manager::get_instance();
+  if (options_mgr.get_option_flag(SHOW_CALIBRATED_HITS)) {
     _tracker_hit_renderer_.push_calibrated_hits();
   }
 }
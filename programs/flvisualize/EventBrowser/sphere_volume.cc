@@ -50,6 +50,16 @@ sphere_volume::sphere_volume(const std::string &name_, const std::string &catego
 sphere_volume::~sphere_volume() = default;
 
 void sphere_volume::_construct(const geomtools::i_shape_3d &shape_3d_) {
+  this->_set_dimensions(shape_3d_);
+
+  auto *material = new TGeoMaterial("Dummy");
+  auto *medium = new TGeoMedium("Dummy", 1, material);
+
+  _geo_volume = gGeoManager->MakeSphere(_name.c_str(), medium, _inner_radius_, _outer_radius_,
+                                        _theta_min_, _theta_max_, _phi_min_, _phi_max_);
+}
+
+void sphere_volume::_set_dimensions(const geomtools::i_shape_3d &shape_3d_) {
   const auto &msphere = dynamic_cast<const geomtools::sphere &>(shape_3d_);
 
   _inner_radius_ = 0.0;
@@ -58,12 +68,6 @@ void sphere_volume::_construct(const geomtools::i_shape_3d &shape_3d_) {
   _theta_max_ = 180.0;
   _phi_min_ = 0.0;
   _phi_max_ = 360;
-
-  auto *material = new TGeoMaterial("Dummy");
-  auto *medium = new TGeoMedium("Dummy", 1, material);
-
-  _geo_volume = gGeoManager->MakeSphere(_name.c_str(), medium, _inner_radius_, _outer_radius_,
-                                        _theta_min_, _theta_max_, _phi_min_, _phi_max_);
 }
 
 void sphere_volume::tree_dump(std::ostream &out_, const std::string &title_,
@@ -96,8 +96,7 @@ void tracker_hit_renderer::push_simulated_hits(const std::string &hit_category_)
     const mctools::base_step_hit &a_step = it_hit.get();
 
     // draw the Geiger avalanche path:
-    auto *gg_path = new TPolyLine3D;
-    _objects->Add(gg_path);
+    TPolyLine3D *gg_path = this->add_polyline(2);
     gg_path->SetPoint(0, a_step.get_position_start().x(), a_step.get_position_start().y(),
                       a_step.get_position_start().z());
     gg_path->SetPoint(1, a_step.get_position_stop().x(), a_step.get_position_stop().y(),
@@ -168,8 +167,7 @@ void tracker_hit_renderer::push_simulated_hits(const std::string &hit_category_)
         }
       }
 
-      TPolyLine3D *gg_drift = base_renderer::make_polyline(points);
-      _objects->Add(gg_drift);
+      TPolyLine3D *gg_drift = this->add_polyline(points);
       gg_drift->SetLineColor(color);
       gg_drift->SetLineWidth(line_width);
     }  // end of "show geiger drift circle" condition
@@ -257,8 +255,7 @@ void tracker_hit_renderer::push_clustered_hits() {
           const double dz = a_gg_hit.get_sigma_z();
           const double r = 22.0 / CLHEP::mm;
 
-          auto *hit_3d = new TMarker3DBox;
-          _objects->Add(hit_3d);
+          TMarker3DBox *hit_3d = this->add_box();
           hit_3d->SetPosition(x, y, z);
           hit_3d->SetSize(r, r, dz);
           hit_3d->SetLineColor(cluster_color);
@@ -324,8 +321,7 @@ void tracker_hit_renderer::push_fitted_tracks() {
       const snemo::datamodel::base_trajectory_pattern &a_pattern = a_trajectory.get_pattern();
       const auto &iw3dr =
           dynamic_cast<const geomtools::i_wires_3d_rendering &>(a_pattern.get_shape());
-      TPolyLine3D *track = base_renderer::make_track(iw3dr);
-      _objects->Add(track);
+      TPolyLine3D *track = this->add_track(iw3dr);
 
       // Determine trajectory color by getting cluster color:
       int trajectory_color = 0;
@@ -420,8 +416,7 @@ void tracker_hit_renderer::_make_calibrated_geiger_hit(
       color = TColor::GetColor(hex_str.c_str());
     }
   }
-  auto *gg_dz = new TPolyLine3D;
-  _objects->Add(gg_dz);
+  TPolyLine3D *gg_dz = this->add_polyline(2);
   gg_dz->SetLineColor(color);
   gg_dz->SetLineWidth(line_width);
 
@@ -449,8 +444,7 @@ void tracker_hit_renderer::_make_calibrated_geiger_hit(
     points.push_back(geomtools::vector_3d(x - r, y + r, z));
     points.push_back(geomtools::vector_3d(x + r, y + r, z));
 
-    TPolyLine3D *gg_drift_square = base_renderer::make_polyline(points);
-    _objects->Add(gg_drift_square);
+    TPolyLine3D *gg_drift_square = this->add_polyline(points);
     gg_drift_square->SetLineColor(color);
     gg_drift_square->SetLineWidth(line_width);
 
@@ -491,13 +485,11 @@ void tracker_hit_renderer::_make_calibrated_geiger_hit(
         rmaxs.push_back(geomtools::vector_3d(r_max.x(), r_max.y() + y, r_max.z() + z));
       }
     }
-    TPolyLine3D *gg_drift_min = base_renderer::make_polyline(rmins);
-    _objects->Add(gg_drift_min);
+    TPolyLine3D *gg_drift_min = this->add_polyline(rmins);
     gg_drift_min->SetLineColor(color);
     gg_drift_min->SetLineWidth(line_width);
 
-    TPolyLine3D *gg_drift_max = base_renderer::make_polyline(rmaxs);
-    _objects->Add(gg_drift_max);
+    TPolyLine3D *gg_drift_max = this->add_polyline(rmaxs);
     gg_drift_max->SetLineColor(color);
     gg_drift_max->SetLineWidth(line_width);
   }
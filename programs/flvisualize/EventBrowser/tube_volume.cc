@@ -47,11 +47,7 @@ tube_volume::tube_volume(const std::string &name_, const std::string &category_)
 tube_volume::~tube_volume() = default;
 
 void tube_volume::_construct(const geomtools::i_shape_3d &shape_3d_) {
-  const auto &mtube = dynamic_cast<const geomtools::tube &>(shape_3d_);
-
-  _inner_radius_ = mtube.get_inner_r();
-  _outer_radius_ = mtube.get_outer_r();
-  _height_ = mtube.get_z();
+  this->_set_dimensions(shape_3d_);
 
   auto *material = new TGeoMaterial("Dummy");
   auto *medium = new TGeoMedium("Dummy", 1, material);
@@ -60,6 +56,14 @@ void tube_volume::_construct(const geomtools::i_shape_3d &shape_3d_) {
       gGeoManager->MakeTube(_name.c_str(), medium, _inner_radius_, _outer_radius_, _height_ / 2.);
 }
 
+void tube_volume::_set_dimensions(const geomtools::i_shape_3d &shape_3d_) {
+  const auto &mtube = dynamic_cast<const geomtools::tube &>(shape_3d_);
+
+  _inner_radius_ = mtube.get_inner_r();
+  _outer_radius_ = mtube.get_outer_r();
+  _height_ = mtube.get_z();
+}
+
 void tube_volume::tree_dump(std::ostream &out_, const std::string &title_,
                             const std::string &indent_, bool inherit_) const {
   std::string indent;
@@ -40,15 +40,20 @@
 
 // Bayeux
 // - geomtools
+#include <geomtools/geom_id.h>
 #include <geomtools/utils.h>
 
+// This project
+#include <EventBrowser/view/primitive_pool.h>
+
 namespace geomtools {
-class geom_id;
 class helix_3d;
 class line_3d;
 class i_wires_3d_rendering;
 }  // namespace geomtools
 
+class TLatex;
+class TMarker3DBox;
 class TObjArray;
 class TPolyLine3D;
 class TPolyMarker3D;
@@ -68,6 +73,15 @@ class base_renderer {
   /// Unique set of geomtools::geom_id
   typedef std::set<geomtools::geom_id> geom_id_collection;
 
+  /// Graphical layers, each one rebuilt independently of the others
+  enum layer_type {
+    MC_TRUTH_LAYER = 0,  //!< Simulated vertex, hits and tracks
+    CALORIMETER_LAYER,   //!< Calibrated calorimeter hits
+    TRACKER_LAYER,       //!< Calibrated and clustered tracker hits
+    TRAJECTORY_LAYER,    //!< Fitted trajectories and particle tracks
+    NUMBER_OF_LAYERS
+  };
+
   /// Return initialization status
   bool is_initialized() const;
 
@@ -99,7 +113,7 @@ class base_renderer {
   void initialize(const io::event_server* server_ = 0, TObjArray* objects_ = 0,
                   TObjArray* text_objects_ = 0);
 
-  /// Clear
+  /// Clear: the primitives of the layers are removed from the scene but kept
   void clear();
 
   /// Reset
@@ -109,6 +123,31 @@ class base_renderer {
   void highlight_geom_id(const geomtools::geom_id& gid_, const size_t color_,
                          const std::string& text_ = "");
 
+  /// Start building a layer, recycling its primitives unless they are kept in the scene
+  void begin_layer(const layer_type layer_, const bool keep_ = false);
+
+  /// Put back in the scene the primitives and the highlighted volumes of a layer
+  void restore_layer(const layer_type layer_);
+
+  /// Add to the scene a polyline, all the points of which are to be set
+  TPolyLine3D* add_polyline(const size_t npoints_);
+
+  /// Add to the scene a polyline from a set of 3D points
+  TPolyLine3D* add_polyline(const geomtools::polyline_type& polyline_, const bool convert_ = false);
+
+  /// Add to the scene a polyline from a track
+  TPolyLine3D* add_track(const geomtools::i_wires_3d_rendering& iw3dr_,
+                         const bool convert_ = false);
+
+  /// Add to the scene a marker from a 3D point
+  TPolyMarker3D* add_polymarker(const geomtools::vector_3d& point_, const bool convert_ = false);
+
+  /// Add to the scene a 3D box marker
+  TMarker3DBox* add_box();
+
+  /// Add to the scene a LaTeX text
+  TLatex* add_latex();
+
   /// Build a marker from a 3D point
   static TPolyMarker3D* make_polymarker(const geomtools::vector_3d& point_,
                                         const bool convert_ = false);
@@ -129,6 +168,27 @@ class base_renderer {
   TObjArray* _text_objects;         //!< ROOT text objects container
 
   geom_id_collection _highlighted_geom_id;  //!< List of geom_id highlighted
+
+ private:
+  /// Highlight a volume, without recording it
+  void _highlight_geom_id_(const geomtools::geom_id& gid_, const size_t color_,
+                           const std::string& text_);
+
+  /// Highlight request, replayed when its layer is restored
+  struct highlight_record {
+    geomtools::geom_id gid;  //!< Highlighted volume
+    size_t color;            //!< Highlight color
+    std::string text;        //!< Text shown on the volume, if any
+  };
+
+  /// Primitives and highlight requests of a layer
+  struct layer_record {
+    primitive_pool pool;                       //!< Primitives of the layer
+    std::vector<highlight_record> highlights;  //!< Highlighted volumes of the layer
+  };
+
+  layer_record _layers_[NUMBER_OF_LAYERS];  //!< Graphical layers
+  layer_type _current_layer_;               //!< Layer being built
 };
 
 }  // end of namespace view
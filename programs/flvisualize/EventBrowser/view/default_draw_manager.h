@@ -95,6 +95,7 @@ class default_draw_manager : public i_draw_manager {
   const io::event_server* _server_;  //!< Pointer to event server
   TObjArray* _objects_;              //!< ROOT array for geometrical TObject
   TObjArray* _text_objects_;         //!< ROOT array for textual TObject
+  bool _displayed_;                  //!< Objects have been updated since the last clear
 
   calorimeter_hit_renderer _calorimeter_hit_renderer_;  //<! Calorimeter hit renderer
   visual_track_renderer _visual_track_renderer_;        //<! Tracker hit renderer
@@ -87,8 +87,8 @@ class event_browser : public TGMainFrame {
   /// Reset event browser
   void reset();
 
-  /// Update event browser
-  void update_browser(const bool reset_view_ = true);
+  /// Update event browser, rebuilding all the event objects if the scene is reset
+  void update_browser(const bool reset_view_ = true, const bool reset_scene_ = true);
 
   /// Update a given browser tab
   void update_tab(const tab_id_index_type index_, const bool reset_view_ = true);
@@ -89,6 +89,9 @@ class event_display {
   /// Clear display
   void clear();
 
+  /// Force the next update to rebuild all the event objects
+  void invalidate();
+
   /// Reset display
   void reset();
 
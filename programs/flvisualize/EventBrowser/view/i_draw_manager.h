@@ -53,6 +53,9 @@ class i_draw_manager {
   virtual void draw_text() = 0;
   virtual void clear() = 0;
   virtual void reset() = 0;
+
+  /// Forget the objects kept from previous updates, if any
+  virtual void invalidate();
 };
 
 }  // end of namespace view
@@ -120,6 +120,10 @@ class options_manager : public utils::singleton<options_manager> {
 
   void set_cut_config_file(const std::string& config_file_);
 
+  const std::string& get_geometry_cache_file() const;
+
+  void set_geometry_cache_file(const std::string& cache_file_);
+
   // View options
   double get_scaling_factor() const;
 
@@ -152,6 +156,7 @@ class options_manager : public utils::singleton<options_manager> {
   std::string _detector_config_file_;
   std::string _style_config_file_;
   std::string _cut_config_file_;
+  std::string _geometry_cache_file_;
 
   bool _2d_display_on_left_;
 
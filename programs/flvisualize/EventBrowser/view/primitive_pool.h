@@ -0,0 +1,112 @@
+// -*- mode: c++ ; -*-
+/* primitive_pool.h
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ *
+ * Description:
+ *
+ *  Pool of ROOT graphical primitives
+ *
+ * History:
+ *
+ */
+
+#ifndef FALAISE_SNEMO_VISUALIZATION_VIEW_PRIMITIVE_POOL_H
+#define FALAISE_SNEMO_VISUALIZATION_VIEW_PRIMITIVE_POOL_H 1
+
+// Standard library
+#include <map>
+#include <vector>
+
+class TLatex;
+class TMarker3DBox;
+class TObject;
+class TPolyLine3D;
+class TPolyMarker3D;
+
+namespace snemo {
+
+namespace visualization {
+
+namespace view {
+
+/// \brief A pool of ROOT graphical primitives reused across redraws
+/*!
+ * The pool owns its primitives. The ones made since the last release are in
+ * use; a release makes them available again, with their attributes reset to
+ * the ROOT defaults. Polylines and polymarkers are preferably reused with the
+ * same number of points, otherwise they are resized in place.
+ */
+class primitive_pool {
+ public:
+  /// Default constructor
+  primitive_pool();
+
+  /// Destructor
+  ~primitive_pool();
+
+  primitive_pool(const primitive_pool&) = delete;
+  primitive_pool& operator=(const primitive_pool&) = delete;
+
+  /// Return a polyline, all the points of which are to be set
+  TPolyLine3D* make_polyline(const size_t npoints_);
+
+  /// Return a polymarker, all the points of which are to be set
+  TPolyMarker3D* make_polymarker(const size_t npoints_);
+
+  /// Return a 3D box marker
+  TMarker3DBox* make_box();
+
+  /// Return a LaTeX text
+  TLatex* make_latex();
+
+  /// Return the primitives made since the last release
+  const std::vector<TObject*>& get_primitives() const;
+
+  /// Remove the primitives in use from the pads they are drawn in
+  void undraw();
+
+  /// Make the primitives in use available again
+  void release();
+
+  /// Delete all the primitives
+  void clear();
+
+ private:
+  std::vector<TObject*> _primitives_;  //!< Primitives in use
+  std::map<size_t, std::vector<TPolyLine3D*> > _free_polylines_;      //!< By number of points
+  std::map<size_t, std::vector<TPolyMarker3D*> > _free_polymarkers_;  //!< By number of points
+  std::vector<TMarker3DBox*> _free_boxes_;                            //!< Available boxes
+  std::vector<TLatex*> _free_latex_;                                  //!< Available texts
+};
+
+}  // end of namespace view
+
+}  // end of namespace visualization
+
+}  // end of namespace snemo
+
+#endif  // FALAISE_SNEMO_VISUALIZATION_VIEW_PRIMITIVE_POOL_H
+
+// end of primitive_pool.h
+/*
+** Local Variables: --
+** mode: c++ --
+** c-file-style: "gnu" --
+** tab-width: 2 --
+** End: --
+*/
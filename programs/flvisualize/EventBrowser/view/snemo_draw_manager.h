@@ -35,6 +35,7 @@
 
 // Standard library:
 #include <string>
+#include <vector>
 
 // This project:
 #include <EventBrowser/view/calorimeter_hit_renderer.h>
@@ -84,12 +85,18 @@ class snemo_draw_manager : public i_draw_manager {
   /// Reset
   virtual void reset();
 
+  /// Rebuild all the layers at the next update
+  virtual void invalidate();
+
  protected:
   /// Add 'simulated_data' bank objects
   void _add_simulated_data();
 
-  /// Add 'calibrated_data' bank objects
-  void _add_calibrated_data();
+  /// Add 'calibrated_data' bank calorimeter objects
+  void _add_calibrated_calorimeter_data();
+
+  /// Add 'calibrated_data' bank tracker objects
+  void _add_calibrated_tracker_data();
 
   /// Add 'tracker_clustering_data' bank objects
   void _add_tracker_clustering_data();
@@ -107,10 +114,25 @@ class snemo_draw_manager : public i_draw_manager {
   /// Add simulated sensitive hits
   void _add_simulated_hits_();
 
+  /// Start a layer of all the renderers: return false if the layer is restored as is
+  bool _begin_layer_(const base_renderer::layer_type layer_, const bool accumulate_,
+                     const bool force_ = false);
+
+  /// Event and display options a layer was built with
+  struct layer_state {
+    bool valid = false;                       //!< Layer may be restored
+    const io::event_record* event = nullptr;  //!< Event record
+    int event_number = -1;                    //!< Event number
+    std::vector<bool> options;                //!< Flags of the options the layer depends on
+  };
+
  private:
   const io::event_server* _server_;  //!< Pointer to event server
   TObjArray* _objects_;              //!< ROOT array for geometrical TObject
   TObjArray* _text_objects_;         //!< ROOT array for textual TObject
+  bool _displayed_;                  //!< Objects were added since the last clear
+
+  layer_state _layer_states_[base_renderer::NUMBER_OF_LAYERS];  //!< State of the layers
 
   calorimeter_hit_renderer _calorimeter_hit_renderer_;  //<! Calorimeter hit renderer
   tracker_hit_renderer _tracker_hit_renderer_;          //<! Tracker hit renderer
@@ -142,20 +142,17 @@ void visual_track_renderer::push_mc_tracks() {
       if (hit_aux.has_flag(browser_tracks::HIGHLIGHT_FLAG)) {  //  &&
         // a_hit.get_auxiliaries().has_flag(mctools::hit_utils::HIT_VISU_HIGHLIGHTED_KEY)) {
         line_width += 3;
-        TPolyMarker3D *mark1 = base_renderer::make_polymarker(a_hit.get_position_start());
-        _objects->Add(mark1);
+        TPolyMarker3D *mark1 = this->add_polymarker(a_hit.get_position_start());
         mark1->SetMarkerColor(kRed);
         mark1->SetMarkerStyle(kPlus);
-        TPolyMarker3D *mark2 = base_renderer::make_polymarker(a_hit.get_position_stop());
-        _objects->Add(mark2);
+        TPolyMarker3D *mark2 = this->add_polymarker(a_hit.get_position_stop());
         mark2->SetMarkerColor(kRed);
         mark2->SetMarkerStyle(kCircle);
       }
       geomtools::polyline_type points;
       points.push_back(a_hit.get_position_start());
       points.push_back(a_hit.get_position_stop());
-      TPolyLine3D *mc_path = base_renderer::make_polyline(points);
-      _objects->Add(mc_path);
+      TPolyLine3D *mc_path = this->add_polyline(points);
       mc_path->SetLineColor(line_color);
       mc_path->SetLineWidth(line_width);
       mc_path->SetLineStyle(line_style);
@@ -180,8 +177,7 @@ void visual_track_renderer::push_mc_legend() {
       continue;
     }
 
-    auto *legend = new TLatex;
-    _objects->Add(legend);
+    TLatex *legend = this->add_latex();
     legend->SetNDC();
     legend->SetTextAlign(31);
     legend->SetTextSize(0.04);
@@ -193,8 +189,7 @@ void visual_track_renderer::push_mc_legend() {
   }
 
   // Add a latest legend text for particles not in the previous list
-  auto *legend = new TLatex;
-  _objects->Add(legend);
+  TLatex *legend = this->add_latex();
   legend->SetNDC();
   legend->SetTextAlign(31);
   legend->SetTextSize(0.04);
@@ -271,14 +266,12 @@ void visual_track_renderer::push_reconstructed_tracks() {
         const geomtools::blur_spot &a_vertex = ivtx.get();
         const geomtools::vector_3d &a_position = a_vertex.get_position();
         {
-          TPolyMarker3D *mark = base_renderer::make_polymarker(a_position);
-          _objects->Add(mark);
+          TPolyMarker3D *mark = this->add_polymarker(a_position);
           mark->SetMarkerColor(color);
           mark->SetMarkerStyle(kPlus);
         }
         if (a_vertex.get_auxiliaries().has_flag(browser_tracks::HIGHLIGHT_FLAG)) {
-          TPolyMarker3D *mark = base_renderer::make_polymarker(a_position);
-          _objects->Add(mark);
+          TPolyMarker3D *mark = this->add_polymarker(a_position);
           mark->SetMarkerColor(color);
           mark->SetMarkerStyle(kCircle);
         }
@@ -290,8 +283,7 @@ void visual_track_renderer::push_reconstructed_tracks() {
         for (const auto &ivtx : vtx) {
           vtces.push_back(ivtx.get().get_position());
         }
-        TPolyLine3D *track = base_renderer::make_polyline(vtces);
-        _objects->Add(track);
+        TPolyLine3D *track = this->add_polyline(vtces);
         track->SetLineColor(color);
         if (a_particle.get_auxiliaries().has_flag("__gamma_from_annihilation")) {
           track->SetLineStyle(kDashDotted);
@@ -340,8 +332,7 @@ void visual_track_renderer::push_reconstructed_tracks() {
       const snemo::datamodel::base_trajectory_pattern &a_pattern = a_trajectory.get_pattern();
       const auto &iw3dr =
           dynamic_cast<const geomtools::i_wires_3d_rendering &>(a_pattern.get_shape());
-      TPolyLine3D *track = base_renderer::make_track(iw3dr);
-      _objects->Add(track);
+      TPolyLine3D *track = this->add_track(iw3dr);
       track->SetLineColor(color);
     }
   }
@@ -8,7 +8,9 @@ list(APPEND FalaiseLibrary_HEADERS
   snemo/datamodels/data_model.h
   snemo/datamodels/event.h
   snemo/datamodels/event_header.h
+  snemo/datamodels/fast_codec.h
   snemo/datamodels/gg_track_utils.h
+  snemo/datamodels/handle_pool.h
   snemo/datamodels/helix_trajectory_pattern.h
   snemo/datamodels/line_trajectory_pattern.h
   snemo/datamodels/particle_track.h
@@ -18,6 +20,7 @@ list(APPEND FalaiseLibrary_HEADERS
   snemo/datamodels/tracker_cluster.h
   snemo/datamodels/tracker_clustering_data.h
   snemo/datamodels/tracker_clustering_solution.h
+  snemo/datamodels/tracker_hit_view.h
   snemo/datamodels/tracker_trajectory.h
   snemo/datamodels/tracker_trajectory_data.h
   snemo/datamodels/tracker_trajectory_solution.h
@@ -46,6 +49,7 @@ list(APPEND FalaiseLibrary_HEADERS
   snemo/geometry/xcalo_locator.h
   snemo/geometry/gg_locator.h
   snemo/geometry/gveto_locator.h
+  snemo/geometry/front_cell_table.h
   snemo/geometry/locator_helpers.h
   snemo/geometry/locator_plugin.h
   snemo/geometry/mapped_magnetic_field.h
@@ -53,6 +57,7 @@ list(APPEND FalaiseLibrary_HEADERS
   snemo/simulation/cosmic_muon_generator.h
   snemo/simulation/gg_step_hit_processor.h
   snemo/simulation/calorimeter_step_hit_processor.h
+  snemo/simulation/inverse_cdf_sampler.h
 
   snemo/processing/calorimeter_regime.h
   snemo/processing/geiger_regime.h
@@ -79,10 +84,12 @@ list(APPEND FalaiseLibrary_HEADERS
 
 list(APPEND FalaiseLibrary_SOURCES
   snemo/datamodels/timestamp.cc
+  snemo/datamodels/event.cc
   snemo/datamodels/event_header.cc
   snemo/datamodels/calibrated_calorimeter_hit.cc
   snemo/datamodels/calibrated_tracker_hit.cc
   snemo/datamodels/calibrated_data.cc
+  snemo/datamodels/tracker_hit_view.cc
   snemo/datamodels/tracker_cluster.cc
   snemo/datamodels/tracker_clustering_solution.cc
   snemo/datamodels/tracker_clustering_data.cc
@@ -93,6 +100,7 @@ list(APPEND FalaiseLibrary_SOURCES
   snemo/datamodels/tracker_trajectory.cc
   snemo/datamodels/tracker_trajectory_solution.cc
   snemo/datamodels/tracker_trajectory_data.cc
+  snemo/datamodels/fast_codec.cc
   snemo/datamodels/particle_track.cc
   snemo/datamodels/particle_track_data.cc
   snemo/datamodels/data_model.cc
@@ -103,6 +111,7 @@ list(APPEND FalaiseLibrary_SOURCES
   snemo/geometry/xcalo_locator.cc
   snemo/geometry/gg_locator.cc
   snemo/geometry/gveto_locator.cc
+  snemo/geometry/front_cell_table.cc
   snemo/geometry/locator_plugin.cc
   snemo/geometry/utils.cc
   snemo/geometry/mapped_magnetic_field.cc
@@ -138,15 +147,22 @@ list(APPEND FalaiseLibrary_SOURCES
   snemo/simulation/cosmic_muon_generator.cc
   snemo/simulation/gg_step_hit_processor.cc
   snemo/simulation/calorimeter_step_hit_processor.cc
+  snemo/simulation/inverse_cdf_sampler.cc
 
   snemo/cuts/event_header_cut.cc
   snemo/cuts/simulated_data_cut.cc
   )
 
 list(APPEND FalaiseLibrary_TESTS_CATCH
+  snemo/test/test_snemo_cuts.cxx
   snemo/test/test_snemo_datamodel_event.cxx
+  snemo/test/test_snemo_datamodel_fast_codec.cxx
+  snemo/test/test_snemo_datamodel_handle_pool.cxx
   snemo/test/test_snemo_datamodel_timestamp.cxx
+  snemo/test/test_snemo_datamodel_tracker_hit_view.cxx
+  snemo/test/test_snemo_geometry_front_cell_table.cxx
   snemo/test/test_snemo_geometry_gveto_locator_2.cxx
+  snemo/test/test_snemo_simulation_inverse_cdf_sampler.cxx
   snemo/test/test_filter.cxx
   snemo/test/test_module.cxx
   snemo/test/test_service.cxx
@@ -4,7 +4,9 @@
 #include "falaise/snemo/cuts/event_header_cut.h"
 
 // Standard library:
+#include <algorithm>
 #include <fstream>
+#include <limits>
 #include <sstream>
 #include <stdexcept>
 
@@ -21,6 +23,14 @@ namespace snemo {
 
 namespace cut {
 
+namespace {
+/// Pack the run and event numbers of an event ID in one integer
+uint64_t packEventID(const datatools::event_id& id) {
+  return (static_cast<uint64_t>(static_cast<uint32_t>(id.get_run_number())) << 32) |
+         static_cast<uint32_t>(id.get_event_number());
+}
+}  // namespace
+
 // Registration instantiation macro :
 CUT_REGISTRATION_IMPLEMENT(event_header_cut, "snemo::cut::event_header_cut")
 
@@ -89,6 +99,7 @@ void event_header_cut::initialize(const datatools::properties& dps,
   DT_THROW_IF(cutMode_ == mode_t::UNDEFINED, std::logic_error,
               "Missing at least a 'mode.XXX' property ! ");
 
+  compileProgram();
   this->i_cut::_set_initialized(true);
 }
 
@@ -106,17 +117,32 @@ bool event_header_cut::cutsOnEventNumber() const { return (cutMode_ & mode_t::EV
 
 bool event_header_cut::cutsOnEventIDs() const { return (cutMode_ & mode_t::EVENT_ID_LIST) != 0u; }
 
-void event_header_cut::setFlagLabel(const std::string& label) { flagLabel_ = label; }
+void event_header_cut::setFlagLabel(const std::string& label) {
+  flagLabel_ = label;
+  compileProgram();
+}
 
 const std::string& event_header_cut::getFlagLabel() const { return flagLabel_; }
 
-void event_header_cut::setMinRunNumber(int min) { minRunNumber_ = min >= 0 ? min : -1; }
+void event_header_cut::setMinRunNumber(int min) {
+  minRunNumber_ = min >= 0 ? min : -1;
+  compileProgram();
+}
 
-void event_header_cut::setMaxRunNumber(int max) { maxRunNumber_ = max >= 0 ? max : -1; }
+void event_header_cut::setMaxRunNumber(int max) {
+  maxRunNumber_ = max >= 0 ? max : -1;
+  compileProgram();
+}
 
-void event_header_cut::setMinEventNumber(int min) { minEventNumber_ = min >= 0 ? min : -1; }
+void event_header_cut::setMinEventNumber(int min) {
+  minEventNumber_ = min >= 0 ? min : -1;
+  compileProgram();
+}
 
-void event_header_cut::setMaxEventNumber(int max) { maxEventNumber_ = max >= 0 ? max : -1; }
+void event_header_cut::setMaxEventNumber(int max) {
+  maxEventNumber_ = max >= 0 ? max : -1;
+  compileProgram();
+}
 
 void event_header_cut::loadEventIDList(const std::string& fname) {
   std::string filename = fname;
@@ -153,6 +179,7 @@ void event_header_cut::loadEventIDList(const std::string& fname) {
   }
 
   cutMode_ |= mode_t::EVENT_ID_LIST;
+  compileProgram();
 }
 
 void event_header_cut::_set_defaults() {
@@ -163,73 +190,79 @@ void event_header_cut::_set_defaults() {
   maxRunNumber_ = -1;
   minEventNumber_ = -1;
   maxEventNumber_ = -1;
+  eventIDs_.clear();
+  compileProgram();
 }
 
-int event_header_cut::_accept() {
-  uint32_t cut_returned = cuts::SELECTION_INAPPLICABLE;
+void event_header_cut::compileProgram() {
+  program_.clear();
+  requiresValidID_ = false;
+  packedEventIDs_.clear();
+
+  // Integer criteria on the event ID come first, the property lookup last
+  if (cutsOnRunNumber() || cutsOnEventNumber() || cutsOnEventIDs()) {
+    requiresValidID_ = true;
+  }
+  if (cutsOnRunNumber() && (minRunNumber_ >= 0 || maxRunNumber_ >= 0)) {
+    program_.push_back({opcode::RUN_NUMBER, minRunNumber_,
+                        maxRunNumber_ >= 0 ? maxRunNumber_ : std::numeric_limits<int>::max()});
+  }
+  if (cutsOnEventNumber() && (minEventNumber_ >= 0 || maxEventNumber_ >= 0)) {
+    program_.push_back(
+        {opcode::EVENT_NUMBER, minEventNumber_,
+         maxEventNumber_ >= 0 ? maxEventNumber_ : std::numeric_limits<int>::max()});
+  }
+  if (cutsOnEventIDs()) {
+    for (const datatools::event_id& id : eventIDs_) {
+      packedEventIDs_.push_back(packEventID(id));
+    }
+    std::sort(packedEventIDs_.begin(), packedEventIDs_.end());
+    program_.push_back({opcode::EVENT_ID_LIST, 0, 0});
+  }
+  if (cutsOnFlag()) {
+    program_.push_back({opcode::FLAG, 0, 0});
+  }
+}
 
+int event_header_cut::_accept() {
   // Get event record
   const auto& ER = get_user_data<datatools::things>();
 
   if (!ER.has(eventHeaderTag_)) {
-    return cut_returned;
+    return cuts::SELECTION_INAPPLICABLE;
   }
 
   // Get event header bank
   const auto& EH = ER.get<snemo::datamodel::event_header>(eventHeaderTag_);
+  const datatools::event_id& id = EH.get_id();
 
-  // Check if the event header has a property flag with a specific name :
-  bool check_flag = true;
-  if (cutsOnFlag()) {
-    check_flag = EH.get_properties().has_flag(flagLabel_);
-  }
-
-  // Check if the event ID has a run number within some interval :
-  bool check_run_number = true;
-  if (cutsOnRunNumber()) {
-    if (!EH.get_id().is_valid()) {
-      return cut_returned;
-    }
-    const int rn = EH.get_id().get_run_number();
-    if (minRunNumber_ >= 0 && rn < minRunNumber_) {
-      check_run_number = false;
-    }
-    if (maxRunNumber_ >= 0 && rn > maxRunNumber_) {
-      check_run_number = false;
-    }
+  // Criteria on the event ID do not apply to events without a valid one
+  if (requiresValidID_ && !id.is_valid()) {
+    return cuts::SELECTION_INAPPLICABLE;
   }
 
-  // Check if the event ID has a event number within some interval :
-  bool check_event_number = true;
-  if (cutsOnEventNumber()) {
-    if (!EH.get_id().is_valid()) {
-      return cut_returned;
-    }
-    const int en = EH.get_id().get_event_number();
-    if (minEventNumber_ >= 0 && en < minEventNumber_) {
-      check_event_number = false;
+  for (const instruction& step : program_) {
+    bool check = true;
+    switch (step.op) {
+      case opcode::RUN_NUMBER:
+        check = id.get_run_number() >= step.min && id.get_run_number() <= step.max;
+        break;
+      case opcode::EVENT_NUMBER:
+        check = id.get_event_number() >= step.min && id.get_event_number() <= step.max;
+        break;
+      case opcode::EVENT_ID_LIST:
+        check = std::binary_search(packedEventIDs_.begin(), packedEventIDs_.end(), packEventID(id));
+        break;
+      case opcode::FLAG:
+        check = EH.get_properties().has_flag(flagLabel_);
+        break;
     }
-    if (maxEventNumber_ >= 0 && en > maxEventNumber_) {
-      check_event_number = false;
-    }
-  }
-
-  // Check if the event ID belongs to a given list :
-  bool check_list_of_events = true;
-  if (cutsOnEventIDs()) {
-    if (!EH.get_id().is_valid()) {
-      return cut_returned;
+    if (!check) {
+      return cuts::SELECTION_REJECTED;
     }
-    auto found = eventIDs_.find(EH.get_id());
-    check_list_of_events = (found != eventIDs_.end());
-  }
-
-  cut_returned = cuts::SELECTION_REJECTED;
-  if (check_flag && check_run_number && check_event_number && check_list_of_events) {
-    cut_returned = cuts::SELECTION_ACCEPTED;
   }
 
-  return cut_returned;
+  return cuts::SELECTION_ACCEPTED;
 }
 
 }  // namespace cut
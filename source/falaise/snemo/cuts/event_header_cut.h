@@ -37,6 +37,7 @@
 #include <iostream>
 #include <set>
 #include <string>
+#include <vector>
 
 // Third party:
 // - Boost:
@@ -127,6 +128,19 @@ class event_header_cut : public cuts::i_cut {
   virtual int _accept();
 
  private:
+  /// \brief Operation of a compiled criterion
+  enum class opcode { RUN_NUMBER, EVENT_NUMBER, EVENT_ID_LIST, FLAG };
+
+  /// \brief Criterion compiled from the configuration of the cut
+  struct instruction {
+    opcode op;
+    int min;  //!< Lower bound of a number range
+    int max;  //!< Upper bound of a number range
+  };
+
+  /// Compile the criteria of the cut mode into the program run on each event
+  void compileProgram();
+
   std::string eventHeaderTag_;  //!< Name of the "Event header" bank
   uint32_t cutMode_;            //!< Mode of the cut
 
@@ -141,6 +155,10 @@ class event_header_cut : public cuts::i_cut {
 
   std::set<datatools::event_id> eventIDs_;
 
+  std::vector<instruction> program_;      //!< Criteria, cheapest first, all of which must pass
+  bool requiresValidID_;                  //!< Flag for criteria on the event ID
+  std::vector<uint64_t> packedEventIDs_;  //!< Sorted run and event numbers of the event ID list
+
   // Macro to automate the registration of the cut :
   CUT_REGISTRATION_INTERFACE(event_header_cut)
 };
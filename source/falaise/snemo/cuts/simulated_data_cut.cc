@@ -4,6 +4,8 @@
 #include <falaise/snemo/cuts/simulated_data_cut.h>
 
 /// Standard library:
+#include <algorithm>
+#include <limits>
 #include <sstream>
 #include <stdexcept>
 
@@ -22,6 +24,15 @@ namespace snemo {
 
 namespace cut {
 
+namespace {
+/// Check if properties have a string property with one of the sorted values
+bool hasStringValue(const datatools::properties& props, const std::string& key,
+                    const std::vector<std::string>& values) {
+  return props.has_key(key) && props.is_string(key) &&
+         std::binary_search(values.begin(), values.end(), props.fetch_string(key));
+}
+}  // namespace
+
 // Registration instantiation macro :
 CUT_REGISTRATION_IMPLEMENT(simulated_data_cut, "snemo::cut::simulated_data_cut")
 
@@ -89,6 +100,7 @@ void simulated_data_cut::initialize(const datatools::properties& dps,
   DT_THROW_IF(cutMode_ == mode_t::UNDEFINED, std::logic_error,
               "Missing at least a 'mode.XXX' property ! ");
 
+  compileProgram();
   this->i_cut::_set_initialized(true);
 }
 
@@ -112,7 +124,10 @@ bool simulated_data_cut::cutsOnHitProperty() const {
   return (cutMode_ & mode_t::HAS_HIT_PROPERTY) != 0u;
 }
 
-void simulated_data_cut::setFlagLabel(const std::string& label) { flagLabel_ = label; }
+void simulated_data_cut::setFlagLabel(const std::string& label) {
+  flagLabel_ = label;
+  compileProgram();
+}
 
 const std::string& simulated_data_cut::getFlagLabel() const { return flagLabel_; }
 
@@ -124,114 +139,118 @@ void simulated_data_cut::_set_defaults() {
   minHitCount_ = -1;
   maxHitCount_ = -1;
   hitPropertyLogic_ = "";
+  hitPropertyMap_.clear();
+  compileProgram();
 }
 
-int simulated_data_cut::_accept() {
-  int cut_returned = cuts::SELECTION_INAPPLICABLE;
+void simulated_data_cut::compileProgram() {
+  program_.clear();
+  requiresHitCategory_ = cutsOnHitCount() || cutsOnHitProperty();
+  hitPropertyAnd_ = hitPropertyLogic_ == "and";
+  hitProperties_.clear();
+
+  // Hit counts come first, the lookups of properties last
+  if (cutsOnHitCount()) {
+    program_.push_back({opcode::HIT_COUNT,
+                        minHitCount_ >= 0 ? static_cast<size_t>(minHitCount_) : 0,
+                        maxHitCount_ >= 0 ? static_cast<size_t>(maxHitCount_)
+                                          : std::numeric_limits<size_t>::max()});
+  }
+  if (cutsOnHitCategory()) {
+    program_.push_back({opcode::HAS_HIT_CATEGORY, 0, 0});
+  }
+  if (cutsOnFlag()) {
+    program_.push_back({opcode::FLAG, 0, 0});
+  }
+  if (cutsOnHitProperty()) {
+    for (const auto& entry : hitPropertyMap_) {
+      hitProperties_.push_back({entry.first, entry.second});
+      std::sort(hitProperties_.back().values.begin(), hitProperties_.back().values.end());
+    }
+    program_.push_back({opcode::HIT_PROPERTY, 0, 0});
+  }
+}
 
+int simulated_data_cut::_accept() {
   // Get event record
   const auto& ER = get_user_data<datatools::things>();
 
   if (!ER.has(SDTag_)) {
-    return cut_returned;
+    return cuts::SELECTION_INAPPLICABLE;
   }
 
   // Get simulated data bank
   const auto& SD = ER.get<mctools::simulated_data>(SDTag_);
 
-  // Check if the simulated data has a property flag with a specific name :
-  bool check_flag = true;
-  if (cutsOnFlag()) {
-    check_flag = SD.get_properties().has_flag(flagLabel_);
+  // Look up the hit category once for all the criteria
+  const mctools::simulated_data::hit_handle_collection_type* hits = nullptr;
+  if ((requiresHitCategory_ || cutsOnHitCategory()) && SD.has_step_hits(hitCategory_)) {
+    hits = &SD.get_step_hits(hitCategory_);
   }
-
-  // Check if the simulated data has some specific category of hits :
-  bool check_has_hit_category = true;
-  if (cutsOnHitCategory()) {
-    check_has_hit_category = SD.has_step_hits(hitCategory_);
+  if (requiresHitCategory_ && hits == nullptr) {
+    return cuts::SELECTION_INAPPLICABLE;
   }
 
-  // Check if the simulated data has some specific category of hits :
-  bool check_range_hit_category = true;
-  if (cutsOnHitCount()) {
-    if (!SD.has_step_hits(hitCategory_)) {
-      return cuts::SELECTION_INAPPLICABLE;
-    }
-    const size_t nhits = SD.get_number_of_step_hits(hitCategory_);
-    bool check = true;
-    if (minHitCount_ >= 0) {
-      if (nhits < (size_t)minHitCount_) {
-        check = false;
-      }
-    }
-    if (maxHitCount_ >= 0) {
-      if (nhits > (size_t)maxHitCount_) {
-        check = false;
-      }
-    }
-    if (!check) {
-      check_range_hit_category = false;
-    }
-  }
+  using hit_handle = mctools::simulated_data::hit_handle_type;
+  using hit_collection = mctools::simulated_data::hit_handle_collection_type;
 
-  // Check if the simulated step hits have some property value :
-  bool check_has_hit_property = true;
-  if (cutsOnHitProperty()) {
-    if (!SD.has_step_hits(hitCategory_)) {
-      return cuts::SELECTION_INAPPLICABLE;
+  // A step hit has a hit property
+  auto hasProperty = [](const hit_handle& hit, const property_values& property) {
+    return hit.has_data() &&
+           hasStringValue(hit.get().get_auxiliaries(), property.key, property.values);
+  };
+
+  // 'or' logic: a step hit has one of the hit properties
+  auto hasAnyProperty = [this, &hasProperty](const hit_handle& hit) -> bool {
+    for (const property_values& property : hitProperties_) {
+      if (hasProperty(hit, property)) {
+        return true;
+      }
     }
-    const mctools::simulated_data::hit_handle_collection_type& the_step_hits =
-        SD.get_step_hits(hitCategory_);
-
-    // Iterators
-    auto istart = the_step_hits.begin();
-    auto istop = the_step_hits.end();
-    auto iprop = hitPropertyMap_.begin();
-
-    while (iprop != hitPropertyMap_.end()) {
-      const std::string& a_key = iprop->first;
-      const std::vector<std::string>& the_values = iprop->second;
-      geomtools::base_hit::has_string_property_predicate str_pred(a_key, the_values);
-      datatools::mother_to_daughter_predicate<geomtools::base_hit, mctools::base_step_hit> pred(
-          str_pred);
-      datatools::handle_predicate<mctools::base_step_hit> pred_via_handle(pred);
-
-      // Update iterator position
-      auto ifound = std::find_if(istart, istop, pred_via_handle);
-      if (ifound == the_step_hits.end()) {
-        check_has_hit_property = false;
-        if (hitPropertyLogic_ == "and") {
+    return false;
+  };
+
+  // 'and' logic: one of the step hits has all the hit properties
+  auto hasAllProperties = [this, &hasProperty](const hit_collection& hits) -> bool {
+    for (const hit_handle& hit : hits) {
+      bool all = true;
+      for (const property_values& property : hitProperties_) {
+        if (!hasProperty(hit, property)) {
+          all = false;
           break;
         }
-        // Go to the next property (OR mode)
-        istart = the_step_hits.begin();
-        istop = the_step_hits.end();
-        iprop++;
-      } else if (ifound == istop) {
-        // This hit does not fulfill requirement : restart to first
-        // property but at different iterator position
-        istart = ++ifound;
-        istop = the_step_hits.end();
-        iprop = hitPropertyMap_.begin();
-      } else {
-        // Found one hit : check next property for this hit
-        check_has_hit_property = true;
-        if (hitPropertyLogic_ == "or") {
-          break;
-        }
-        istart = ifound;
-        istop = ++ifound;
-        iprop++;
+      }
+      if (all) {
+        return true;
       }
     }
-  }
+    return false;
+  };
 
-  cut_returned = cuts::SELECTION_REJECTED;
-  if (check_flag && check_has_hit_category && check_range_hit_category && check_has_hit_property) {
-    cut_returned = cuts::SELECTION_ACCEPTED;
+  for (const instruction& step : program_) {
+    bool check = true;
+    switch (step.op) {
+      case opcode::HIT_COUNT:
+        check = hits->size() >= step.min && hits->size() <= step.max;
+        break;
+      case opcode::HAS_HIT_CATEGORY:
+        check = hits != nullptr;
+        break;
+      case opcode::FLAG:
+        check = SD.get_properties().has_flag(flagLabel_);
+        break;
+      case opcode::HIT_PROPERTY:
+        check = hitProperties_.empty() ||
+                (hitPropertyAnd_ ? hasAllProperties(*hits)
+                                 : std::any_of(hits->begin(), hits->end(), hasAnyProperty));
+        break;
+    }
+    if (!check) {
+      return cuts::SELECTION_REJECTED;
+    }
   }
 
-  return cut_returned;
+  return cuts::SELECTION_ACCEPTED;
 }
 
 }  // namespace cut
@@ -34,7 +34,9 @@
 #define FALAISE_SNEMO_CUT_SIMULATED_DATA_CUT_H 1
 
 // Standard library:
+#include <map>
 #include <string>
+#include <vector>
 
 // Third party:
 // - Boost:
@@ -115,6 +117,25 @@ class simulated_data_cut : public cuts::i_cut {
   virtual int _accept();
 
  private:
+  /// \brief Operation of a compiled criterion
+  enum class opcode { HIT_COUNT, HAS_HIT_CATEGORY, FLAG, HIT_PROPERTY };
+
+  /// \brief Criterion compiled from the configuration of the cut
+  struct instruction {
+    opcode op;
+    size_t min;  //!< Minimal number of hits
+    size_t max;  //!< Maximal number of hits
+  };
+
+  /// \brief Accepted string values of a step hit property
+  struct property_values {
+    std::string key;                  //!< Name of the property
+    std::vector<std::string> values;  //!< Sorted accepted values
+  };
+
+  /// Compile the criteria of the cut mode into the program run on each event
+  void compileProgram();
+
   std::string SDTag_;  //!< Name of the "Simulated data" bank
   uint32_t cutMode_;   //!< Mode of the cut
 
@@ -128,6 +149,11 @@ class simulated_data_cut : public cuts::i_cut {
   std::map<std::string, std::vector<std::string> >
       hitPropertyMap_;  //!< Values of the 'step_hit' property to look for
 
+  std::vector<instruction> program_;  //!< Criteria, cheapest first, all of which must pass
+  bool requiresHitCategory_;          //!< Flag for criteria not applicable without the category
+  bool hitPropertyAnd_;               //!< Flag for the 'and' logic between hit properties
+  std::vector<property_values> hitProperties_;  //!< Hit properties to look for
+
   // Macro to automate the registration of the cut :
   CUT_REGISTRATION_INTERFACE(simulated_data_cut)
 };
@@ -31,6 +31,8 @@ void calibrated_data::serialize(Archive& ar, const unsigned int version) {
   ar& boost::serialization::make_nvp("calibrated_calorimeter_hits", calorimeter_hits_);
   ar& boost::serialization::make_nvp("calibrated_tracker_hits", tracker_hits_);
   ar& boost::serialization::make_nvp("properties", _properties_);
+  // Loaded hits are not those of the cached view
+  tracker_hits_view_valid_ = false;
 }
 
 }  // end of namespace datamodel
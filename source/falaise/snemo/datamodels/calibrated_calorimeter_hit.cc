@@ -50,6 +50,8 @@ void calibrated_calorimeter_hit::invalidate() {
   datatools::invalidate(sigma_time_);
 }
 
+void calibrated_calorimeter_hit::clear() { calibrated_calorimeter_hit::invalidate(); }
+
 void calibrated_calorimeter_hit::tree_dump(std::ostream& out, const std::string& title,
                                            const std::string& indent, bool is_last) const {
   base_hit::tree_dump(out, title, indent, true);
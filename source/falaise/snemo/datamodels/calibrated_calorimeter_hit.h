@@ -74,6 +74,9 @@ class calibrated_calorimeter_hit : public geomtools::base_hit {
   /// Invalidate the internal data of hit
   void invalidate();
 
+  /// Reset the hit, as invalidate()
+  virtual void clear();
+
   /// Smart print
   virtual void tree_dump(std::ostream& out = std::clog, const std::string& title = "",
                          const std::string& indent = "", bool is_last = false) const;
@@ -84,6 +87,8 @@ class calibrated_calorimeter_hit : public geomtools::base_hit {
   double time_{datatools::invalid_real()};          //!< Time associated to the hit
   double sigma_time_{datatools::invalid_real()};    //!< Error on the time associated to the hit
 
+  friend class fast_codec;
+
   DATATOOLS_SERIALIZATION_DECLARATION()
 };
 
@@ -23,12 +23,28 @@ CalorimeterHitHdlCollection& calibrated_data::calorimeter_hits() { return calori
 
 const TrackerHitHdlCollection& calibrated_data::tracker_hits() const { return tracker_hits_; }
 
-TrackerHitHdlCollection& calibrated_data::tracker_hits() { return tracker_hits_; }
+TrackerHitHdlCollection& calibrated_data::tracker_hits() {
+  tracker_hits_view_valid_ = false;
+  return tracker_hits_;
+}
+
+const tracker_hit_view& calibrated_data::tracker_hits_view(
+    const tracker_hit_view::address_indices& address) const {
+  // A copied object holds a view of the original collection
+  if (!tracker_hits_view_valid_ || !tracker_hits_view_.is_view_of(tracker_hits_) ||
+      !(tracker_hits_view_.address() == address)) {
+    tracker_hits_view_.assign(tracker_hits_, address);
+    tracker_hits_view_valid_ = true;
+  }
+  return tracker_hits_view_;
+}
 
 void calibrated_data::clear() {
   calorimeter_hits_.clear();
   tracker_hits_.clear();
   _properties_.clear();
+  tracker_hits_view_.clear();
+  tracker_hits_view_valid_ = false;
 }
 
 void calibrated_data::tree_dump(std::ostream& out, const std::string& title,
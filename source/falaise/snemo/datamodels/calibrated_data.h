@@ -35,6 +35,7 @@
 // This project :
 #include <falaise/snemo/datamodels/calibrated_calorimeter_hit.h>
 #include <falaise/snemo/datamodels/calibrated_tracker_hit.h>
+#include <falaise/snemo/datamodels/tracker_hit_view.h>
 
 namespace snemo {
 
@@ -55,8 +56,17 @@ class calibrated_data : public datatools::i_serializable,
   const TrackerHitHdlCollection& tracker_hits() const;
 
   /// Return the mutable collection of tracker hits
+  /// Invalidates the view returned by tracker_hits_view()
   TrackerHitHdlCollection& tracker_hits();
 
+  /// Return a struct-of-arrays view of the tracker hits
+  /// The view is built on the first call of an event and shared by all later
+  /// calls, e.g. by the clusterizer and the fitter, until the collection is
+  /// accessed through the mutable tracker_hits() or the event is cleared or
+  /// loaded. It must not be requested concurrently from several threads.
+  const tracker_hit_view& tracker_hits_view(
+      const tracker_hit_view::address_indices& address) const;
+
   /// Clear attributes
   virtual void clear();
 
@@ -71,6 +81,11 @@ class calibrated_data : public datatools::i_serializable,
   datatools::properties
       _properties_;  //!< Auxiliary properties (only retained for serialization compat)
 
+  mutable tracker_hit_view tracker_hits_view_;    //!< Cached view of tracker hits (not serialized)
+  mutable bool tracker_hits_view_valid_{false};  //!< Validity of the cached view
+
+  friend class fast_codec;
+
   DATATOOLS_SERIALIZATION_DECLARATION()
 };
 
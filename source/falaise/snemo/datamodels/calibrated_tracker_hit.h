@@ -210,6 +210,8 @@ class calibrated_tracker_hit : public geomtools::base_hit {
   double delayed_time_{datatools::invalid_real()};        //!< Delayed reference time
   double delayed_time_error_{datatools::invalid_real()};  //!< Delayed reference time error
 
+  friend class fast_codec;
+
   DATATOOLS_SERIALIZATION_DECLARATION()
 };
 
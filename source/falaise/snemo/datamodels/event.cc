@@ -0,0 +1,45 @@
+/// \file falaise/snemo/datamodels/event.cc
+
+// Ourselves:
+#include <falaise/snemo/datamodels/event.h>
+
+// Standard library:
+#include <vector>
+
+// This project:
+#include <falaise/snemo/datamodels/calibrated_data.h>
+#include <falaise/snemo/datamodels/event_header.h>
+#include <falaise/snemo/datamodels/particle_track_data.h>
+#include <falaise/snemo/datamodels/tracker_clustering_data.h>
+#include <falaise/snemo/datamodels/tracker_trajectory_data.h>
+
+namespace snedm {
+
+namespace {
+template <typename T>
+bool clearBank(event_record& event, const std::string& key) {
+  if (!event.is_a<T>(key)) {
+    return false;
+  }
+  event.grab<T>(key).clear();
+  return true;
+}
+}  // namespace
+
+void resetEvent(event_record& event) {
+  namespace sdm = snemo::datamodel;
+  std::vector<std::string> keys;
+  event.get_names(keys);
+  for (const std::string& key : keys) {
+    const bool cleared = clearBank<sdm::event_header>(event, key) ||
+                         clearBank<sdm::calibrated_data>(event, key) ||
+                         clearBank<sdm::tracker_clustering_data>(event, key) ||
+                         clearBank<sdm::tracker_trajectory_data>(event, key) ||
+                         clearBank<sdm::particle_track_data>(event, key);
+    if (!cleared) {
+      event.remove(key);
+    }
+  }
+}
+
+}  // namespace snedm
@@ -110,6 +110,30 @@ T& addToEvent(std::string const& key, event_record& event) {
   return event.add<T>(key);
 }
 
+//! Reset the banks of an event_record in place for the next event
+/*!
+ * Recycling the same event_record across events avoids destroying and
+ * reallocating every bank:
+ *
+ * ```cpp
+ * snedm::event_record event;
+ * while (...) {
+ *   snedm::resetEvent(event);  // in place of event.clear()
+ *   ...
+ * }
+ * ```
+ *
+ * Banks of the Falaise data model types (event header, calibrated,
+ * tracker clustering, tracker trajectory and particle track data) stay in
+ * the record, emptied through their clear() method so that their handle
+ * collections keep their capacity. Modules retrieving them through
+ * getOrAddToEvent then fill the same objects again. Any other bank, such as
+ * the simulated data rebuilt by the simulation module, is removed.
+ *
+ * \param[in] event event_record to reset
+ */
+void resetEvent(event_record& event);
+
 }  // namespace snedm
 
 #endif
\ No newline at end of file
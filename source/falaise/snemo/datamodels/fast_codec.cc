@@ -0,0 +1,944 @@
+// falaise/snemo/datamodels/fast_codec.cc
+
+// Ourselves:
+#include <falaise/snemo/datamodels/fast_codec.h>
+
+// Standard library:
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+// Third party:
+// - Boost:
+#include <boost/serialization/nvp.hpp>
+#include <boost/serialization/vector.hpp>
+// - Bayeux/datatools:
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wshadow"
+#endif
+#include <datatools/eos/portable_iarchive.hpp>
+#include <datatools/eos/portable_oarchive.hpp>
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
+#include <datatools/exception.h>
+
+// This project:
+#include <falaise/snemo/datamodels/boost_io/calibrated_data.ipp>
+#include <falaise/snemo/datamodels/boost_io/event_header.ipp>
+#include <falaise/snemo/datamodels/boost_io/particle_track_data.ipp>
+#include <falaise/snemo/datamodels/boost_io/tracker_clustering_data.ipp>
+#include <falaise/snemo/datamodels/boost_io/tracker_trajectory_data.ipp>
+
+namespace snemo {
+
+namespace datamodel {
+
+namespace {
+
+const char kMagic[4] = {'S', 'N', 'F', 'C'};
+
+/// Append little-endian values to a buffer
+class writer {
+ public:
+  explicit writer(std::string& buffer) : buffer_(buffer) {}
+
+  void u8(uint8_t value) { buffer_.push_back(static_cast<char>(value)); }
+  void u16(uint16_t value) { put(value, 2); }
+  void u32(uint32_t value) { put(value, 4); }
+  void u64(uint64_t value) { put(value, 8); }
+  void i32(int32_t value) { u32(static_cast<uint32_t>(value)); }
+  void i64(int64_t value) { u64(static_cast<uint64_t>(value)); }
+
+  void f64(double value) {
+    uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    u64(bits);
+  }
+
+  void raw(const char* data, std::size_t size) { buffer_.append(data, size); }
+
+  /// Open a length-prefixed block, returning the position of its length
+  std::size_t begin_block() {
+    const std::size_t at = buffer_.size();
+    u64(0);
+    return at;
+  }
+
+  /// Close the block opened at the given position
+  void end_block(std::size_t at) {
+    uint64_t length = buffer_.size() - at - 8;
+    for (std::size_t i = 0; i < 8; ++i) {
+      buffer_[at + i] = static_cast<char>(length & 0xff);
+      length >>= 8;
+    }
+  }
+
+ private:
+  void put(uint64_t value, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+      buffer_.push_back(static_cast<char>(value & 0xff));
+      value >>= 8;
+    }
+  }
+
+  std::string& buffer_;
+};
+
+/// Read little-endian values from a buffer
+class reader {
+ public:
+  explicit reader(const std::string& buffer) : buffer_(buffer) {}
+
+  uint8_t u8() { return static_cast<uint8_t>(get(1)); }
+  uint16_t u16() { return static_cast<uint16_t>(get(2)); }
+  uint32_t u32() { return static_cast<uint32_t>(get(4)); }
+  uint64_t u64() { return get(8); }
+  int32_t i32() { return static_cast<int32_t>(u32()); }
+  int64_t i64() { return static_cast<int64_t>(u64()); }
+
+  double f64() {
+    const uint64_t bits = u64();
+    double value = 0.0;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  const char* raw(std::size_t size) {
+    need(size);
+    const char* data = buffer_.data() + pos_;
+    pos_ += size;
+    return data;
+  }
+
+  /// Check that the buffer holds at least the given number of bytes past the current position
+  void need(uint64_t size) const {
+    DT_THROW_IF(size > buffer_.size() - pos_, std::range_error,
+                "Truncated fast codec buffer: " << size << " bytes needed at position " << pos_
+                                                << " of " << buffer_.size() << " !");
+  }
+
+  /// Enter a length-prefixed block, returning the position of its end
+  std::size_t begin_block() {
+    const uint64_t length = u64();
+    need(length);
+    return pos_ + length;
+  }
+
+  /// Check that the whole buffer has been read
+  void end_buffer() const {
+    DT_THROW_IF(pos_ != buffer_.size(), std::logic_error,
+                "Trailing bytes after position " << pos_ << " of fast codec buffer !");
+  }
+
+  /// Return the number of bytes left in the block ending at the given position
+  std::size_t left(std::size_t end) const { return end - pos_; }
+
+  /// Leave the block ending at the given position, which must have been fully read
+  void end_block(std::size_t end) const {
+    DT_THROW_IF(pos_ != end, std::logic_error,
+                "Malformed fast codec block ending at position " << end << " !");
+  }
+
+ private:
+  uint64_t get(std::size_t size) {
+    need(size);
+    uint64_t value = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+      value |= static_cast<uint64_t>(static_cast<unsigned char>(buffer_[pos_ + i])) << (8 * i);
+    }
+    pos_ += size;
+    return value;
+  }
+
+  const std::string& buffer_;
+  std::size_t pos_{0};
+};
+
+/// Check if properties are those of a default constructed object
+bool is_trivial(const datatools::properties& props) {
+  return props.empty() && props.get_description().empty();
+}
+
+/// Objects of a type referenced in a bank, numbered by first appearance
+template <class T>
+struct table {
+  std::vector<const T*> rows;
+  std::unordered_map<const T*, uint32_t> index;
+
+  /// Add an object, return false if it is already in the table
+  bool add(const T& object) {
+    if (!index.emplace(&object, static_cast<uint32_t>(rows.size())).second) {
+      return false;
+    }
+    rows.push_back(&object);
+    return true;
+  }
+
+  /// Return the reference of a handle: 0 if null, else its row plus one
+  uint32_t ref(const datatools::handle<T>& handle) const {
+    return handle.has_data() ? index.at(&handle.get()) + 1 : 0;
+  }
+};
+
+/// Return the handle of a reference in decoded rows
+template <class T>
+datatools::handle<T> resolve(const std::vector<datatools::handle<T>>& rows, uint32_t ref) {
+  DT_THROW_IF(ref > rows.size(), std::range_error,
+              "Invalid reference " << ref << " to one of " << rows.size() << " objects !");
+  return ref == 0 ? datatools::handle<T>{} : rows[ref - 1];
+}
+
+}  // namespace
+
+struct fast_codec::impl {
+  using vertices_type = particle_track::vertex_collection_type;
+
+  static void write_header(writer& out, bank_tag tag) {
+    out.raw(kMagic, sizeof(kMagic));
+    out.u16(format_version);
+    out.u16(tag);
+  }
+
+  static bank_tag read_header(reader& in) {
+    DT_THROW_IF(std::memcmp(in.raw(sizeof(kMagic)), kMagic, sizeof(kMagic)) != 0,
+                std::logic_error, "Not a fast codec buffer !");
+    const uint16_t version = in.u16();
+    DT_THROW_IF(version == 0 || version > format_version, std::logic_error,
+                "Unsupported fast codec format version " << version << " !");
+    const uint16_t tag = in.u16();
+    DT_THROW_IF(tag < EVENT_HEADER || tag > PARTICLE_TRACK_DATA, std::logic_error,
+                "Unknown fast codec bank tag " << tag << " !");
+    return static_cast<bank_tag>(tag);
+  }
+
+  /// Writes the objects of a bank
+  struct encoder {
+    encoder(std::string& buffer, bank_tag tag) : out(buffer) {
+      buffer.clear();
+      write_header(out, tag);
+    }
+
+    writer out;
+    table<calibrated_tracker_hit> tracker_hits;
+    table<calibrated_calorimeter_hit> calorimeter_hits;
+    table<tracker_cluster> clusters;
+    table<tracker_clustering_solution> clustering_solutions;
+    table<tracker_trajectory> trajectories;
+    table<tracker_trajectory_solution> trajectory_solutions;
+    table<particle_track> particles;
+
+    // Members written in the archive block, in order
+    std::vector<const datatools::properties*> archived_properties;
+    std::vector<const TrajectoryPatternHdl*> archived_patterns;
+    std::vector<const vertices_type*> archived_vertices;
+
+    // Gather the objects referenced from a bank in their tables
+    void gather(const TrackerHitHdl& hit) {
+      if (hit.has_data()) {
+        tracker_hits.add(hit.get());
+      }
+    }
+
+    void gather(const CalorimeterHitHdl& hit) {
+      if (hit.has_data()) {
+        calorimeter_hits.add(hit.get());
+      }
+    }
+
+    void gather(const TrackerClusterHdl& cluster) {
+      if (cluster.has_data() && clusters.add(cluster.get())) {
+        gather(cluster.get().hits_);
+      }
+    }
+
+    void gather(const TrackerClusteringSolutionHdl& solution) {
+      if (solution.has_data() && clustering_solutions.add(solution.get())) {
+        gather(solution.get().clusters_);
+        gather(solution.get().unclustered_hits_);
+      }
+    }
+
+    void gather(const TrackerTrajectoryHdl& trajectory) {
+      if (trajectory.has_data() && trajectories.add(trajectory.get())) {
+        gather(trajectory.get().cluster_);
+        gather(trajectory.get().orphans_);
+      }
+    }
+
+    void gather(const TrackerTrajectorySolutionHdl& solution) {
+      if (solution.has_data() && trajectory_solutions.add(solution.get())) {
+        gather(solution.get().solutions_);
+        gather(solution.get().trajectories_);
+        gather(solution.get().unfitted_);
+      }
+    }
+
+    void gather(const ParticleHdl& particle) {
+      if (particle.has_data() && particles.add(particle.get())) {
+        gather(particle.get().trajectory_);
+        gather(particle.get().associated_calorimeters_);
+      }
+    }
+
+    template <class T>
+    void gather(const std::vector<datatools::handle<T>>& handles) {
+      for (const auto& handle : handles) {
+        gather(handle);
+      }
+    }
+
+    // Columns
+    void write_properties(const datatools::properties& props) {
+      const bool archived = !is_trivial(props);
+      out.u8(archived ? 1 : 0);
+      if (archived) {
+        archived_properties.push_back(&props);
+      }
+    }
+
+    template <class Row>
+    void write_column(const table<Row>& rows, double Row::*member) {
+      for (const Row* row : rows.rows) {
+        out.f64(row->*member);
+      }
+    }
+
+    template <class Row, class T>
+    void write_ref_column(const table<Row>& rows, datatools::handle<T> Row::*member,
+                          const table<T>& targets) {
+      for (const Row* row : rows.rows) {
+        out.u32(targets.ref(row->*member));
+      }
+    }
+
+    template <class Row, class T>
+    void write_ref_lists(const table<Row>& rows, std::vector<datatools::handle<T>> Row::*member,
+                         const table<T>& targets) {
+      for (const Row* row : rows.rows) {
+        out.u32(static_cast<uint32_t>((row->*member).size()));
+      }
+      for (const Row* row : rows.rows) {
+        for (const auto& handle : row->*member) {
+          out.u32(targets.ref(handle));
+        }
+      }
+    }
+
+    template <class T>
+    void write_refs(const std::vector<datatools::handle<T>>& handles, const table<T>& targets) {
+      out.u32(static_cast<uint32_t>(handles.size()));
+      for (const auto& handle : handles) {
+        out.u32(targets.ref(handle));
+      }
+    }
+
+    /// Write the columns of the geomtools::base_hit part, for the members it stores
+    template <class Hit>
+    void write_base_hits(const table<Hit>& hits) {
+      out.u32(static_cast<uint32_t>(hits.rows.size()));
+      for (const Hit* hit : hits.rows) {
+        out.u32(hit->_store);
+      }
+      for (const Hit* hit : hits.rows) {
+        if ((hit->_store & geomtools::base_hit::STORE_HIT_ID) != 0u) {
+          out.i32(hit->get_hit_id());
+        }
+      }
+      for (const Hit* hit : hits.rows) {
+        if ((hit->_store & geomtools::base_hit::STORE_GEOM_ID) != 0u) {
+          out.u32(hit->get_geom_id().get_type());
+          out.u32(static_cast<uint32_t>(hit->get_geom_id().get_depth()));
+        }
+      }
+      for (const Hit* hit : hits.rows) {
+        if ((hit->_store & geomtools::base_hit::STORE_GEOM_ID) != 0u) {
+          const geomtools::geom_id& gid = hit->get_geom_id();
+          for (std::size_t i = 0; i < gid.get_depth(); ++i) {
+            out.u32(gid.get(i));
+          }
+        }
+      }
+      for (const Hit* hit : hits.rows) {
+        if ((hit->_store & geomtools::base_hit::STORE_AUXILIARIES) != 0u) {
+          write_properties(hit->get_auxiliaries());
+        }
+      }
+    }
+
+    // Tables
+    void write_tracker_hits() {
+      write_base_hits(tracker_hits);
+      for (const calibrated_tracker_hit* hit : tracker_hits.rows) {
+        out.u32(hit->traits_);
+      }
+      write_column(tracker_hits, &calibrated_tracker_hit::r_);
+      write_column(tracker_hits, &calibrated_tracker_hit::sigma_r_);
+      write_column(tracker_hits, &calibrated_tracker_hit::z_);
+      write_column(tracker_hits, &calibrated_tracker_hit::sigma_z_);
+      // Same optional members as the Boost serialization
+      for (const calibrated_tracker_hit* hit : tracker_hits.rows) {
+        if (hit->has_xy()) {
+          out.f64(hit->x_);
+          out.f64(hit->y_);
+        }
+      }
+      for (const calibrated_tracker_hit* hit : tracker_hits.rows) {
+        if (hit->is_delayed()) {
+          out.f64(hit->delayed_time_);
+          out.f64(hit->delayed_time_error_);
+        }
+      }
+    }
+
+    void write_calorimeter_hits() {
+      write_base_hits(calorimeter_hits);
+      write_column(calorimeter_hits, &calibrated_calorimeter_hit::energy_);
+      write_column(calorimeter_hits, &calibrated_calorimeter_hit::sigma_energy_);
+      write_column(calorimeter_hits, &calibrated_calorimeter_hit::time_);
+      write_column(calorimeter_hits, &calibrated_calorimeter_hit::sigma_time_);
+    }
+
+    void write_clusters() {
+      write_base_hits(clusters);
+      write_ref_lists(clusters, &tracker_cluster::hits_, tracker_hits);
+    }
+
+    void write_clustering_solutions() {
+      out.u32(static_cast<uint32_t>(clustering_solutions.rows.size()));
+      for (const tracker_clustering_solution* solution : clustering_solutions.rows) {
+        out.i32(solution->id_);
+      }
+      write_ref_lists(clustering_solutions, &tracker_clustering_solution::clusters_, clusters);
+      write_ref_lists(clustering_solutions, &tracker_clustering_solution::unclustered_hits_,
+                      tracker_hits);
+      for (const tracker_clustering_solution* solution : clustering_solutions.rows) {
+        write_properties(solution->auxiliaries_);
+      }
+    }
+
+    void write_trajectories() {
+      write_base_hits(trajectories);
+      write_ref_column(trajectories, &tracker_trajectory::cluster_, clusters);
+      write_ref_lists(trajectories, &tracker_trajectory::orphans_, tracker_hits);
+      for (const tracker_trajectory* trajectory : trajectories.rows) {
+        const bool archived = trajectory->pattern_.has_data();
+        out.u8(archived ? 1 : 0);
+        if (archived) {
+          archived_patterns.push_back(&trajectory->pattern_);
+        }
+      }
+    }
+
+    void write_trajectory_solutions() {
+      out.u32(static_cast<uint32_t>(trajectory_solutions.rows.size()));
+      for (const tracker_trajectory_solution* solution : trajectory_solutions.rows) {
+        out.i32(solution->id_);
+      }
+      write_ref_column(trajectory_solutions, &tracker_trajectory_solution::solutions_,
+                       clustering_solutions);
+      write_ref_lists(trajectory_solutions, &tracker_trajectory_solution::trajectories_,
+                      trajectories);
+      write_ref_lists(trajectory_solutions, &tracker_trajectory_solution::unfitted_, clusters);
+      for (const tracker_trajectory_solution* solution : trajectory_solutions.rows) {
+        write_properties(solution->_auxiliaries_);
+      }
+    }
+
+    void write_particles() {
+      write_base_hits(particles);
+      for (const particle_track* particle : particles.rows) {
+        out.i32(particle->charge_from_source_);
+      }
+      write_ref_column(particles, &particle_track::trajectory_, trajectories);
+      for (const particle_track* particle : particles.rows) {
+        const bool archived = !particle->vertices_.empty();
+        out.u8(archived ? 1 : 0);
+        if (archived) {
+          archived_vertices.push_back(&particle->vertices_);
+        }
+      }
+      write_ref_lists(particles, &particle_track::associated_calorimeters_, calorimeter_hits);
+    }
+
+    /// Write the blocks of all the tables, in dependency order
+    void write_tables() {
+      using table_writer = void (encoder::*)();
+      for (table_writer write :
+           {&encoder::write_tracker_hits, &encoder::write_calorimeter_hits,
+            &encoder::write_clusters, &encoder::write_clustering_solutions,
+            &encoder::write_trajectories, &encoder::write_trajectory_solutions,
+            &encoder::write_particles}) {
+        const std::size_t block = out.begin_block();
+        (this->*write)();
+        out.end_block(block);
+      }
+    }
+
+    /// Write the archive block
+    void write_archive() {
+      const std::size_t block = out.begin_block();
+      if (!archived_properties.empty() || !archived_patterns.empty() ||
+          !archived_vertices.empty()) {
+        std::ostringstream archive;
+        {
+          eos::portable_oarchive oa(archive);
+          for (const datatools::properties* props : archived_properties) {
+            oa << boost::serialization::make_nvp("properties", *props);
+          }
+          for (const TrajectoryPatternHdl* pattern : archived_patterns) {
+            oa << boost::serialization::make_nvp("pattern", *pattern);
+          }
+          for (const vertices_type* vertices : archived_vertices) {
+            oa << boost::serialization::make_nvp("vertices", *vertices);
+          }
+        }
+        const std::string bytes = archive.str();
+        out.raw(bytes.data(), bytes.size());
+      }
+      out.end_block(block);
+    }
+  };
+
+  /// Reads the objects of a bank
+  struct decoder {
+    decoder(const std::string& buffer, bank_tag tag) : in(buffer) {
+      const bank_tag found = read_header(in);
+      DT_THROW_IF(found != tag, std::logic_error,
+                  "Fast codec buffer holds bank " << found << ", not bank " << tag << " !");
+    }
+
+    reader in;
+    std::vector<TrackerHitHdl> tracker_hits;
+    std::vector<CalorimeterHitHdl> calorimeter_hits;
+    std::vector<TrackerClusterHdl> clusters;
+    std::vector<TrackerClusteringSolutionHdl> clustering_solutions;
+    std::vector<TrackerTrajectoryHdl> trajectories;
+    std::vector<TrackerTrajectorySolutionHdl> trajectory_solutions;
+    std::vector<ParticleHdl> particles;
+
+    // Members read from the archive block, in order
+    std::vector<datatools::properties*> archived_properties;
+    std::vector<TrajectoryPatternHdl*> archived_patterns;
+    std::vector<vertices_type*> archived_vertices;
+
+    /// Create the rows of a table, each of which holds at least four bytes
+    template <class T>
+    void make_rows(std::vector<datatools::handle<T>>& rows) {
+      const uint32_t size = in.u32();
+      in.need(4ull * size);
+      rows.clear();
+      rows.reserve(size);
+      for (uint32_t i = 0; i < size; ++i) {
+        rows.push_back(datatools::make_handle<T>());
+      }
+    }
+
+    // Columns
+    void read_properties(datatools::properties& props) {
+      if (in.u8() != 0) {
+        archived_properties.push_back(&props);
+      }
+    }
+
+    template <class Row>
+    void read_column(std::vector<datatools::handle<Row>>& rows, double Row::*member) {
+      for (auto& row : rows) {
+        row.grab().*member = in.f64();
+      }
+    }
+
+    template <class Row, class T>
+    void read_ref_column(std::vector<datatools::handle<Row>>& rows,
+                         datatools::handle<T> Row::*member,
+                         const std::vector<datatools::handle<T>>& targets) {
+      for (auto& row : rows) {
+        row.grab().*member = resolve(targets, in.u32());
+      }
+    }
+
+    template <class Row, class T>
+    void read_ref_lists(std::vector<datatools::handle<Row>>& rows,
+                        std::vector<datatools::handle<T>> Row::*member,
+                        const std::vector<datatools::handle<T>>& targets) {
+      std::vector<uint32_t> sizes(rows.size());
+      for (uint32_t& size : sizes) {
+        size = in.u32();
+      }
+      for (std::size_t i = 0; i < rows.size(); ++i) {
+        read_refs(rows[i].grab().*member, sizes[i], targets);
+      }
+    }
+
+    template <class T>
+    void read_refs(std::vector<datatools::handle<T>>& handles, uint32_t size,
+                   const std::vector<datatools::handle<T>>& targets) {
+      in.need(4ull * size);
+      handles.clear();
+      handles.reserve(size);
+      for (uint32_t i = 0; i < size; ++i) {
+        handles.push_back(resolve(targets, in.u32()));
+      }
+    }
+
+    template <class T>
+    void read_refs(std::vector<datatools::handle<T>>& handles,
+                   const std::vector<datatools::handle<T>>& targets) {
+      read_refs(handles, in.u32(), targets);
+    }
+
+    /// Read the columns of the geomtools::base_hit part and create the rows
+    template <class Hit>
+    void read_base_hits(std::vector<datatools::handle<Hit>>& hits) {
+      make_rows(hits);
+      std::vector<uint32_t> stores(hits.size());
+      for (uint32_t& store : stores) {
+        store = in.u32();
+      }
+      for (std::size_t i = 0; i < hits.size(); ++i) {
+        if ((stores[i] & geomtools::base_hit::STORE_HIT_ID) != 0u) {
+          hits[i].grab().set_hit_id(in.i32());
+        }
+      }
+      for (std::size_t i = 0; i < hits.size(); ++i) {
+        if ((stores[i] & geomtools::base_hit::STORE_GEOM_ID) != 0u) {
+          geomtools::geom_id& gid = hits[i].grab().grab_geom_id();
+          gid.set_type(in.u32());
+          const uint32_t depth = in.u32();
+          in.need(4ull * depth);
+          gid.set_depth(depth);
+        }
+      }
+      for (std::size_t i = 0; i < hits.size(); ++i) {
+        if ((stores[i] & geomtools::base_hit::STORE_GEOM_ID) != 0u) {
+          geomtools::geom_id& gid = hits[i].grab().grab_geom_id();
+          for (std::size_t j = 0; j < gid.get_depth(); ++j) {
+            gid.set(j, in.u32());
+          }
+        }
+      }
+      for (std::size_t i = 0; i < hits.size(); ++i) {
+        if ((stores[i] & geomtools::base_hit::STORE_AUXILIARIES) != 0u) {
+          read_properties(hits[i].grab().grab_auxiliaries());
+        }
+      }
+      // The accessors above flag their member as stored, restore the original flags
+      for (std::size_t i = 0; i < hits.size(); ++i) {
+        hits[i].grab()._store = stores[i];
+      }
+    }
+
+    // Tables
+    void read_tracker_hits() {
+      read_base_hits(tracker_hits);
+      for (auto& hit : tracker_hits) {
+        hit.grab().traits_ = in.u32();
+      }
+      read_column(tracker_hits, &calibrated_tracker_hit::r_);
+      read_column(tracker_hits, &calibrated_tracker_hit::sigma_r_);
+      read_column(tracker_hits, &calibrated_tracker_hit::z_);
+      read_column(tracker_hits, &calibrated_tracker_hit::sigma_z_);
+      for (auto& hit : tracker_hits) {
+        if (hit.get().has_xy()) {
+          hit.grab().x_ = in.f64();
+          hit.grab().y_ = in.f64();
+        }
+      }
+      for (auto& hit : tracker_hits) {
+        if (hit.get().is_delayed()) {
+          hit.grab().delayed_time_ = in.f64();
+          hit.grab().delayed_time_error_ = in.f64();
+        }
+      }
+    }
+
+    void read_calorimeter_hits() {
+      read_base_hits(calorimeter_hits);
+      read_column(calorimeter_hits, &calibrated_calorimeter_hit::energy_);
+      read_column(calorimeter_hits, &calibrated_calorimeter_hit::sigma_energy_);
+      read_column(calorimeter_hits, &calibrated_calorimeter_hit::time_);
+      read_column(calorimeter_hits, &calibrated_calorimeter_hit::sigma_time_);
+    }
+
+    void read_clusters() {
+      read_base_hits(clusters);
+      read_ref_lists(clusters, &tracker_cluster::hits_, tracker_hits);
+    }
+
+    void read_clustering_solutions() {
+      make_rows(clustering_solutions);
+      for (auto& solution : clustering_solutions) {
+        solution.grab().id_ = in.i32();
+      }
+      read_ref_lists(clustering_solutions, &tracker_clustering_solution::clusters_, clusters);
+      read_ref_lists(clustering_solutions, &tracker_clustering_solution::unclustered_hits_,
+                     tracker_hits);
+      for (auto& solution : clustering_solutions) {
+        read_properties(solution.grab().auxiliaries_);
+      }
+    }
+
+    void read_trajectories() {
+      read_base_hits(trajectories);
+      read_ref_column(trajectories, &tracker_trajectory::cluster_, clusters);
+      read_ref_lists(trajectories, &tracker_trajectory::orphans_, tracker_hits);
+      for (auto& trajectory : trajectories) {
+        if (in.u8() != 0) {
+          archived_patterns.push_back(&trajectory.grab().pattern_);
+        }
+      }
+    }
+
+    void read_trajectory_solutions() {
+      make_rows(trajectory_solutions);
+      for (auto& solution : trajectory_solutions) {
+        solution.grab().id_ = in.i32();
+      }
+      read_ref_column(trajectory_solutions, &tracker_trajectory_solution::solutions_,
+                      clustering_solutions);
+      read_ref_lists(trajectory_solutions, &tracker_trajectory_solution::trajectories_,
+                     trajectories);
+      read_ref_lists(trajectory_solutions, &tracker_trajectory_solution::unfitted_, clusters);
+      for (auto& solution : trajectory_solutions) {
+        read_properties(solution.grab()._auxiliaries_);
+      }
+    }
+
+    void read_particles() {
+      read_base_hits(particles);
+      for (auto& particle : particles) {
+        particle.grab().charge_from_source_ =
+            static_cast<particle_track::charge_type>(in.i32());
+      }
+      read_ref_column(particles, &particle_track::trajectory_, trajectories);
+      for (auto& particle : particles) {
+        if (in.u8() != 0) {
+          archived_vertices.push_back(&particle.grab().vertices_);
+        }
+      }
+      read_ref_lists(particles, &particle_track::associated_calorimeters_, calorimeter_hits);
+    }
+
+    /// Read the blocks of all the tables, in dependency order
+    void read_tables() {
+      using table_reader = void (decoder::*)();
+      for (table_reader read :
+           {&decoder::read_tracker_hits, &decoder::read_calorimeter_hits,
+            &decoder::read_clusters, &decoder::read_clustering_solutions,
+            &decoder::read_trajectories, &decoder::read_trajectory_solutions,
+            &decoder::read_particles}) {
+        const std::size_t block = in.begin_block();
+        (this->*read)();
+        in.end_block(block);
+      }
+    }
+
+    /// Read the archive block, which ends the buffer
+    void read_archive() {
+      const std::size_t block = in.begin_block();
+      if (!archived_properties.empty() || !archived_patterns.empty() ||
+          !archived_vertices.empty()) {
+        const std::size_t size = in.left(block);
+        std::istringstream archive(std::string(in.raw(size), size));
+        eos::portable_iarchive ia(archive);
+        for (datatools::properties* props : archived_properties) {
+          ia >> boost::serialization::make_nvp("properties", *props);
+        }
+        for (TrajectoryPatternHdl* pattern : archived_patterns) {
+          ia >> boost::serialization::make_nvp("pattern", *pattern);
+        }
+        for (vertices_type* vertices : archived_vertices) {
+          ia >> boost::serialization::make_nvp("vertices", *vertices);
+        }
+      }
+      in.end_block(block);
+      in.end_buffer();
+    }
+  };
+};
+
+fast_codec::bank_tag fast_codec::get_bank_tag(const std::string& buffer) {
+  reader in(buffer);
+  return impl::read_header(in);
+}
+
+// event_header
+void fast_codec::encode(const event_header& bank, std::string& buffer) {
+  impl::encoder codec(buffer, EVENT_HEADER);
+  const std::size_t block = codec.out.begin_block();
+  codec.out.i32(bank.get_id().get_run_number());
+  codec.out.i32(bank.get_id().get_event_number());
+  codec.out.i32(bank.get_generation());
+  codec.out.i64(bank.get_timestamp().get_seconds());
+  codec.out.i64(bank.get_timestamp().get_picoseconds());
+  codec.write_properties(bank.get_properties());
+  codec.out.end_block(block);
+  codec.write_archive();
+}
+
+void fast_codec::decode(const std::string& buffer, event_header& bank) {
+  impl::decoder codec(buffer, EVENT_HEADER);
+  const std::size_t block = codec.in.begin_block();
+  const int32_t run = codec.in.i32();
+  const int32_t event = codec.in.i32();
+  bank.get_id().set(run, event);
+  bank.set_generation(static_cast<event_header::generation_type>(codec.in.i32()));
+  bank.get_timestamp().set_seconds(codec.in.i64());
+  bank.get_timestamp().set_picoseconds(codec.in.i64());
+  bank.get_properties() = datatools::properties();
+  codec.read_properties(bank.get_properties());
+  codec.in.end_block(block);
+  codec.read_archive();
+}
+
+// calibrated_data
+void fast_codec::encode(const calibrated_data& bank, std::string& buffer) {
+  impl::encoder codec(buffer, CALIBRATED_DATA);
+  codec.gather(bank.calorimeter_hits_);
+  codec.gather(bank.tracker_hits_);
+  codec.write_tables();
+  const std::size_t block = codec.out.begin_block();
+  codec.write_refs(bank.calorimeter_hits_, codec.calorimeter_hits);
+  codec.write_refs(bank.tracker_hits_, codec.tracker_hits);
+  codec.write_properties(bank._properties_);
+  codec.out.end_block(block);
+  codec.write_archive();
+}
+
+void fast_codec::decode(const std::string& buffer, calibrated_data& bank) {
+  impl::decoder codec(buffer, CALIBRATED_DATA);
+  codec.read_tables();
+  const std::size_t block = codec.in.begin_block();
+  codec.read_refs(bank.calorimeter_hits_, codec.calorimeter_hits);
+  codec.read_refs(bank.tracker_hits_, codec.tracker_hits);
+  bank._properties_ = datatools::properties();
+  codec.read_properties(bank._properties_);
+  codec.in.end_block(block);
+  codec.read_archive();
+  // Decoded hits are not those of the cached view
+  bank.tracker_hits_view_valid_ = false;
+}
+
+// tracker_clustering_data
+void fast_codec::encode(const tracker_clustering_data& bank, std::string& buffer) {
+  impl::encoder codec(buffer, TRACKER_CLUSTERING_DATA);
+  codec.gather(bank.solutions_);
+  codec.gather(bank.default_);
+  codec.write_tables();
+  const std::size_t block = codec.out.begin_block();
+  codec.write_refs(bank.solutions_, codec.clustering_solutions);
+  codec.out.u32(codec.clustering_solutions.ref(bank.default_));
+  codec.write_properties(bank._auxiliaries_);
+  codec.out.end_block(block);
+  codec.write_archive();
+}
+
+void fast_codec::decode(const std::string& buffer, tracker_clustering_data& bank) {
+  impl::decoder codec(buffer, TRACKER_CLUSTERING_DATA);
+  codec.read_tables();
+  const std::size_t block = codec.in.begin_block();
+  codec.read_refs(bank.solutions_, codec.clustering_solutions);
+  bank.default_ = resolve(codec.clustering_solutions, codec.in.u32());
+  bank._auxiliaries_ = datatools::properties();
+  codec.read_properties(bank._auxiliaries_);
+  codec.in.end_block(block);
+  codec.read_archive();
+}
+
+// tracker_trajectory_data
+void fast_codec::encode(const tracker_trajectory_data& bank, std::string& buffer) {
+  impl::encoder codec(buffer, TRACKER_TRAJECTORY_DATA);
+  codec.gather(bank.solutions_);
+  codec.gather(bank.default_);
+  codec.write_tables();
+  const std::size_t block = codec.out.begin_block();
+  codec.write_refs(bank.solutions_, codec.trajectory_solutions);
+  codec.out.u32(codec.trajectory_solutions.ref(bank.default_));
+  codec.write_properties(bank._auxiliaries_);
+  codec.out.end_block(block);
+  codec.write_archive();
+}
+
+void fast_codec::decode(const std::string& buffer, tracker_trajectory_data& bank) {
+  impl::decoder codec(buffer, TRACKER_TRAJECTORY_DATA);
+  codec.read_tables();
+  const std::size_t block = codec.in.begin_block();
+  codec.read_refs(bank.solutions_, codec.trajectory_solutions);
+  bank.default_ = resolve(codec.trajectory_solutions, codec.in.u32());
+  bank._auxiliaries_ = datatools::properties();
+  codec.read_properties(bank._auxiliaries_);
+  codec.in.end_block(block);
+  codec.read_archive();
+}
+
+// particle_track_data
+void fast_codec::encode(const particle_track_data& bank, std::string& buffer) {
+  impl::encoder codec(buffer, PARTICLE_TRACK_DATA);
+  codec.gather(bank.particles_);
+  codec.gather(bank.isolated_calorimeters_);
+  codec.write_tables();
+  const std::size_t block = codec.out.begin_block();
+  codec.write_refs(bank.particles_, codec.particles);
+  codec.write_refs(bank.isolated_calorimeters_, codec.calorimeter_hits);
+  codec.write_properties(bank._auxiliaries_);
+  codec.out.end_block(block);
+  codec.write_archive();
+}
+
+void fast_codec::decode(const std::string& buffer, particle_track_data& bank) {
+  impl::decoder codec(buffer, PARTICLE_TRACK_DATA);
+  codec.read_tables();
+  const std::size_t block = codec.in.begin_block();
+  codec.read_refs(bank.particles_, codec.particles);
+  codec.read_refs(bank.isolated_calorimeters_, codec.calorimeter_hits);
+  bank._auxiliaries_ = datatools::properties();
+  codec.read_properties(bank._auxiliaries_);
+  codec.in.end_block(block);
+  codec.read_archive();
+}
+
+// Converters
+template <class Bank>
+std::string fast_codec::from_boost(const std::string& archive) {
+  Bank bank;
+  {
+    std::istringstream is(archive);
+    eos::portable_iarchive ia(is);
+    ia >> boost::serialization::make_nvp("bank", bank);
+  }
+  std::string buffer;
+  encode(bank, buffer);
+  return buffer;
+}
+
+template <class Bank>
+std::string fast_codec::to_boost(const std::string& buffer) {
+  Bank bank;
+  decode(buffer, bank);
+  std::ostringstream os;
+  {
+    eos::portable_oarchive oa(os);
+    const Bank& saved = bank;
+    oa << boost::serialization::make_nvp("bank", saved);
+  }
+  return os.str();
+}
+
+template std::string fast_codec::from_boost<event_header>(const std::string&);
+template std::string fast_codec::from_boost<calibrated_data>(const std::string&);
+template std::string fast_codec::from_boost<tracker_clustering_data>(const std::string&);
+template std::string fast_codec::from_boost<tracker_trajectory_data>(const std::string&);
+template std::string fast_codec::from_boost<particle_track_data>(const std::string&);
+
+template std::string fast_codec::to_boost<event_header>(const std::string&);
+template std::string fast_codec::to_boost<calibrated_data>(const std::string&);
+template std::string fast_codec::to_boost<tracker_clustering_data>(const std::string&);
+template std::string fast_codec::to_boost<tracker_trajectory_data>(const std::string&);
+template std::string fast_codec::to_boost<particle_track_data>(const std::string&);
+
+}  // end of namespace datamodel
+
+}  // end of namespace snemo
@@ -0,0 +1,109 @@
+/// \file falaise/snemo/datamodels/fast_codec.h
+/// \brief Fast binary codec for the reconstruction banks
+
+#ifndef FALAISE_SNEMO_DATAMODELS_FAST_CODEC_H
+#define FALAISE_SNEMO_DATAMODELS_FAST_CODEC_H
+
+#include <cstdint>
+#include <string>
+
+namespace snemo {
+
+namespace datamodel {
+
+class event_header;
+class calibrated_data;
+class tracker_clustering_data;
+class tracker_trajectory_data;
+class particle_track_data;
+
+//! Schema specialized binary codec for the Falaise data model banks
+/*!
+ * Boost serialization writes each object of a bank through its own
+ * serialize() method, with per-object class information, version and
+ * pointer tracking. The fast codec writes a bank with a fixed schema
+ * instead: the objects of each type are gathered in a table and written
+ * column by column, and handles are written as indices in these tables.
+ *
+ * A buffer is little-endian whatever the host, and is laid out as:
+ *
+ * - the magic "SNFC", the format version (u16) and the bank tag (u16),
+ * - except for the event header, one length-prefixed (u64) block per table,
+ *   in dependency order: tracker hits, calorimeter hits, clusters, clustering
+ *   solutions, trajectories, trajectory solutions, particles,
+ * - one length-prefixed block with the top level members of the bank,
+ * - one length-prefixed block holding a Boost portable binary archive of the
+ *   auxiliary properties, trajectory patterns and vertices of the bank.
+ *
+ * The last block keeps the members whose classes are owned by Bayeux, or are
+ * polymorphic, exact without duplicating their schema here. Empty properties
+ * and patterns, and empty vertex collections, are only flagged in their
+ * table and do not go through the archive.
+ *
+ * Within a table, the members of the objects are written column by column,
+ * optional members only for the objects that store them, and handles as their
+ * row in the target table plus one, zero for a null handle.
+ *
+ * Decoding a buffer gives the same bank as loading the Boost archive of the
+ * original one, with the same members stored, including the shared handles:
+ * an object referenced several times within the bank is decoded once.
+ * Handles shared between different banks are not, as for banks archived
+ * separately. The from_boost() and to_boost() converters translate a bank
+ * between the Boost portable binary archive and the fast format.
+ *
+ * ```cpp
+ * std::string buffer;
+ * snemo::datamodel::fast_codec::encode(calibratedData, buffer);
+ * ...
+ * snemo::datamodel::calibrated_data decoded;
+ * snemo::datamodel::fast_codec::decode(buffer, decoded);
+ * ```
+ */
+class fast_codec {
+ public:
+  /// Version of the format written by the codec
+  static const uint16_t format_version = 1;
+
+  /// \brief Tags of the banks
+  enum bank_tag : uint16_t {
+    EVENT_HEADER = 1,
+    CALIBRATED_DATA = 2,
+    TRACKER_CLUSTERING_DATA = 3,
+    TRACKER_TRAJECTORY_DATA = 4,
+    PARTICLE_TRACK_DATA = 5
+  };
+
+  /// Return the tag of the bank in a buffer
+  static bank_tag get_bank_tag(const std::string& buffer);
+
+  /// Encode a bank, replacing the contents of the buffer
+  static void encode(const event_header& bank, std::string& buffer);
+  static void encode(const calibrated_data& bank, std::string& buffer);
+  static void encode(const tracker_clustering_data& bank, std::string& buffer);
+  static void encode(const tracker_trajectory_data& bank, std::string& buffer);
+  static void encode(const particle_track_data& bank, std::string& buffer);
+
+  /// Decode a bank, replacing its contents
+  static void decode(const std::string& buffer, event_header& bank);
+  static void decode(const std::string& buffer, calibrated_data& bank);
+  static void decode(const std::string& buffer, tracker_clustering_data& bank);
+  static void decode(const std::string& buffer, tracker_trajectory_data& bank);
+  static void decode(const std::string& buffer, particle_track_data& bank);
+
+  /// Convert a Boost portable binary archive of a bank to the fast format
+  template <class Bank>
+  static std::string from_boost(const std::string& archive);
+
+  /// Convert a bank in the fast format to a Boost portable binary archive
+  template <class Bank>
+  static std::string to_boost(const std::string& buffer);
+
+ private:
+  struct impl;
+};
+
+}  // end of namespace datamodel
+
+}  // end of namespace snemo
+
+#endif  // FALAISE_SNEMO_DATAMODELS_FAST_CODEC_H
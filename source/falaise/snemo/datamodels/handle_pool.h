@@ -0,0 +1,100 @@
+/// \file falaise/snemo/datamodels/handle_pool.h
+/// \brief Pool of reusable data model objects handed out through handles
+
+#ifndef FALAISE_SNEMO_DATAMODELS_HANDLE_POOL_H
+#define FALAISE_SNEMO_DATAMODELS_HANDLE_POOL_H
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <bayeux/datatools/handle.h>
+
+namespace snedm {
+//! Per-run pool of objects of type T handed out as datatools::handle<T>
+/*!
+ * Data model objects such as hits, clusters and trajectories are usually
+ * created once per event through `datatools::make_handle<T>()` and destroyed
+ * when the event record is cleared. For high rate processing, this heap
+ * churn is a significant fraction of the per-event cost.
+ *
+ * A handle_pool keeps a reference to every object it has created. Once all
+ * other handles to an object have been released, typically because the event
+ * holding it has been cleared, the object becomes free and will be handed
+ * out again by a later call to make(), reset in place through its clear()
+ * method. Its containers and auxiliary properties are emptied rather than
+ * reallocated, so that the storage they hold is reused too. Objects are
+ * therefore only deallocated when the pool is cleared or destroyed.
+ *
+ * Typical use in a module, with the pool as a data member:
+ *
+ * ```cpp
+ * process_status process(datatools::things& event) {
+ *   hitPool_.recycle();
+ *   ...
+ *   auto hit = hitPool_.make();  // in place of datatools::make_handle<T>()
+ *   ...
+ * }
+ * ```
+ *
+ * The pool is not thread safe, and should be owned by the single module
+ * or algorithm creating the objects.
+ *
+ * \tparam T type of object to pool, which must be default constructible and
+ *           provide a clear() method resetting it to its default state
+ */
+template <typename T>
+class handle_pool {
+ public:
+  //! Collect objects that are no longer referenced outside the pool
+  /*!
+   * Should be called at the start of processing each event, once the
+   * previous event record has been cleared. Cost is linear in the pool size.
+   */
+  void recycle() {
+    free_.clear();
+    for (std::size_t i = 0; i < objects_.size(); ++i) {
+      if (objects_[i].use_count() == 1) {
+        free_.push_back(i);
+      }
+    }
+  }
+
+  //! Return a handle to an object in its default state, reusing a free one if available
+  datatools::handle<T> make() {
+    if (free_.empty()) {
+      objects_.push_back(boost::make_shared<T>());
+      return datatools::handle<T>{objects_.back()};
+    }
+    boost::shared_ptr<T>& obj = objects_[free_.back()];
+    free_.pop_back();
+    obj->clear();
+    return datatools::handle<T>{obj};
+  }
+
+  //! Return the number of objects owned by the pool
+  std::size_t size() const { return objects_.size(); }
+
+  //! Return the number of objects available for reuse since the last call to recycle()
+  std::size_t available() const { return free_.size(); }
+
+  //! Release all objects owned by the pool
+  /*!
+   * Objects still referenced elsewhere stay alive until their last handle is
+   * released
+   */
+  void clear() {
+    free_.clear();
+    objects_.clear();
+  }
+
+ private:
+  std::vector<boost::shared_ptr<T>> objects_;  //!< All objects created by the pool
+  std::vector<std::size_t> free_;              //!< Indices of objects free for reuse
+};
+
+}  // namespace snedm
+
+#endif  // FALAISE_SNEMO_DATAMODELS_HANDLE_POOL_H
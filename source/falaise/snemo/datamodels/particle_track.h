@@ -179,6 +179,8 @@ class particle_track : public geomtools::base_hit {
   CalorimeterHitHdlCollection
       associated_calorimeters_{};  //! Calorimeter hits associated with the Particle
 
+  friend class fast_codec;
+
   DATATOOLS_SERIALIZATION_DECLARATION()
 };
 
@@ -83,6 +83,8 @@ class particle_track_data : public datatools::i_serializable,
 
   datatools::properties _auxiliaries_;  // unused, retained for serialization back compatibility
 
+  friend class fast_codec;
+
   DATATOOLS_SERIALIZATION_DECLARATION()
 };
 
@@ -3,6 +3,13 @@
 // Ourselves:
 #include <falaise/snemo/datamodels/tracker_cluster.h>
 
+// Standard library:
+#include <cmath>
+
+// Third party:
+// - Bayeux/datatools:
+#include <datatools/exception.h>
+
 namespace {
 const std::string& delayed_cluster_flag() {
   static const std::string _flag("delayed");
@@ -36,8 +43,33 @@ TrackerHitHdlCollection& tracker_cluster::hits() { return hits_; }
 
 const TrackerHitHdlCollection& tracker_cluster::hits() const { return hits_; }
 
+bool tracker_cluster::helix_seed::is_valid() const {
+  return std::isfinite(x0) && std::isfinite(y0) && std::isfinite(z0) && std::isfinite(r) &&
+         std::isfinite(step) && r > 0.0 && step != 0.0;
+}
+
+bool tracker_cluster::has_helix_seed() const { return has_helix_seed_; }
+
+const tracker_cluster::helix_seed& tracker_cluster::get_helix_seed() const {
+  DT_THROW_IF(!has_helix_seed_, std::logic_error,
+              "Cluster " << get_cluster_id() << " has no helix seed !");
+  return helix_seed_;
+}
+
+void tracker_cluster::set_helix_seed(const helix_seed& seed) {
+  DT_THROW_IF(!seed.is_valid(), std::domain_error, "Invalid helix seed !");
+  helix_seed_ = seed;
+  has_helix_seed_ = true;
+}
+
+void tracker_cluster::reset_helix_seed() {
+  has_helix_seed_ = false;
+  helix_seed_ = helix_seed();
+}
+
 void tracker_cluster::clear() {
   hits_.clear();
+  reset_helix_seed();
   base_hit::clear();
 }
 
@@ -63,6 +95,14 @@ void tracker_cluster::tree_dump(std::ostream& out, const std::string& title,
     out << "Hit[" << i << "] : (Id : " << hits_[i]->get_hit_id()
          << ", GID : " << hits_[i]->get_geom_id() << ")" << std::endl;
   }
+  out << indent << datatools::i_tree_dumpable::tag << "Helix seed  : ";
+  if (has_helix_seed_) {
+    out << "(center : (" << helix_seed_.x0 << ", " << helix_seed_.y0 << ", " << helix_seed_.z0
+        << "), R : " << helix_seed_.r << ", step : " << helix_seed_.step << ")";
+  } else {
+    out << "<none>";
+  }
+  out << std::endl;
   out << indent << datatools::i_tree_dumpable::inherit_tag(is_last)
        << "Cluster ID  : " << get_cluster_id() << std::endl;
 }
@@ -14,6 +14,7 @@
 #include <boost/cstdint.hpp>
 // - Bayeux/datatools:
 #include <datatools/handle.h>
+#include <datatools/utils.h>
 // - Bayeux/geomtools:
 #include <geomtools/base_hit.h>
 
@@ -27,6 +28,28 @@ namespace datamodel {
 /// \brief A cluster of Geiger calibrated hits referenced by handles
 class tracker_cluster : public geomtools::base_hit {
  public:
+  /// \brief Helix fitted by the clusterizer to the hits of the cluster
+  /*!
+   * The helix follows the TrackFit convention: the point at angle theta is
+   * (x0 + r cos(theta), y0 + r sin(theta), z0 + step * theta / (2 pi)).
+   * A seed is a transient hint for the track fit: it is not serialized.
+   */
+  struct helix_seed {
+    double x0{datatools::invalid_real()};        //!< X position of the center
+    double y0{datatools::invalid_real()};        //!< Y position of the center
+    double z0{datatools::invalid_real()};        //!< Z position of the center
+    double r{datatools::invalid_real()};         //!< Radius
+    double step{datatools::invalid_real()};      //!< Z step per turn
+    double err_x0{datatools::invalid_real()};    //!< Error on x0
+    double err_y0{datatools::invalid_real()};    //!< Error on y0
+    double err_z0{datatools::invalid_real()};    //!< Error on z0
+    double err_r{datatools::invalid_real()};     //!< Error on the radius
+    double err_step{datatools::invalid_real()};  //!< Error on the step
+
+    /// Check if the helix is usable, errors aside
+    bool is_valid() const;
+  };
+
   /// Check if the cluster is associated to delayed hits
   bool is_delayed() const;
 
@@ -57,6 +80,18 @@ class tracker_cluster : public geomtools::base_hit {
   /// Return a non mutable reference on the calibrated tracker hit given its index
   const calibrated_tracker_hit& at(size_t index) const;
 
+  /// Check if the clusterizer has attached a helix seed to the cluster
+  bool has_helix_seed() const;
+
+  /// Return the helix seed of the cluster
+  const helix_seed& get_helix_seed() const;
+
+  /// Attach a helix seed to the cluster
+  void set_helix_seed(const helix_seed& seed);
+
+  /// Remove the helix seed of the cluster
+  void reset_helix_seed();
+
   /// Reset/invalidate the contents of the tracker cluster
   void clear();
 
@@ -66,6 +101,10 @@ class tracker_cluster : public geomtools::base_hit {
 
  private:
   TrackerHitHdlCollection hits_;  //!< Collection of Geiger hit handles
+  bool has_helix_seed_{false};    //!< Validity of the helix seed (not serialized)
+  helix_seed helix_seed_{};       //!< Helix seed (not serialized)
+
+  friend class fast_codec;
 
   DATATOOLS_SERIALIZATION_DECLARATION()
 };
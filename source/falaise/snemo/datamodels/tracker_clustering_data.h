@@ -172,6 +172,8 @@ class tracker_clustering_data : public datatools::i_serializable,
   TrackerClusteringSolutionHdl default_{};              //!< Handle to the default solution
 
   datatools::properties _auxiliaries_{};  // unused, kept for backward serialization compatibility
+  friend class fast_codec;
+
   DATATOOLS_SERIALIZATION_DECLARATION()
 };
 
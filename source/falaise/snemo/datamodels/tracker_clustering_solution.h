@@ -188,6 +188,8 @@ class tracker_clustering_solution : public datatools::i_serializable {
   // Non persistent information :
   hit_belonging_col_type hit_belonging_{};  //!< List of clusters for each clustered hits
 
+  friend class fast_codec;
+
   DATATOOLS_SERIALIZATION_DECLARATION()
 };
 
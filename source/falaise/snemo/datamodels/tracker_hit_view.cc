@@ -0,0 +1,150 @@
+// falaise/snemo/datamodels/tracker_hit_view.cc
+
+// Ourselves:
+#include <falaise/snemo/datamodels/tracker_hit_view.h>
+
+// Standard library:
+#include <limits>
+#include <stdexcept>
+
+// Third party:
+// - Bayeux/datatools:
+#include <bayeux/datatools/exception.h>
+
+namespace snemo {
+
+namespace datamodel {
+
+namespace {
+const uint32_t kNoEntry = std::numeric_limits<uint32_t>::max();
+}  // namespace
+
+const std::size_t tracker_hit_view::npos;
+
+tracker_hit_view::address_indices tracker_hit_view::address_indices::from_category(
+    const geomtools::id_mgr::category_info& geiger_category) {
+  // The get_subaddress_index member function returns an invalid index
+  // rather than throwing an exception, so check the subaddresses upfront
+  for (const std::string& subaddress : {"module", "side", "layer", "row"}) {
+    DT_THROW_IF(!geiger_category.has_subaddress(subaddress), std::logic_error,
+                "Category '" << geiger_category.get_category() << "' has no subaddress '"
+                             << subaddress << "'");
+  }
+  address_indices address;
+  address.module = geiger_category.get_subaddress_index("module");
+  address.side = geiger_category.get_subaddress_index("side");
+  address.layer = geiger_category.get_subaddress_index("layer");
+  address.row = geiger_category.get_subaddress_index("row");
+  return address;
+}
+
+tracker_hit_view::tracker_hit_view(const TrackerHitHdlCollection& hits,
+                                   const address_indices& address) {
+  assign(hits, address);
+}
+
+void tracker_hit_view::clear() {
+  source_ = nullptr;
+  index_.clear();
+  entry_of_id_.clear();
+  id_.clear();
+  geom_type_.clear();
+  module_.clear();
+  side_.clear();
+  layer_.clear();
+  row_.clear();
+  x_.clear();
+  y_.clear();
+  z_.clear();
+  sigma_z_.clear();
+  r_.clear();
+  sigma_r_.clear();
+  time_.clear();
+  flags_.clear();
+}
+
+void tracker_hit_view::assign(const TrackerHitHdlCollection& hits,
+                              const address_indices& address) {
+  clear();
+  source_ = &hits;
+  address_ = address;
+  const std::size_t n = hits.size();
+  index_.reserve(n);
+  id_.reserve(n);
+  geom_type_.reserve(n);
+  module_.reserve(n);
+  side_.reserve(n);
+  layer_.reserve(n);
+  row_.reserve(n);
+  x_.reserve(n);
+  y_.reserve(n);
+  z_.reserve(n);
+  sigma_z_.reserve(n);
+  r_.reserve(n);
+  sigma_r_.reserve(n);
+  time_.reserve(n);
+  flags_.reserve(n);
+
+  for (std::size_t i = 0; i < n; ++i) {
+    if (!hits[i].has_data()) {
+      continue;
+    }
+    const calibrated_tracker_hit& hit = hits[i].get();
+    const geomtools::geom_id& gid = hit.get_geom_id();
+    const int32_t hit_id = hit.get_hit_id();
+    // Ids are usually numbered from zero, larger ones are found by the scan of find()
+    if (hit_id >= 0 && static_cast<std::size_t>(hit_id) < 2 * n + 64) {
+      if (static_cast<std::size_t>(hit_id) >= entry_of_id_.size()) {
+        entry_of_id_.resize(hit_id + 1, kNoEntry);
+      }
+      entry_of_id_[hit_id] = static_cast<uint32_t>(id_.size());
+    }
+    index_.push_back(static_cast<uint32_t>(i));
+    id_.push_back(hit_id);
+    geom_type_.push_back(gid.get_type());
+    module_.push_back(gid.get(address.module));
+    side_.push_back(gid.get(address.side));
+    layer_.push_back(gid.get(address.layer));
+    row_.push_back(gid.get(address.row));
+    x_.push_back(hit.get_x());
+    y_.push_back(hit.get_y());
+    z_.push_back(hit.get_z());
+    sigma_z_.push_back(hit.get_sigma_z());
+    r_.push_back(hit.get_r());
+    sigma_r_.push_back(hit.get_sigma_r());
+    time_.push_back(hit.has_delayed_time() ? hit.get_delayed_time() : hit.get_anode_time());
+
+    uint8_t flags = 0;
+    flags |= hit.is_delayed() ? delayed : 0;
+    flags |= hit.is_noisy() ? noisy : 0;
+    flags |= hit.is_peripheral() ? peripheral : 0;
+    flags |= hit.is_bottom_cathode_missing() ? bottom_cathode_missing : 0;
+    flags |= hit.is_top_cathode_missing() ? top_cathode_missing : 0;
+    flags_.push_back(flags);
+  }
+}
+
+std::size_t tracker_hit_view::find(const TrackerHitHdl& hit) const {
+  if (!hit.has_data() || source_ == nullptr) {
+    return npos;
+  }
+  const calibrated_tracker_hit* target = &hit.get();
+  // Hit ids are unique in a calibrated data bank, check the entry in case they are not
+  const int32_t hit_id = target->get_hit_id();
+  if (hit_id >= 0 && static_cast<std::size_t>(hit_id) < entry_of_id_.size()) {
+    const uint32_t entry = entry_of_id_[hit_id];
+    if (entry != kNoEntry && &handle(entry).get() == target) {
+      return entry;
+    }
+  }
+  for (std::size_t i = 0; i < size(); ++i) {
+    if (&handle(i).get() == target) {
+      return i;
+    }
+  }
+  return npos;
+}
+
+}  // end of namespace datamodel
+
+}  // end of namespace snemo
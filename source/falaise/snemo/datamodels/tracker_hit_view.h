@@ -0,0 +1,186 @@
+/// \file falaise/snemo/datamodels/tracker_hit_view.h
+/// \brief Struct-of-arrays view of calibrated tracker hits
+
+#ifndef FALAISE_SNEMO_DATAMODELS_TRACKER_HIT_VIEW_H
+#define FALAISE_SNEMO_DATAMODELS_TRACKER_HIT_VIEW_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <bayeux/geomtools/id_mgr.h>
+
+#include <falaise/snemo/datamodels/calibrated_tracker_hit.h>
+
+namespace snemo {
+
+namespace datamodel {
+
+//! Columns of the values of a collection of calibrated tracker hits
+/*!
+ * Reconstruction algorithms convert the calibrated tracker hits into their
+ * own representation on every event, going through the handle, the virtual
+ * accessors and the auxiliary properties of each hit. A tracker_hit_view reads
+ * each hit once and stores its values in contiguous columns, entry `i` of
+ * every column describing the same hit. Algorithms can loop over the columns
+ * directly, or build their own structures from them.
+ *
+ * Entries follow the order of the collection the view was built from,
+ * skipping null handles. The handles are not copied: handle(i) refers back to
+ * the collection, which must outlive the view. The values are a snapshot,
+ * and are not updated if the hits are modified after the view is built.
+ *
+ * The cell numbers are read from the geometry IDs at the positions of the
+ * subaddresses of the Geiger cell category, resolved once by the caller.
+ * A view of the whole calibrated data is built once per event by
+ * calibrated_data::tracker_hits_view(), and algorithms working on subsets of
+ * these hits, e.g. clusters, find their entries with find():
+ *
+ * ```cpp
+ * const auto address = tracker_hit_view::address_indices::from_category(geigerCategory);
+ * const tracker_hit_view& hits = calibratedData.tracker_hits_view(address);
+ * for (const TrackerHitHdl& hit : cluster.hits()) {
+ *   const std::size_t i = hits.find(hit);
+ *   if (hits.is_delayed(i)) {
+ *     continue;
+ *   }
+ *   use(hits.x()[i], hits.y()[i], hits.r()[i], hits.sigma_r()[i]);
+ * }
+ * ```
+ */
+class tracker_hit_view {
+ public:
+  /// \brief Bits of the flags column
+  enum flag_bits : uint8_t {
+    delayed = 0x1,
+    noisy = 0x2,
+    peripheral = 0x4,
+    bottom_cathode_missing = 0x8,
+    top_cathode_missing = 0x10
+  };
+
+  /// \brief Positions of the cell numbers in the geometry IDs of the hits
+  struct address_indices {
+    uint32_t module;  ///< Index of the module number
+    uint32_t side;    ///< Index of the side number
+    uint32_t layer;   ///< Index of the layer number
+    uint32_t row;     ///< Index of the row number
+
+    /// Return the subaddress indices of the Geiger cell category
+    static address_indices from_category(const geomtools::id_mgr::category_info& geiger_category);
+
+    /// Check if both sets of indices are the same
+    bool operator==(const address_indices& other) const {
+      return module == other.module && side == other.side && layer == other.layer &&
+             row == other.row;
+    }
+  };
+
+  /// Value returned by find() for a hit which is not in the view
+  static const std::size_t npos = static_cast<std::size_t>(-1);
+
+  /// Construct an empty view
+  tracker_hit_view() = default;
+
+  /// Construct a view of a collection of hits
+  tracker_hit_view(const TrackerHitHdlCollection& hits, const address_indices& address);
+
+  /// Fill the view from a collection of hits, reusing the storage of the columns
+  void assign(const TrackerHitHdlCollection& hits, const address_indices& address);
+
+  /// Empty the view, keeping the storage of the columns
+  void clear();
+
+  /// Return the number of hits in the view
+  std::size_t size() const { return id_.size(); }
+
+  /// Check if the view has no hit
+  bool empty() const { return id_.empty(); }
+
+  /// Check if the view was built from this collection
+  bool is_view_of(const TrackerHitHdlCollection& hits) const { return source_ == &hits; }
+
+  /// Return the subaddress indices the cell numbers were read with
+  const address_indices& address() const { return address_; }
+
+  /// Return the entry of a hit of the source collection, or npos if it is not in the view
+  std::size_t find(const TrackerHitHdl& hit) const;
+
+  /// Return the handle of the i-th hit in the source collection
+  const TrackerHitHdl& handle(std::size_t i) const { return (*source_)[index_[i]]; }
+
+  /// Check if the i-th hit is delayed
+  bool is_delayed(std::size_t i) const { return (flags_[i] & delayed) != 0; }
+
+  /// Check if the i-th hit is prompt
+  bool is_prompt(std::size_t i) const { return !is_delayed(i); }
+
+  /// Return the hit ids
+  const std::vector<int32_t>& id() const { return id_; }
+
+  /// Return the geometry types of the cells
+  const std::vector<uint32_t>& geom_type() const { return geom_type_; }
+
+  /// Return the module numbers of the cells
+  const std::vector<int32_t>& module() const { return module_; }
+
+  /// Return the sides of the cells
+  const std::vector<int32_t>& side() const { return side_; }
+
+  /// Return the layers of the cells
+  const std::vector<int32_t>& layer() const { return layer_; }
+
+  /// Return the rows of the cells
+  const std::vector<int32_t>& row() const { return row_; }
+
+  /// Return the X positions of the cells in the module coordinate system
+  const std::vector<double>& x() const { return x_; }
+
+  /// Return the Y positions of the cells in the module coordinate system
+  const std::vector<double>& y() const { return y_; }
+
+  /// Return the longitudinal positions of the hits along the anode wires
+  const std::vector<double>& z() const { return z_; }
+
+  /// Return the errors on the longitudinal positions
+  const std::vector<double>& sigma_z() const { return sigma_z_; }
+
+  /// Return the drift radii
+  const std::vector<double>& r() const { return r_; }
+
+  /// Return the errors on the drift radii
+  const std::vector<double>& sigma_r() const { return sigma_r_; }
+
+  /// Return the delayed reference times of delayed hits, the anode drift times of prompt hits
+  /// (invalid if not stored)
+  const std::vector<double>& time() const { return time_; }
+
+  /// Return the trait flags (see flag_bits)
+  const std::vector<uint8_t>& flags() const { return flags_; }
+
+ private:
+  const TrackerHitHdlCollection* source_{nullptr};  //!< Collection the view was built from
+  address_indices address_{};                       //!< Subaddress indices of the cell numbers
+  std::vector<uint32_t> index_;                     //!< Index of each hit in the source collection
+  std::vector<uint32_t> entry_of_id_;               //!< Entry of each hit id, UINT32_MAX if none
+  std::vector<int32_t> id_;
+  std::vector<uint32_t> geom_type_;
+  std::vector<int32_t> module_;
+  std::vector<int32_t> side_;
+  std::vector<int32_t> layer_;
+  std::vector<int32_t> row_;
+  std::vector<double> x_;
+  std::vector<double> y_;
+  std::vector<double> z_;
+  std::vector<double> sigma_z_;
+  std::vector<double> r_;
+  std::vector<double> sigma_r_;
+  std::vector<double> time_;
+  std::vector<uint8_t> flags_;
+};
+
+}  // namespace datamodel
+
+}  // namespace snemo
+
+#endif  // FALAISE_SNEMO_DATAMODELS_TRACKER_HIT_VIEW_H
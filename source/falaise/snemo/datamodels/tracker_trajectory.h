@@ -82,6 +82,8 @@ class tracker_trajectory : public geomtools::base_hit {
   orphans_collection_type orphans_;  ///< Collection of orphan Geiger hit handles (retained only
                                       ///< for serialization back-compatibility)
 
+  friend class fast_codec;
+
   DATATOOLS_SERIALIZATION_DECLARATION()
 };
 
@@ -81,6 +81,8 @@ class tracker_trajectory_data : public datatools::i_serializable,
 
   datatools::properties _auxiliaries_;  // unused, retained for serialization backward compatibility
 
+  friend class fast_codec;
+
   DATATOOLS_SERIALIZATION_DECLARATION()
 
 };  // end of class tracker_trajectory_data
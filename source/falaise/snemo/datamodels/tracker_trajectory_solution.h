@@ -118,6 +118,8 @@ class tracker_trajectory_solution : public datatools::i_serializable,
   TrackerClusterHdlCollection unfitted_;         //!< Unfitted clusters
   datatools::properties _auxiliaries_;           //!< List of auxiliary properties
 
+  friend class fast_codec;
+
   DATATOOLS_SERIALIZATION_DECLARATION()
 };
 
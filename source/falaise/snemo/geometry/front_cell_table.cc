@@ -0,0 +1,144 @@
+// falaise/snemo/geometry/front_cell_table.cc
+
+// Ourselves:
+#include <falaise/snemo/geometry/front_cell_table.h>
+
+#include "private/categories.h"
+
+// Standard library:
+#include <cmath>
+#include <stdexcept>
+
+// Third party:
+// - Bayeux/geomtools:
+#include <geomtools/box.h>
+#include <geomtools/manager.h>
+
+// This project:
+#include <falaise/snemo/geometry/gg_locator.h>
+#include <falaise/snemo/geometry/locator_plugin.h>
+
+namespace snemo {
+
+namespace geometry {
+
+void front_cell_table::initialize(const geomtools::manager& geoMgr,
+                                  const locator_plugin& locators, double tolerance) {
+  DT_THROW_IF(isInitialized(), std::logic_error, "Front cell table is already initialized !");
+  DT_THROW_IF(!(tolerance >= 0.0), std::range_error, "Invalid tolerance " << tolerance << " !");
+  ggLocator_ = &locators.geigerLocator();
+  tolerance_ = tolerance;
+
+  // Number the cells side by side, then layer by layer, then row by row
+  std::vector<geomtools::vector_3d> cellPositions;
+  for (uint32_t side = 0; side < ggLocator_->numberOfSides(); side++) {
+    sideOffset_.push_back(cellPositions.size());
+    sideRows_.push_back(0);
+    if (!ggLocator_->hasSubmodules(side)) {
+      continue;
+    }
+    sideRows_.back() = ggLocator_->numberOfRows(side);
+    for (uint32_t layer = 0; layer < ggLocator_->numberOfLayers(side); layer++) {
+      for (uint32_t row = 0; row < ggLocator_->numberOfRows(side); row++) {
+        cellPositions.push_back(ggLocator_->getCellPosition(side, layer, row));
+      }
+    }
+  }
+  nCells_ = cellPositions.size();
+
+  // Scintillator block categories, with their module and part subaddresses
+  const geomtools::id_mgr& idManager = geoMgr.get_id_mgr();
+  std::map<uint32_t, std::pair<int, int> > blockTypes;
+  for (const char* category : {detail::kCaloBlockGIDCategory, detail::kXCaloBlockGIDCategory,
+                               detail::kGammaVetoBlockGIDCategory}) {
+    if (!idManager.has_category_info(category)) {
+      continue;
+    }
+    const geomtools::id_mgr::category_info& blockCI = idManager.get_category_info(category);
+    DT_THROW_IF(!blockCI.has_subaddress("module"), std::logic_error,
+                "Category '" << category << "' has no subaddress 'module'");
+    int partIndex = blockCI.has_subaddress("part") ? blockCI.get_subaddress_index("part") : -1;
+    blockTypes[blockCI.get_type()] = std::make_pair(blockCI.get_subaddress_index("module"),
+                                                    partIndex);
+  }
+
+  const double margin = tolerance_ + ggLocator_->cellDiameter();
+  for (const auto& entry : geoMgr.get_mapping().get_geom_infos()) {
+    const geomtools::geom_id& gid = entry.first;
+    auto blockType = blockTypes.find(gid.get_type());
+    if (blockType == blockTypes.end() ||
+        gid.get(blockType->second.first) != ggLocator_->getModuleNumber()) {
+      continue;
+    }
+    geomtools::geom_id blockGID = gid;
+    if (blockType->second.second >= 0) {
+      blockGID.set_any(blockType->second.second);
+    }
+    block_entry& block = blocks_[blockGID];
+    if (block.cells.empty()) {
+      block.cells.resize(nCells_);
+    }
+    block.parts.push_back(&entry.second);
+
+    // Blocks of an unsupported shape keep all the cells
+    const geomtools::box* partBox = detail::getBlockBox(entry.second);
+    if (partBox == nullptr) {
+      block.cells.set();
+      continue;
+    }
+    const double reach =
+        0.5 * std::sqrt(partBox->get_x() * partBox->get_x() +
+                        partBox->get_y() * partBox->get_y() +
+                        partBox->get_z() * partBox->get_z()) +
+        margin;
+    const geomtools::vector_3d& centre = entry.second.get_world_placement().get_translation();
+    for (size_t icell = 0; icell < nCells_; icell++) {
+      const double dx = cellPositions[icell].x() - centre.x();
+      const double dy = cellPositions[icell].y() - centre.y();
+      if (dx * dx + dy * dy <= reach * reach) {
+        block.cells.set(icell);
+      }
+    }
+  }
+}
+
+bool front_cell_table::isInitialized() const { return ggLocator_ != nullptr; }
+
+void front_cell_table::reset() {
+  ggLocator_ = nullptr;
+  tolerance_ = 0.0;
+  sideOffset_.clear();
+  sideRows_.clear();
+  nCells_ = 0;
+  blocks_.clear();
+}
+
+double front_cell_table::getTolerance() const { return tolerance_; }
+
+size_t front_cell_table::numberOfCells() const { return nCells_; }
+
+size_t front_cell_table::getCellNumber(const geomtools::geom_id& cellGID) const {
+  DT_THROW_IF(!isInitialized(), std::logic_error, "Front cell table is not initialized !");
+  if (!ggLocator_->isGeigerCellInThisModule(cellGID)) {
+    return nCells_;
+  }
+  const uint32_t side = ggLocator_->getSideAddress(cellGID);
+  const uint32_t layer = ggLocator_->getLayerAddress(cellGID);
+  const uint32_t row = ggLocator_->getRowAddress(cellGID);
+  if (side >= sideOffset_.size() || row >= sideRows_[side]) {
+    return nCells_;
+  }
+  const size_t number = sideOffset_[side] + layer * sideRows_[side] + row;
+  const size_t sideEnd = side + 1 < sideOffset_.size() ? sideOffset_[side + 1] : nCells_;
+  return number < sideEnd ? number : nCells_;
+}
+
+const front_cell_table::block_entry* front_cell_table::findBlock(
+    const geomtools::geom_id& blockGID) const {
+  auto found = blocks_.find(blockGID);
+  return found == blocks_.end() ? nullptr : &found->second;
+}
+
+}  // end of namespace geometry
+
+}  // end of namespace snemo
@@ -0,0 +1,95 @@
+/// \file falaise/snemo/geometry/front_cell_table.h
+/* Description:
+ *
+ *   Table of the Geiger cells in front of the calorimeter, xcalo and gveto
+ *   blocks of one module of the SuperNEMO detector
+ *
+ */
+
+#ifndef FALAISE_SNEMO_GEOMETRY_FRONT_CELL_TABLE_H
+#define FALAISE_SNEMO_GEOMETRY_FRONT_CELL_TABLE_H 1
+
+// Standard library:
+#include <map>
+#include <vector>
+
+// Third party:
+// - Boost :
+#include <boost/dynamic_bitset.hpp>
+// - Bayeux/geomtools:
+#include <geomtools/geom_id.h>
+
+// Forward declaration:
+namespace geomtools {
+class geom_info;
+class manager;
+}  // namespace geomtools
+
+namespace snemo {
+
+namespace geometry {
+
+class gg_locator;
+class locator_plugin;
+
+/// \brief Geiger cells whose anode wire passes near each scintillator block
+/*!
+ * A block is keyed by its geom ID with a wildcard part address, as for
+ * calibrated calorimeter hits, and holds the mapped volumes of all its parts.
+ *
+ * A cell is in front of a block if its wire passes within the half diagonal
+ * of the bounding box of one of the parts, plus the tolerance and one cell
+ * diameter, of the part centre. Any point inside the tolerance volume of the
+ * part satisfies this condition, so that only the hits of the cells of the
+ * table need the exact geometrical test.
+ */
+class front_cell_table {
+ public:
+  /// Set of Geiger cells, indexed by cell number
+  typedef boost::dynamic_bitset<> cell_set;
+
+  /// Scintillator block entry
+  struct block_entry {
+    std::vector<const geomtools::geom_info*> parts;  //!< Mapped volumes of the block parts
+    cell_set cells;                                   //!< Cells in front of the block
+  };
+
+  /// Default constructor
+  front_cell_table() = default;
+
+  /// Build the table of the blocks of the module of the Geiger cell locator
+  void initialize(const geomtools::manager& geoMgr, const locator_plugin& locators,
+                  double tolerance);
+
+  /// Check initialization
+  bool isInitialized() const;
+
+  /// Clear the table
+  void reset();
+
+  /// Return the tolerance of the table
+  double getTolerance() const;
+
+  /// Return the number of Geiger cells of the module
+  size_t numberOfCells() const;
+
+  /// Return the number of a Geiger cell, or numberOfCells() if it is not in the module
+  size_t getCellNumber(const geomtools::geom_id& cellGID) const;
+
+  /// Return the entry of a block, or nullptr if it is not in the table
+  const block_entry* findBlock(const geomtools::geom_id& blockGID) const;
+
+ private:
+  const gg_locator* ggLocator_ = nullptr;  //!< Locator of the Geiger cells
+  double tolerance_ = 0.0;                 //!< Skin tolerance of the block volumes
+  std::vector<size_t> sideOffset_;         //!< Number of the first cell of each side
+  std::vector<size_t> sideRows_;           //!< Number of rows of each side
+  size_t nCells_ = 0;                      //!< Number of Geiger cells
+  std::map<geomtools::geom_id, block_entry> blocks_;  //!< Blocks by wildcard part geom ID
+};
+
+}  // end of namespace geometry
+
+}  // end of namespace snemo
+
+#endif  // FALAISE_SNEMO_GEOMETRY_FRONT_CELL_TABLE_H
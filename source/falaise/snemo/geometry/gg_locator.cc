@@ -432,6 +432,8 @@ bool gg_locator::isGeigerCell(const geomtools::geom_id &gid) const {
   return gid.get_type() == cellGIDType_;
 }
 
+uint32_t gg_locator::getCellType() const { return cellGIDType_; }
+
 bool gg_locator::isGeigerCellInThisModule(const geomtools::geom_id &gid) const {
   return isGeigerCell(gid) && (getModuleAddress(gid) == moduleNumber_);
 }
@@ -154,6 +154,10 @@ class gg_locator : public geomtools::base_locator, public datatools::i_tree_dump
    */
   bool isGeigerCell(const geomtools::geom_id& gid) const;
 
+  /** @return the geometry type of Geiger cell GIDs, for checks on bare types
+   */
+  uint32_t getCellType() const;
+
   /** @arg a_gid the GID to be checked
    *  @return true if the GID corresponds to a Geiger cell's drift volume in the
    *  module number associated to the locator.
@@ -24,6 +24,12 @@
 #include <falaise/snemo/geometry/mapped_magnetic_field.h>
 
 // Standard library:
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
 #include <vector>
 
 // Third party:
@@ -39,6 +45,9 @@
 #include <boost/lexical_cast.hpp>
 // - Bayeux/datatools:
 #include <datatools/clhep_units.h>
+#include <datatools/configuration/variant_repository.h>
+#include <datatools/kernel.h>
+#include <datatools/logger.h>
 #include <datatools/properties.h>
 #include <datatools/service_manager.h>
 #include <datatools/units.h>
@@ -81,12 +90,67 @@ std::istream& safe_getline(std::istream& in_, std::string& out_) {
   }
 }
 
+/// Return the 64 bits FNV-1a hash of a buffer
+uint64_t fnv1a_hash(const std::string& buffer) {
+  uint64_t h = 14695981039346656037ULL;
+  for (unsigned char c : buffer) {
+    h ^= c;
+    h *= 1099511628211ULL;
+  }
+  return h;
+}
+
+/// Return the default directory of the field map cache, empty if the user has none
+std::string default_cache_directory() {
+  const char* xdg_cache = std::getenv("XDG_CACHE_HOME");
+  if (xdg_cache != nullptr && *xdg_cache != '\0') {
+    return std::string(xdg_cache) + "/falaise/magnetic_field";
+  }
+  const char* home = std::getenv("HOME");
+  if (home != nullptr && *home != '\0') {
+    return std::string(home) + "/.cache/falaise/magnetic_field";
+  }
+  return "";
+}
+
+/// Return the settings of the active geometry variants, which the field configuration uses
+std::string geometry_variant_settings() {
+  std::ostringstream settings;
+  if (datatools::kernel::is_instantiated()) {
+    datatools::properties variant_props;
+    datatools::configuration::variant_repository::exporter variant_exporter(
+        variant_props, datatools::configuration::variant_repository::exporter::EXPORT_NOCLEAR);
+    variant_exporter.process(datatools::kernel::instance().get_effective_variant_repository());
+    for (const auto& a_setting : variant_exporter.get_settings()) {
+      if (a_setting.compare(0, 9, "geometry:") == 0) {
+        settings << "variant " << a_setting << std::endl;
+      }
+    }
+  }
+  return settings.str();
+}
+
 /// \brief Private working data for MM_IMPORT_CSV_MAP_0 mode
+///
+/// Parsing the CSV map dominates the initialization of the field. If a cache
+/// directory is set, the parsed map is stored there in binary form and
+/// reloaded by later initializations. The cache is keyed by a hash of the CSV
+/// contents and of a context given by the field, i.e. its configuration and
+/// the geometry variants. A cache file that is missing, unreadable or does not
+/// match is rebuilt silently.
 struct csv_map_0_t {
  public:
   csv_map_0_t() = default;
-  csv_map_0_t(std::string mapfile) : map_filename{std::move(mapfile)} { load(map_filename); }
-  void load(const std::string& mapfile);
+  csv_map_0_t(std::string mapfile, const std::string& cachedir = "",
+              const std::string& context = "")
+      : map_filename{std::move(mapfile)} {
+    load(map_filename, cachedir, context);
+  }
+  void load(const std::string& mapfile, const std::string& cachedir = "",
+            const std::string& context = "");
+  void parse(std::istream& fin);
+  bool load_cache(const std::string& cachefile, uint64_t key);
+  void save_cache(const std::string& cachefile, uint64_t key) const;
   void reset();
   int interpolate(const geomtools::vector_3d& position, geomtools::vector_3d& magnetic_field) const;
   int compute(const geomtools::vector_3d& position, geomtools::vector_3d& magnetic_field) const;
@@ -110,6 +174,8 @@ struct csv_map_0_t {
   using vvvd = std::vector<vvd>;
   using vvvvd = std::vector<vvvd>;
   vvvvd bmap;
+  // Origin of the map:
+  bool from_cache = false;
 };
 
 void csv_map_0_t::reset() {
@@ -121,9 +187,11 @@ void csv_map_0_t::reset() {
   dx = datatools::invalid_real();
   dy = datatools::invalid_real();
   dz = datatools::invalid_real();
+  from_cache = false;
 }
 
-void csv_map_0_t::load(const std::string& mapfile) {
+void csv_map_0_t::load(const std::string& mapfile, const std::string& cachedir,
+                       const std::string& context) {
   std::string mfn = mapfile;
   datatools::fetch_path_with_env(mfn);
   DT_THROW_IF(!boost::filesystem::exists(mfn), std::runtime_error,
@@ -133,6 +201,28 @@ void csv_map_0_t::load(const std::string& mapfile) {
 
   map_filename = mapfile;
   this->reset();
+  if (cachedir.empty()) {
+    parse(fin);
+    return;
+  }
+
+  std::ostringstream content;
+  content << fin.rdbuf();
+  uint64_t key = fnv1a_hash(content.str() + context);
+  std::string cdir = cachedir;
+  datatools::fetch_path_with_env(cdir);
+  std::ostringstream cfn;
+  cfn << cdir << "/csv_map_0-" << std::hex << std::setw(16) << std::setfill('0') << key << ".bin";
+  if (load_cache(cfn.str(), key)) {
+    from_cache = true;
+    return;
+  }
+  std::istringstream csv(content.str());
+  parse(csv);
+  save_cache(cfn.str(), key);
+}
+
+void csv_map_0_t::parse(std::istream& fin) {
   {
     // Read header line:
     std::string header_line;
@@ -200,6 +290,87 @@ void csv_map_0_t::load(const std::string& mapfile) {
   }
 }
 
+/// Identifier of the binary cache format, to be changed with the layout
+const char kCacheMagic[8] = {'F', 'L', 'B', 'M', 'A', 'P', '0', '1'};
+
+bool csv_map_0_t::load_cache(const std::string& cachefile, uint64_t key) {
+  std::ifstream fin(cachefile.c_str(), std::ios::binary);
+  if (!fin) {
+    return false;
+  }
+  char magic[sizeof(kCacheMagic)];
+  uint64_t fkey = 0;
+  uint32_t dims[3];
+  double geo[6];
+  fin.read(magic, sizeof(magic));
+  fin.read(reinterpret_cast<char*>(&fkey), sizeof(fkey));
+  fin.read(reinterpret_cast<char*>(dims), sizeof(dims));
+  fin.read(reinterpret_cast<char*>(geo), sizeof(geo));
+  if (!fin || !std::equal(magic, magic + sizeof(magic), kCacheMagic) || fkey != key) {
+    return false;
+  }
+
+  std::vector<int> data(3 * std::size_t{dims[0]} * dims[1] * dims[2]);
+  fin.read(reinterpret_cast<char*>(data.data()), data.size() * sizeof(int));
+  if (!fin) {
+    return false;
+  }
+
+  nx = dims[0];
+  ny = dims[1];
+  nz = dims[2];
+  origin.set(geo[0], geo[1], geo[2]);
+  dx = geo[3];
+  dy = geo[4];
+  dz = geo[5];
+  auto it = data.cbegin();
+  bmap.assign(3, vvvd(nz, vvd(ny)));
+  for (vvvd& bxyz : bmap) {
+    for (vvd& bxy : bxyz) {
+      for (vd& xdata : bxy) {
+        xdata.assign(it, it + nx);
+        it += nx;
+      }
+    }
+  }
+  return true;
+}
+
+void csv_map_0_t::save_cache(const std::string& cachefile, uint64_t key) const {
+  // Write to a unique file then rename, so concurrent jobs never see a partial cache
+  boost::system::error_code ec;
+  boost::filesystem::path cpath{cachefile};
+  boost::filesystem::create_directories(cpath.parent_path(), ec);
+  boost::filesystem::path tmp = cpath;
+  tmp += boost::filesystem::unique_path(".%%%%-%%%%-%%%%.tmp");
+  {
+    std::ofstream fout(tmp.string().c_str(), std::ios::binary);
+    uint32_t dims[3] = {nx, ny, nz};
+    double geo[6] = {origin.x(), origin.y(), origin.z(), dx, dy, dz};
+    fout.write(kCacheMagic, sizeof(kCacheMagic));
+    fout.write(reinterpret_cast<const char*>(&key), sizeof(key));
+    fout.write(reinterpret_cast<const char*>(dims), sizeof(dims));
+    fout.write(reinterpret_cast<const char*>(geo), sizeof(geo));
+    for (const vvvd& bxyz : bmap) {
+      for (const vvd& bxy : bxyz) {
+        for (const vd& xdata : bxy) {
+          fout.write(reinterpret_cast<const char*>(xdata.data()), xdata.size() * sizeof(int));
+        }
+      }
+    }
+    if (!fout) {
+      DT_LOG_WARNING(datatools::logger::PRIO_WARNING,
+                     "Cannot write magnetic field map cache '" << cachefile << "'");
+      boost::filesystem::remove(tmp, ec);
+      return;
+    }
+  }
+  boost::filesystem::rename(tmp, cpath, ec);
+  if (ec) {
+    boost::filesystem::remove(tmp, ec);
+  }
+}
+
 int csv_map_0_t::interpolate(const geomtools::vector_3d& position_,
                              geomtools::vector_3d& magnetic_field) const {
   double xu = (position_.x() - origin.x()) / dx;
@@ -299,7 +470,8 @@ namespace geometry {
 
 /// \brief Private working data
 struct mapped_magnetic_field::MapImpl {
-  MapImpl(const std::string& mapfile) : map{mapfile} {};
+  MapImpl(const std::string& mapfile, const std::string& cachedir, const std::string& context)
+      : map{mapfile, cachedir, context} {};
   ~MapImpl() = default;
   csv_map_0_t map;
 };
@@ -319,6 +491,7 @@ mapped_magnetic_field::~mapped_magnetic_field() {
 
 void mapped_magnetic_field::_set_defaults() {
   mapMode_ = map_mode_t::INVALID;
+  useCache_ = true;
   zeroFieldOutsideMap_ = true;
   invertFieldAlongZ_ = false;
 }
@@ -327,6 +500,7 @@ void mapped_magnetic_field::reset() {
   _set_initialized(false);
   fieldMap_.reset();
   mapFile_.clear();
+  cacheDirectory_.clear();
   _set_defaults();
   this->base_electromagnetic_field::_set_defaults();
 }
@@ -352,13 +526,29 @@ void mapped_magnetic_field::initialize(const datatools::properties& config_,
   }
 
   mapFile_ = ps.get<falaise::path>("map_file", mapFile_);
-  // if (mapMode_ == map_mode_t::IMPORT_CSV_MAP_0) { // Useless as this is the only mode
-  fieldMap_.reset(new MapImpl{mapFile_});
-  //}
-
   zeroFieldOutsideMap_ = ps.get<bool>("zero_field_outside_map", zeroFieldOutsideMap_);
   invertFieldAlongZ_ = ps.get<bool>("z_inverted", invertFieldAlongZ_);
 
+  // if (mapMode_ == map_mode_t::IMPORT_CSV_MAP_0) { // Useless as this is the only mode
+  useCache_ = ps.get<bool>("use_cache", useCache_);
+  if (cacheDirectory_.empty()) {
+    cacheDirectory_ = default_cache_directory();
+  }
+  cacheDirectory_ = ps.get<falaise::path>("cache_directory", cacheDirectory_);
+  std::string cacheContext;
+  if (useCache_) {
+    // The cached map is only reused with the same configuration and geometry variants
+    std::ostringstream context;
+    context << "map_file " << mapFile_ << std::endl;
+    context << "zero_field_outside_map " << zeroFieldOutsideMap_ << std::endl;
+    context << "z_inverted " << invertFieldAlongZ_ << std::endl;
+    config_.tree_dump(context);
+    context << geometry_variant_settings();
+    cacheContext = context.str();
+  }
+  fieldMap_.reset(new MapImpl{mapFile_, useCache_ ? cacheDirectory_ : "", cacheContext});
+  //}
+
   _set_initialized(true);
 }
 
@@ -367,6 +557,20 @@ void mapped_magnetic_field::setMapFilename(const std::string& mfn) {
   mapFile_ = mfn;
 }
 
+void mapped_magnetic_field::setCacheDirectory(const std::string& dir) {
+  DT_THROW_IF(is_initialized(), std::logic_error, "Cannot change the map cache directory !");
+  cacheDirectory_ = dir;
+}
+
+void mapped_magnetic_field::setUseCache(bool flag) {
+  DT_THROW_IF(is_initialized(), std::logic_error, "Cannot change the map cache flag !");
+  useCache_ = flag;
+}
+
+bool mapped_magnetic_field::isMapFromCache() const {
+  return fieldMap_ != nullptr && fieldMap_->map.from_cache;
+}
+
 void mapped_magnetic_field::setMapMode(map_mode_t mm) {
   DT_THROW_IF(is_initialized(), std::logic_error, "Cannot change the mapping mode!");
   mapMode_ = mm;
@@ -411,8 +615,17 @@ void mapped_magnetic_field::tree_dump(std::ostream& out, const std::string& titl
       << "Mapping mode : " << static_cast<std::underlying_type<map_mode_t>::type>(mapMode_)
       << std::endl;
 
-  out << indent << datatools::i_tree_dumpable::inherit_tag(inherit) << "Map file : '" << mapFile_
+  out << indent << datatools::i_tree_dumpable::tag << "Map file : '" << mapFile_ << "'"
       << std::endl;
+
+  out << indent << datatools::i_tree_dumpable::tag << "Use map cache : " << std::boolalpha
+      << useCache_ << std::endl;
+
+  out << indent << datatools::i_tree_dumpable::tag << "Map cache directory : '"
+      << cacheDirectory_ << "'" << std::endl;
+
+  out << indent << datatools::i_tree_dumpable::inherit_tag(inherit)
+      << "Map loaded from cache : " << std::boolalpha << isMapFromCache() << std::endl;
 }
 
 }  // end of namespace geometry
@@ -81,6 +81,19 @@ class mapped_magnetic_field : public ::emfield::base_electromagnetic_field {
   /// Set the map source filename
   void setMapFilename(const std::string &);
 
+  /// Set the flag to cache the parsed map (default: true)
+  void setUseCache(bool);
+
+  /// Set the directory where the parsed map is cached
+  ///
+  /// The default is falaise/magnetic_field in the user cache directory,
+  /// i.e. $XDG_CACHE_HOME or else ~/.cache. If it cannot be written, the
+  /// map is parsed at each initialization.
+  void setCacheDirectory(const std::string &);
+
+  /// Return true if the map was loaded from the binary cache at initialization
+  bool isMapFromCache() const;
+
   /// Set the mapping mode
   void setMapMode(map_mode_t mm);
 
@@ -95,10 +108,12 @@ class mapped_magnetic_field : public ::emfield::base_electromagnetic_field {
   void _set_defaults();
 
  private:
-  map_mode_t mapMode_;        //!< Mapping mode
-  std::string mapFile_;       //!< Map filename
-  bool zeroFieldOutsideMap_;  //!< Force zero field outside the interpolated map
-  bool invertFieldAlongZ_;    //!< Invert the Z component of the field
+  map_mode_t mapMode_;          //!< Mapping mode
+  std::string mapFile_;         //!< Map filename
+  bool useCache_;               //!< Cache the parsed map
+  std::string cacheDirectory_;  //!< Directory of the binary map cache
+  bool zeroFieldOutsideMap_;    //!< Force zero field outside the interpolated map
+  bool invertFieldAlongZ_;      //!< Invert the Z component of the field
 
   struct MapImpl;
   std::unique_ptr<MapImpl> fieldMap_;  //!< PIMPL-ized working data
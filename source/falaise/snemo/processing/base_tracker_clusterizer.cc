@@ -68,6 +68,8 @@ void base_tracker_clusterizer::_set_defaults() {
   _logging_priority = datatools::logger::PRIO_WARNING;
   geoManager_ = nullptr;
   geigerLocator_ = nullptr;
+  hitAddress_ = snemo::datamodel::tracker_hit_view::address_indices{};
+  hitView_ = nullptr;
 }
 
 void base_tracker_clusterizer::_reset() {
@@ -102,6 +104,11 @@ const snemo::geometry::gg_locator &base_tracker_clusterizer::get_gg_locator() co
   return *geigerLocator_;
 }
 
+const snemo::datamodel::tracker_hit_view &base_tracker_clusterizer::_get_hit_view() const {
+  DT_THROW_IF(hitView_ == nullptr, std::logic_error, "No event is being processed !");
+  return *hitView_;
+}
+
 void base_tracker_clusterizer::_initialize(const datatools::properties &setup_) {
   DT_THROW_IF(is_initialized(), std::logic_error, "Already initialized !");
   DT_THROW_IF(!has_geometry_manager(), std::logic_error, "Missing geometry manager !");
@@ -121,6 +128,10 @@ void base_tracker_clusterizer::_initialize(const datatools::properties &setup_)
   auto snLocator = snemo::geometry::getSNemoLocator(get_geometry_manager(), locator_plugin_name);
   geigerLocator_ = &(snLocator->geigerLocator());
 
+  // Positions of the cell numbers in the geom_id of the hits :
+  hitAddress_ = snemo::datamodel::tracker_hit_view::address_indices::from_category(
+      get_geometry_manager().get_id_mgr().get_category_info(geigerLocator_->getCellType()));
+
   // Cell geom_id mask
   auto cell_id_mask_rules = ps.get<std::string>("cell_id_mask_rules", "");
   if (!cell_id_mask_rules.empty()) {
@@ -139,6 +150,8 @@ void base_tracker_clusterizer::_clear_working_arrays() {
   ignoredHits_.clear();
   promptClusters_.clear();
   delayedClusters_.clear();
+  hitView_ = nullptr;
+  ownHitView_.clear();
 }
 
 void base_tracker_clusterizer::set_geometry_manager(const geomtools::manager &gmgr_) {
@@ -254,11 +267,31 @@ int base_tracker_clusterizer::process(
     const base_tracker_clusterizer::hit_collection_type &gg_hits_,
     const base_tracker_clusterizer::calo_hit_collection_type &calo_hits_,
     snemo::datamodel::tracker_clustering_data &clustering_) {
-  namespace snedm = snemo::datamodel;
-  int status = 0;
   DT_THROW_IF(!is_initialized(), std::logic_error,
               "Clusterizer '" << id_ << "' is not initialized !");
   _clear_working_arrays();
+  ownHitView_.assign(gg_hits_, hitAddress_);
+  hitView_ = &ownHitView_;
+  return _process_hits(gg_hits_, calo_hits_, clustering_);
+}
+
+int base_tracker_clusterizer::process(const snemo::datamodel::calibrated_data &calibrated_data_,
+                                      snemo::datamodel::tracker_clustering_data &clustering_) {
+  DT_THROW_IF(!is_initialized(), std::logic_error,
+              "Clusterizer '" << id_ << "' is not initialized !");
+  _clear_working_arrays();
+  // Built once per event, and shared with the other algorithms :
+  hitView_ = &calibrated_data_.tracker_hits_view(hitAddress_);
+  return _process_hits(calibrated_data_.tracker_hits(), calibrated_data_.calorimeter_hits(),
+                       clustering_);
+}
+
+int base_tracker_clusterizer::_process_hits(
+    const base_tracker_clusterizer::hit_collection_type &gg_hits_,
+    const base_tracker_clusterizer::calo_hit_collection_type &calo_hits_,
+    snemo::datamodel::tracker_clustering_data &clustering_) {
+  namespace snedm = snemo::datamodel;
+  int status = 0;
 
   clustering_.clear();
 
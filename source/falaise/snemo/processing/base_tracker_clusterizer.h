@@ -110,6 +110,12 @@ class base_tracker_clusterizer {
               const base_tracker_clusterizer::calo_hit_collection_type &calo_hits_,
               snemo::datamodel::tracker_clustering_data &clustering_);
 
+  /// Main clustering process of the hits of a calibrated data bank
+  /// The view of the tracker hits is taken from the bank, and shared with the other
+  /// algorithms processing the same event
+  int process(const snemo::datamodel::calibrated_data &calibrated_data_,
+              snemo::datamodel::tracker_clustering_data &clustering_);
+
   // Smart print
   void tree_dump(std::ostream &out_ = std::clog, const std::string &title_ = "",
                  const std::string &indent_ = "", bool inherit_ = false) const;
@@ -140,6 +146,10 @@ class base_tracker_clusterizer {
   /// Set the initialization flag
   void _set_initialized(bool);
 
+  /// Return the view of the tracker hits of the event being processed
+  /// The hits passed to _process_algo are found in it with tracker_hit_view::find
+  const snemo::datamodel::tracker_hit_view &_get_hit_view() const;
+
   /// Prepare cluster for processing
   virtual int _prepare_process(const base_tracker_clusterizer::hit_collection_type &gg_hits_,
                                const base_tracker_clusterizer::calo_hit_collection_type &calo_hits_,
@@ -167,10 +177,16 @@ class base_tracker_clusterizer {
   datatools::logger::priority _logging_priority;  /// Logging priority
 
  private:
+  /// Run the clustering once the view of the hits is set
+  int _process_hits(const base_tracker_clusterizer::hit_collection_type &gg_hits_,
+                    const base_tracker_clusterizer::calo_hit_collection_type &calo_hits_,
+                    snemo::datamodel::tracker_clustering_data &clustering_);
+
   bool isInitialized_;                                  //!< Initialization status
   std::string id_;                                      //!< Identifier of the clusterizer algorithm
   const geomtools::manager *geoManager_;                //!< The SuperNEMO geometry manager
   const snemo::geometry::gg_locator *geigerLocator_;    //!< Locator for geiger cells
+  snemo::datamodel::tracker_hit_view::address_indices hitAddress_;  //!< Cell number indices
   geomtools::id_selector cellSelector_;                 //!< A selector of GIDs
   snreco::detail::GeigerTimePartitioner preClusterer_;  //!< The time-clustering algorithm
 
@@ -178,6 +194,8 @@ class base_tracker_clusterizer {
   hit_collection_type ignoredHits_;  //!< Hits not used as input for any clustering algorithm
   std::vector<hit_collection_type> promptClusters_;   //!< Clusters of only prompt hits
   std::vector<hit_collection_type> delayedClusters_;  //!< Clusters of only delayed hits
+  const snemo::datamodel::tracker_hit_view *hitView_;  //!< View of the hits of the event
+  snemo::datamodel::tracker_hit_view ownHitView_;      //!< View of hits not from a bank
 };
 
 }  // end of namespace processing
@@ -12,9 +12,11 @@
 // - Bayeux/datatools:
 #include <bayeux/datatools/properties.h>
 // - Bayeux/geomtools:
+#include <bayeux/geomtools/id_mgr.h>
 #include <bayeux/geomtools/manager.h>
 
 // This project:
+#include <falaise/snemo/datamodels/calibrated_data.h>
 #include <falaise/snemo/datamodels/helix_trajectory_pattern.h>
 #include <falaise/snemo/datamodels/line_trajectory_pattern.h>
 #include <falaise/snemo/datamodels/tracker_clustering_data.h>
@@ -42,6 +44,8 @@ void base_tracker_fitter::_set_defaults() {
   geoManager_ = nullptr;
   geigerLocator_ = nullptr;
   maxFitsToSave_ = 0;
+  hitAddress_ = snemo::datamodel::tracker_hit_view::address_indices{};
+  hitView_ = nullptr;
 }
 
 datatools::logger::priority base_tracker_fitter::get_logging_priority() const {
@@ -64,6 +68,11 @@ const snemo::geometry::gg_locator& base_tracker_fitter::get_gg_locator() const {
   return *geigerLocator_;
 }
 
+const snemo::datamodel::tracker_hit_view& base_tracker_fitter::_get_hit_view() const {
+  DT_THROW_IF(hitView_ == nullptr, std::logic_error, "No event is being processed !");
+  return *hitView_;
+}
+
 void base_tracker_fitter::_initialize(const datatools::properties& setup_) {
   DT_THROW_IF(is_initialized(), std::logic_error, "Already initialized !");
   DT_THROW_IF(!has_geometry_manager(), std::logic_error, "Missing geometry manager !");
@@ -84,6 +93,10 @@ void base_tracker_fitter::_initialize(const datatools::properties& setup_) {
   auto snLocator = snemo::geometry::getSNemoLocator(get_geometry_manager(), locator_plugin_name);
   geigerLocator_ = &(snLocator->geigerLocator());
   DT_THROW_IF(geigerLocator_ == nullptr, std::logic_error, "Cannot find Geiger locator !");
+
+  // Positions of the cell numbers in the geom_id of the hits :
+  hitAddress_ = snemo::datamodel::tracker_hit_view::address_indices::from_category(
+      get_geometry_manager().get_id_mgr().get_category_info(geigerLocator_->getCellType()));
 }
 
 void base_tracker_fitter::_reset() {
@@ -105,9 +118,50 @@ bool base_tracker_fitter::has_geometry_manager() const { return geoManager_ != n
 
 int base_tracker_fitter::process(const snemo::datamodel::tracker_clustering_data& clustering_,
                                  snemo::datamodel::tracker_trajectory_data& trajectory_) {
-  int status = 0;
   DT_THROW_IF(!is_initialized(), std::logic_error, "Fitter '" << id_ << "' is not initialized !");
 
+  // Without calibrated data, view the distinct hits of all the clustering solutions :
+  ownHits_.clear();
+  std::set<const snemo::datamodel::calibrated_tracker_hit*> seen;
+  auto add_hits = [&](const snemo::datamodel::TrackerHitHdlCollection& hits) {
+    for (const auto& hit : hits) {
+      if (hit.has_data() && seen.insert(&hit.get()).second) {
+        ownHits_.push_back(hit);
+      }
+    }
+  };
+  for (const auto& a_solution : clustering_.solutions()) {
+    for (const auto& a_cluster : a_solution->get_clusters()) {
+      add_hits(a_cluster->hits());
+    }
+    add_hits(a_solution->get_unclustered_hits());
+  }
+  ownHitView_.assign(ownHits_, hitAddress_);
+  hitView_ = &ownHitView_;
+
+  const int status = _process_clusters(clustering_, trajectory_);
+  hitView_ = nullptr;
+  return status;
+}
+
+int base_tracker_fitter::process(const snemo::datamodel::calibrated_data& calibrated_data_,
+                                 const snemo::datamodel::tracker_clustering_data& clustering_,
+                                 snemo::datamodel::tracker_trajectory_data& trajectory_) {
+  DT_THROW_IF(!is_initialized(), std::logic_error, "Fitter '" << id_ << "' is not initialized !");
+
+  // Built once per event, and shared with the other algorithms :
+  hitView_ = &calibrated_data_.tracker_hits_view(hitAddress_);
+
+  const int status = _process_clusters(clustering_, trajectory_);
+  hitView_ = nullptr;
+  return status;
+}
+
+int base_tracker_fitter::_process_clusters(
+    const snemo::datamodel::tracker_clustering_data& clustering_,
+    snemo::datamodel::tracker_trajectory_data& trajectory_) {
+  int status = 0;
+
   trajectory_.invalidate_solutions();
 
   status = _process_algo(clustering_, trajectory_);
@@ -38,6 +38,9 @@
 #include <datatools/logger.h>
 #include <datatools/object_configuration_description.h>
 
+// This project:
+#include <falaise/snemo/datamodels/tracker_hit_view.h>
+
 // Forward declaration :
 namespace datatools {
 class properties;
@@ -54,6 +57,7 @@ class gg_locator;
 }
 
 namespace datamodel {
+class calibrated_data;
 class tracker_clustering_data;
 class tracker_trajectory_data;
 }  // namespace datamodel
@@ -97,6 +101,13 @@ class base_tracker_fitter {
   int process(const snemo::datamodel::tracker_clustering_data &clustering_,
               snemo::datamodel::tracker_trajectory_data &trajectory_);
 
+  /// Main tracker trajectory driver for the clusters of the hits of a calibrated data bank
+  /// The view of the tracker hits is taken from the bank, and shared with the other
+  /// algorithms processing the same event
+  int process(const snemo::datamodel::calibrated_data &calibrated_data_,
+              const snemo::datamodel::tracker_clustering_data &clustering_,
+              snemo::datamodel::tracker_trajectory_data &trajectory_);
+
   /// Initialize the tracker trajectory fitter through configuration properties
   virtual void initialize(const datatools::properties &setup_) = 0;
 
@@ -124,6 +135,10 @@ class base_tracker_fitter {
   /// Set the initialization flag
   void _set_initialized(bool);
 
+  /// Return the view of the tracker hits of the event being processed
+  /// The hits of the clusters passed to _process_algo are found in it with tracker_hit_view::find
+  const snemo::datamodel::tracker_hit_view &_get_hit_view() const;
+
   /// Specific fitting algorithm
   virtual int _process_algo(const snemo::datamodel::tracker_clustering_data &clustering_,
                             snemo::datamodel::tracker_trajectory_data &trajectory_) = 0;
@@ -135,12 +150,20 @@ class base_tracker_fitter {
   datatools::logger::priority _logging_priority;  /// Logging priority threshold
 
  private:
+  /// Run the fit once the view of the hits is set
+  int _process_clusters(const snemo::datamodel::tracker_clustering_data &clustering_,
+                        snemo::datamodel::tracker_trajectory_data &trajectory_);
+
   bool isInitialized_;                            /// Initialization status
   std::string id_;                              /// Identifier of the fitter algorithm
   const geomtools::manager *geoManager_;  /// The SuperNEMO geometry manager
   const snemo::geometry::gg_locator
       *geigerLocator_;                /// Locator dedicated to the SuperNEMO tracking chamber
   size_t maxFitsToSave_;  /// The maximum number of fits to be saved
+  snemo::datamodel::tracker_hit_view::address_indices hitAddress_;  /// Cell number indices
+  const snemo::datamodel::tracker_hit_view *hitView_;  /// View of the hits of the event
+  snemo::datamodel::TrackerHitHdlCollection ownHits_;  /// Hits of the clusters, without bank
+  snemo::datamodel::tracker_hit_view ownHitView_;      /// View of the hits of the clusters
 };
 
 }  // end of namespace processing
@@ -70,7 +70,10 @@ void mock_calorimeter_s2c_module::initialize(const datatools::properties& ps,
   this->base_module::_set_initialized(true);
 }
 
-void mock_calorimeter_s2c_module::reset() { this->base_module::_set_initialized(false); }
+void mock_calorimeter_s2c_module::reset() {
+  hitPool_.clear();
+  this->base_module::_set_initialized(false);
+}
 
 // Processing :
 dpp::base_module::process_status mock_calorimeter_s2c_module::process(datatools::things& event) {
@@ -93,6 +96,7 @@ dpp::base_module::process_status mock_calorimeter_s2c_module::process(datatools:
 
   // Always rewrite hits....
   calibratedData.calorimeter_hits().clear();
+  hitPool_.recycle();
 
   // Main processing method :
   process_impl(simulatedData, calibratedData.calorimeter_hits());
@@ -140,7 +144,7 @@ void mock_calorimeter_s2c_module::digitizeHits(
 
       if (found == calohits.rend()) {
         // Then it's a new hit
-        auto newHit = datatools::make_handle<snemo::datamodel::calibrated_calorimeter_hit>();
+        auto newHit = hitPool_.make();
         // auto& newHit = newHandle.grab();
 
         newHit->set_hit_id(calibrated_calorimeter_hit_id++);
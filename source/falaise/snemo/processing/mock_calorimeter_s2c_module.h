@@ -32,6 +32,7 @@
 
 // This project :
 #include <falaise/snemo/datamodels/calibrated_data.h>
+#include <falaise/snemo/datamodels/handle_pool.h>
 #include <falaise/snemo/processing/calorimeter_regime.h>
 
 namespace geomtools {
@@ -87,6 +88,7 @@ class mock_calorimeter_s2c_module : public dpp::base_module {
   double timeWindow{100. * CLHEP::ns};  //!< Time width of a calo cluster
   bool quenchAlphas{true};              //!< Flag to (dis)activate the alpha quenching
   bool assocMCHitId{false};             //!< The flag to reference MC true hit
+  snedm::handle_pool<snemo::datamodel::calibrated_calorimeter_hit> hitPool_{};  //!< Hit pool
 
   // Macro to automate the registration of the module :
   DPP_MODULE_REGISTRATION_INTERFACE(mock_calorimeter_s2c_module)
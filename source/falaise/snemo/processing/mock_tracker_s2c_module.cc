@@ -94,7 +94,10 @@ void mock_tracker_s2c_module::initialize(const datatools::properties& ps,
   this->base_module::_set_initialized(true);
 }
 
-void mock_tracker_s2c_module::reset() { this->base_module::_set_initialized(false); }
+void mock_tracker_s2c_module::reset() {
+  hitPool_.clear();
+  this->base_module::_set_initialized(false);
+}
 
 // Processing :
 dpp::base_module::process_status mock_tracker_s2c_module::process(datatools::things& event) {
@@ -112,6 +115,7 @@ dpp::base_module::process_status mock_tracker_s2c_module::process(datatools::thi
         snedm::getOrAddToEvent<snemo::datamodel::calibrated_data>(cdOutputTag, event);
     cal_tracker_hit_col_t& calTrackerHits = currentCalData.tracker_hits();
 
+    hitPool_.recycle();
     calTrackerHits = process_(simTrackerHits);
   }
 
@@ -313,7 +317,7 @@ mock_tracker_s2c_module::cal_tracker_hit_col_t mock_tracker_s2c_module::calibrat
     // boost::tie(a_tracker_hit, raw_tracker_hit_id) = hit;
     auto& the_raw_tracker_hit = hit.value();
 
-    auto calTrackerHit = datatools::make_handle<snemo::datamodel::calibrated_tracker_hit>();
+    auto calTrackerHit = hitPool_.make();
 
     // Hit and GeomIDs
     calTrackerHit->set_hit_id(hit.index());
@@ -29,6 +29,7 @@
 
 // This project :
 #include <falaise/snemo/datamodels/calibrated_data.h>
+#include <falaise/snemo/datamodels/handle_pool.h>
 #include <falaise/snemo/processing/geiger_regime.h>
 #include <falaise/snemo/services/geometry.h>
 #include <falaise/snemo/services/service_handle.h>
@@ -93,6 +94,7 @@ class mock_tracker_s2c_module : public dpp::base_module {
   bool _store_mc_hit_id_{false};           //!< Flag to store the MC true hit ID
   bool _store_mc_truth_track_ids_{false};  //!< The flag to reference the MC engine track and parent
                                            //!< track IDs associated to this calibrated Geiger hit
+  snedm::handle_pool<snemo::datamodel::calibrated_tracker_hit> hitPool_{};  //!< Hit pool
 
   // Macro to automate the registration of the module :
   DPP_MODULE_REGISTRATION_INTERFACE(mock_tracker_s2c_module)
@@ -17,7 +17,6 @@
 #include <mygsl/histogram.h>
 #include <mygsl/i_unary_function.h>
 #include <mygsl/tabulated_function.h>
-#include <mygsl/von_neumann_method.h>
 // - Bayeux/genbb_help:
 #include <genbb_help/primary_event.h>
 #include <genbb_help/single_particle_generator.h>
@@ -45,10 +44,7 @@ double sea_level_toy_theta_density_function::_eval(double x_) const {
 bool cosmic_muon_generator::can_external_random() const { return true; }
 
 void cosmic_muon_generator::sea_level_toy_setup::reset() {
-  if (angular_VNM != nullptr) {
-    delete angular_VNM;
-    angular_VNM = nullptr;
-  }
+  angular_sampler.reset();
   if (theta_density_function != nullptr) {
     delete theta_density_function;
     theta_density_function = nullptr;
@@ -61,8 +57,8 @@ void cosmic_muon_generator::sea_level_toy_setup::set_defaults() {
   energy_sigma = 1.0 * CLHEP::GeV;
   maximum_theta = 70. * CLHEP::degree;
   muon_ratio = 1.2;
+  angular_table_size = inverse_cdf_sampler::DEFAULT_NUMBER_OF_BINS;
   theta_density_function = nullptr;
-  angular_VNM = nullptr;
 }
 
 cosmic_muon_generator::sea_level_toy_setup::sea_level_toy_setup() { set_defaults(); }
@@ -213,6 +209,13 @@ void cosmic_muon_generator::initialize(const datatools::properties& dps,
                     "Invalid 'sea_level_toy.maximum_theta' value for particle generator '"
                         << get_name() << "' !");
       }
+      if (dps.has_key("sea_level_toy.angular_table_size")) {
+        int table_size = dps.fetch_integer("sea_level_toy.angular_table_size");
+        DT_THROW_IF(table_size <= 0, std::range_error,
+                    "Invalid 'sea_level_toy.angular_table_size' value for particle generator '"
+                        << get_name() << "' !");
+        _sea_level_toy_setup_.angular_table_size = table_size;
+      }
       if (dps.has_key("sea_level_toy.muon_ratio")) {
         _sea_level_toy_setup_.muon_ratio = dps.fetch_real("sea_level_toy.muon_ratio");
         DT_THROW_IF(_sea_level_toy_setup_.muon_ratio < 0.0, std::logic_error,
@@ -242,9 +245,10 @@ void cosmic_muon_generator::_at_init_() {
   if (_mode_ == MODE_SEA_LEVEL) {
     if (_sea_level_mode_ == SEA_LEVEL_TOY) {
       _sea_level_toy_setup_.theta_density_function = new sea_level_toy_theta_density_function;
-      _sea_level_toy_setup_.angular_VNM = new mygsl::von_neumann_method(
-          0.0, _sea_level_toy_setup_.maximum_theta, *_sea_level_toy_setup_.theta_density_function,
-          mygsl::von_neumann_method::AUTO_FMAX, 100, 100);
+      // One uniform number and a table lookup per muon, instead of rejection sampling
+      _sea_level_toy_setup_.angular_sampler.initialize(
+          *_sea_level_toy_setup_.theta_density_function, 0.0, _sea_level_toy_setup_.maximum_theta,
+          _sea_level_toy_setup_.angular_table_size);
     }
   }
 }
@@ -287,7 +291,7 @@ void cosmic_muon_generator::_load_next(::genbb::primary_event& event_,
 
       double momentum = std::sqrt(kinetic_energy * (kinetic_energy + 2 * muon_mass));
       double phi = grab_random().flat(0., 2. * M_PI);
-      double theta = M_PI - _sea_level_toy_setup_.angular_VNM->shoot(grab_random());
+      double theta = M_PI - _sea_level_toy_setup_.angular_sampler.shoot(grab_random());
       px = momentum * std::sin(theta) * std::cos(phi);
       py = momentum * std::sin(theta) * std::sin(phi);
       pz = momentum * std::cos(theta);
@@ -43,9 +43,11 @@
 // - Bayeux/genbb_help:
 #include <genbb_help/i_genbb.h>
 
+// This project:
+#include <falaise/snemo/simulation/inverse_cdf_sampler.h>
+
 namespace mygsl {
 class i_unary_function;
-class von_neumann_method;
 }  // namespace mygsl
 namespace datatools {
 class properties;
@@ -68,8 +70,9 @@ class cosmic_muon_generator : public ::genbb::i_genbb {
     double energy_sigma;   //!< ~ 1 GeV
     double muon_ratio;     //!< Ratio (Nmu+/Nmu-) ~ 1.1
     double maximum_theta;  //!< Maximum azimuthal angle (70 degree)
+    std::size_t angular_table_size;  //!< Number of bins of the angular sampler table
     mygsl::i_unary_function* theta_density_function;
-    mygsl::von_neumann_method* angular_VNM;
+    inverse_cdf_sampler angular_sampler;  //!< Sampler of the zenith angle
     sea_level_toy_setup();
     void set_defaults();
     void reset();
@@ -0,0 +1,93 @@
+// falaise/snemo/simulation/inverse_cdf_sampler.cc
+
+// Ourselves
+#include <falaise/snemo/simulation/inverse_cdf_sampler.h>
+
+// Standard library:
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+
+// Third party:
+// - Bayeux/datatools:
+#include <datatools/exception.h>
+// - Bayeux/mygsl:
+#include <mygsl/i_unary_function.h>
+#include <mygsl/rng.h>
+
+namespace snemo {
+
+namespace simulation {
+
+void inverse_cdf_sampler::initialize(const mygsl::i_unary_function& density, double min,
+                                     double max, std::size_t number_of_bins) {
+  DT_THROW_IF(!(min < max), std::range_error, "Invalid interval [" << min << ", " << max << "]");
+  DT_THROW_IF(number_of_bins == 0, std::range_error, "Invalid number of bins");
+  min_ = min;
+  max_ = max;
+  step_ = (max - min) / number_of_bins;
+
+  pdf_.resize(number_of_bins + 1);
+  for (std::size_t i = 0; i <= number_of_bins; ++i) {
+    double x = (i == number_of_bins) ? max : min + i * step_;
+    pdf_[i] = density.eval(x);
+    DT_THROW_IF(!(pdf_[i] >= 0.0), std::range_error, "Negative density at " << x);
+  }
+
+  // Trapezoidal integral, exact for the piecewise linear density
+  cdf_.resize(number_of_bins + 1);
+  cdf_[0] = 0.0;
+  for (std::size_t i = 0; i < number_of_bins; ++i) {
+    cdf_[i + 1] = cdf_[i] + 0.5 * step_ * (pdf_[i] + pdf_[i + 1]);
+  }
+  double norm = cdf_.back();
+  DT_THROW_IF(!(norm > 0.0), std::range_error, "Density has a null integral");
+  for (std::size_t i = 0; i <= number_of_bins; ++i) {
+    pdf_[i] /= norm;
+    cdf_[i] /= norm;
+  }
+  cdf_.back() = 1.0;
+}
+
+void inverse_cdf_sampler::reset() {
+  min_ = 0.0;
+  max_ = 0.0;
+  step_ = 0.0;
+  pdf_.clear();
+  cdf_.clear();
+}
+
+double inverse_cdf_sampler::inverse(double u) const {
+  DT_THROW_IF(!is_initialized(), std::logic_error, "Sampler is not initialized");
+  // Bin i such that cdf_[i] <= u < cdf_[i+1]
+  auto it = std::upper_bound(cdf_.begin(), cdf_.end(), u);
+  std::size_t i = std::min<std::size_t>(std::max<std::ptrdiff_t>(it - cdf_.begin(), 1) - 1,
+                                        cdf_.size() - 2);
+  // Solve cdf_[i] + f0 t + (f1 - f0) t^2 / (2 step) = u for t in [0, step]
+  double f0 = pdf_[i];
+  double f1 = pdf_[i + 1];
+  double du = u - cdf_[i];
+  // Root of slope/2 t^2 + f0 t - du = 0, in a form stable for null slopes
+  double slope = (f1 - f0) / step_;
+  double denominator = f0 + std::sqrt(std::max(0.0, f0 * f0 + 2.0 * slope * du));
+  double t = (denominator > 0.0) ? 2.0 * du / denominator : 0.0;
+  t = std::min(std::max(t, 0.0), step_);
+  return std::min(min_ + i * step_ + t, max_);
+}
+
+double inverse_cdf_sampler::shoot(mygsl::rng& random) const { return inverse(random.uniform()); }
+
+void inverse_cdf_sampler::shoot(mygsl::rng& random, std::size_t n, double* values) const {
+  for (std::size_t k = 0; k < n; ++k) {
+    values[k] = inverse(random.uniform());
+  }
+}
+
+void inverse_cdf_sampler::shoot(mygsl::rng& random, std::vector<double>& values) const {
+  shoot(random, values.size(), values.data());
+}
+
+}  // end of namespace simulation
+
+}  // end of namespace snemo
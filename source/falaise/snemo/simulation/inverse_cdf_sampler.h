@@ -0,0 +1,85 @@
+// -*- mode: c++ ; -*-
+/// \file falaise/snemo/simulation/inverse_cdf_sampler.h
+/* Description:
+ *
+ *  Sampling of a one-dimensional density from a tabulated inverse
+ *  cumulative distribution function.
+ *
+ */
+
+#ifndef FALAISE_SNEMO_SIMULATION_INVERSE_CDF_SAMPLER_H
+#define FALAISE_SNEMO_SIMULATION_INVERSE_CDF_SAMPLER_H 1
+
+// Standard library:
+#include <cstddef>
+#include <vector>
+
+namespace mygsl {
+class i_unary_function;
+class rng;
+}  // namespace mygsl
+
+namespace snemo {
+
+namespace simulation {
+
+/// \brief Sampler of a density on an interval by inversion of its tabulated CDF
+/*!
+ * The density is evaluated once, at initialization, on a regular grid of
+ * the interval. Within each bin it is taken as linear between its values at
+ * the bin edges, so that the cumulative distribution function is piecewise
+ * quadratic and is inverted exactly. Each value is then shot from a single
+ * uniform random number, with a table lookup and no density evaluation,
+ * where rejection methods need several random numbers and evaluations.
+ *
+ * The density must be non-negative on the interval, with a non-zero integral.
+ */
+class inverse_cdf_sampler {
+ public:
+  /// Default number of bins of the table
+  static const std::size_t DEFAULT_NUMBER_OF_BINS = 1000;
+
+  /// Default constructor
+  inverse_cdf_sampler() = default;
+
+  /// Tabulate a density on [min, max]
+  void initialize(const mygsl::i_unary_function& density, double min, double max,
+                  std::size_t number_of_bins = DEFAULT_NUMBER_OF_BINS);
+
+  /// Check initialization
+  bool is_initialized() const { return !cdf_.empty(); }
+
+  /// Clear the table
+  void reset();
+
+  /// Return the lower bound of the interval
+  double get_min() const { return min_; }
+
+  /// Return the upper bound of the interval
+  double get_max() const { return max_; }
+
+  /// Return the value whose cumulative probability is u, for u in [0, 1]
+  double inverse(double u) const;
+
+  /// Shoot a value
+  double shoot(mygsl::rng& random) const;
+
+  /// Shoot n values in a buffer
+  void shoot(mygsl::rng& random, std::size_t n, double* values) const;
+
+  /// Shoot values to fill a vector, keeping its size
+  void shoot(mygsl::rng& random, std::vector<double>& values) const;
+
+ private:
+  double min_ = 0.0;           //!< Lower bound of the interval
+  double max_ = 0.0;           //!< Upper bound of the interval
+  double step_ = 0.0;          //!< Bin width
+  std::vector<double> pdf_;    //!< Normalized density at the bin edges
+  std::vector<double> cdf_;    //!< Cumulative probability at the bin edges
+};
+
+}  // end of namespace simulation
+
+}  // end of namespace snemo
+
+#endif  // FALAISE_SNEMO_SIMULATION_INVERSE_CDF_SAMPLER_H
@@ -0,0 +1,544 @@
+// test_snemo_cuts.cxx
+#include "catch.hpp"
+
+#include <falaise/snemo/cuts/event_header_cut.h>
+#include <falaise/snemo/cuts/simulated_data_cut.h>
+#include <falaise/snemo/datamodels/event_header.h>
+
+#include "bayeux/datatools/event_id.h"
+#include "bayeux/datatools/properties.h"
+#include "bayeux/datatools/service_manager.h"
+#include "bayeux/datatools/things.h"
+#include "bayeux/geomtools/base_hit.h"
+#include "bayeux/mctools/simulated_data.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+// The cuts run a list of criteria compiled at initialization. Their decisions
+// are compared with the previous implementation, restated below, on corpora of
+// events covering each mode.
+
+namespace {
+
+using EventPtr = std::unique_ptr<datatools::things>;
+
+int applyCut(cuts::i_cut& cut, datatools::things& event) {
+  cut.set_user_data(event);
+  const int status = cut.process();
+  cut.reset_user_data();
+  return status;
+}
+
+//----------------------------------------------------------------------
+// simulated_data_cut
+
+const std::string kCategory = "gg";
+const std::string kFlag = "high_energy";
+
+struct SDCriteria {
+  bool flag = false;
+  bool hasCategory = false;
+  bool range = false;
+  bool property = false;
+  int min = -1;
+  int max = -1;
+  std::string logic = "or";
+  std::map<std::string, std::vector<std::string>> properties = {
+      {"creator_process", {"compton", "brems"}}, {"g4_volume", {"drift_cell_core.log"}}};
+};
+
+datatools::properties makeConfig(const SDCriteria& c) {
+  datatools::properties config;
+  config.store_string("SD_label", "SD");
+  if (c.flag) {
+    config.store_flag("mode.flag");
+    config.store_string("flag.name", kFlag);
+  }
+  if (c.hasCategory) {
+    config.store_flag("mode.has_hit_category");
+    config.store_string("has_hit_category.category", kCategory);
+  }
+  if (c.range) {
+    config.store_flag("mode.range_hit_category");
+    config.store_string("range_hit_category.category", kCategory);
+    config.store_integer("range_hit_category.min", c.min);
+    config.store_integer("range_hit_category.max", c.max);
+  }
+  if (c.property) {
+    config.store_flag("mode.has_hit_property");
+    config.store_string("has_hit_property.category", kCategory);
+    config.store_string("has_hit_property.logic", c.logic);
+    std::vector<std::string> keys;
+    for (const auto& entry : c.properties) {
+      keys.push_back(entry.first);
+      config.store("has_hit_property." + entry.first + ".values", entry.second);
+    }
+    config.store("has_hit_property.keys", keys);
+  }
+  return config;
+}
+
+struct OldDecision {
+  int status;
+  bool skippedHit;  //!< The "and" walk stepped over a hit without checking it
+};
+
+// Previous simulated_data_cut::_accept
+OldDecision oldSDAccept(const SDCriteria& c, const datatools::things& ER) {
+  if (!ER.has("SD")) {
+    return {cuts::SELECTION_INAPPLICABLE, false};
+  }
+  const auto& SD = ER.get<mctools::simulated_data>("SD");
+
+  bool check_flag = true;
+  if (c.flag) {
+    check_flag = SD.get_properties().has_flag(kFlag);
+  }
+
+  bool check_has_hit_category = true;
+  if (c.hasCategory) {
+    check_has_hit_category = SD.has_step_hits(kCategory);
+  }
+
+  bool check_range_hit_category = true;
+  if (c.range) {
+    if (!SD.has_step_hits(kCategory)) {
+      return {cuts::SELECTION_INAPPLICABLE, false};
+    }
+    const size_t nhits = SD.get_number_of_step_hits(kCategory);
+    if (c.min >= 0 && nhits < (size_t)c.min) {
+      check_range_hit_category = false;
+    }
+    if (c.max >= 0 && nhits > (size_t)c.max) {
+      check_range_hit_category = false;
+    }
+  }
+
+  bool check_has_hit_property = true;
+  bool skipped = false;
+  if (c.property) {
+    if (!SD.has_step_hits(kCategory)) {
+      return {cuts::SELECTION_INAPPLICABLE, false};
+    }
+    const mctools::simulated_data::hit_handle_collection_type& the_step_hits =
+        SD.get_step_hits(kCategory);
+
+    auto istart = the_step_hits.begin();
+    auto istop = the_step_hits.end();
+    auto iprop = c.properties.begin();
+
+    while (iprop != c.properties.end()) {
+      geomtools::base_hit::has_string_property_predicate str_pred(iprop->first, iprop->second);
+      datatools::mother_to_daughter_predicate<geomtools::base_hit, mctools::base_step_hit> pred(
+          str_pred);
+      datatools::handle_predicate<mctools::base_step_hit> pred_via_handle(pred);
+
+      auto ifound = std::find_if(istart, istop, pred_via_handle);
+      if (ifound == the_step_hits.end()) {
+        check_has_hit_property = false;
+        if (c.logic == "and") {
+          break;
+        }
+        istart = the_step_hits.begin();
+        istop = the_step_hits.end();
+        iprop++;
+      } else if (ifound == istop) {
+        skipped = true;
+        istart = ++ifound;
+        istop = the_step_hits.end();
+        iprop = c.properties.begin();
+      } else {
+        check_has_hit_property = true;
+        if (c.logic == "or") {
+          break;
+        }
+        istart = ifound;
+        istop = ++ifound;
+        iprop++;
+      }
+    }
+  }
+
+  if (check_flag && check_has_hit_category && check_range_hit_category &&
+      check_has_hit_property) {
+    return {cuts::SELECTION_ACCEPTED, skipped};
+  }
+  return {cuts::SELECTION_REJECTED, skipped};
+}
+
+// "and" logic as documented: one hit has all the properties
+bool someHitHasAllProperties(const SDCriteria& c, const datatools::things& ER) {
+  const auto& hits = ER.get<mctools::simulated_data>("SD").get_step_hits(kCategory);
+  for (const auto& hit : hits) {
+    const datatools::properties& aux = hit.get().get_auxiliaries();
+    bool all = true;
+    for (const auto& p : c.properties) {
+      all = all && aux.has_key(p.first) && aux.is_string(p.first) &&
+            std::find(p.second.begin(), p.second.end(), aux.fetch_string(p.first)) !=
+                p.second.end();
+    }
+    if (all) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void addHit(mctools::simulated_data& SD, const std::string& process, const std::string& volume) {
+  mctools::base_step_hit& hit = SD.add_step_hit(kCategory);
+  if (!process.empty()) {
+    hit.grab_auxiliaries().store_string("creator_process", process);
+  }
+  if (!volume.empty()) {
+    hit.grab_auxiliaries().store_string("g4_volume", volume);
+  }
+}
+
+std::vector<EventPtr> makeSDCorpus() {
+  std::vector<EventPtr> corpus;
+  // No simulated data bank
+  corpus.emplace_back(new datatools::things);
+
+  const std::vector<std::string> processes = {"", "compton", "brems", "eIoni"};
+  const std::vector<std::string> volumes = {"", "drift_cell_core.log", "calorimeter_block.log"};
+  std::mt19937 generator(314159);
+  for (int i = 0; i < 400; ++i) {
+    corpus.emplace_back(new datatools::things);
+    auto& SD = corpus.back()->add<mctools::simulated_data>("SD");
+    if (generator() % 2 == 0) {
+      SD.grab_properties().store_flag(kFlag);
+    }
+    // Some events have no step hit category
+    const int nhits = static_cast<int>(generator() % 6) - 1;
+    if (nhits < 0) {
+      continue;
+    }
+    SD.add_step_hits(kCategory);
+    for (int j = 0; j < nhits; ++j) {
+      addHit(SD, processes[generator() % processes.size()],
+             volumes[generator() % volumes.size()]);
+    }
+  }
+  return corpus;
+}
+
+void compareSDCut(const SDCriteria& c, std::vector<EventPtr>& corpus) {
+  datatools::service_manager services;
+  cuts::cut_handle_dict_type dict;
+  snemo::cut::simulated_data_cut cut;
+  cut.initialize(makeConfig(c), services, dict);
+
+  for (size_t i = 0; i < corpus.size(); ++i) {
+    INFO("Event #" << i);
+    const OldDecision old = oldSDAccept(c, *corpus[i]);
+    const int status = applyCut(cut, *corpus[i]);
+    if (!old.skippedHit) {
+      REQUIRE(status == old.status);
+    } else {
+      // The previous "and" walk could miss the hit with all the properties
+      REQUIRE(status != cuts::SELECTION_INAPPLICABLE);
+      SDCriteria others = c;
+      others.property = false;
+      const bool otherCriteria =
+          oldSDAccept(others, *corpus[i]).status == cuts::SELECTION_ACCEPTED;
+      REQUIRE((status == cuts::SELECTION_ACCEPTED) ==
+              (otherCriteria && someHitHasAllProperties(c, *corpus[i])));
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// event_header_cut
+
+struct EHCriteria {
+  bool flag = false;
+  bool run = false;
+  bool event = false;
+  bool list = false;
+  int minRun = -1;
+  int maxRun = -1;
+  int minEvent = -1;
+  int maxEvent = -1;
+  std::vector<datatools::event_id> ids;
+};
+
+datatools::properties makeConfig(const EHCriteria& c) {
+  datatools::properties config;
+  config.store_string("EH_label", "EH");
+  if (c.flag) {
+    config.store_flag("mode.flag");
+    config.store_string("flag.name", kFlag);
+  }
+  if (c.run) {
+    config.store_flag("mode.run_number");
+    config.store_integer("run_number.min", c.minRun);
+    config.store_integer("run_number.max", c.maxRun);
+  }
+  if (c.event) {
+    config.store_flag("mode.event_number");
+    config.store_integer("event_number.min", c.minEvent);
+    config.store_integer("event_number.max", c.maxEvent);
+  }
+  if (c.list) {
+    config.store_flag("mode.list_of_event_ids");
+    std::vector<std::string> ids;
+    for (const auto& id : c.ids) {
+      ids.push_back(id.to_string());
+    }
+    config.store("list_of_event_ids.ids", ids);
+  }
+  return config;
+}
+
+// Previous event_header_cut::_accept
+int oldEHAccept(const EHCriteria& c, const datatools::things& ER) {
+  if (!ER.has("EH")) {
+    return cuts::SELECTION_INAPPLICABLE;
+  }
+  const auto& EH = ER.get<snemo::datamodel::event_header>("EH");
+
+  bool check_flag = true;
+  if (c.flag) {
+    check_flag = EH.get_properties().has_flag(kFlag);
+  }
+
+  bool check_run_number = true;
+  if (c.run) {
+    if (!EH.get_id().is_valid()) {
+      return cuts::SELECTION_INAPPLICABLE;
+    }
+    const int rn = EH.get_id().get_run_number();
+    if (c.minRun >= 0 && rn < c.minRun) {
+      check_run_number = false;
+    }
+    if (c.maxRun >= 0 && rn > c.maxRun) {
+      check_run_number = false;
+    }
+  }
+
+  bool check_event_number = true;
+  if (c.event) {
+    if (!EH.get_id().is_valid()) {
+      return cuts::SELECTION_INAPPLICABLE;
+    }
+    const int en = EH.get_id().get_event_number();
+    if (c.minEvent >= 0 && en < c.minEvent) {
+      check_event_number = false;
+    }
+    if (c.maxEvent >= 0 && en > c.maxEvent) {
+      check_event_number = false;
+    }
+  }
+
+  bool check_list_of_events = true;
+  if (c.list) {
+    if (!EH.get_id().is_valid()) {
+      return cuts::SELECTION_INAPPLICABLE;
+    }
+    const std::set<datatools::event_id> ids(c.ids.begin(), c.ids.end());
+    check_list_of_events = ids.count(EH.get_id()) != 0;
+  }
+
+  if (check_flag && check_run_number && check_event_number && check_list_of_events) {
+    return cuts::SELECTION_ACCEPTED;
+  }
+  return cuts::SELECTION_REJECTED;
+}
+
+std::vector<EventPtr> makeEHCorpus() {
+  std::vector<EventPtr> corpus;
+  // No event header bank
+  corpus.emplace_back(new datatools::things);
+  // Event header without a valid ID
+  corpus.emplace_back(new datatools::things);
+  corpus.back()->add<snemo::datamodel::event_header>("EH");
+
+  for (int run = 0; run < 4; ++run) {
+    for (int event = 0; event < 10; ++event) {
+      corpus.emplace_back(new datatools::things);
+      auto& EH = corpus.back()->add<snemo::datamodel::event_header>("EH");
+      EH.set_id(datatools::event_id(run, event));
+      if ((run + event) % 3 == 0) {
+        EH.get_properties().store_flag(kFlag);
+      }
+    }
+  }
+  return corpus;
+}
+
+void compareEHCut(const EHCriteria& c, std::vector<EventPtr>& corpus) {
+  datatools::service_manager services;
+  cuts::cut_handle_dict_type dict;
+  snemo::cut::event_header_cut cut;
+  cut.initialize(makeConfig(c), services, dict);
+
+  for (size_t i = 0; i < corpus.size(); ++i) {
+    INFO("Event #" << i);
+    REQUIRE(applyCut(cut, *corpus[i]) == oldEHAccept(c, *corpus[i]));
+  }
+}
+
+}  // namespace
+
+TEST_CASE("Simulated data cut decides as before in each mode", "[falaise][cuts]") {
+  std::vector<EventPtr> corpus = makeSDCorpus();
+
+  SECTION("Flag") {
+    SDCriteria c;
+    c.flag = true;
+    compareSDCut(c, corpus);
+  }
+
+  SECTION("Hit category") {
+    SDCriteria c;
+    c.hasCategory = true;
+    compareSDCut(c, corpus);
+  }
+
+  SECTION("Hit count range") {
+    SDCriteria c;
+    c.range = true;
+    c.min = 1;
+    c.max = 3;
+    compareSDCut(c, corpus);
+  }
+
+  SECTION("Hit property, or") {
+    SDCriteria c;
+    c.property = true;
+    c.logic = "or";
+    compareSDCut(c, corpus);
+  }
+
+  SECTION("Hit property, and") {
+    SDCriteria c;
+    c.property = true;
+    c.logic = "and";
+    compareSDCut(c, corpus);
+  }
+
+  SECTION("All modes, or") {
+    SDCriteria c;
+    c.flag = true;
+    c.hasCategory = true;
+    c.range = true;
+    c.min = 2;
+    c.max = 4;
+    c.property = true;
+    c.logic = "or";
+    compareSDCut(c, corpus);
+  }
+
+  SECTION("All modes, and") {
+    SDCriteria c;
+    c.flag = true;
+    c.hasCategory = true;
+    c.range = true;
+    c.min = 2;
+    c.max = 4;
+    c.property = true;
+    c.logic = "and";
+    compareSDCut(c, corpus);
+  }
+}
+
+TEST_CASE("Simulated data cut checks every hit with the and logic", "[falaise][cuts]") {
+  // The first hit has the first property only, the second one has both
+  std::vector<EventPtr> corpus;
+  corpus.emplace_back(new datatools::things);
+  auto& SD = corpus.back()->add<mctools::simulated_data>("SD");
+  SD.add_step_hits(kCategory);
+  addHit(SD, "brems", "");
+  addHit(SD, "brems", "drift_cell_core.log");
+
+  SDCriteria c;
+  c.property = true;
+  c.logic = "and";
+
+  // The previous walk stepped over the second hit
+  const OldDecision old = oldSDAccept(c, *corpus.front());
+  REQUIRE(old.skippedHit);
+  REQUIRE(old.status == cuts::SELECTION_REJECTED);
+
+  datatools::service_manager services;
+  cuts::cut_handle_dict_type dict;
+  snemo::cut::simulated_data_cut cut;
+  cut.initialize(makeConfig(c), services, dict);
+  REQUIRE(applyCut(cut, *corpus.front()) == cuts::SELECTION_ACCEPTED);
+
+  // Neither hit has both properties
+  corpus.emplace_back(new datatools::things);
+  auto& SD2 = corpus.back()->add<mctools::simulated_data>("SD");
+  SD2.add_step_hits(kCategory);
+  addHit(SD2, "brems", "");
+  addHit(SD2, "eIoni", "drift_cell_core.log");
+  addHit(SD2, "compton", "calorimeter_block.log");
+  REQUIRE(applyCut(cut, *corpus.back()) == cuts::SELECTION_REJECTED);
+}
+
+TEST_CASE("Event header cut decides as before in each mode", "[falaise][cuts]") {
+  std::vector<EventPtr> corpus = makeEHCorpus();
+
+  SECTION("Flag") {
+    EHCriteria c;
+    c.flag = true;
+    compareEHCut(c, corpus);
+  }
+
+  SECTION("Run number range") {
+    EHCriteria c;
+    c.run = true;
+    c.minRun = 1;
+    c.maxRun = 2;
+    compareEHCut(c, corpus);
+  }
+
+  SECTION("Unbounded run number range") {
+    EHCriteria c;
+    c.run = true;
+    compareEHCut(c, corpus);
+  }
+
+  SECTION("Event number range, minimum only") {
+    EHCriteria c;
+    c.event = true;
+    c.minEvent = 4;
+    compareEHCut(c, corpus);
+  }
+
+  SECTION("Event number range, maximum only") {
+    EHCriteria c;
+    c.event = true;
+    c.maxEvent = 6;
+    compareEHCut(c, corpus);
+  }
+
+  SECTION("List of event IDs") {
+    EHCriteria c;
+    c.list = true;
+    c.ids = {datatools::event_id(3, 9), datatools::event_id(0, 0), datatools::event_id(2, 5),
+             datatools::event_id(7, 1)};
+    compareEHCut(c, corpus);
+  }
+
+  SECTION("All modes") {
+    EHCriteria c;
+    c.flag = true;
+    c.run = true;
+    c.minRun = 0;
+    c.maxRun = 2;
+    c.event = true;
+    c.minEvent = 3;
+    c.maxEvent = 9;
+    c.list = true;
+    c.ids = {datatools::event_id(0, 3), datatools::event_id(1, 6), datatools::event_id(2, 9),
+             datatools::event_id(3, 3), datatools::event_id(1, 2)};
+    compareEHCut(c, corpus);
+  }
+}
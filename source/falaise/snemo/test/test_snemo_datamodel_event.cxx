@@ -2,6 +2,7 @@
 #include <falaise/snemo/datamodels/event.h>
 #include "catch.hpp"
 
+#include <falaise/snemo/datamodels/calibrated_data.h>
 #include <falaise/snemo/datamodels/timestamp.h>
 
 TEST_CASE("Event construction works", "[falaise][datamodel]") {
@@ -37,4 +38,33 @@ TEST_CASE("getOrAddToEvent free function works", "[falaise][datamodel]") {
     REQUIRE_THROWS_AS(snedm::getOrAddToEvent<datatools::things>("first", e),
                       datatools::bad_things_cast);
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE("resetEvent free function works", "[falaise][datamodel]") {
+  snedm::event_record e;
+  using calibrated_data = snemo::datamodel::calibrated_data;
+  using timestamp = snemo::datamodel::timestamp;
+
+  auto& cd0 = snedm::getOrAddToEvent<calibrated_data>("CD", e);
+  for (int i = 0; i < 10; ++i) {
+    cd0.tracker_hits().push_back(
+        snemo::datamodel::TrackerHitHdl{new snemo::datamodel::calibrated_tracker_hit});
+  }
+  const auto capacity = cd0.tracker_hits().capacity();
+  snedm::getOrAddToEvent<timestamp>("other", e);
+
+  snedm::resetEvent(e);
+
+  SECTION("Falaise banks are emptied in place, keeping their storage") {
+    REQUIRE(e.has("CD"));
+    auto& cd1 = snedm::getOrAddToEvent<calibrated_data>("CD", e);
+    REQUIRE(&cd0 == &cd1);
+    REQUIRE(cd1.tracker_hits().empty());
+    REQUIRE(cd1.tracker_hits().capacity() == capacity);
+  }
+
+  SECTION("Other banks are removed") {
+    REQUIRE(!e.has("other"));
+    REQUIRE(e.size() == 1);
+  }
+}
@@ -0,0 +1,194 @@
+// test_snemo_datamodel_fast_codec.cxx
+#include <falaise/snemo/datamodels/fast_codec.h>
+#include "catch.hpp"
+
+#include <sstream>
+
+#include <boost/serialization/nvp.hpp>
+
+#include <bayeux/datatools/clhep_units.h>
+#include <bayeux/datatools/eos/portable_oarchive.hpp>
+
+#include <falaise/snemo/datamodels/calibrated_data.h>
+#include <falaise/snemo/datamodels/event_header.h>
+#include <falaise/snemo/datamodels/line_trajectory_pattern.h>
+#include <falaise/snemo/datamodels/particle_track_data.h>
+#include <falaise/snemo/datamodels/tracker_clustering_data.h>
+#include <falaise/snemo/datamodels/tracker_trajectory_data.h>
+
+namespace {
+namespace sdm = snemo::datamodel;
+
+template <class Bank>
+std::string boost_archive(const Bank& bank) {
+  std::ostringstream os;
+  {
+    eos::portable_oarchive oa(os);
+    oa << boost::serialization::make_nvp("bank", bank);
+  }
+  return os.str();
+}
+
+// Encode and decode a bank, checking that its Boost archive is unchanged
+template <class Bank>
+void check_round_trip(const Bank& bank) {
+  std::string buffer;
+  sdm::fast_codec::encode(bank, buffer);
+  Bank decoded;
+  sdm::fast_codec::decode(buffer, decoded);
+
+  const std::string archive = boost_archive(bank);
+  REQUIRE(boost_archive(decoded) == archive);
+  REQUIRE(sdm::fast_codec::from_boost<Bank>(archive) == buffer);
+  REQUIRE(sdm::fast_codec::to_boost<Bank>(buffer) == archive);
+
+  // Truncated buffers are rejected
+  REQUIRE_THROWS(sdm::fast_codec::decode(buffer.substr(0, buffer.size() - 1), decoded));
+}
+
+sdm::TrackerHitHdl make_tracker_hit(int id, uint32_t layer, uint32_t row) {
+  auto hit = datatools::make_handle<sdm::calibrated_tracker_hit>();
+  hit->set_hit_id(id);
+  hit->set_geom_id(geomtools::geom_id(1204, 0, 0, layer, row));
+  hit->set_xy(10.0 * layer, 20.0 * row);
+  hit->set_z(1.5 * id);
+  hit->set_sigma_z(1.0 * CLHEP::cm);
+  hit->set_r(2.0 * CLHEP::mm);
+  hit->set_sigma_r(0.3 * CLHEP::mm);
+  return hit;
+}
+
+sdm::CalorimeterHitHdl make_calorimeter_hit(int id, uint32_t column) {
+  auto hit = datatools::make_handle<sdm::calibrated_calorimeter_hit>();
+  hit->set_hit_id(id);
+  hit->set_geom_id(geomtools::geom_id(1302, 0, 1, column, 7, 3));
+  hit->set_energy(1.0 * CLHEP::MeV);
+  hit->set_sigma_energy(0.1 * CLHEP::MeV);
+  hit->set_time(3.0 * CLHEP::ns);
+  hit->set_sigma_time(0.4 * CLHEP::ns);
+  return hit;
+}
+
+sdm::TrackerClusterHdl make_cluster(int id, const sdm::TrackerHitHdlCollection& hits) {
+  auto cluster = datatools::make_handle<sdm::tracker_cluster>();
+  cluster->set_cluster_id(id);
+  cluster->hits() = hits;
+  return cluster;
+}
+}  // namespace
+
+TEST_CASE("Event headers round trip", "[falaise][datamodel]") {
+  sdm::event_header header;
+  header.get_id().set(12, 3456);
+  header.set_generation(sdm::event_header::GENERATION_SIMULATED);
+  header.get_timestamp().set_seconds(1234567);
+  header.get_timestamp().set_picoseconds(890);
+  check_round_trip(header);
+
+  header.get_properties().store("origin", "test");
+  check_round_trip(header);
+
+  std::string buffer;
+  sdm::fast_codec::encode(header, buffer);
+  REQUIRE(sdm::fast_codec::get_bank_tag(buffer) == sdm::fast_codec::EVENT_HEADER);
+  sdm::calibrated_data wrongBank;
+  REQUIRE_THROWS(sdm::fast_codec::decode(buffer, wrongBank));
+}
+
+TEST_CASE("Calibrated data round trips", "[falaise][datamodel]") {
+  sdm::calibrated_data data;
+  check_round_trip(data);
+
+  data.tracker_hits().push_back(make_tracker_hit(0, 1, 2));
+  data.tracker_hits().push_back(make_tracker_hit(1, 3, 4));
+  data.tracker_hits().back()->set_delayed_time(5.0 * CLHEP::microsecond, 0.1 * CLHEP::microsecond);
+  data.tracker_hits().back()->set_noisy(true);
+  data.tracker_hits().push_back(datatools::make_handle<sdm::calibrated_tracker_hit>());
+  data.tracker_hits().front()->grab_auxiliaries().store_flag("peripheral");
+  data.calorimeter_hits().push_back(make_calorimeter_hit(0, 5));
+  data.calorimeter_hits().push_back(make_calorimeter_hit(1, 6));
+  // The same hit may be referenced twice
+  data.calorimeter_hits().push_back(data.calorimeter_hits().front());
+  check_round_trip(data);
+}
+
+TEST_CASE("Tracker clustering and trajectory data round trip", "[falaise][datamodel]") {
+  sdm::TrackerHitHdlCollection hits;
+  for (int i = 0; i < 6; ++i) {
+    hits.push_back(make_tracker_hit(i, i, 10 + i));
+  }
+
+  auto clustering = datatools::make_handle<sdm::tracker_clustering_solution>();
+  clustering->set_solution_id(0);
+  clustering->get_clusters().push_back(make_cluster(0, {hits[0], hits[1], hits[2]}));
+  clustering->get_clusters().push_back(make_cluster(1, {hits[3], hits[4]}));
+  clustering->get_unclustered_hits().push_back(hits[5]);
+  clustering->get_auxiliaries().store("driver", "test");
+
+  sdm::tracker_clustering_data clusteringData;
+  clusteringData.push_back(clustering, true);
+  check_round_trip(clusteringData);
+
+  auto pattern = datatools::make_handle<sdm::line_trajectory_pattern>();
+  pattern->get_segment().set_first(geomtools::vector_3d(3.0, 5.0, 7.0));
+  pattern->get_segment().set_last(geomtools::vector_3d(13.0, -5.0, 12.0));
+  auto trajectory = datatools::make_handle<sdm::tracker_trajectory>();
+  trajectory->set_id(0);
+  trajectory->set_cluster_handle(clustering->get_clusters()[0]);
+  trajectory->set_pattern_handle(pattern);
+  trajectory->grab_auxiliaries().store("chi2", 0.234);
+
+  // Two solutions sharing the clustering solution and the trajectory
+  sdm::tracker_trajectory_data trajectoryData;
+  for (int i = 0; i < 2; ++i) {
+    auto solution = datatools::make_handle<sdm::tracker_trajectory_solution>();
+    solution->set_solution_id(i);
+    solution->set_clustering_solution(clustering);
+    solution->grab_trajectories().push_back(trajectory);
+    solution->grab_unfitted_clusters().push_back(clustering->get_clusters()[1]);
+    trajectoryData.add_solution(solution, i == 1);
+  }
+  check_round_trip(trajectoryData);
+
+  std::string buffer;
+  sdm::fast_codec::encode(trajectoryData, buffer);
+  sdm::tracker_trajectory_data decoded;
+  sdm::fast_codec::decode(buffer, decoded);
+  const auto& solutions = decoded.get_solutions();
+  REQUIRE(solutions.size() == 2);
+  const sdm::tracker_trajectory_solution& first = solutions[0].get();
+  const sdm::tracker_trajectory_solution& second = solutions[1].get();
+  REQUIRE(&first.get_clustering_solution() == &second.get_clustering_solution());
+  REQUIRE(&first.get_trajectories()[0].get() == &second.get_trajectories()[0].get());
+  REQUIRE(&first.get_trajectories()[0].get().get_cluster() ==
+          &first.get_clustering_solution().get_clusters()[0].get());
+}
+
+TEST_CASE("Particle track data round trips", "[falaise][datamodel]") {
+  sdm::particle_track_data particleData;
+  check_round_trip(particleData);
+
+  auto trajectory = datatools::make_handle<sdm::tracker_trajectory>();
+  trajectory->set_cluster_handle(make_cluster(0, {make_tracker_hit(0, 0, 1)}));
+  auto calorimeterHit = make_calorimeter_hit(0, 5);
+
+  auto particle = datatools::make_handle<sdm::particle_track>();
+  particle->set_track_id(0);
+  particle->set_charge(sdm::particle_track::NEGATIVE);
+  particle->set_trajectory_handle(trajectory);
+  particle->get_associated_calorimeter_hits().push_back(calorimeterHit);
+  auto vertex =
+      datatools::make_handle<geomtools::blur_spot>(geomtools::blur_spot::dimension_three);
+  vertex->set_hit_id(0);
+  vertex->set_position(geomtools::vector_3d(1.0, 2.0, 3.0));
+  particle->get_vertices().push_back(vertex);
+  particleData.insertParticle(particle);
+
+  auto neutral = datatools::make_handle<sdm::particle_track>();
+  neutral->set_track_id(1);
+  neutral->set_charge(sdm::particle_track::NEUTRAL);
+  neutral->get_associated_calorimeter_hits().push_back(make_calorimeter_hit(1, 8));
+  particleData.insertParticle(neutral);
+  particleData.isolatedCalorimeters().push_back(make_calorimeter_hit(2, 9));
+  check_round_trip(particleData);
+}
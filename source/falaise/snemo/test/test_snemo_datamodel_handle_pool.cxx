@@ -0,0 +1,81 @@
+// test_snemo_datamodel_handle_pool.cxx
+#include <falaise/snemo/datamodels/handle_pool.h>
+#include "catch.hpp"
+
+#include <falaise/snemo/datamodels/calibrated_tracker_hit.h>
+#include <falaise/snemo/datamodels/tracker_cluster.h>
+
+TEST_CASE("Handle pool creates objects on demand", "[falaise][datamodel]") {
+  snedm::handle_pool<snemo::datamodel::calibrated_tracker_hit> pool;
+  REQUIRE(pool.size() == 0);
+
+  auto h0 = pool.make();
+  auto h1 = pool.make();
+  REQUIRE(pool.size() == 2);
+  REQUIRE(&(h0.get()) != &(h1.get()));
+}
+
+TEST_CASE("Handle pool reuses released objects only", "[falaise][datamodel]") {
+  using hit_t = snemo::datamodel::calibrated_tracker_hit;
+  snedm::handle_pool<hit_t> pool;
+
+  auto kept = pool.make();
+  const hit_t* keptAddress = &(kept.get());
+  const hit_t* releasedAddress = nullptr;
+  {
+    auto released = pool.make();
+    released->set_hit_id(42);
+    released->set_noisy(true);
+    releasedAddress = &(released.get());
+  }
+
+  // Nothing is reused until the pool is told to recycle
+  REQUIRE(pool.available() == 0);
+  pool.recycle();
+  REQUIRE(pool.available() == 1);
+
+  auto reused = pool.make();
+  REQUIRE(pool.size() == 2);
+  REQUIRE(&(reused.get()) == releasedAddress);
+  REQUIRE(&(reused.get()) != keptAddress);
+
+  // Reused object is reset to default state
+  REQUIRE(reused->get_hit_id() == hit_t{}.get_hit_id());
+  REQUIRE(!reused->is_noisy());
+
+  // Pool is exhausted, so a new object is created
+  auto fresh = pool.make();
+  REQUIRE(pool.size() == 3);
+
+  pool.clear();
+  REQUIRE(pool.size() == 0);
+  REQUIRE(kept->get_hit_id() == hit_t{}.get_hit_id());
+}
+
+TEST_CASE("Handle pool clears reused objects in place", "[falaise][datamodel]") {
+  using cluster_t = snemo::datamodel::tracker_cluster;
+  using hit_t = snemo::datamodel::calibrated_tracker_hit;
+  snedm::handle_pool<cluster_t> pool;
+
+  const cluster_t* releasedAddress = nullptr;
+  size_t capacity = 0;
+  {
+    auto released = pool.make();
+    released->set_cluster_id(3);
+    released->make_delayed();
+    for (int i = 0; i < 10; ++i) {
+      released->hits().push_back(datatools::make_handle<hit_t>());
+    }
+    releasedAddress = &(released.get());
+    capacity = released->hits().capacity();
+  }
+  pool.recycle();
+
+  auto reused = pool.make();
+  REQUIRE(&(reused.get()) == releasedAddress);
+  REQUIRE(reused->get_cluster_id() == cluster_t{}.get_cluster_id());
+  REQUIRE(reused->is_prompt());
+  REQUIRE(reused->hits().empty());
+  // The storage of the hits is kept for the next event
+  REQUIRE(reused->hits().capacity() == capacity);
+}
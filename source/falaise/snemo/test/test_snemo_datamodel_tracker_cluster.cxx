@@ -4,11 +4,13 @@
 #include <cstdlib>
 #include <exception>
 #include <iostream>
+#include <stdexcept>
 #include <string>
 
 // Third party:
 // - Boost/datatools:
 #include <datatools/clhep_units.h>
+#include <datatools/exception.h>
 
 // This project:
 #include <falaise/snemo/datamodels/tracker_cluster.h>
@@ -56,6 +58,14 @@ int main(/* int argc_, char ** argv_ */) {
     TC1.hits().push_back(hits[3]);
     TC1.hits().push_back(hits[4]);
     TC1.grab_auxiliaries().store("display.color", "blue");
+    sdm::tracker_cluster::helix_seed seed;
+    seed.x0 = 150. * CLHEP::mm;
+    seed.y0 = -20. * CLHEP::mm;
+    seed.z0 = 50. * CLHEP::cm;
+    seed.r = 600. * CLHEP::mm;
+    seed.step = 1.2 * CLHEP::m;
+    TC1.set_helix_seed(seed);
+    DT_THROW_IF(!TC1.has_helix_seed(), std::logic_error, "Missing helix seed !");
     {
       std::ostringstream title;
       title << "Cluster #0";
@@ -78,6 +88,18 @@ int main(/* int argc_, char ** argv_ */) {
       TC2.tree_dump(std::clog, title.str());
     }
 
+    // A seed is cleared with its cluster, and a helix without step is not a seed :
+    TC1.clear();
+    DT_THROW_IF(TC1.has_helix_seed(), std::logic_error, "Helix seed not cleared !");
+    seed.step = 0.0;
+    bool rejected = false;
+    try {
+      TC2.set_helix_seed(seed);
+    } catch (std::domain_error&) {
+      rejected = true;
+    }
+    DT_THROW_IF(!rejected || TC2.has_helix_seed(), std::logic_error, "Invalid helix seed set !");
+
     std::clog << "The end." << std::endl;
   } catch (std::exception& x) {
     std::cerr << "error: " << x.what() << std::endl;
@@ -0,0 +1,115 @@
+// test_snemo_datamodel_tracker_hit_view.cxx
+#include <falaise/snemo/datamodels/tracker_hit_view.h>
+#include "catch.hpp"
+
+#include <bayeux/datatools/clhep_units.h>
+#include <bayeux/datatools/utils.h>
+
+#include <falaise/snemo/datamodels/calibrated_data.h>
+
+namespace {
+snemo::datamodel::TrackerHitHdl make_hit(int id, uint32_t side, uint32_t layer, uint32_t row) {
+  auto hit = datatools::make_handle<snemo::datamodel::calibrated_tracker_hit>();
+  hit->set_hit_id(id);
+  hit->set_geom_id(geomtools::geom_id(1204, 0, side, layer, row));
+  hit->set_xy(10.0 * layer, 20.0 * row);
+  hit->set_z(1.5 * id);
+  hit->set_sigma_z(1.0 * CLHEP::cm);
+  hit->set_r(2.0 * CLHEP::mm);
+  hit->set_sigma_r(0.3 * CLHEP::mm);
+  hit->set_anode_time(100.0 * CLHEP::ns);
+  return hit;
+}
+
+// Subaddresses of the Geiger cell category: [module.side.layer.row]
+snemo::datamodel::tracker_hit_view::address_indices cell_address() {
+  snemo::datamodel::tracker_hit_view::address_indices address;
+  address.module = 0;
+  address.side = 1;
+  address.layer = 2;
+  address.row = 3;
+  return address;
+}
+}  // namespace
+
+TEST_CASE("Tracker hit view holds one entry per non null hit", "[falaise][datamodel]") {
+  using view_t = snemo::datamodel::tracker_hit_view;
+  snemo::datamodel::TrackerHitHdlCollection hits;
+  hits.push_back(make_hit(0, 0, 1, 2));
+  hits.push_back(snemo::datamodel::TrackerHitHdl{});
+  hits.push_back(make_hit(1, 1, 3, 4));
+  hits.back()->set_delayed_time(5.0 * CLHEP::microsecond);
+  hits.back()->set_noisy(true);
+
+  view_t view{hits, cell_address()};
+  REQUIRE(view.size() == 2);
+  REQUIRE(view.is_view_of(hits));
+
+  REQUIRE(view.id()[1] == 1);
+  REQUIRE(view.side()[1] == 1);
+  REQUIRE(view.layer()[1] == 3);
+  REQUIRE(view.row()[1] == 4);
+  REQUIRE(view.geom_type()[0] == 1204);
+  REQUIRE(view.x()[1] == Approx(30.0));
+  REQUIRE(view.y()[1] == Approx(80.0));
+  REQUIRE(view.z()[1] == Approx(1.5));
+  REQUIRE(view.r()[0] == Approx(2.0 * CLHEP::mm));
+  REQUIRE(view.sigma_r()[0] == Approx(0.3 * CLHEP::mm));
+
+  // Prompt hits carry their anode time, delayed hits their reference time
+  REQUIRE(view.is_prompt(0));
+  REQUIRE(view.time()[0] == Approx(100.0 * CLHEP::ns));
+  REQUIRE(view.is_delayed(1));
+  REQUIRE(view.time()[1] == Approx(5.0 * CLHEP::microsecond));
+  REQUIRE((view.flags()[1] & view_t::noisy) != 0);
+  REQUIRE((view.flags()[0] & view_t::noisy) == 0);
+
+  // Handles refer back to the collection, skipping the null one
+  REQUIRE(&(view.handle(1).get()) == &(hits[2].get()));
+
+  // Hits of the collection are found from their handles
+  REQUIRE(view.find(hits[0]) == 0);
+  REQUIRE(view.find(hits[2]) == 1);
+  REQUIRE(view.find(hits[1]) == view_t::npos);
+  REQUIRE(view.find(make_hit(1, 1, 3, 4)) == view_t::npos);
+
+  view.clear();
+  REQUIRE(view.empty());
+  REQUIRE(!view.is_view_of(hits));
+}
+
+TEST_CASE("Tracker hit view reads the cell numbers at the given subaddresses",
+          "[falaise][datamodel]") {
+  snemo::datamodel::TrackerHitHdlCollection hits;
+  hits.push_back(make_hit(0, 1, 3, 4));
+
+  snemo::datamodel::tracker_hit_view::address_indices address = cell_address();
+  address.layer = 3;
+  address.row = 2;
+  const snemo::datamodel::tracker_hit_view view{hits, address};
+  REQUIRE(view.layer()[0] == 4);
+  REQUIRE(view.row()[0] == 3);
+}
+
+TEST_CASE("Calibrated data shares its tracker hit view", "[falaise][datamodel]") {
+  snemo::datamodel::calibrated_data cd;
+  cd.tracker_hits().push_back(make_hit(0, 0, 0, 0));
+
+  const snemo::datamodel::calibrated_data& ccd = cd;
+  const snemo::datamodel::tracker_hit_view& view = ccd.tracker_hits_view(cell_address());
+  REQUIRE(view.size() == 1);
+  REQUIRE(&ccd.tracker_hits_view(cell_address()) == &view);
+  REQUIRE(view.find(ccd.tracker_hits()[0]) == 0);
+
+  // Mutable access invalidates the view
+  cd.tracker_hits().push_back(make_hit(1, 0, 0, 1));
+  REQUIRE(ccd.tracker_hits_view(cell_address()).size() == 2);
+
+  // A copy gets its own view
+  const snemo::datamodel::calibrated_data copy = cd;
+  REQUIRE(copy.tracker_hits_view(cell_address()).is_view_of(copy.tracker_hits()));
+  REQUIRE(copy.tracker_hits_view(cell_address()).size() == 2);
+
+  cd.clear();
+  REQUIRE(ccd.tracker_hits_view(cell_address()).empty());
+}
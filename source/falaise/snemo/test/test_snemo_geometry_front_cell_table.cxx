@@ -0,0 +1,87 @@
+// Catch
+#include "catch.hpp"
+
+#include "falaise/snemo/geometry/calo_locator.h"
+#include "falaise/snemo/geometry/front_cell_table.h"
+#include "falaise/snemo/geometry/gg_locator.h"
+#include "falaise/snemo/geometry/locator_helpers.h"
+#include "falaise/snemo/geometry/locator_plugin.h"
+#include "falaise/snemo/services/geometry.h"
+#include "falaise/snemo/services/service_handle.h"
+
+#include "bayeux/datatools/multi_properties.h"
+#include "bayeux/datatools/service_manager.h"
+#include "bayeux/geomtools/mapping.h"
+
+TEST_CASE("Front cell table holds every cell whose wire may be near a block", "") {
+  datatools::service_manager dummyServices{};
+  datatools::multi_properties config;
+  config.add_section("geometry", "geomtools::geometry_service")
+      .store_path("manager.configuration_file",
+                  "@falaise:snemo/demonstrator/geometry/GeometryManager.conf");
+  dummyServices.load(config);
+  dummyServices.initialize();
+  snemo::service_handle<snemo::geometry_svc> gs{dummyServices};
+  const geomtools::manager& gm = *(gs.operator->());
+
+  const snemo::geometry::locator_plugin* lp =
+      snemo::geometry::getSNemoLocator(gm, "locators_driver");
+  const snemo::geometry::gg_locator& ggl = lp->geigerLocator();
+  const snemo::geometry::calo_locator& cl = lp->caloLocator();
+
+  const double tolerance = 100 * CLHEP::mm;
+  snemo::geometry::front_cell_table table;
+  REQUIRE_FALSE(table.isInitialized());
+  table.initialize(gm, *lp, tolerance);
+  REQUIRE(table.isInitialized());
+  REQUIRE_THROWS(table.initialize(gm, *lp, tolerance));
+
+  // Cell numbers are a one to one map of the cells of the module
+  REQUIRE(table.numberOfCells() == 2 * 9 * 113);
+  std::vector<bool> numbered(table.numberOfCells(), false);
+  for (uint32_t side = 0; side < ggl.numberOfSides(); side++) {
+    for (uint32_t layer = 0; layer < ggl.numberOfLayers(side); layer++) {
+      for (uint32_t row = 0; row < ggl.numberOfRows(side); row++) {
+        geomtools::geom_id cellGID(ggl.getCellType(), ggl.getModuleNumber(), side, layer, row);
+        const size_t cell = table.getCellNumber(cellGID);
+        REQUIRE(cell < table.numberOfCells());
+        REQUIRE_FALSE(numbered[cell]);
+        numbered[cell] = true;
+      }
+    }
+  }
+
+  // Calorimeter hits are keyed with a wildcard part, as neighbour GIDs
+  const std::vector<geomtools::geom_id> blocks = cl.getNeighbourGIDs(1, 10, 6);
+  REQUIRE_FALSE(blocks.empty());
+  for (const geomtools::geom_id& blockGID : blocks) {
+    const snemo::geometry::front_cell_table::block_entry* block = table.findBlock(blockGID);
+    REQUIRE(block != nullptr);
+    REQUIRE_FALSE(block->parts.empty());
+    REQUIRE(block->cells.size() == table.numberOfCells());
+    REQUIRE(block->cells.any());
+
+    // No point of the wire of the other cells is inside the block tolerance volume
+    for (uint32_t side = 0; side < ggl.numberOfSides(); side++) {
+      for (uint32_t layer = 0; layer < ggl.numberOfLayers(side); layer++) {
+        for (uint32_t row = 0; row < ggl.numberOfRows(side); row++) {
+          geomtools::geom_id cellGID(ggl.getCellType(), ggl.getModuleNumber(), side, layer, row);
+          if (block->cells.test(table.getCellNumber(cellGID))) {
+            continue;
+          }
+          geomtools::vector_3d wire = ggl.getCellPosition(side, layer, row);
+          for (double z = -0.5 * ggl.anodeWireLength(); z <= 0.5 * ggl.anodeWireLength();
+               z += 50 * CLHEP::mm) {
+            wire.setZ(z);
+            for (const geomtools::geom_info* part : block->parts) {
+              REQUIRE_FALSE(geomtools::mapping::check_inside(*part, wire, tolerance, true));
+            }
+          }
+        }
+      }
+    }
+  }
+
+  table.reset();
+  REQUIRE_FALSE(table.isInitialized());
+}
@@ -29,10 +29,13 @@
 #include <string>
 
 // Third party:
+// - Boost:
+#include <boost/filesystem.hpp>
 // - Bayeux:
 #include <bayeux/bayeux.h>
 // - Bayeux/datatools:
 #include <datatools/clhep_units.h>
+#include <datatools/exception.h>
 #include <datatools/ioutils.h>
 #include <datatools/library_loader.h>
 #include <datatools/properties.h>
@@ -109,6 +112,8 @@ int main(int argc_, char** argv_) {
     mmf.setMapFilename(map_filename);
     mmf.setZeroFieldOutsideMap(true);
     mmf.setInvertedZ(z_inverted);
+    // Reference field, parsed from the CSV map:
+    mmf.setUseCache(false);
     if (trace) {
       mmf.set_logging_priority(datatools::logger::PRIO_TRACE);
     }
@@ -183,6 +188,43 @@ int main(int argc_, char** argv_) {
       std::clog << "|B| = " << B.mag() / b_unit << " mG" << std::endl;
     }
 
+    {
+      // The binary cache must reproduce the field parsed from the CSV map.
+      // Tests run from the build tree, where the cache is created from scratch:
+      boost::filesystem::path cache_path = boost::filesystem::current_path() /
+                                           "test_snemo_geometry_mapped_magnetic_field_cache";
+      boost::filesystem::remove_all(cache_path);
+      std::string cache_dir = cache_path.string();
+      geomtools::vector_3d position(-0.337 * CLHEP::m, 1.6231 * CLHEP::m, -1.3692 * CLHEP::m);
+      geomtools::vector_3d B_csv;
+      mmf.compute_magnetic_field(position, 0.0, B_csv);
+      for (int pass = 0; pass < 3; pass++) {
+        // First pass writes the cache, second pass reads it, third pass has
+        // another configuration and so another cache entry
+        const bool other_config = (pass == 2);
+        snemo::geometry::mapped_magnetic_field cmf;
+        cmf.setMapMode(snemo::geometry::mapped_magnetic_field::map_mode_t::IMPORT_CSV_MAP_0);
+        cmf.setMapFilename(map_filename);
+        cmf.setCacheDirectory(cache_dir);
+        cmf.setZeroFieldOutsideMap(true);
+        cmf.setInvertedZ(other_config ? !z_inverted : z_inverted);
+        cmf.initialize_simple();
+        DT_THROW_IF(cmf.isMapFromCache() != (pass == 1), std::logic_error,
+                    "Field map " << (pass != 1 ? "loaded from a stale" : "not loaded from the")
+                                 << " cache (pass " << pass << ")");
+        geomtools::vector_3d B_cache;
+        cmf.compute_magnetic_field(position, 0.0, B_cache);
+        if (other_config) {
+          B_cache.setZ(-B_cache.z());
+        }
+        DT_THROW_IF(B_cache != B_csv, std::logic_error,
+                    "Cached field map differs from CSV map (pass " << pass << ")");
+        cmf.reset();
+      }
+      boost::filesystem::remove_all(cache_path);
+      std::clog << "Field map cache is consistent" << std::endl;
+    }
+
     mmf.reset();
 
     if (draw) {
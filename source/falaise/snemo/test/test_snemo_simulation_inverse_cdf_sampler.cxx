@@ -0,0 +1,108 @@
+// test_snemo_simulation_inverse_cdf_sampler.cxx
+#include <falaise/snemo/simulation/inverse_cdf_sampler.h>
+#include "catch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <bayeux/mygsl/i_unary_function.h>
+#include <bayeux/mygsl/rng.h>
+#include <bayeux/mygsl/von_neumann_method.h>
+
+namespace {
+//! Zenith angle density of the sea level toy cosmic muons
+struct cos2_density : public mygsl::i_unary_function {
+ protected:
+  double _eval(double x_) const override { return std::cos(x_) * std::cos(x_); }
+};
+
+const double kMaxTheta = 70.0 * M_PI / 180.0;
+
+double cos2_cdf(double x) {
+  return (x + std::sin(x) * std::cos(x)) / (kMaxTheta + std::sin(kMaxTheta) * std::cos(kMaxTheta));
+}
+
+//! Largest distance between the empirical CDFs of two sorted samples
+double ks_distance(const std::vector<double>& a, const std::vector<double>& b) {
+  double d = 0.0;
+  std::size_t i = 0;
+  std::size_t j = 0;
+  while (i < a.size() && j < b.size()) {
+    if (a[i] <= b[j]) {
+      ++i;
+    } else {
+      ++j;
+    }
+    d = std::max(d, std::abs(double(i) / a.size() - double(j) / b.size()));
+  }
+  return d;
+}
+}  // namespace
+
+TEST_CASE("Inverse CDF sampler reproduces the analytic quantiles", "[falaise][simulation]") {
+  cos2_density density;
+  snemo::simulation::inverse_cdf_sampler sampler;
+  REQUIRE_FALSE(sampler.is_initialized());
+  sampler.initialize(density, 0.0, kMaxTheta);
+  REQUIRE(sampler.is_initialized());
+
+  REQUIRE(sampler.inverse(0.0) == Approx(0.0));
+  REQUIRE(sampler.inverse(1.0) == Approx(kMaxTheta));
+  for (int k = 1; k < 100; ++k) {
+    double u = k / 100.0;
+    double x = sampler.inverse(u);
+    REQUIRE(x >= 0.0);
+    REQUIRE(x <= kMaxTheta);
+    REQUIRE(cos2_cdf(x) == Approx(u).margin(1.0e-6));
+  }
+
+  sampler.reset();
+  REQUIRE_FALSE(sampler.is_initialized());
+  REQUIRE_THROWS(sampler.inverse(0.5));
+}
+
+TEST_CASE("Inverse CDF sampler rejects invalid densities", "[falaise][simulation]") {
+  cos2_density density;
+  snemo::simulation::inverse_cdf_sampler sampler;
+  REQUIRE_THROWS(sampler.initialize(density, 1.0, 1.0));
+  REQUIRE_THROWS(sampler.initialize(density, 0.0, 1.0, 0));
+  REQUIRE_FALSE(sampler.is_initialized());
+}
+
+TEST_CASE("Inverse CDF sampler matches the von Neumann method", "[falaise][simulation]") {
+  cos2_density density;
+  snemo::simulation::inverse_cdf_sampler sampler;
+  sampler.initialize(density, 0.0, kMaxTheta);
+  mygsl::von_neumann_method vnm(0.0, kMaxTheta, density, mygsl::von_neumann_method::AUTO_FMAX,
+                                100, 100);
+
+  mygsl::rng random("taus2", 314159);
+  const std::size_t n = 20000;
+  std::vector<double> tabulated(n);
+  std::vector<double> rejected(n);
+  sampler.shoot(random, tabulated);
+  for (double& x : rejected) {
+    x = vnm.shoot(random);
+  }
+  std::sort(tabulated.begin(), tabulated.end());
+  std::sort(rejected.begin(), rejected.end());
+
+  // Critical value of the two-sample test at the 0.1% level
+  const double critical = 1.95 * std::sqrt(2.0 / n);
+  REQUIRE(ks_distance(tabulated, rejected) < critical);
+}
+
+TEST_CASE("Inverse CDF sampler batch shoots match single shoots", "[falaise][simulation]") {
+  cos2_density density;
+  snemo::simulation::inverse_cdf_sampler sampler;
+  sampler.initialize(density, 0.0, kMaxTheta, 50);
+
+  mygsl::rng batchRandom("taus2", 271828);
+  mygsl::rng singleRandom("taus2", 271828);
+  std::vector<double> batch(64);
+  sampler.shoot(batchRandom, batch);
+  for (double x : batch) {
+    REQUIRE(x == sampler.shoot(singleRandom));
+  }
+}